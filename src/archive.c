@@ -0,0 +1,304 @@
+#include "raylib.h"
+#include "screens.h"
+
+#include "external/sinfl.h" // Required for: sinflate(), implemented by raylib (SUPPORT_COMPRESSION_API)
+
+#include <stdio.h> // Required for: fopen(), fread(), fclose()
+#include <stdlib.h> // Required for: qsort()
+#include <string.h> // Required for: strcmp(), strlen(), memcpy(), memchr()
+
+//----------------------------------------------------------------------------------
+// Defines
+//----------------------------------------------------------------------------------
+#define ARCHIVE_FILE_VERSION 1
+#define ARCHIVE_DATA_ALIGNMENT 16 // Entries data alignment, model cache (.rmdl) data is accessed in place
+#define ARCHIVE_MIN_COMPRESSION 0.9f // Entries are stored compressed only if size is reduced under this ratio
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+// Resource archive file header
+// NOTE: Entries table follows the header, sorted by name, then entry names and entries data
+typedef struct ArchiveHeader {
+    char id[4]; // Archive file identifier: "rPAK"
+    unsigned int version; // Archive file version
+    unsigned int fileSize; // Archive file size in bytes
+    unsigned int entryCount; // Number of entries
+} ArchiveHeader;
+
+// Resource archive entry
+typedef struct ArchiveEntry {
+    unsigned int nameOffset; // Entry name offset from file start, '\0' terminated
+    unsigned int dataOffset; // Entry data offset from file start
+    unsigned int dataSize; // Entry data size in bytes
+    unsigned int packedSize; // Entry data size stored, compressed (DEFLATE) if smaller than dataSize
+} ArchiveEntry;
+
+//----------------------------------------------------------------------------------
+// Module Variables Definition (local)
+//----------------------------------------------------------------------------------
+static unsigned char* archiveData = NULL; // Archive file data, entries are read in place
+static int archiveSize = 0;
+static ArchiveEntry* archiveEntries = NULL;
+static int archiveEntryCount = 0;
+
+//----------------------------------------------------------------------------------
+// Module Functions Declaration (local)
+//----------------------------------------------------------------------------------
+static const ArchiveEntry* FindArchiveEntry(const char* fileName); // Find archive entry by file name
+static unsigned char* LoadArchiveFileData(const char* fileName, int* dataSize); // LoadFileData() callback (any thread)
+static void UnloadArchiveFileData(unsigned char* data); // UnloadFileData() callback (any thread)
+static unsigned char* LoadDiskFileData(const char* fileName, int* dataSize); // Load file not packed from disk
+static int CompareArchiveNames(const void* a, const void* b); // Compare file names for archive sorting
+
+//----------------------------------------------------------------------------------
+// Resource Archive Functions Definition
+//----------------------------------------------------------------------------------
+
+// Open resource archive, files packed are loaded from it instead of disk
+// NOTE: Archive is mapped into memory, stored entries are provided without copies
+bool OpenResourceArchive(const char* fileName)
+{
+    if (archiveData != NULL)
+        CloseResourceArchive();
+
+    int dataSize = 0;
+    unsigned char* data = FileExists(fileName) ? LoadFileDataMapped(fileName, &dataSize) : NULL;
+
+    if (data == NULL)
+        return false;
+
+    ArchiveHeader* header = (ArchiveHeader*)data;
+    ArchiveEntry* entries = (ArchiveEntry*)(data + sizeof(ArchiveHeader));
+
+    bool valid = ((unsigned int)dataSize >= sizeof(ArchiveHeader)) && (memcmp(header->id, "rPAK", 4) == 0) &&
+                 (header->version == ARCHIVE_FILE_VERSION) && (header->fileSize == (unsigned int)dataSize) &&
+                 (sizeof(ArchiveHeader) + (size_t)header->entryCount * sizeof(ArchiveEntry) <= (size_t)dataSize);
+
+    for (unsigned int i = 0; valid && (i < header->entryCount); i++) {
+        valid = (entries[i].nameOffset < (unsigned int)dataSize) &&
+                (memchr(data + entries[i].nameOffset, '\0', dataSize - entries[i].nameOffset) != NULL) &&
+                (entries[i].packedSize <= entries[i].dataSize) &&
+                ((size_t)entries[i].dataOffset + entries[i].packedSize <= (size_t)dataSize);
+    }
+
+    if (!valid) {
+        TraceLog(LOG_WARNING, "ARCHIVE: [%s] Resource archive not valid", fileName);
+        UnloadFileDataMapped(data);
+        return false;
+    }
+
+    archiveData = data;
+    archiveSize = dataSize;
+    archiveEntries = entries;
+    archiveEntryCount = (int)header->entryCount;
+
+    SetLoadFileDataCallback(LoadArchiveFileData);
+    SetUnloadFileDataCallback(UnloadArchiveFileData);
+
+    TraceLog(LOG_INFO, "ARCHIVE: [%s] Resource archive opened (%i entries, %i bytes)", fileName, archiveEntryCount, archiveSize);
+
+    return true;
+}
+
+// Close resource archive, file data loaded from it must be unloaded before
+void CloseResourceArchive(void)
+{
+    if (archiveData == NULL)
+        return;
+
+    SetLoadFileDataCallback(NULL);
+    SetUnloadFileDataCallback(NULL);
+
+    UnloadFileDataMapped(archiveData);
+    archiveData = NULL;
+    archiveSize = 0;
+    archiveEntries = NULL;
+    archiveEntryCount = 0;
+}
+
+// Check if resource file exists, packed in archive or on disk
+bool ResourceExists(const char* fileName)
+{
+    return (FindArchiveEntry(fileName) != NULL) || FileExists(fileName);
+}
+
+// Export resource archive from files, entries are named as the file paths provided
+bool ExportResourceArchive(const char* fileName, const char** files, int fileCount)
+{
+    const char** names = (const char**)MemAlloc(fileCount * sizeof(const char*));
+    memcpy(names, files, fileCount * sizeof(const char*));
+    qsort(names, fileCount, sizeof(const char*), CompareArchiveNames);
+
+    // Header, entries table and names are written before entries data
+    unsigned int namesOffset = sizeof(ArchiveHeader) + fileCount * sizeof(ArchiveEntry);
+    unsigned int offset = namesOffset;
+
+    for (int i = 0; i < fileCount; i++)
+        offset += (unsigned int)strlen(names[i]) + 1;
+
+    unsigned char* data = (unsigned char*)MemAlloc(offset);
+    ArchiveHeader* header = (ArchiveHeader*)data;
+    memcpy(header->id, "rPAK", 4);
+    header->version = ARCHIVE_FILE_VERSION;
+    header->entryCount = fileCount;
+
+    bool success = true;
+    int packedCount = 0;
+    unsigned int nameOffset = namesOffset;
+
+    for (int i = 0; success && (i < fileCount); i++) {
+        int dataSize = 0;
+        unsigned char* fileData = LoadFileData(names[i], &dataSize);
+
+        if (fileData == NULL) {
+            TraceLog(LOG_WARNING, "ARCHIVE: [%s] File could not be packed", names[i]);
+            success = false;
+            break;
+        }
+
+        int compSize = 0;
+        unsigned char* compData = CompressData(fileData, dataSize, &compSize);
+        bool compressed = (compData != NULL) && (compSize > 0) && (compSize < (int)(dataSize * ARCHIVE_MIN_COMPRESSION));
+        unsigned char* packedData = compressed ? compData : fileData;
+        int packedSize = compressed ? compSize : dataSize;
+
+        unsigned int dataOffset = (offset + ARCHIVE_DATA_ALIGNMENT - 1) & ~(ARCHIVE_DATA_ALIGNMENT - 1);
+
+        data = (unsigned char*)MemRealloc(data, dataOffset + packedSize);
+        memset(data + offset, 0, dataOffset - offset); // Alignment padding
+        memcpy(data + dataOffset, packedData, packedSize);
+        offset = dataOffset + packedSize;
+        memcpy(data + nameOffset, names[i], strlen(names[i]) + 1);
+
+        ArchiveEntry* entry = (ArchiveEntry*)(data + sizeof(ArchiveHeader)) + i;
+        entry->nameOffset = nameOffset;
+        entry->dataOffset = dataOffset;
+        entry->dataSize = dataSize;
+        entry->packedSize = packedSize;
+        nameOffset += (unsigned int)strlen(names[i]) + 1;
+
+        if (compressed)
+            packedCount++;
+
+        MemFree(compData);
+        UnloadFileData(fileData);
+    }
+
+    if (success) {
+        header = (ArchiveHeader*)data;
+        header->fileSize = offset;
+        success = SaveFileData(fileName, data, offset);
+    }
+
+    if (success)
+        TraceLog(LOG_INFO, "ARCHIVE: [%s] Resource archive exported (%i entries, %i compressed, %u bytes)", fileName, fileCount, packedCount, offset);
+
+    MemFree(data);
+    MemFree(names);
+
+    return success;
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition (local)
+//----------------------------------------------------------------------------------
+
+// Find archive entry by file name
+static const ArchiveEntry* FindArchiveEntry(const char* fileName)
+{
+    if ((archiveData == NULL) || (fileName == NULL))
+        return NULL;
+
+    int first = 0;
+    int last = archiveEntryCount - 1;
+
+    while (first <= last) {
+        int middle = (first + last) / 2;
+        int result = strcmp(fileName, (const char*)archiveData + archiveEntries[middle].nameOffset);
+
+        if (result == 0)
+            return &archiveEntries[middle];
+        if (result < 0)
+            last = middle - 1;
+        else
+            first = middle + 1;
+    }
+
+    return NULL;
+}
+
+// LoadFileData() callback (any thread)
+// NOTE: Stored entries point into archive data, compressed entries are inflated into a new buffer
+static unsigned char* LoadArchiveFileData(const char* fileName, int* dataSize)
+{
+    const ArchiveEntry* entry = FindArchiveEntry(fileName);
+
+    if (entry == NULL)
+        return LoadDiskFileData(fileName, dataSize);
+
+    if (entry->packedSize == entry->dataSize) {
+        *dataSize = (int)entry->dataSize;
+        return archiveData + entry->dataOffset;
+    }
+
+    // NOTE: DecompressData() is not used, it allocates the maximum decompression size (64 MB) for every call
+    unsigned char* data = (unsigned char*)MemAlloc(entry->dataSize);
+
+    if ((data == NULL) || (sinflate(data, (int)entry->dataSize, archiveData + entry->dataOffset, (int)entry->packedSize) != (int)entry->dataSize)) {
+        TraceLog(LOG_WARNING, "ARCHIVE: [%s] Failed to decompress file data", fileName);
+        MemFree(data);
+        return NULL;
+    }
+
+    *dataSize = (int)entry->dataSize;
+
+    return data;
+}
+
+// UnloadFileData() callback (any thread)
+static void UnloadArchiveFileData(unsigned char* data)
+{
+    // Stored entries data is owned by the archive
+    if ((data >= archiveData) && (data < archiveData + archiveSize))
+        return;
+
+    MemFree(data);
+}
+
+// Load file not packed from disk
+static unsigned char* LoadDiskFileData(const char* fileName, int* dataSize)
+{
+    unsigned char* data = NULL;
+    FILE* file = fopen(fileName, "rb");
+
+    if (file == NULL) {
+        TraceLog(LOG_WARNING, "FILEIO: [%s] Failed to open file", fileName);
+        return NULL;
+    }
+
+    fseek(file, 0, SEEK_END);
+    long size = ftell(file);
+    fseek(file, 0, SEEK_SET);
+
+    if (size > 0)
+        data = (unsigned char*)MemAlloc((unsigned int)size);
+
+    if ((data != NULL) && (fread(data, 1, size, file) == (size_t)size))
+        *dataSize = (int)size;
+    else {
+        TraceLog(LOG_WARNING, "FILEIO: [%s] Failed to read file", fileName);
+        MemFree(data);
+        data = NULL;
+    }
+
+    fclose(file);
+
+    return data;
+}
+
+// Compare file names for archive sorting
+static int CompareArchiveNames(const void* a, const void* b)
+{
+    return strcmp(*(const char* const*)a, *(const char* const*)b);
+}
@@ -0,0 +1,335 @@
+#include "raylib.h"
+#include "screens.h"
+
+// Asset files are decoded on loader threads, except on web builds without pthreads
+#if !defined(PLATFORM_WEB) || defined(__EMSCRIPTEN_PTHREADS__)
+#define ASSETS_THREADS_ENABLED
+#include <pthread.h>
+#endif
+
+//----------------------------------------------------------------------------------
+// Defines
+//----------------------------------------------------------------------------------
+#define MAX_LOADER_THREADS 4
+#define FONT_FIRST_CHAR 32 // First character of image fonts (as LoadFont() does)
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+typedef enum {
+    ASSET_MODEL = 0,
+    ASSET_MUSIC,
+    ASSET_FONT
+} AssetType;
+
+typedef enum {
+    ASSET_QUEUED = 0,
+    ASSET_DECODING,
+    ASSET_DECODED, // File decoded into RAM, waiting for GPU upload
+    ASSET_LOADED
+} AssetState;
+
+typedef struct Asset {
+    AssetType type;
+    const char* name;
+    void* target; // Shared variable assigned when loaded (Model, Music or Font)
+    AssetState state;
+
+    // Decoded data
+    Model model;
+    Music music;
+    Image image;
+} Asset;
+
+//----------------------------------------------------------------------------------
+// Module Variables Definition (local)
+//----------------------------------------------------------------------------------
+static Asset assets[] = {
+    { .type = ASSET_MODEL, .name = "king", .target = &kingModel },
+    { .type = ASSET_MODEL, .name = "pawn", .target = &pieceModels[PIECE_PAWN] },
+    { .type = ASSET_MODEL, .name = "knight", .target = &pieceModels[PIECE_KNIGHT] },
+    { .type = ASSET_MODEL, .name = "bishop", .target = &pieceModels[PIECE_BISHOP] },
+    { .type = ASSET_MODEL, .name = "rook", .target = &pieceModels[PIECE_ROOK] },
+    { .type = ASSET_MODEL, .name = "queen", .target = &pieceModels[PIECE_QUEEN] },
+    { .type = ASSET_MUSIC, .name = "resources/audio/background.ogg", .target = &backgroundMusic },
+    { .type = ASSET_FONT, .name = "resources/images/mecha.png", .target = &font }
+};
+static const int assetCount = sizeof(assets) / sizeof(assets[0]);
+
+static int nextAsset = 0; // Next queued asset to be decoded
+static int loadedCount = 0;
+static double loadingStartTime = 0.0;
+
+#if defined(ASSETS_THREADS_ENABLED)
+static pthread_t loaderThreads[MAX_LOADER_THREADS];
+static int loaderThreadCount = 0;
+static pthread_mutex_t assetsLock = PTHREAD_MUTEX_INITIALIZER; // Protects assets state and nextAsset
+#endif
+
+//----------------------------------------------------------------------------------
+// Module Functions Declaration (local)
+//----------------------------------------------------------------------------------
+static void DecodeAsset(Asset* asset); // Load asset file data into RAM (any thread)
+static void UploadAsset(Asset* asset); // Upload asset decoded to GPU and assign it (main thread)
+static void UnloadAsset(Asset* asset); // Unload asset, decoded or loaded
+static bool DecodeNextAsset(void); // Decode next queued asset, returns false if none left
+#if defined(ASSETS_THREADS_ENABLED)
+static void* LoaderThread(void* arg); // Loader thread, decodes queued assets until none left
+static void JoinLoaderThreads(void); // Wait for loader threads to finish
+#endif
+
+//----------------------------------------------------------------------------------
+// Assets Loader Functions Definition
+//----------------------------------------------------------------------------------
+
+// Start loading game assets
+// NOTE: Files are decoded on loader threads, time to load is bounded by the slowest asset
+void StartLoadingAssets(void)
+{
+    nextAsset = 0;
+    loadedCount = 0;
+    loadingStartTime = GetTime();
+
+#if defined(ASSETS_THREADS_ENABLED)
+    int threadCount = (assetCount < MAX_LOADER_THREADS) ? assetCount : MAX_LOADER_THREADS;
+
+    for (int i = 0; i < threadCount; i++) {
+        if (pthread_create(&loaderThreads[loaderThreadCount], NULL, LoaderThread, NULL) == 0)
+            loaderThreadCount++;
+    }
+
+    TraceLog(LOG_INFO, "ASSETS: Loading %i assets on %i threads", assetCount, loaderThreadCount);
+#endif
+}
+
+// Upload assets decoded to GPU, must be called every frame until all assets are loaded
+// NOTE: Without loader threads, one asset is decoded per frame on main thread
+void UpdateLoadingAssets(void)
+{
+    if (loadedCount == assetCount)
+        return;
+
+#if defined(ASSETS_THREADS_ENABLED)
+    if (loaderThreadCount == 0)
+        DecodeNextAsset();
+#else
+    DecodeNextAsset();
+#endif
+
+    for (int i = 0; i < assetCount; i++) {
+#if defined(ASSETS_THREADS_ENABLED)
+        pthread_mutex_lock(&assetsLock);
+        AssetState state = assets[i].state;
+        pthread_mutex_unlock(&assetsLock);
+#else
+        AssetState state = assets[i].state;
+#endif
+        if (state == ASSET_DECODED) {
+            UploadAsset(&assets[i]);
+            assets[i].state = ASSET_LOADED;
+            loadedCount++;
+        }
+    }
+
+    if (loadedCount == assetCount) {
+#if defined(ASSETS_THREADS_ENABLED)
+        JoinLoaderThreads();
+#endif
+        TraceLog(LOG_INFO, "ASSETS: %i assets loaded in %.2f ms", assetCount, (GetTime() - loadingStartTime) * 1000.0);
+    }
+}
+
+// Check if all game assets are loaded
+bool IsAssetsLoaded(void)
+{
+    return (loadedCount == assetCount);
+}
+
+// Get number of game assets
+int GetAssetCount(void)
+{
+    return assetCount;
+}
+
+// Get asset loading progress: 0.0f queued, 0.5f decoded, 1.0f loaded
+float GetAssetProgress(int index)
+{
+    if ((index < 0) || (index >= assetCount))
+        return 0.0f;
+
+#if defined(ASSETS_THREADS_ENABLED)
+    pthread_mutex_lock(&assetsLock);
+    AssetState state = assets[index].state;
+    pthread_mutex_unlock(&assetsLock);
+#else
+    AssetState state = assets[index].state;
+#endif
+
+    if (state == ASSET_LOADED)
+        return 1.0f;
+    if (state == ASSET_DECODED)
+        return 0.5f;
+    return 0.0f;
+}
+
+// Get overall loading progress (0.0f to 1.0f)
+float GetAssetsProgress(void)
+{
+    float progress = 0.0f;
+
+    for (int i = 0; i < assetCount; i++)
+        progress += GetAssetProgress(i);
+
+    return progress / assetCount;
+}
+
+// Unload game assets, waits for loading in progress
+void UnloadAssets(void)
+{
+#if defined(ASSETS_THREADS_ENABLED)
+    // Stop decoding queued assets, then wait for the ones in progress
+    pthread_mutex_lock(&assetsLock);
+    nextAsset = assetCount;
+    pthread_mutex_unlock(&assetsLock);
+
+    JoinLoaderThreads();
+#endif
+
+    for (int i = 0; i < assetCount; i++) {
+        UnloadAsset(&assets[i]);
+        assets[i].state = ASSET_QUEUED;
+    }
+
+    loadedCount = 0;
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition (local)
+//----------------------------------------------------------------------------------
+
+// Load asset file data into RAM (any thread)
+static void DecodeAsset(Asset* asset)
+{
+    switch (asset->type) {
+    case ASSET_MODEL: {
+        // Model cache (.rmdl) preferred if available, generated with: make models
+        const char* cachePath = TextFormat("resources/models/%s.rmdl", asset->name);
+
+        if (ResourceExists(cachePath))
+            asset->model = LoadModelData(cachePath);
+        if (asset->model.meshCount == 0)
+            asset->model = LoadModelData(TextFormat("resources/models/%s.glb", asset->name));
+    } break;
+    case ASSET_MUSIC:
+        // NOTE: Audio stream creation is synchronized with the audio thread by raudio
+        asset->music = LoadMusicStream(asset->name);
+        break;
+    case ASSET_FONT:
+        asset->image = LoadImage(asset->name);
+        break;
+    default:
+        break;
+    }
+}
+
+// Upload asset decoded to GPU and assign it (main thread)
+static void UploadAsset(Asset* asset)
+{
+    switch (asset->type) {
+    case ASSET_MODEL:
+        UploadModel(&asset->model);
+        *(Model*)asset->target = asset->model;
+        break;
+    case ASSET_MUSIC:
+        *(Music*)asset->target = asset->music;
+        break;
+    case ASSET_FONT:
+        if (asset->image.data != NULL)
+            *(Font*)asset->target = LoadFontFromImage(asset->image, MAGENTA, FONT_FIRST_CHAR);
+        UnloadImage(asset->image);
+        asset->image = (Image) { 0 };
+        break;
+    default:
+        break;
+    }
+}
+
+// Unload asset, decoded or loaded
+static void UnloadAsset(Asset* asset)
+{
+    switch (asset->type) {
+    case ASSET_MODEL:
+        if (asset->model.meshes != NULL)
+            UnloadModel(asset->model);
+        asset->model = (Model) { 0 };
+        *(Model*)asset->target = asset->model;
+        break;
+    case ASSET_MUSIC:
+        if (asset->music.stream.buffer != NULL)
+            UnloadMusicStream(asset->music);
+        asset->music = (Music) { 0 };
+        *(Music*)asset->target = asset->music;
+        break;
+    case ASSET_FONT:
+        if (asset->state == ASSET_LOADED)
+            UnloadFont(*(Font*)asset->target);
+        UnloadImage(asset->image);
+        asset->image = (Image) { 0 };
+        *(Font*)asset->target = (Font) { 0 };
+        break;
+    default:
+        break;
+    }
+}
+
+// Decode next queued asset, returns false if none left
+static bool DecodeNextAsset(void)
+{
+#if defined(ASSETS_THREADS_ENABLED)
+    pthread_mutex_lock(&assetsLock);
+#endif
+    int index = nextAsset;
+    if (index < assetCount) {
+        nextAsset++;
+        assets[index].state = ASSET_DECODING;
+    }
+#if defined(ASSETS_THREADS_ENABLED)
+    pthread_mutex_unlock(&assetsLock);
+#endif
+
+    if (index >= assetCount)
+        return false;
+
+    DecodeAsset(&assets[index]);
+
+#if defined(ASSETS_THREADS_ENABLED)
+    pthread_mutex_lock(&assetsLock);
+    assets[index].state = ASSET_DECODED;
+    pthread_mutex_unlock(&assetsLock);
+#else
+    assets[index].state = ASSET_DECODED;
+#endif
+
+    return true;
+}
+
+#if defined(ASSETS_THREADS_ENABLED)
+// Loader thread, decodes queued assets until none left
+static void* LoaderThread(void* arg)
+{
+    (void)arg;
+
+    while (DecodeNextAsset()) { }
+
+    return NULL;
+}
+
+// Wait for loader threads to finish
+static void JoinLoaderThreads(void)
+{
+    for (int i = 0; i < loaderThreadCount; i++)
+        pthread_join(loaderThreads[i], NULL);
+
+    loaderThreadCount = 0;
+}
+#endif
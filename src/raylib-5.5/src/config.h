@@ -57,7 +57,9 @@
 // Use busy wait loop for timing sync, if not defined, a high-resolution timer is set up and used
 //#define SUPPORT_BUSY_WAIT_LOOP          1
 // Use a partial-busy wait loop, in this case frame sleeps for most of the time, but then runs a busy loop at the end for accuracy
-#define SUPPORT_PARTIALBUSY_WAIT_LOOP    1
+//#define SUPPORT_PARTIALBUSY_WAIT_LOOP    1
+// Pace frames and WaitTime() sleeping until absolute deadlines, wake-up latency is measured and only that slack is busy waited
+#define SUPPORT_PRECISE_FRAME_PACING    1
 // Allow automatic screen capture of current screen pressing F12, defined in KeyCallback()
 #define SUPPORT_SCREEN_CAPTURE          1
 // Allow automatic gif recording of current screen pressing CTRL+F12, defined in KeyCallback()
@@ -115,6 +117,9 @@
 
 #define MAX_AUTOMATION_EVENTS       16384       // Maximum number of automation events to record
 
+#define FRAME_PACING_MAX_SLACK      0.002       // Maximum sleep wake-up slack busy waited by frame pacing (seconds)
+#define LOW_LATENCY_INPUT_MARGIN    0.001       // Low latency input, frame work time estimate margin (seconds)
+
 //------------------------------------------------------------------------------------
 // Module: rlgl - Configuration values
 //------------------------------------------------------------------------------------
@@ -125,6 +130,10 @@
 // Show OpenGL extensions and capabilities detailed logs on init
 //#define RLGL_SHOW_GL_DETAILS_INFO              1
 
+// Track OpenGL state (shader, textures, VAO, render states, uniforms) to skip redundant calls
+// NOTE: Call rlResetStateCache() after raw OpenGL state changes done outside rlgl
+#define RLGL_ENABLE_STATE_CACHE                1
+
 #define RL_SUPPORT_MESH_GPU_SKINNING           1      // GPU skinning, comment if your GPU does not support more than 8 VBOs
 
 //#define RL_DEFAULT_BATCH_BUFFER_ELEMENTS    4096    // Default internal render batch elements limits
@@ -136,6 +145,9 @@
 
 #define RL_MAX_SHADER_LOCATIONS               32      // Maximum number of shader locations supported
 
+#define RL_MAX_CACHED_TEXTURE_UNITS           16      // Maximum number of texture units tracked by state cache
+#define RL_MAX_CACHED_UNIFORMS               512      // Maximum number of uniform values tracked by state cache (power of two)
+
 #define RL_CULL_DISTANCE_NEAR              0.001      // Default projection matrix near cull distance
 #define RL_CULL_DISTANCE_FAR             10000.0      // Default projection matrix far cull distance
 
@@ -251,13 +263,33 @@
 #define SUPPORT_FILEFORMAT_GLTF         1
 #define SUPPORT_FILEFORMAT_VOX          1
 #define SUPPORT_FILEFORMAT_M3D          1
+// Support GPU-ready model cache loading (.rmdl), generated with ExportModel()
+#define SUPPORT_FILEFORMAT_RMDL         1
 // Support procedural mesh generation functions, uses external par_shapes.h library
 // NOTE: Some generated meshes DO NOT include generated texture coordinates
 #define SUPPORT_MESH_GENERATION         1
+// Optimize imported model meshes triangles and vertices order for GPU vertex cache and overdraw
+// NOTE: Optimization is done on model loading, ACMR (average cache miss ratio) before and after is logged
+#define SUPPORT_MESH_OPTIMIZATION       1
+// Allow UploadMeshQuantized(): static meshes with a compact interleaved vertex layout, 16bit positions relative
+// to mesh bounds, 8bit normals/tangents and 16bit texcoords, positions decoded by matDequantization shader uniform
+// NOTE: Only meshes explicitly uploaded with UploadMeshQuantized() are quantized, UploadMesh() is not affected
+// WARNING: Shaders drawing quantized meshes must apply matDequantization to vertexPosition (default shader does),
+// quantized meshes vertex buffers can not be updated with UpdateMeshBuffer()
+//#define SUPPORT_MESH_QUANTIZATION       1
+#if defined(SUPPORT_MESH_QUANTIZATION)
+    #define RL_SUPPORT_MESH_QUANTIZATION  1   // Default shader decodes quantized mesh vertex positions
+#endif
+// Share textures and material maps with identical content between loaded models, identified by content hash
+// NOTE: Shared material maps are reference counted and freed by UnloadModel(), textures are still owned by the user
+// WARNING: Model textures and material maps could be shared, modifying or unloading them affects every model sharing them
+//#define SUPPORT_MODEL_RESOURCE_CACHE    1
 
 // rmodels: Configuration values
 //------------------------------------------------------------------------------------
 #define MAX_MATERIAL_MAPS              12       // Maximum number of shader maps supported
+#define MAX_SKINNED_POSES              32       // Maximum number of models tracked with their skinned baked pose (pose sharing)
+#define MESH_VERTEX_CACHE_SIZE         16       // Post-transform vertex cache size (FIFO) simulated to measure mesh ACMR
 
 #ifdef RL_SUPPORT_MESH_GPU_SKINNING
 #define MAX_MESH_VERTEX_BUFFERS         9       // Maximum vertex buffers (VBO) per mesh
@@ -277,6 +309,11 @@
 #define SUPPORT_FILEFORMAT_XM           1
 #define SUPPORT_FILEFORMAT_MOD          1
 
+// Decode music streams ahead of playback on a streaming thread, UpdateMusicStream() does not decode
+#define SUPPORT_MUSIC_STREAM_THREAD     1
+// Record audio callback timing, underruns and voices processing time, read with GetAudioStats()
+#define SUPPORT_AUDIO_STATS             1
+
 // raudio: Configuration values
 //------------------------------------------------------------------------------------
 #define AUDIO_DEVICE_FORMAT    ma_format_f32    // Device output format (miniaudio: float-32bit)
@@ -284,6 +321,19 @@
 #define AUDIO_DEVICE_SAMPLE_RATE           0    // Device sample rate (device default)
 
 #define MAX_AUDIO_BUFFER_POOL_CHANNELS    16    // Maximum number of audio pool channels
+#define MAX_AUDIO_VOICES                 256    // Maximum number of audio buffers playing at once (mixer voices)
+#define AUDIO_COMMAND_QUEUE_SIZE        1024    // Audio commands queued to audio thread, power of two (lock-free queue)
+#define AUDIO_OFFLINE_PERIOD_MS           10    // Offline mode period, frames mixed at once by UpdateAudioDeviceOffline() (milliseconds)
+#define MAX_SOUND_POOL_VOICES             32    // Maximum number of pooled sounds playing at once, least important voice stolen
+#define SOUND_POOL_COALESCE_MS            30    // Pooled sound played again within this time is merged into the voice playing it
+#define AUDIO_SPATIAL_CULL_VOLUME     0.001f    // Emitters attenuated below this volume are culled (not mixed)
+#define AUDIO_SPATIAL_VIEW_MARGIN       1.5f    // Listener view cone scale over camera fovy, emitters out of it are culled
+#define AUDIO_SPATIAL_SPEED_OF_SOUND  343.0f    // Speed of sound for doppler pitch (units per second)
+#define AUDIO_SPATIAL_BATCH_SIZE          64    // Emitters spatialized at once by UpdateAudioEmitters() (multiple of 4)
+#define MAX_MUSIC_STREAMS                 16    // Maximum number of music streams decoded by streaming thread
+#define MUSIC_STREAM_DECODE_AHEAD_MS     250    // Music decoded ahead of playback by streaming thread (milliseconds)
+#define MUSIC_STREAM_UPDATE_MS             5    // Streaming thread sleep time between music streams updates (milliseconds)
+#define AUDIO_STATS_LATE_PERIODS           2    // Audio callback started later than this number of periods is counted late
 
 //------------------------------------------------------------------------------------
 // Module: utils - Configuration Flags
@@ -294,9 +344,17 @@
 // NOTE: By default LOG_DEBUG traces not shown
 #define SUPPORT_TRACELOG                1
 //#define SUPPORT_TRACELOG_DEBUG          1
+// Worker threads pool to split heavy work (i.e. CPU skinning) across CPU cores
+// NOTE: Requires pthreads, work runs on calling thread if not available (i.e. web without -pthread)
+#define SUPPORT_WORKER_THREADS          1
+// Map files into memory with LoadFileDataMapped(), loaders read file pages directly instead of a copy
+// NOTE: Requires mmap(), file data is read instead if not available (i.e. web, Windows, Android assets)
+#define SUPPORT_FILE_MAPPING            1
 
 // utils: Configuration values
 //------------------------------------------------------------------------------------
 #define MAX_TRACELOG_MSG_LENGTH       256       // Max length of one trace-log message
+#define MAX_WORKER_THREADS              8       // Maximum number of worker threads (calling thread not included)
+#define MIN_FILE_MAPPING_SIZE       65536       // Minimum file size to be mapped, smaller files are read
 
 #endif // CONFIG_H
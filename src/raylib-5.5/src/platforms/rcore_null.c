@@ -0,0 +1,799 @@
+/**********************************************************************************************
+*
+*   rcore_null - Functions to manage window, graphics device and inputs without a display
+*
+*   PLATFORM: NULL
+*       - Linux/BSD (headless servers, CI machines, containers)
+*       - Any POSIX system with a C99 compiler
+*
+*   LIMITATIONS:
+*       - No window, no display output: all GL submission is stubbed, nothing is rasterized,
+*         unless built with GRAPHICS_API_SOFTWARE (rlsw software rasterizer)
+*       - GPU readbacks (rlReadScreenPixels(), rlReadTexturePixels()) return zeroed/undefined data,
+*         with GRAPHICS_API_SOFTWARE readbacks (and TakeScreenshot()) return the rendered pixels
+*       - Gamepads and touch are only available through scripted input (automation events)
+*       - Generic GL stub relies on caller-cleanup calling conventions (x86_64 SysV, AArch64),
+*         32bit Windows (__stdcall) is not supported
+*
+*   POSSIBLE IMPROVEMENTS:
+*       - Scripted input from a custom text format in addition to automation events
+*
+*   ADDITIONAL NOTES:
+*       - TRACELOG() function is located in raylib [utils] module
+*       - GL functions are provided by a custom glad loader: rlgl runs all its batching
+*         logic (vertex buffers fill, draw calls generation, state changes) but every
+*         GL call lands on a stub that only records some statistics
+*       - Time is virtual: every frame advances time by the target frame time
+*         (SetTargetFPS() or NULL_PLATFORM_FRAME_TIME), so the application logic behaves
+*         like a vsync'ed run while the loop runs as fast as the CPU allows
+*       - Scripted input is provided by an automation events list (LoadAutomationEventList()),
+*         events are played on the frame they were recorded at
+*
+*   CONFIGURATION:
+*       #define NULL_PLATFORM_FRAME_TIME
+*           Virtual frame time (seconds) used when no target FPS is set, default: 1/60
+*
+*       Environment variables (read on InitWindow()):
+*           RAYLIB_NULL_INPUT   Automation events file (.rae) to play as scripted input
+*           RAYLIB_NULL_FRAMES  Number of frames to run before WindowShouldClose() returns true
+*
+*   DEPENDENCIES:
+*       - gestures: Gestures system for touch-ready devices (or simulated from mouse inputs)
+*
+*
+*   LICENSE: zlib/libpng
+*
+*   Copyright (c) 2013-2025 Ramon Santamaria (@raysan5) and contributors
+*
+*   This software is provided "as-is", without any express or implied warranty. In no event
+*   will the authors be held liable for any damages arising from the use of this software.
+*
+*   Permission is granted to anyone to use this software for any purpose, including commercial
+*   applications, and to alter it and redistribute it freely, subject to the following restrictions:
+*
+*     1. The origin of this software must not be misrepresented; you must not claim that you
+*     wrote the original software. If you use this software in a product, an acknowledgment
+*     in the product documentation would be appreciated but is not required.
+*
+*     2. Altered source versions must be plainly marked as such, and must not be misrepresented
+*     as being the original software.
+*
+*     3. This notice may not be removed or altered from any source distribution.
+*
+**********************************************************************************************/
+
+#include <stdlib.h>                 // Required for: getenv(), atoi()
+#include <time.h>                   // Required for: clock_gettime()
+
+#if !defined(GRAPHICS_API_OPENGL_33)
+    #error "PLATFORM_NULL requires GRAPHICS_API_OPENGL_33 (GL stubs are loaded through glad)"
+#endif
+
+//----------------------------------------------------------------------------------
+// Defines and Macros
+//----------------------------------------------------------------------------------
+#ifndef NULL_PLATFORM_FRAME_TIME
+    #define NULL_PLATFORM_FRAME_TIME    (1.0/60.0)  // Virtual frame time when no target FPS is set
+#endif
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+typedef struct {
+    unsigned int nextObjectId;          // Next id returned by glGen*()/glCreate*()
+    int nextLocation;                   // Next location returned by glGet*Location()
+    unsigned long long int calls;       // Total GL calls
+    unsigned long long int drawCalls;   // Total GL draw calls
+    unsigned long long int vertices;    // Total vertices/indices submitted by draw calls
+    unsigned long long int bufferBytes; // Total bytes uploaded to GL buffers
+} NullGLStats;
+
+typedef struct {
+    double time;                        // Virtual time (seconds) since InitTimer()
+    double realTimeBase;                // Real time at InitPlatform(), used for benchmarking
+    unsigned int maxFrames;             // Frames to run before closing (0 = no limit)
+
+    AutomationEventList script;         // Scripted input events
+    unsigned int scriptEvent;           // Next event to play
+
+    NullGLStats gl;                     // GL stubs statistics
+} PlatformData;
+
+//----------------------------------------------------------------------------------
+// Global Variables Definition
+//----------------------------------------------------------------------------------
+extern CoreData CORE;                   // Global CORE state context
+
+static PlatformData platform = { 0 };   // Platform specific data
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Declaration
+//----------------------------------------------------------------------------------
+int InitPlatform(void);          // Initialize platform (graphics, inputs and more)
+void ClosePlatform(void);        // Close platform
+
+static double GetRealTime(void);                // Get real monotonic time in seconds
+static void *GetGLProcAddress(const char *name); // GL functions loader, returns GL stubs
+
+//----------------------------------------------------------------------------------
+// Module Functions Declaration
+//----------------------------------------------------------------------------------
+// NOTE: Functions declaration is provided by raylib.h
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition: Window and Graphics Device
+//----------------------------------------------------------------------------------
+
+// Check if application should close
+bool WindowShouldClose(void)
+{
+    if (CORE.Window.ready)
+    {
+        if ((platform.maxFrames > 0) && (CORE.Time.frameCounter >= platform.maxFrames)) CORE.Window.shouldClose = true;
+
+        return CORE.Window.shouldClose;
+    }
+    else return true;
+}
+
+// Toggle fullscreen mode
+void ToggleFullscreen(void)
+{
+    CORE.Window.fullscreen = !CORE.Window.fullscreen;
+    if (CORE.Window.fullscreen) CORE.Window.flags |= FLAG_FULLSCREEN_MODE;
+    else CORE.Window.flags &= ~FLAG_FULLSCREEN_MODE;
+}
+
+// Toggle borderless windowed mode
+void ToggleBorderlessWindowed(void)
+{
+    if (CORE.Window.flags & FLAG_BORDERLESS_WINDOWED_MODE) CORE.Window.flags &= ~FLAG_BORDERLESS_WINDOWED_MODE;
+    else CORE.Window.flags |= FLAG_BORDERLESS_WINDOWED_MODE;
+}
+
+// Set window state: maximized, if resizable
+void MaximizeWindow(void)
+{
+    CORE.Window.flags &= ~FLAG_WINDOW_MINIMIZED;
+    CORE.Window.flags |= FLAG_WINDOW_MAXIMIZED;
+}
+
+// Set window state: minimized
+void MinimizeWindow(void)
+{
+    CORE.Window.flags &= ~FLAG_WINDOW_MAXIMIZED;
+    CORE.Window.flags |= FLAG_WINDOW_MINIMIZED;
+}
+
+// Restore window from being minimized/maximized
+void RestoreWindow(void)
+{
+    CORE.Window.flags &= ~(FLAG_WINDOW_MINIMIZED | FLAG_WINDOW_MAXIMIZED);
+}
+
+// Set window configuration state using flags
+void SetWindowState(unsigned int flags)
+{
+    CORE.Window.flags |= flags;
+}
+
+// Clear window configuration state flags
+void ClearWindowState(unsigned int flags)
+{
+    CORE.Window.flags &= ~flags;
+}
+
+// Set icon for window
+void SetWindowIcon(Image image)
+{
+    TRACELOG(LOG_WARNING, "SetWindowIcon() not available on target platform");
+}
+
+// Set icon for window
+void SetWindowIcons(Image *images, int count)
+{
+    TRACELOG(LOG_WARNING, "SetWindowIcons() not available on target platform");
+}
+
+// Set title for window
+void SetWindowTitle(const char *title)
+{
+    CORE.Window.title = title;
+}
+
+// Set window position on screen (windowed mode)
+void SetWindowPosition(int x, int y)
+{
+    CORE.Window.position.x = x;
+    CORE.Window.position.y = y;
+}
+
+// Set monitor for the current window
+void SetWindowMonitor(int monitor)
+{
+    TRACELOG(LOG_WARNING, "SetWindowMonitor() not available on target platform");
+}
+
+// Set window minimum dimensions (FLAG_WINDOW_RESIZABLE)
+void SetWindowMinSize(int width, int height)
+{
+    CORE.Window.screenMin.width = width;
+    CORE.Window.screenMin.height = height;
+}
+
+// Set window maximum dimensions (FLAG_WINDOW_RESIZABLE)
+void SetWindowMaxSize(int width, int height)
+{
+    CORE.Window.screenMax.width = width;
+    CORE.Window.screenMax.height = height;
+}
+
+// Set window dimensions
+// NOTE: There is no real window, screen and render sizes are just updated
+void SetWindowSize(int width, int height)
+{
+    CORE.Window.screen.width = width;
+    CORE.Window.screen.height = height;
+    CORE.Window.display.width = width;
+    CORE.Window.display.height = height;
+
+#if defined(GRAPHICS_API_SOFTWARE)
+    swResize(width, height);
+#endif
+    SetupViewport(width, height);
+
+    CORE.Window.currentFbo.width = width;
+    CORE.Window.currentFbo.height = height;
+    CORE.Window.resizedLastFrame = true;
+}
+
+// Set window opacity, value opacity is between 0.0 and 1.0
+void SetWindowOpacity(float opacity)
+{
+    TRACELOG(LOG_WARNING, "SetWindowOpacity() not available on target platform");
+}
+
+// Set window focused
+void SetWindowFocused(void)
+{
+    CORE.Window.flags &= ~FLAG_WINDOW_UNFOCUSED;
+}
+
+// Get native window handle
+void *GetWindowHandle(void)
+{
+    return NULL;
+}
+
+// Get number of monitors
+int GetMonitorCount(void)
+{
+    return 1;
+}
+
+// Get current monitor where window is placed
+int GetCurrentMonitor(void)
+{
+    return 0;
+}
+
+// Get selected monitor position
+Vector2 GetMonitorPosition(int monitor)
+{
+    return (Vector2){ 0, 0 };
+}
+
+// Get selected monitor width (currently used by monitor)
+int GetMonitorWidth(int monitor)
+{
+    return CORE.Window.display.width;
+}
+
+// Get selected monitor height (currently used by monitor)
+int GetMonitorHeight(int monitor)
+{
+    return CORE.Window.display.height;
+}
+
+// Get selected monitor physical width in millimetres
+int GetMonitorPhysicalWidth(int monitor)
+{
+    return 0;
+}
+
+// Get selected monitor physical height in millimetres
+int GetMonitorPhysicalHeight(int monitor)
+{
+    return 0;
+}
+
+// Get selected monitor refresh rate
+int GetMonitorRefreshRate(int monitor)
+{
+    return (int)(1.0/NULL_PLATFORM_FRAME_TIME + 0.5);
+}
+
+// Get the human-readable, UTF-8 encoded name of the selected monitor
+const char *GetMonitorName(int monitor)
+{
+    return "NULL";
+}
+
+// Get window position XY on monitor
+Vector2 GetWindowPosition(void)
+{
+    return (Vector2){ (float)CORE.Window.position.x, (float)CORE.Window.position.y };
+}
+
+// Get window scale DPI factor for current monitor
+Vector2 GetWindowScaleDPI(void)
+{
+    return (Vector2){ 1.0f, 1.0f };
+}
+
+// Set clipboard text content
+void SetClipboardText(const char *text)
+{
+    TRACELOG(LOG_WARNING, "SetClipboardText() not available on target platform");
+}
+
+// Get clipboard text content
+const char *GetClipboardText(void)
+{
+    return NULL;
+}
+
+// Get clipboard image
+Image GetClipboardImage(void)
+{
+    Image image = { 0 };
+
+    TRACELOG(LOG_WARNING, "GetClipboardImage() not available on target platform");
+
+    return image;
+}
+
+// Show mouse cursor
+void ShowCursor(void)
+{
+    CORE.Input.Mouse.cursorHidden = false;
+}
+
+// Hides mouse cursor
+void HideCursor(void)
+{
+    CORE.Input.Mouse.cursorHidden = true;
+}
+
+// Enables cursor (unlock cursor)
+void EnableCursor(void)
+{
+    // Set cursor position in the middle
+    SetMousePosition(CORE.Window.screen.width/2, CORE.Window.screen.height/2);
+
+    CORE.Input.Mouse.cursorHidden = false;
+}
+
+// Disables cursor (lock cursor)
+void DisableCursor(void)
+{
+    // Set cursor position in the middle
+    SetMousePosition(CORE.Window.screen.width/2, CORE.Window.screen.height/2);
+
+    CORE.Input.Mouse.cursorHidden = true;
+}
+
+// Swap back buffer with front buffer (screen drawing)
+// NOTE: Nothing to present, virtual time advances one frame
+void SwapScreenBuffer(void)
+{
+#if defined(GRAPHICS_API_SOFTWARE)
+    swFinish();     // Rasterize frame queued triangles
+#endif
+    platform.time += (CORE.Time.target > 0.0)? CORE.Time.target : NULL_PLATFORM_FRAME_TIME;
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition: Misc
+//----------------------------------------------------------------------------------
+
+// Get elapsed time measure in seconds since InitTimer()
+// NOTE: Virtual time, only advanced by SwapScreenBuffer() and WaitTime()
+double GetTime(void)
+{
+    return platform.time;
+}
+
+// Open URL with default system browser (if available)
+void OpenURL(const char *url)
+{
+    TRACELOG(LOG_WARNING, "OpenURL() not available on target platform");
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition: Inputs
+//----------------------------------------------------------------------------------
+
+// Set internal gamepad mappings
+int SetGamepadMappings(const char *mappings)
+{
+    TRACELOG(LOG_WARNING, "SetGamepadMappings() not available on target platform");
+    return 0;
+}
+
+// Set gamepad vibration
+void SetGamepadVibration(int gamepad, float leftMotor, float rightMotor, float duration)
+{
+    TRACELOG(LOG_WARNING, "SetGamepadVibration() not available on target platform");
+}
+
+// Set mouse position XY
+void SetMousePosition(int x, int y)
+{
+    CORE.Input.Mouse.currentPosition = (Vector2){ (float)x, (float)y };
+    CORE.Input.Mouse.previousPosition = CORE.Input.Mouse.currentPosition;
+}
+
+// Set mouse cursor
+void SetMouseCursor(int cursor)
+{
+    CORE.Input.Mouse.cursor = cursor;
+}
+
+// Get physical key name.
+const char *GetKeyName(int key)
+{
+    return "";
+}
+
+// Register all input events
+// NOTE: Input comes from the scripted events list, events recorded for next frame are played
+void PollInputEvents(void)
+{
+#if defined(SUPPORT_GESTURES_SYSTEM)
+    // NOTE: Gestures update must be called every frame to reset gestures correctly
+    // because ProcessGestureEvent() is just called on an event, not every frame
+    UpdateGestures();
+#endif
+
+    // Reset keys/chars pressed registered
+    CORE.Input.Keyboard.keyPressedQueueCount = 0;
+    CORE.Input.Keyboard.charPressedQueueCount = 0;
+
+    // Reset last gamepad button/axis registered state
+    CORE.Input.Gamepad.lastButtonPressed = 0;       // GAMEPAD_BUTTON_UNKNOWN
+
+    // Register previous keys states
+    for (int i = 0; i < MAX_KEYBOARD_KEYS; i++)
+    {
+        CORE.Input.Keyboard.previousKeyState[i] = CORE.Input.Keyboard.currentKeyState[i];
+        CORE.Input.Keyboard.keyRepeatInFrame[i] = 0;
+    }
+
+    // Register previous mouse states
+    for (int i = 0; i < MAX_MOUSE_BUTTONS; i++) CORE.Input.Mouse.previousButtonState[i] = CORE.Input.Mouse.currentButtonState[i];
+
+    // Register previous mouse wheel state
+    CORE.Input.Mouse.previousWheelMove = CORE.Input.Mouse.currentWheelMove;
+    CORE.Input.Mouse.currentWheelMove = (Vector2){ 0.0f, 0.0f };
+
+    // Register previous mouse position
+    CORE.Input.Mouse.previousPosition = CORE.Input.Mouse.currentPosition;
+
+    // Register previous touch states
+    for (int i = 0; i < MAX_TOUCH_POINTS; i++) CORE.Input.Touch.previousTouchState[i] = CORE.Input.Touch.currentTouchState[i];
+
+    // Register previous gamepad states
+    for (int i = 0; i < MAX_GAMEPADS; i++)
+    {
+        for (int k = 0; k < MAX_GAMEPAD_BUTTONS; k++) CORE.Input.Gamepad.previousButtonState[i][k] = CORE.Input.Gamepad.currentButtonState[i][k];
+    }
+
+    // Play scripted events
+    // NOTE: Events are recorded with the frame that reads them, input polled at the
+    // end of current frame is read by next frame
+    while ((platform.scriptEvent < platform.script.count) &&
+           (platform.script.events[platform.scriptEvent].frame <= CORE.Time.frameCounter + 1))
+    {
+        PlayAutomationEvent(platform.script.events[platform.scriptEvent]);
+        platform.scriptEvent++;
+    }
+
+    // Map touch position to mouse position for convenience
+    CORE.Input.Touch.position[0] = CORE.Input.Mouse.currentPosition;
+}
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Definition: GL stubs
+//----------------------------------------------------------------------------------
+// NOTE: Stubs are provided to glad as if they were the driver entry points, only the
+// functions returning data are implemented, any other function maps to NullGLFunction()
+
+// Generic GL stub, returns 0/NULL
+static void *GLAD_API_PTR NullGLFunction(void)
+{
+    platform.gl.calls++;
+    return NULL;
+}
+
+static const GLubyte *GLAD_API_PTR NullGLGetString(GLenum name)
+{
+    platform.gl.calls++;
+
+    switch (name)
+    {
+        case GL_VENDOR: return (const GLubyte *)"raylib";
+        case GL_RENDERER: return (const GLubyte *)"NULL";
+        case GL_VERSION: return (const GLubyte *)"3.3.0 NULL";
+        case GL_SHADING_LANGUAGE_VERSION: return (const GLubyte *)"3.30 NULL";
+        default: return (const GLubyte *)"";
+    }
+}
+
+static const GLubyte *GLAD_API_PTR NullGLGetStringi(GLenum name, GLuint index)
+{
+    platform.gl.calls++;
+
+    // NOTE: glad requires at least one extension to consider the context valid
+    return (const GLubyte *)"GL_RAYLIB_null_platform";
+}
+
+static void GLAD_API_PTR NullGLGetIntegerv(GLenum pname, GLint *data)
+{
+    platform.gl.calls++;
+
+    switch (pname)
+    {
+        case GL_NUM_EXTENSIONS: data[0] = 1; break;
+        case GL_MAX_TEXTURE_SIZE:
+        case GL_MAX_CUBE_MAP_TEXTURE_SIZE: data[0] = 16384; break;
+        case GL_MAX_TEXTURE_IMAGE_UNITS: data[0] = 16; break;
+        case GL_MAX_VERTEX_ATTRIBS: data[0] = 16; break;
+        case GL_MAX_DRAW_BUFFERS: data[0] = 8; break;
+        case GL_VIEWPORT:
+        {
+            data[0] = 0;
+            data[1] = 0;
+            data[2] = CORE.Window.render.width;
+            data[3] = CORE.Window.render.height;
+        } break;
+        default: data[0] = 0; break;
+    }
+}
+
+static void GLAD_API_PTR NullGLGetFloatv(GLenum pname, GLfloat *data)
+{
+    platform.gl.calls++;
+
+    if (pname == GL_LINE_WIDTH) data[0] = 1.0f;
+    else data[0] = 0.0f;
+}
+
+static void GLAD_API_PTR NullGLGetObjectiv(GLuint id, GLenum pname, GLint *params)
+{
+    platform.gl.calls++;
+
+    // Shaders always compile and link successfully
+    if ((pname == GL_COMPILE_STATUS) || (pname == GL_LINK_STATUS)) params[0] = GL_TRUE;
+    else params[0] = 0;
+}
+
+static void GLAD_API_PTR NullGLGetFramebufferAttachmentParameteriv(GLenum target, GLenum attachment, GLenum pname, GLint *params)
+{
+    platform.gl.calls++;
+    params[0] = 0;
+}
+
+static void GLAD_API_PTR NullGLGenObjects(GLsizei n, GLuint *ids)
+{
+    platform.gl.calls++;
+    for (int i = 0; i < n; i++) ids[i] = ++platform.gl.nextObjectId;
+}
+
+static GLuint GLAD_API_PTR NullGLCreateShader(GLenum type)
+{
+    platform.gl.calls++;
+    return ++platform.gl.nextObjectId;
+}
+
+static GLuint GLAD_API_PTR NullGLCreateProgram(void)
+{
+    platform.gl.calls++;
+    return ++platform.gl.nextObjectId;
+}
+
+static GLint GLAD_API_PTR NullGLGetLocation(GLuint program, const GLchar *name)
+{
+    platform.gl.calls++;
+
+    // NOTE: Locations only need to be valid (>= 0), they are not checked against names
+    platform.gl.nextLocation = (platform.gl.nextLocation + 1)%256;
+    return platform.gl.nextLocation;
+}
+
+static GLenum GLAD_API_PTR NullGLCheckFramebufferStatus(GLenum target)
+{
+    platform.gl.calls++;
+    return GL_FRAMEBUFFER_COMPLETE;
+}
+
+static void GLAD_API_PTR NullGLReadPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, void *pixels)
+{
+    platform.gl.calls++;
+    if ((format == GL_RGBA) && (type == GL_UNSIGNED_BYTE)) memset(pixels, 0, (size_t)width*height*4);
+}
+
+static void GLAD_API_PTR NullGLDrawArrays(GLenum mode, GLint first, GLsizei count)
+{
+    platform.gl.calls++;
+    platform.gl.drawCalls++;
+    platform.gl.vertices += count;
+}
+
+static void GLAD_API_PTR NullGLDrawArraysInstanced(GLenum mode, GLint first, GLsizei count, GLsizei instancecount)
+{
+    platform.gl.calls++;
+    platform.gl.drawCalls++;
+    platform.gl.vertices += (unsigned long long int)count*instancecount;
+}
+
+static void GLAD_API_PTR NullGLDrawElements(GLenum mode, GLsizei count, GLenum type, const void *indices)
+{
+    platform.gl.calls++;
+    platform.gl.drawCalls++;
+    platform.gl.vertices += count;
+}
+
+static void GLAD_API_PTR NullGLDrawElementsInstanced(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount)
+{
+    platform.gl.calls++;
+    platform.gl.drawCalls++;
+    platform.gl.vertices += (unsigned long long int)count*instancecount;
+}
+
+static void GLAD_API_PTR NullGLBufferData(GLenum target, GLsizeiptr size, const void *data, GLenum usage)
+{
+    platform.gl.calls++;
+    if (data != NULL) platform.gl.bufferBytes += size;
+}
+
+static void GLAD_API_PTR NullGLBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, const void *data)
+{
+    platform.gl.calls++;
+    platform.gl.bufferBytes += size;
+}
+
+// GL functions loader
+static void *GetGLProcAddress(const char *name)
+{
+    static const struct { const char *name; void *proc; } stubs[] = {
+        { "glGetString", (void *)NullGLGetString },
+        { "glGetStringi", (void *)NullGLGetStringi },
+        { "glGetIntegerv", (void *)NullGLGetIntegerv },
+        { "glGetFloatv", (void *)NullGLGetFloatv },
+        { "glGetShaderiv", (void *)NullGLGetObjectiv },
+        { "glGetProgramiv", (void *)NullGLGetObjectiv },
+        { "glGetFramebufferAttachmentParameteriv", (void *)NullGLGetFramebufferAttachmentParameteriv },
+        { "glGenTextures", (void *)NullGLGenObjects },
+        { "glGenBuffers", (void *)NullGLGenObjects },
+        { "glGenVertexArrays", (void *)NullGLGenObjects },
+        { "glGenFramebuffers", (void *)NullGLGenObjects },
+        { "glGenRenderbuffers", (void *)NullGLGenObjects },
+        { "glCreateShader", (void *)NullGLCreateShader },
+        { "glCreateProgram", (void *)NullGLCreateProgram },
+        { "glGetUniformLocation", (void *)NullGLGetLocation },
+        { "glGetAttribLocation", (void *)NullGLGetLocation },
+        { "glCheckFramebufferStatus", (void *)NullGLCheckFramebufferStatus },
+        { "glReadPixels", (void *)NullGLReadPixels },
+        { "glDrawArrays", (void *)NullGLDrawArrays },
+        { "glDrawArraysInstanced", (void *)NullGLDrawArraysInstanced },
+        { "glDrawElements", (void *)NullGLDrawElements },
+        { "glDrawElementsInstanced", (void *)NullGLDrawElementsInstanced },
+        { "glBufferData", (void *)NullGLBufferData },
+        { "glBufferSubData", (void *)NullGLBufferSubData },
+    };
+
+    for (int i = 0; i < (int)(sizeof(stubs)/sizeof(stubs[0])); i++)
+    {
+        if (strcmp(name, stubs[i].name) == 0) return stubs[i].proc;
+    }
+
+    return (void *)NullGLFunction;
+}
+
+//----------------------------------------------------------------------------------
+// Module Internal Functions Definition
+//----------------------------------------------------------------------------------
+
+// Get real monotonic time in seconds
+static double GetRealTime(void)
+{
+    struct timespec ts = { 0 };
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (double)ts.tv_sec + (double)ts.tv_nsec*1e-9;
+}
+
+// Initialize platform: graphics, inputs and more
+int InitPlatform(void)
+{
+    // Initialize virtual display
+    //----------------------------------------------------------------------------
+    if (CORE.Window.screen.width == 0) CORE.Window.screen.width = 800;
+    if (CORE.Window.screen.height == 0) CORE.Window.screen.height = 450;
+
+    // NOTE: Virtual display matches requested screen size, no scaling required
+    CORE.Window.display.width = CORE.Window.screen.width;
+    CORE.Window.display.height = CORE.Window.screen.height;
+    SetupFramebuffer(CORE.Window.display.width, CORE.Window.display.height);
+    CORE.Window.currentFbo.width = CORE.Window.render.width;
+    CORE.Window.currentFbo.height = CORE.Window.render.height;
+
+    CORE.Window.ready = true;
+
+    TRACELOG(LOG_INFO, "DISPLAY: Device initialized successfully (NULL, no output)");
+    TRACELOG(LOG_INFO, "    > Display size: %i x %i", CORE.Window.display.width, CORE.Window.display.height);
+    TRACELOG(LOG_INFO, "    > Screen size:  %i x %i", CORE.Window.screen.width, CORE.Window.screen.height);
+    TRACELOG(LOG_INFO, "    > Render size:  %i x %i", CORE.Window.render.width, CORE.Window.render.height);
+    TRACELOG(LOG_INFO, "    > Viewport offsets: %i, %i", CORE.Window.renderOffset.x, CORE.Window.renderOffset.y);
+    //----------------------------------------------------------------------------
+
+    // Load OpenGL stubs
+    //----------------------------------------------------------------------------
+    rlLoadExtensions(GetGLProcAddress);
+    //----------------------------------------------------------------------------
+
+    // Initialize scripted input
+    //----------------------------------------------------------------------------
+    const char *inputFileName = getenv("RAYLIB_NULL_INPUT");
+    if ((inputFileName != NULL) && (inputFileName[0] != '\0'))
+    {
+        platform.script = LoadAutomationEventList(inputFileName);
+        TRACELOG(LOG_INFO, "PLATFORM: NULL: Scripted input loaded: %s (%i events)", inputFileName, platform.script.count);
+    }
+
+    const char *maxFrames = getenv("RAYLIB_NULL_FRAMES");
+    if (maxFrames != NULL) platform.maxFrames = (unsigned int)atoi(maxFrames);
+    //----------------------------------------------------------------------------
+
+    // Initialize timing system
+    //----------------------------------------------------------------------------
+    platform.time = 0.0;
+    platform.realTimeBase = GetRealTime();
+    InitTimer();
+    //----------------------------------------------------------------------------
+
+    // Initialize storage system
+    //----------------------------------------------------------------------------
+    CORE.Storage.basePath = GetWorkingDirectory();
+    //----------------------------------------------------------------------------
+
+    TRACELOG(LOG_INFO, "PLATFORM: NULL: Initialized successfully");
+
+    return 0;
+}
+
+// Close platform
+void ClosePlatform(void)
+{
+    double realTime = GetRealTime() - platform.realTimeBase;
+    unsigned int frames = (CORE.Time.frameCounter > 0)? CORE.Time.frameCounter : 1;
+
+    TRACELOG(LOG_INFO, "PLATFORM: NULL: %u frames, virtual time: %.3f s, real time: %.3f s (%.3f ms/frame)",
+        CORE.Time.frameCounter, platform.time, realTime, realTime*1000.0/frames);
+    TRACELOG(LOG_INFO, "    > GL calls/frame: %.1f | Draw calls/frame: %.1f | Vertices/frame: %.1f | Buffer KB/frame: %.2f",
+        (double)platform.gl.calls/frames, (double)platform.gl.drawCalls/frames,
+        (double)platform.gl.vertices/frames, (double)platform.gl.bufferBytes/1024.0/frames);
+#if defined(GRAPHICS_API_SOFTWARE)
+    swStats stats = swGetStats();
+    TRACELOG(LOG_INFO, "    > RLSW: Draw calls/frame: %.1f | Triangles/frame: %.1f (culled: %.1f) | Tile bins/frame: %.1f | Fragments/frame: %.0f (written: %.0f)",
+        (double)stats.drawCalls/frames, (double)stats.triangles/frames, (double)stats.trianglesCulled/frames,
+        (double)stats.trianglesBinned/frames, (double)stats.fragments/frames, (double)stats.fragmentsWritten/frames);
+#endif
+
+    UnloadAutomationEventList(platform.script);
+    platform.script = (AutomationEventList){ 0 };
+    platform.scriptEvent = 0;
+}
+
+// EOF
@@ -28,6 +28,22 @@
 *           Selected desired fileformats to be supported for loading. Some of those formats are
 *           supported by default, to remove support, just comment unrequired #define in this module
 *
+*       #define SUPPORT_MUSIC_STREAM_THREAD
+*           Music streams are decoded ahead of playback on a streaming thread (MUSIC_STREAM_DECODE_AHEAD_MS),
+*           UpdateMusicStream() only updates looping state. Without it (or without threads available)
+*           music is decoded by UpdateMusicStream() on calling thread
+*
+*       #define SUPPORT_AUDIO_STATS
+*           Audio callback duration (histogram over device period), callbacks late or longer than a period,
+*           music streams underruns and late refills and per voice processing time are recorded,
+*           read with GetAudioStats() and saved with ExportAudioStats()
+*
+*       #define RAUDIO_DISABLE_SIMD
+*           Disables SIMD implementation of mixing, format conversion and emitters spatialization kernels.
+*           By default SIMD is used when the target supports it: SSE2 (x86/x64 desktop, AVX targets
+*           included), NEON (ARM) or WebAssembly simd128 (web, compiled with -msimd128).
+*           Results are identical to the scalar version
+*
 *   DEPENDENCIES:
 *       miniaudio.h  - Audio device management lib (https://github.com/mackron/miniaudio)
 *       stb_vorbis.h - Ogg audio files loading (http://www.nothings.org/stb_vorbis/)
@@ -183,6 +199,7 @@ typedef struct tagBITMAPINFOHEADER {
 #include <stdlib.h>                     // Required for: malloc(), free()
 #include <stdio.h>                      // Required for: FILE, fopen(), fclose(), fread()
 #include <string.h>                     // Required for: strcmp() [Used in IsFileExtension(), LoadWaveFromMemory(), LoadMusicStreamFromMemory()]
+#include <math.h>                       // Required for: sqrtf(), cosf(), fabsf() [Used in SetAudioListener(), UpdateAudioEmitters()]
 
 #if defined(RAUDIO_STANDALONE)
     #ifndef TRACELOG
@@ -298,6 +315,109 @@ typedef struct tagBITMAPINFOHEADER {
 #ifndef MAX_AUDIO_BUFFER_POOL_CHANNELS
     #define MAX_AUDIO_BUFFER_POOL_CHANNELS    16    // Audio pool channels
 #endif
+#ifndef MAX_AUDIO_VOICES
+    #define MAX_AUDIO_VOICES                 256    // Maximum number of audio buffers playing at once (mixer voices)
+#endif
+#ifndef AUDIO_COMMAND_QUEUE_SIZE
+    #define AUDIO_COMMAND_QUEUE_SIZE        1024    // Audio commands queued to audio thread (power of two)
+#endif
+#ifndef MAX_SOUND_POOL_VOICES
+    #define MAX_SOUND_POOL_VOICES             32    // Maximum number of pooled sounds playing at once
+#endif
+#ifndef SOUND_POOL_COALESCE_MS
+    #define SOUND_POOL_COALESCE_MS            30    // Pooled sound played again within this time is merged (milliseconds)
+#endif
+#ifndef AUDIO_OFFLINE_PERIOD_MS
+    #define AUDIO_OFFLINE_PERIOD_MS           10    // Offline mode period, frames mixed at once by UpdateAudioDeviceOffline() (milliseconds)
+#endif
+#ifndef AUDIO_SPATIAL_CULL_VOLUME
+    #define AUDIO_SPATIAL_CULL_VOLUME     0.001f    // Emitters attenuated below this volume are culled (not mixed)
+#endif
+#ifndef AUDIO_SPATIAL_VIEW_MARGIN
+    #define AUDIO_SPATIAL_VIEW_MARGIN       1.5f    // Listener view cone scale over camera fovy, emitters out of it are culled
+#endif
+#ifndef AUDIO_SPATIAL_SPEED_OF_SOUND
+    #define AUDIO_SPATIAL_SPEED_OF_SOUND  343.0f    // Speed of sound for doppler pitch (units per second)
+#endif
+#ifndef AUDIO_SPATIAL_BATCH_SIZE
+    #define AUDIO_SPATIAL_BATCH_SIZE          64    // Emitters spatialized at once by UpdateAudioEmitters() (multiple of 4)
+#endif
+#ifndef MAX_MUSIC_STREAMS
+    #define MAX_MUSIC_STREAMS                 16    // Maximum number of music streams decoded by streaming thread
+#endif
+#ifndef MUSIC_STREAM_DECODE_AHEAD_MS
+    #define MUSIC_STREAM_DECODE_AHEAD_MS     250    // Music decoded ahead of playback by streaming thread (milliseconds)
+#endif
+#ifndef MUSIC_STREAM_UPDATE_MS
+    #define MUSIC_STREAM_UPDATE_MS             5    // Streaming thread sleep time between music streams updates (milliseconds)
+#endif
+#ifndef AUDIO_STATS_LATE_PERIODS
+    #define AUDIO_STATS_LATE_PERIODS           2    // Audio callback started later than this number of periods is counted late
+#endif
+
+#define AUDIO_STATS_HISTOGRAM_SIZE            12    // Audio callback duration histogram buckets, must match AudioStats.callbackHistogram
+
+// SIMD backend selection for mixing kernels (internal)
+#if !defined(RAUDIO_DISABLE_SIMD)
+    #if defined(__wasm_simd128__)
+        #include <wasm_simd128.h>
+        #define RAUDIO_SIMD_WASM
+    #elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+        #include <emmintrin.h>
+        #define RAUDIO_SIMD_SSE
+    #elif defined(__ARM_NEON) || defined(_M_ARM64)
+        #include <arm_neon.h>
+        #define RAUDIO_SIMD_NEON
+    #endif
+#endif
+
+// NOTE: 4-wide float vector operations, no fused multiply-add so results match the scalar version
+#if defined(RAUDIO_SIMD_SSE)
+    #define RAUDIO_SIMD
+    typedef __m128 raVec4;
+    #define RAVEC_LOAD(p)                   _mm_loadu_ps(p)
+    #define RAVEC_LOAD_S16(p)               _mm_cvtepi32_ps(_mm_srai_epi32(_mm_unpacklo_epi16(_mm_setzero_si128(), _mm_loadl_epi64((const __m128i *)(p))), 16))
+    #define RAVEC_STORE(p, v)               _mm_storeu_ps(p, v)
+    #define RAVEC_SET1(s)                   _mm_set1_ps(s)
+    #define RAVEC_ADD(a, b)                 _mm_add_ps(a, b)
+    #define RAVEC_MUL(a, b)                 _mm_mul_ps(a, b)
+    #define RAVEC_SUB(a, b)                 _mm_sub_ps(a, b)
+    #define RAVEC_DIV(a, b)                 _mm_div_ps(a, b)
+    #define RAVEC_SQRT(a)                   _mm_sqrt_ps(a)
+    #define RAVEC_MIN(a, b)                 _mm_min_ps(a, b)
+    #define RAVEC_MAX(a, b)                 _mm_max_ps(a, b)
+#elif defined(RAUDIO_SIMD_NEON)
+    #define RAUDIO_SIMD
+    typedef float32x4_t raVec4;
+    #define RAVEC_LOAD(p)                   vld1q_f32(p)
+    #define RAVEC_LOAD_S16(p)               vcvtq_f32_s32(vmovl_s16(vld1_s16(p)))
+    #define RAVEC_STORE(p, v)               vst1q_f32(p, v)
+    #define RAVEC_SET1(s)                   vdupq_n_f32(s)
+    #define RAVEC_ADD(a, b)                 vaddq_f32(a, b)
+    #define RAVEC_MUL(a, b)                 vmulq_f32(a, b)
+    #define RAVEC_SUB(a, b)                 vsubq_f32(a, b)
+    #define RAVEC_MIN(a, b)                 vminq_f32(a, b)
+    #define RAVEC_MAX(a, b)                 vmaxq_f32(a, b)
+    #if defined(__aarch64__) || defined(_M_ARM64)
+        // NOTE: Division and square root not available on ARMv7 NEON, spatialization kernel is scalar there
+        #define RAVEC_DIV(a, b)             vdivq_f32(a, b)
+        #define RAVEC_SQRT(a)               vsqrtq_f32(a)
+    #endif
+#elif defined(RAUDIO_SIMD_WASM)
+    #define RAUDIO_SIMD
+    typedef v128_t raVec4;
+    #define RAVEC_LOAD(p)                   wasm_v128_load(p)
+    #define RAVEC_LOAD_S16(p)               wasm_f32x4_convert_i32x4(wasm_i32x4_load16x4(p))
+    #define RAVEC_STORE(p, v)               wasm_v128_store(p, v)
+    #define RAVEC_SET1(s)                   wasm_f32x4_splat(s)
+    #define RAVEC_ADD(a, b)                 wasm_f32x4_add(a, b)
+    #define RAVEC_MUL(a, b)                 wasm_f32x4_mul(a, b)
+    #define RAVEC_SUB(a, b)                 wasm_f32x4_sub(a, b)
+    #define RAVEC_DIV(a, b)                 wasm_f32x4_div(a, b)
+    #define RAVEC_SQRT(a)                   wasm_f32x4_sqrt(a)
+    #define RAVEC_MIN(a, b)                 wasm_f32x4_pmin(a, b)
+    #define RAVEC_MAX(a, b)                 wasm_f32x4_pmax(a, b)
+#endif
 
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
@@ -338,6 +458,29 @@ typedef enum {
     AUDIO_BUFFER_USAGE_STREAM
 } AudioBufferUsage;
 
+// Audio spatialization, emitter parameters relative to listener
+typedef struct AudioSpatial {
+    float volume;                   // Emitter volume attenuated by distance
+    float pan;                      // Emitter pan from listener direction
+    float pitch;                    // Emitter pitch, doppler shifted
+    bool culled;                    // Emitter inaudible or out of listener view, not mixed
+} AudioSpatial;
+
+// Audio emitters spatialized at once, structure of arrays (SIMD)
+typedef struct AudioSpatialBatch {
+    float x[AUDIO_SPATIAL_BATCH_SIZE];          // Emitters position x
+    float y[AUDIO_SPATIAL_BATCH_SIZE];          // Emitters position y
+    float z[AUDIO_SPATIAL_BATCH_SIZE];          // Emitters position z
+    float vx[AUDIO_SPATIAL_BATCH_SIZE];         // Emitters velocity x
+    float vy[AUDIO_SPATIAL_BATCH_SIZE];         // Emitters velocity y
+    float vz[AUDIO_SPATIAL_BATCH_SIZE];         // Emitters velocity z
+    float volume[AUDIO_SPATIAL_BATCH_SIZE];     // Emitters volume, attenuated on output
+    float pitch[AUDIO_SPATIAL_BATCH_SIZE];      // Emitters pitch, doppler shifted on output
+    float pan[AUDIO_SPATIAL_BATCH_SIZE];        // Emitters pan (output)
+    float distance[AUDIO_SPATIAL_BATCH_SIZE];   // Emitters distance to listener (output)
+    float facing[AUDIO_SPATIAL_BATCH_SIZE];     // Emitters direction cosine to listener forward (output)
+} AudioSpatialBatch;
+
 // Audio buffer struct
 struct rAudioBuffer {
     ma_data_converter converter;    // Audio data converter
@@ -349,20 +492,31 @@ struct rAudioBuffer {
     float pitch;                    // Audio buffer pitch
     float pan;                      // Audio buffer pan (0.0f to 1.0f)
 
-    bool playing;                   // Audio buffer state: AUDIO_PLAYING
-    bool paused;                    // Audio buffer state: AUDIO_PAUSED
+    bool playing;                   // Audio buffer state: AUDIO_PLAYING (audio thread)
+    bool paused;                    // Audio buffer state: AUDIO_PAUSED (audio thread)
     bool looping;                   // Audio buffer looping, default to true for AudioStreams
     int usage;                      // Audio buffer usage mode: STATIC or STREAM
 
-    bool isSubBufferProcessed[2];   // SubBuffer processed (virtual double buffer)
+    ma_uint32 isSubBufferProcessed[2];  // SubBuffer processed (virtual double buffer), atomic
     unsigned int sizeInFrames;      // Total buffer size in frames
-    unsigned int frameCursorPos;    // Frame cursor position
-    unsigned int framesProcessed;   // Total frames processed in this buffer (required for play timing)
+    unsigned int frameCursorPos;    // Frame cursor position (audio thread)
+    ma_uint32 framesProcessed;      // Total frames processed in this buffer (required for play timing), atomic
 
     unsigned char *data;            // Data buffer, on music stream keeps filling
-
-    rAudioBuffer *next;             // Next audio buffer on the list
-    rAudioBuffer *prev;             // Previous audio buffer on the list
+    unsigned char *fileData;        // Music file data loaded by LoadFileDataMapped(), streamed from memory
+    ma_pcm_rb *streamRing;          // Music frames decoded ahead by streaming thread, NULL if refilled by UpdateMusicStream()
+    ma_uint32 streamEnded;          // Music decoded up to the end (not looping), stopped once ring is played, atomic
+    ma_uint32 streamLooping;        // Music looping state decoded by streaming thread, set by UpdateMusicStream(), atomic
+    bool sharedData;                // Data buffer owned by another audio buffer (sound alias)
+
+    ma_uint32 pendingCommands;      // Commands queued not yet applied by audio thread, atomic
+    bool playRequested;             // Playing state requested, reported while commands are pending
+    bool pauseRequested;            // Paused state requested, reported while commands are pending
+    int voiceIndex;                 // Mixer voice playing the buffer, -1 if not playing (audio thread)
+    bool culled;                    // Voice culled by spatialization, playback advanced without mixing (audio thread)
+    AudioSpatial spatial;           // Last spatialization queued, emitter changes only are queued (AUDIO.System.lock locked)
+    bool streamPrimed;              // Stream data read since played, silence read after counts as underrun (audio thread)
+    ma_uint32 streamStarved;        // Stream ran out of data, next refill counted late, atomic
 };
 
 // Audio processor struct
@@ -375,22 +529,123 @@ struct rAudioProcessor {
 
 #define AudioBuffer rAudioBuffer    // HACK: To avoid CoreAudio (macOS) symbol collision
 
+// Audio command type
+// NOTE: Mixer state is only modified by the audio thread, program threads queue commands
+typedef enum {
+    AUDIO_COMMAND_PLAY = 0,         // Play buffer from start
+    AUDIO_COMMAND_STOP,             // Stop buffer
+    AUDIO_COMMAND_PAUSE,            // Pause buffer
+    AUDIO_COMMAND_RESUME,           // Resume buffer
+    AUDIO_COMMAND_VOLUME,           // Set buffer volume: value
+    AUDIO_COMMAND_PITCH,            // Set buffer pitch: value
+    AUDIO_COMMAND_PAN,              // Set buffer pan: value
+    AUDIO_COMMAND_SEEK,             // Discard stream data queued, frames processed set: frames
+    AUDIO_COMMAND_CALLBACK,         // Set buffer callback: callback
+    AUDIO_COMMAND_ATTACH_PROCESSOR, // Attach processor to buffer (mixed output if no buffer): processor
+    AUDIO_COMMAND_DETACH_PROCESSOR, // Detach processors from buffer (mixed output if no buffer): callback
+    AUDIO_COMMAND_SET_DATA,         // Stop buffer and play shared sample data: data, frames
+    AUDIO_COMMAND_SPATIAL,          // Set buffer volume, pan, pitch and culling from emitter: spatial
+    AUDIO_COMMAND_RELEASE           // Buffer unloaded, freed once removed from mixer
+} AudioCommandType;
+
+// Audio command
+typedef struct AudioCommand {
+    int type;                       // Command type: AudioCommandType
+    AudioBuffer *buffer;            // Audio buffer
+    rAudioProcessor *processor;     // Audio processor
+    AudioCallback callback;         // Audio callback
+    float value;                    // Command value
+    unsigned int frames;            // Command frames
+    unsigned char *data;            // Command sample data
+    AudioSpatial spatial;           // Command spatialization
+} AudioCommand;
+
+// Audio commands queue, lock-free single producer and single consumer
+typedef struct AudioCommandQueue {
+    AudioCommand items[AUDIO_COMMAND_QUEUE_SIZE];   // Commands ring buffer
+    ma_uint32 head;                 // Next command to read, written by consumer
+    ma_uint32 tail;                 // Next command to write, written by producer
+} AudioCommandQueue;
+
+// Sound pool voice, plays sample data shared with a loaded sound
+typedef struct SoundPoolVoice {
+    AudioBuffer *buffer;            // Audio buffer playing the sound, created with the device
+    unsigned char *data;            // Sound sample data bound to the voice, NULL if free
+    int priority;                   // Play request priority, higher priority voices are stolen last
+    float audibility;               // Play request audibility: volume attenuated by distance
+    ma_uint32 startFrame;           // Mixer frame the voice was played at (coalescing and stealing)
+    bool positional;                // Voice played from an emitter, spatialized by UpdateAudioEmitters()
+    Vector3 position;               // Emitter position at play time
+    Vector3 velocity;               // Emitter velocity at play time (doppler)
+    float volume;                   // Emitter volume at play time
+    float pitch;                    // Emitter pitch at play time
+} SoundPoolVoice;
+
 // Audio data context
 typedef struct AudioData {
     struct {
         ma_context context;         // miniaudio context data
         ma_device device;           // miniaudio device
-        ma_mutex lock;              // miniaudio mutex lock
+        ma_mutex lock;              // miniaudio mutex lock, program threads only (never locked by audio thread)
         bool isReady;               // Check if audio device is ready
         size_t pcmBufferSize;       // Pre-allocated buffer size
         void *pcmBuffer;            // Pre-allocated buffer to read audio data from file/memory
     } System;
     struct {
-        AudioBuffer *first;         // Pointer to first AudioBuffer in the list
-        AudioBuffer *last;          // Pointer to last AudioBuffer in the list
+        AudioCommandQueue commands; // Commands queued by program threads, applied by audio thread
+        AudioCommandQueue released; // Buffers and processors released by audio thread, freed by program threads
+        AudioBuffer *voices[MAX_AUDIO_VOICES];  // Audio buffers playing (audio thread)
+        int voiceCount;             // Audio buffers playing count
+        ma_uint32 framesMixed;      // Frames mixed since device started, atomic
+    } Mixer;
+    struct {
+        float position[3];          // Listener position
+        float forward[3];           // Listener forward direction (normalized)
+        float right[3];             // Listener right direction (normalized)
+        float viewCos;              // Listener view cone half angle cosine, -1.0f if emitters are not culled by view
+        float refDistance;          // Emitters distance with no attenuation
+        float maxDistance;          // Emitters distance attenuation stops at (volume clamped)
+        float rolloff;              // Emitters attenuation rolloff factor
+        float dopplerFactor;        // Emitters doppler pitch factor, 0.0f if disabled
+    } Spatial;                      // Audio listener and emitters parameters (AUDIO.System.lock locked)
+    struct {
+        bool active;                // Offline mode, no playback device, mixing driven by UpdateAudioDeviceOffline()
+        float *buffer;              // Frames mixed for one period
+        void *wav;                  // Mixed output WAV file writer (drwav), NULL if output is discarded
+    } Offline;
+#if defined(SUPPORT_AUDIO_STATS)
+    struct {
+        ma_timer timer;             // Stats clock, started with the device
+        double lastCallback;        // Previous callback start time in seconds (audio thread)
+        ma_uint32 callbackCount;    // Callbacks recorded, atomic
+        ma_uint64 callbackTime;     // Callbacks total duration in nanoseconds, atomic
+        ma_uint32 callbackTimeMax;  // Callback maximum duration in nanoseconds, atomic
+        ma_uint32 intervalMax;      // Maximum time between callbacks start in nanoseconds, atomic
+        ma_uint32 histogram[AUDIO_STATS_HISTOGRAM_SIZE];    // Callbacks by duration over period, atomic
+        ma_uint32 overruns;         // Callbacks longer than period, atomic
+        ma_uint32 lateCallbacks;    // Callbacks started late, atomic
+        ma_uint32 streamUnderruns;  // Stream reads with no data queued, atomic
+        ma_uint32 lateRefills;      // Stream refills after an underrun, atomic
+        ma_uint32 voiceCount;       // Voices processed, atomic
+        ma_uint64 voiceTime;        // Voices total processing time in nanoseconds, atomic
+        ma_uint32 voiceTimeMax;     // Voice maximum processing time in nanoseconds, atomic
+    } Stats;                        // Audio callback timing, written by audio thread, read and reset by program threads
+#endif
+    struct {
+        SoundPoolVoice voices[MAX_SOUND_POOL_VOICES];   // Pooled sounds voices (AUDIO.System.lock locked)
+        int voiceCount;             // Pooled sounds voices created
+    } Pool;
+    struct {
         int defaultSize;            // Default audio buffer size for audio streams
     } Buffer;
-    rAudioProcessor *mixedProcessor;
+    struct {
+        ma_thread thread;           // Music streaming thread, decodes music streams ahead of playback
+        ma_mutex lock;              // Music streams lock, program and streaming threads (never locked by audio thread)
+        ma_uint32 running;          // Streaming thread running, atomic
+        Music music[MAX_MUSIC_STREAMS]; // Music streams decoded by streaming thread
+        int musicCount;             // Music streams count
+    } Stream;
+    rAudioProcessor *mixedProcessor;    // Mixed output processors (audio thread)
 } AudioData;
 
 //----------------------------------------------------------------------------------
@@ -403,6 +658,13 @@ static AudioData AUDIO = {          // Global AUDIO context
     // standard double-buffering system, a 4096 samples buffer has been chosen, it should be enough
     // In case of music-stalls, just increase this number
     .Buffer.defaultSize = 0,
+    .Spatial.forward = { 0.0f, 0.0f, -1.0f },
+    .Spatial.right = { 1.0f, 0.0f, 0.0f },
+    .Spatial.viewCos = -1.0f,
+    .Spatial.refDistance = 1.0f,
+    .Spatial.maxDistance = 100.0f,
+    .Spatial.rolloff = 1.0f,
+    .Spatial.dopplerFactor = 0.0f,
     .mixedProcessor = NULL
 };
 
@@ -417,10 +679,56 @@ static ma_uint32 ReadAudioBufferFramesInMixingFormat(AudioBuffer *audioBuffer, f
 
 static void OnSendAudioDataToDevice(ma_device *pDevice, void *pFramesOut, const void *pFramesInput, ma_uint32 frameCount);
 static void MixAudioFrames(float *framesOut, const float *framesIn, ma_uint32 frameCount, AudioBuffer *buffer);
+static void MixAudioSamples(float *samplesOut, const float *samplesIn, ma_uint32 sampleCount, const float levels[2]);   // Accumulate samples with per channel level (SIMD)
+static void ConvertAudioSamplesS16ToF32(float *samplesOut, const short *samplesIn, ma_uint32 sampleCount);          // Convert samples from 16 bit to float (SIMD)
+static void SpatializeAudioBatch(AudioSpatialBatch *batch, int count);             // Compute emitters attenuation, pan and doppler pitch (SIMD)
+static bool IsAudioSpatialChanged(const AudioSpatial *spatial, const AudioSpatial *other);  // Check if spatialization changed audibly
+static AudioSpatial GetAudioSpatial(const AudioSpatialBatch *batch, int index);    // Get emitter spatialization computed in batch, culling included
 
-static bool IsAudioBufferPlayingInLockedState(AudioBuffer *buffer);
-static void StopAudioBufferInLockedState(AudioBuffer *buffer);
 static void UpdateAudioStreamInLockedState(AudioStream stream, const void *data, int frameCount);
+static void AddAudioBufferFramesProcessed(AudioBuffer *buffer, ma_uint32 frameCount, ma_uint32 wrap);  // Add frames processed, wrapped to music length, atomic
+
+// Music streaming, music decoded ahead by streaming thread
+#if defined(SUPPORT_MUSIC_STREAM_THREAD)
+static ma_thread_result MA_THREADCALL MusicStreamThread(void *data);   // Music streaming thread main loop
+#endif
+static bool UpdateMusicStreamRing(int index);               // Decode music frames ahead into stream ring, false if ring is full (streaming thread)
+static void ReadMusicFrames(Music music, void *framesOut, unsigned int frameCount); // Decode music frames, rewinding at the end
+static void RewindMusicFrames(Music music);                 // Rewind music decoder to first frame
+static void TrackMusicStream(Music *music);                 // Add music stream to streaming thread, stream ring allocated
+static void UntrackMusicStream(Music music);                // Remove music stream from streaming thread
+static ma_uint32 ReadMusicStreamRing(AudioBuffer *buffer, void *framesOut, ma_uint32 frameCount); // Read frames decoded ahead (audio thread)
+static void DiscardMusicStreamRing(AudioBuffer *buffer);    // Discard frames decoded ahead, stream restarted (audio thread)
+
+// Audio stats, callback timing and underruns
+#if defined(SUPPORT_AUDIO_STATS)
+static double GetAudioStatsTime(void);                      // Get stats clock time in seconds
+static void UpdateAudioStatsMax(ma_uint32 *max, ma_uint32 value);   // Update stats maximum value, atomic
+static void RecordAudioCallback(double start, double end, ma_uint32 frameCount);   // Record callback duration and interval (audio thread)
+static void RecordAudioVoice(double start, double end);     // Record voice processing time (audio thread)
+#endif
+static void RecordStreamUnderrun(AudioBuffer *buffer);      // Record stream read with no data queued (audio thread)
+static void RecordStreamRefill(AudioBuffer *buffer);        // Record stream refill, late if stream ran out of data
+
+// Audio commands, mixer state is owned by audio thread
+static bool PushAudioQueue(AudioCommandQueue *queue, const AudioCommand *command);   // Push command to queue, false if full
+static bool PopAudioQueue(AudioCommandQueue *queue, AudioCommand *command);         // Pop command from queue, false if empty
+static void PushAudioCommand(AudioCommand command);         // Queue command to audio thread (AUDIO.System.lock locked)
+static void ProcessAudioCommands(void);                     // Apply commands queued (audio thread)
+static void ApplyAudioCommand(const AudioCommand *command); // Apply command to mixer state (audio thread)
+static void ReleaseAudioResource(const AudioCommand *command);  // Return buffer or processor released to program threads (audio thread)
+static void FreeAudioResources(void);                       // Free buffers and processors released (AUDIO.System.lock locked)
+static void FreeAudioResource(const AudioCommand *command); // Free buffer or processor released
+static void WaitAudioBufferCommands(AudioBuffer *buffer);   // Wait for buffer commands to be applied by audio thread
+static void WaitAudioThread(void);                          // Wait for audio thread to apply commands queued
+static void LoadSoundPoolVoices(void);                      // Create pooled sounds voices (device ready)
+static void StopAudioVoice(AudioBuffer *buffer);            // Stop audio buffer playing (audio thread)
+static void RemoveAudioVoice(AudioBuffer *buffer);          // Remove audio buffer from mixer voices (audio thread)
+static void AdvanceAudioVoice(AudioBuffer *buffer, ma_uint32 frameCount);   // Advance culled voice playback without mixing (audio thread)
+static void SetAudioVoicePitch(AudioBuffer *buffer, float pitch);           // Set voice pitch, converter sample rate adjusted (audio thread)
+static void StopSoundPoolVoices(unsigned char *data, bool unbind); // Stop pooled voices playing sample data (AUDIO.System.lock locked)
+static bool IsSoundPoolVoiceLess(const SoundPoolVoice *voice, const SoundPoolVoice *other, ma_uint32 frame); // Check if pooled voice is less important than other
+static void PlaySoundPoolVoice(Sound sound, int priority, const AudioEmitter *emitter); // Play sound on a pooled voice, spatialized from emitter if provided
 
 #if defined(RAUDIO_STANDALONE)
 static bool IsFileExtension(const char *fileName, const char *ext); // Check file extension
@@ -448,8 +756,6 @@ void ResumeAudioBuffer(AudioBuffer *buffer);
 void SetAudioBufferVolume(AudioBuffer *buffer, float volume);
 void SetAudioBufferPitch(AudioBuffer *buffer, float pitch);
 void SetAudioBufferPan(AudioBuffer *buffer, float pan);
-void TrackAudioBuffer(AudioBuffer *buffer);
-void UntrackAudioBuffer(AudioBuffer *buffer);
 
 
 //----------------------------------------------------------------------------------
@@ -490,8 +796,8 @@ void InitAudioDevice(void)
         return;
     }
 
-    // Mixing happens on a separate thread which means we need to synchronize. I'm using a mutex here to make things simple, but may
-    // want to look at something a bit smarter later on to keep everything real-time, if that's necessary
+    // Mixing happens on a separate thread which means we need to synchronize. Program threads calls are serialized with a mutex,
+    // mixer state changes are queued as commands (lock-free) applied by the audio thread, that never waits for program threads
     if (ma_mutex_init(&AUDIO.System.lock) != MA_SUCCESS)
     {
         TRACELOG(LOG_WARNING, "AUDIO: Failed to create mutex for mixing");
@@ -500,6 +806,12 @@ void InitAudioDevice(void)
         return;
     }
 
+#if defined(SUPPORT_AUDIO_STATS)
+    ma_timer_init(&AUDIO.Stats.timer);
+    AUDIO.Stats.lastCallback = 0.0;
+    ResetAudioStats();
+#endif
+
     // Keep the device running the whole time. May want to consider doing something a bit smarter and only have the device running
     // while there's at least one sound being played
     result = ma_device_start(&AUDIO.System.device);
@@ -519,6 +831,28 @@ void InitAudioDevice(void)
     TRACELOG(LOG_INFO, "    > Periods size:  %d", AUDIO.System.device.playback.internalPeriodSizeInFrames*AUDIO.System.device.playback.internalPeriods);
 
     AUDIO.System.isReady = true;
+
+    LoadSoundPoolVoices();
+
+#if defined(SUPPORT_MUSIC_STREAM_THREAD)
+    // Music streams are decoded ahead on a streaming thread, if it can not be created (i.e. web without threads)
+    // music is decoded by UpdateMusicStream() on calling thread
+    if (ma_mutex_init(&AUDIO.Stream.lock) == MA_SUCCESS)
+    {
+        ma_atomic_store_32(&AUDIO.Stream.running, true);
+
+        if (ma_thread_create(&AUDIO.Stream.thread, ma_thread_priority_normal, 0, MusicStreamThread, NULL, NULL) == MA_SUCCESS)
+        {
+            TRACELOG(LOG_INFO, "AUDIO: Music streaming thread started successfully (%i ms ahead)", MUSIC_STREAM_DECODE_AHEAD_MS);
+        }
+        else
+        {
+            ma_atomic_store_32(&AUDIO.Stream.running, false);
+            ma_mutex_uninit(&AUDIO.Stream.lock);
+            TRACELOG(LOG_INFO, "AUDIO: Music streaming thread not available, music decoded on update");
+        }
+    }
+#endif
 }
 
 // Close the audio device for all contexts
@@ -526,11 +860,42 @@ void CloseAudioDevice(void)
 {
     if (AUDIO.System.isReady)
     {
-        ma_mutex_uninit(&AUDIO.System.lock);
-        ma_device_uninit(&AUDIO.System.device);
-        ma_context_uninit(&AUDIO.System.context);
+        for (int i = 0; i < AUDIO.Pool.voiceCount; i++) UnloadAudioBuffer(AUDIO.Pool.voices[i].buffer);
+        AUDIO.Pool.voiceCount = 0;
+
+        if (ma_atomic_load_32(&AUDIO.Stream.running))
+        {
+            ma_atomic_store_32(&AUDIO.Stream.running, false);
+            ma_thread_wait(&AUDIO.Stream.thread);
+            ma_mutex_uninit(&AUDIO.Stream.lock);
+        }
+
+        if (!AUDIO.Offline.active) ma_device_uninit(&AUDIO.System.device);
 
         AUDIO.System.isReady = false;
+
+        // Audio thread stopped, commands queued are applied here, buffers still playing are removed from mixer
+        ma_mutex_lock(&AUDIO.System.lock);
+        ProcessAudioCommands();
+        FreeAudioResources();
+        while (AUDIO.Mixer.voiceCount > 0) RemoveAudioVoice(AUDIO.Mixer.voices[0]);
+        ma_mutex_unlock(&AUDIO.System.lock);
+
+        ma_mutex_uninit(&AUDIO.System.lock);
+
+        if (AUDIO.Offline.active)
+        {
+        #if defined(SUPPORT_FILEFORMAT_WAV)
+            if (AUDIO.Offline.wav != NULL) drwav_uninit((drwav *)AUDIO.Offline.wav);
+        #endif
+            RL_FREE(AUDIO.Offline.wav);
+            RL_FREE(AUDIO.Offline.buffer);
+            AUDIO.Offline.wav = NULL;
+            AUDIO.Offline.buffer = NULL;
+            AUDIO.Offline.active = false;
+        }
+        else ma_context_uninit(&AUDIO.System.context);
+
         RL_FREE(AUDIO.System.pcmBuffer);
         AUDIO.System.pcmBuffer = NULL;
         AUDIO.System.pcmBufferSize = 0;
@@ -540,6 +905,110 @@ void CloseAudioDevice(void)
     else TRACELOG(LOG_WARNING, "AUDIO: Device could not be closed, not currently initialized");
 }
 
+// Initialize audio in offline mode, no playback device is opened
+// NOTE: Mixing is driven by UpdateAudioDeviceOffline() on calling thread (virtual clock),
+// mixed output is written to a WAV file or discarded if no fileName is provided
+void InitAudioDeviceOffline(int sampleRate, const char *fileName)
+{
+    if (AUDIO.System.isReady)
+    {
+        TRACELOG(LOG_WARNING, "AUDIO: Device already initialized");
+        return;
+    }
+
+    if (sampleRate <= 0) sampleRate = 48000;
+
+    if (ma_mutex_init(&AUDIO.System.lock) != MA_SUCCESS)
+    {
+        TRACELOG(LOG_WARNING, "AUDIO: Failed to create mutex for mixing");
+        return;
+    }
+
+    // Device is not initialized, only the parameters required by mixing are defined
+    memset(&AUDIO.System.device, 0, sizeof(ma_device));
+    AUDIO.System.device.sampleRate = sampleRate;
+    AUDIO.System.device.playback.format = AUDIO_DEVICE_FORMAT;
+    AUDIO.System.device.playback.channels = AUDIO_DEVICE_CHANNELS;
+    AUDIO.System.device.playback.internalPeriodSizeInFrames = sampleRate*AUDIO_OFFLINE_PERIOD_MS/1000;
+    AUDIO.System.device.playback.internalPeriods = 1;
+    ma_device_set_master_volume(&AUDIO.System.device, 1.0f);
+
+    AUDIO.Offline.buffer = (float *)RL_CALLOC(AUDIO.System.device.playback.internalPeriodSizeInFrames*AUDIO_DEVICE_CHANNELS, sizeof(float));
+
+    if (fileName != NULL)
+    {
+    #if defined(SUPPORT_FILEFORMAT_WAV)
+        drwav_data_format format = { 0 };
+        format.container = drwav_container_riff;
+        format.format = DR_WAVE_FORMAT_IEEE_FLOAT;
+        format.channels = AUDIO_DEVICE_CHANNELS;
+        format.sampleRate = sampleRate;
+        format.bitsPerSample = 32;
+
+        AUDIO.Offline.wav = RL_CALLOC(1, sizeof(drwav));
+
+        if (!drwav_init_file_write((drwav *)AUDIO.Offline.wav, fileName, &format, NULL))
+        {
+            TRACELOG(LOG_WARNING, "AUDIO: [%s] Failed to open offline output file, output discarded", fileName);
+            RL_FREE(AUDIO.Offline.wav);
+            AUDIO.Offline.wav = NULL;
+        }
+    #else
+        TRACELOG(LOG_WARNING, "AUDIO: [%s] WAV file format not supported, output discarded", fileName);
+    #endif
+    }
+
+#if defined(SUPPORT_AUDIO_STATS)
+    ma_timer_init(&AUDIO.Stats.timer);
+    AUDIO.Stats.lastCallback = 0.0;
+    ResetAudioStats();
+#endif
+
+    AUDIO.Offline.active = true;
+    AUDIO.System.isReady = true;
+
+    LoadSoundPoolVoices();
+
+    TRACELOG(LOG_INFO, "AUDIO: Device initialized successfully (offline)");
+    TRACELOG(LOG_INFO, "    > Sample rate:   %d", AUDIO.System.device.sampleRate);
+    TRACELOG(LOG_INFO, "    > Periods size:  %d", AUDIO.System.device.playback.internalPeriodSizeInFrames);
+    TRACELOG(LOG_INFO, "    > Output:        %s", (AUDIO.Offline.wav != NULL)? fileName : "discarded");
+}
+
+// Mix frames in offline mode, advancing the virtual clock
+// NOTE: Frames are mixed on calling thread one period at a time, as a playback device would request them
+void UpdateAudioDeviceOffline(int frameCount)
+{
+    if (!AUDIO.Offline.active) return;
+
+    ma_uint32 periodSize = AUDIO.System.device.playback.internalPeriodSizeInFrames;
+    float volume = 1.0f;
+
+    ma_mutex_lock(&AUDIO.System.lock);
+
+    ma_device_get_master_volume(&AUDIO.System.device, &volume);
+
+    while (frameCount > 0)
+    {
+        ma_uint32 framesToMix = ((ma_uint32)frameCount < periodSize)? (ma_uint32)frameCount : periodSize;
+
+        OnSendAudioDataToDevice(&AUDIO.System.device, AUDIO.Offline.buffer, NULL, framesToMix);
+
+        // NOTE: Master volume is applied by miniaudio on playback devices
+        if (volume != 1.0f) ma_apply_volume_factor_f32(AUDIO.Offline.buffer, framesToMix*AUDIO_DEVICE_CHANNELS, volume);
+
+    #if defined(SUPPORT_FILEFORMAT_WAV)
+        if (AUDIO.Offline.wav != NULL) drwav_write_pcm_frames((drwav *)AUDIO.Offline.wav, framesToMix, AUDIO.Offline.buffer);
+    #endif
+
+        frameCount -= framesToMix;
+    }
+
+    FreeAudioResources();
+
+    ma_mutex_unlock(&AUDIO.System.lock);
+}
+
 // Check if device has been initialized successfully
 bool IsAudioDeviceReady(void)
 {
@@ -560,6 +1029,87 @@ float GetMasterVolume(void)
     return volume;
 }
 
+// Get audio callback timing and underruns stats
+// NOTE: Returns zeroed stats if device is not ready or stats are not supported
+AudioStats GetAudioStats(void)
+{
+    AudioStats stats = { 0 };
+
+#if defined(SUPPORT_AUDIO_STATS)
+    if (!AUDIO.System.isReady) return stats;
+
+    stats.sampleRate = (int)AUDIO.System.device.sampleRate;
+    stats.periodSize = (int)AUDIO.System.device.playback.internalPeriodSizeInFrames;
+    stats.periodCount = (int)AUDIO.System.device.playback.internalPeriods;
+    if (stats.sampleRate > 0) stats.periodTime = (float)stats.periodSize*1000.0f/stats.sampleRate;
+
+    stats.callbackCount = ma_atomic_load_32(&AUDIO.Stats.callbackCount);
+    if (stats.callbackCount > 0) stats.callbackTimeAvg = (float)((double)ma_atomic_load_64(&AUDIO.Stats.callbackTime)/stats.callbackCount/1e6);
+    stats.callbackTimeMax = (float)ma_atomic_load_32(&AUDIO.Stats.callbackTimeMax)/1e6f;
+    stats.callbackIntervalMax = (float)ma_atomic_load_32(&AUDIO.Stats.intervalMax)/1e6f;
+    for (int i = 0; i < AUDIO_STATS_HISTOGRAM_SIZE; i++) stats.callbackHistogram[i] = ma_atomic_load_32(&AUDIO.Stats.histogram[i]);
+
+    stats.overruns = ma_atomic_load_32(&AUDIO.Stats.overruns);
+    stats.lateCallbacks = ma_atomic_load_32(&AUDIO.Stats.lateCallbacks);
+    stats.streamUnderruns = ma_atomic_load_32(&AUDIO.Stats.streamUnderruns);
+    stats.lateRefills = ma_atomic_load_32(&AUDIO.Stats.lateRefills);
+
+    stats.voiceCount = ma_atomic_load_32(&AUDIO.Stats.voiceCount);
+    if (stats.voiceCount > 0) stats.voiceTimeAvg = (float)((double)ma_atomic_load_64(&AUDIO.Stats.voiceTime)/stats.voiceCount/1e3);
+    stats.voiceTimeMax = (float)ma_atomic_load_32(&AUDIO.Stats.voiceTimeMax)/1e3f;
+#endif
+
+    return stats;
+}
+
+// Reset audio stats recorded
+// NOTE: Counters are reset one by one, a callback running meanwhile could be partially recorded
+void ResetAudioStats(void)
+{
+#if defined(SUPPORT_AUDIO_STATS)
+    ma_atomic_store_32(&AUDIO.Stats.callbackCount, 0);
+    ma_atomic_store_64(&AUDIO.Stats.callbackTime, 0);
+    ma_atomic_store_32(&AUDIO.Stats.callbackTimeMax, 0);
+    ma_atomic_store_32(&AUDIO.Stats.intervalMax, 0);
+    for (int i = 0; i < AUDIO_STATS_HISTOGRAM_SIZE; i++) ma_atomic_store_32(&AUDIO.Stats.histogram[i], 0);
+
+    ma_atomic_store_32(&AUDIO.Stats.overruns, 0);
+    ma_atomic_store_32(&AUDIO.Stats.lateCallbacks, 0);
+    ma_atomic_store_32(&AUDIO.Stats.streamUnderruns, 0);
+    ma_atomic_store_32(&AUDIO.Stats.lateRefills, 0);
+
+    ma_atomic_store_32(&AUDIO.Stats.voiceCount, 0);
+    ma_atomic_store_64(&AUDIO.Stats.voiceTime, 0);
+    ma_atomic_store_32(&AUDIO.Stats.voiceTimeMax, 0);
+#endif
+}
+
+// Export audio stats as CSV, header line and one line of values (times in milliseconds, voice times in microseconds)
+bool ExportAudioStats(const char *fileName)
+{
+    AudioStats stats = GetAudioStats();
+
+    char text[2048] = { 0 };
+    int byteCount = 0;
+
+    byteCount += sprintf(text + byteCount, "sampleRate,periodSize,periodCount,periodTime,callbackCount,callbackTimeAvg,callbackTimeMax,callbackIntervalMax,");
+    for (int i = 0; i < AUDIO_STATS_HISTOGRAM_SIZE; i++) byteCount += sprintf(text + byteCount, "callback%03i,", i*10);
+    byteCount += sprintf(text + byteCount, "overruns,lateCallbacks,streamUnderruns,lateRefills,voiceCount,voiceTimeAvg,voiceTimeMax\n");
+
+    byteCount += sprintf(text + byteCount, "%i,%i,%i,%.3f,%u,%.4f,%.4f,%.4f,", stats.sampleRate, stats.periodSize, stats.periodCount, stats.periodTime,
+        stats.callbackCount, stats.callbackTimeAvg, stats.callbackTimeMax, stats.callbackIntervalMax);
+    for (int i = 0; i < AUDIO_STATS_HISTOGRAM_SIZE; i++) byteCount += sprintf(text + byteCount, "%u,", stats.callbackHistogram[i]);
+    byteCount += sprintf(text + byteCount, "%u,%u,%u,%u,%u,%.3f,%.3f\n", stats.overruns, stats.lateCallbacks, stats.streamUnderruns, stats.lateRefills,
+        stats.voiceCount, stats.voiceTimeAvg, stats.voiceTimeMax);
+
+    bool success = SaveFileText(fileName, text);
+
+    if (success) TRACELOG(LOG_INFO, "FILEIO: [%s] Audio stats exported successfully", fileName);
+    else TRACELOG(LOG_WARNING, "FILEIO: [%s] Failed to export audio stats", fileName);
+
+    return success;
+}
+
 //----------------------------------------------------------------------------------
 // Module Functions Definition - Audio Buffer management
 //----------------------------------------------------------------------------------
@@ -612,31 +1162,36 @@ AudioBuffer *LoadAudioBuffer(ma_format format, ma_uint32 channels, ma_uint32 sam
     audioBuffer->isSubBufferProcessed[0] = true;
     audioBuffer->isSubBufferProcessed[1] = true;
 
-    // Track audio buffer to linked list next position
-    TrackAudioBuffer(audioBuffer);
+    // Buffer is not known by the mixer until played
+    audioBuffer->voiceIndex = -1;
 
     return audioBuffer;
 }
 
 // Delete an audio buffer
+// NOTE: Buffer is freed once removed from mixer by the audio thread
 void UnloadAudioBuffer(AudioBuffer *buffer)
 {
     if (buffer != NULL)
     {
-        UntrackAudioBuffer(buffer);
-        ma_data_converter_uninit(&buffer->converter, NULL);
-        RL_FREE(buffer->data);
-        RL_FREE(buffer);
+        ma_mutex_lock(&AUDIO.System.lock);
+        PushAudioCommand((AudioCommand){ .type = AUDIO_COMMAND_RELEASE, .buffer = buffer });
+        ma_mutex_unlock(&AUDIO.System.lock);
     }
 }
 
 // Check if an audio buffer is playing from a program state without lock
+// NOTE: While commands are pending, the state requested is reported
 bool IsAudioBufferPlaying(AudioBuffer *buffer)
 {
     bool result = false;
-    ma_mutex_lock(&AUDIO.System.lock);
-    result = IsAudioBufferPlayingInLockedState(buffer);
-    ma_mutex_unlock(&AUDIO.System.lock);
+
+    if (buffer != NULL)
+    {
+        if (ma_atomic_load_32(&buffer->pendingCommands) > 0) result = (buffer->playRequested && !buffer->pauseRequested);
+        else result = (ma_atomic_load_8((ma_uint8 *)&buffer->playing) && !ma_atomic_load_8((ma_uint8 *)&buffer->paused));
+    }
+
     return result;
 }
 
@@ -648,12 +1203,9 @@ void PlayAudioBuffer(AudioBuffer *buffer)
     if (buffer != NULL)
     {
         ma_mutex_lock(&AUDIO.System.lock);
-        buffer->playing = true;
-        buffer->paused = false;
-        buffer->frameCursorPos = 0;
-        buffer->framesProcessed = 0;
-        buffer->isSubBufferProcessed[0] = true;
-        buffer->isSubBufferProcessed[1] = true;
+        buffer->playRequested = true;
+        buffer->pauseRequested = false;
+        PushAudioCommand((AudioCommand){ .type = AUDIO_COMMAND_PLAY, .buffer = buffer });
         ma_mutex_unlock(&AUDIO.System.lock);
     }
 }
@@ -661,9 +1213,13 @@ void PlayAudioBuffer(AudioBuffer *buffer)
 // Stop an audio buffer from a program state without lock
 void StopAudioBuffer(AudioBuffer *buffer)
 {
-    ma_mutex_lock(&AUDIO.System.lock);
-    StopAudioBufferInLockedState(buffer);
-    ma_mutex_unlock(&AUDIO.System.lock);
+    if (buffer != NULL)
+    {
+        ma_mutex_lock(&AUDIO.System.lock);
+        if (!buffer->pauseRequested) buffer->playRequested = false;
+        PushAudioCommand((AudioCommand){ .type = AUDIO_COMMAND_STOP, .buffer = buffer });
+        ma_mutex_unlock(&AUDIO.System.lock);
+    }
 }
 
 // Pause an audio buffer
@@ -672,7 +1228,8 @@ void PauseAudioBuffer(AudioBuffer *buffer)
     if (buffer != NULL)
     {
         ma_mutex_lock(&AUDIO.System.lock);
-        buffer->paused = true;
+        buffer->pauseRequested = true;
+        PushAudioCommand((AudioCommand){ .type = AUDIO_COMMAND_PAUSE, .buffer = buffer });
         ma_mutex_unlock(&AUDIO.System.lock);
     }
 }
@@ -683,7 +1240,8 @@ void ResumeAudioBuffer(AudioBuffer *buffer)
     if (buffer != NULL)
     {
         ma_mutex_lock(&AUDIO.System.lock);
-        buffer->paused = false;
+        buffer->pauseRequested = false;
+        PushAudioCommand((AudioCommand){ .type = AUDIO_COMMAND_RESUME, .buffer = buffer });
         ma_mutex_unlock(&AUDIO.System.lock);
     }
 }
@@ -694,7 +1252,7 @@ void SetAudioBufferVolume(AudioBuffer *buffer, float volume)
     if (buffer != NULL)
     {
         ma_mutex_lock(&AUDIO.System.lock);
-        buffer->volume = volume;
+        PushAudioCommand((AudioCommand){ .type = AUDIO_COMMAND_VOLUME, .buffer = buffer, .value = volume });
         ma_mutex_unlock(&AUDIO.System.lock);
     }
 }
@@ -705,14 +1263,7 @@ void SetAudioBufferPitch(AudioBuffer *buffer, float pitch)
     if ((buffer != NULL) && (pitch > 0.0f))
     {
         ma_mutex_lock(&AUDIO.System.lock);
-        // Pitching is just an adjustment of the sample rate
-        // Note that this changes the duration of the sound:
-        //  - higher pitches will make the sound faster
-        //  - lower pitches make it slower
-        ma_uint32 outputSampleRate = (ma_uint32)((float)buffer->converter.sampleRateOut/pitch);
-        ma_data_converter_set_rate(&buffer->converter, buffer->converter.sampleRateIn, outputSampleRate);
-
-        buffer->pitch = pitch;
+        PushAudioCommand((AudioCommand){ .type = AUDIO_COMMAND_PITCH, .buffer = buffer, .value = pitch });
         ma_mutex_unlock(&AUDIO.System.lock);
     }
 }
@@ -726,45 +1277,11 @@ void SetAudioBufferPan(AudioBuffer *buffer, float pan)
     if (buffer != NULL)
     {
         ma_mutex_lock(&AUDIO.System.lock);
-        buffer->pan = pan;
+        PushAudioCommand((AudioCommand){ .type = AUDIO_COMMAND_PAN, .buffer = buffer, .value = pan });
         ma_mutex_unlock(&AUDIO.System.lock);
     }
 }
 
-// Track audio buffer to linked list next position
-void TrackAudioBuffer(AudioBuffer *buffer)
-{
-    ma_mutex_lock(&AUDIO.System.lock);
-    {
-        if (AUDIO.Buffer.first == NULL) AUDIO.Buffer.first = buffer;
-        else
-        {
-            AUDIO.Buffer.last->next = buffer;
-            buffer->prev = AUDIO.Buffer.last;
-        }
-
-        AUDIO.Buffer.last = buffer;
-    }
-    ma_mutex_unlock(&AUDIO.System.lock);
-}
-
-// Untrack audio buffer from linked list
-void UntrackAudioBuffer(AudioBuffer *buffer)
-{
-    ma_mutex_lock(&AUDIO.System.lock);
-    {
-        if (buffer->prev == NULL) AUDIO.Buffer.first = buffer->next;
-        else buffer->prev->next = buffer->next;
-
-        if (buffer->next == NULL) AUDIO.Buffer.last = buffer->prev;
-        else buffer->next->prev = buffer->prev;
-
-        buffer->prev = NULL;
-        buffer->next = NULL;
-    }
-    ma_mutex_unlock(&AUDIO.System.lock);
-}
-
 //----------------------------------------------------------------------------------
 // Module Functions Definition - Sounds loading and playing (.WAV)
 //----------------------------------------------------------------------------------
@@ -774,14 +1291,14 @@ Wave LoadWave(const char *fileName)
 {
     Wave wave = { 0 };
 
-    // Loading file to memory
+    // Loading file to memory (mapped, decoded in place)
     int dataSize = 0;
-    unsigned char *fileData = LoadFileData(fileName, &dataSize);
+    unsigned char *fileData = LoadFileDataMapped(fileName, &dataSize);
 
     // Loading wave from memory data
     if (fileData != NULL) wave = LoadWaveFromMemory(GetFileExtension(fileName), fileData, dataSize);
 
-    UnloadFileData(fileData);
+    UnloadFileDataMapped(fileData);
 
     return wave;
 }
@@ -985,6 +1502,7 @@ Sound LoadSoundAlias(Sound source)
         audioBuffer->sizeInFrames = source.stream.buffer->sizeInFrames;
         audioBuffer->volume = source.stream.buffer->volume;
         audioBuffer->data = source.stream.buffer->data;
+        audioBuffer->sharedData = true;
 
         sound.frameCount = source.frameCount;
         sound.stream.sampleRate = AUDIO.System.device.sampleRate;
@@ -1021,19 +1539,22 @@ void UnloadWave(Wave wave)
 // Unload sound
 void UnloadSound(Sound sound)
 {
+    if ((sound.stream.buffer != NULL) && AUDIO.System.isReady)
+    {
+        // Pooled voices sharing the sample data are unbound before the data is freed
+        ma_mutex_lock(&AUDIO.System.lock);
+        StopSoundPoolVoices(sound.stream.buffer->data, true);
+        ma_mutex_unlock(&AUDIO.System.lock);
+    }
+
     UnloadAudioBuffer(sound.stream.buffer);
     //TRACELOG(LOG_INFO, "SOUND: Unloaded sound data from RAM");
 }
 
 void UnloadSoundAlias(Sound alias)
 {
-    // Untrack and unload just the sound buffer, not the sample data, it is shared with the source for the alias
-    if (alias.stream.buffer != NULL)
-    {
-        UntrackAudioBuffer(alias.stream.buffer);
-        ma_data_converter_uninit(&alias.stream.buffer->converter, NULL);
-        RL_FREE(alias.stream.buffer);
-    }
+    // Unload just the sound buffer, not the sample data, it is shared with the source for the alias
+    UnloadAudioBuffer(alias.stream.buffer);
 }
 
 // Update sound buffer with new data
@@ -1041,7 +1562,9 @@ void UpdateSound(Sound sound, const void *data, int frameCount)
 {
     if (sound.stream.buffer != NULL)
     {
+        StopSoundPooled(sound);
         StopAudioBuffer(sound.stream.buffer);
+        WaitAudioBufferCommands(sound.stream.buffer);   // Data is not read by audio thread once stopped, commands applied in order
 
         memcpy(sound.stream.buffer->data, data, frameCount*ma_get_bytes_per_frame(sound.stream.buffer->converter.formatIn, sound.stream.buffer->converter.channelsIn));
     }
@@ -1224,6 +1747,33 @@ void SetSoundPan(Sound sound, float pan)
     SetAudioBufferPan(sound.stream.buffer, pan);
 }
 
+// Play a sound on a pooled voice, sample data is shared with the sound
+// NOTE: When all pooled voices are playing, the least important one is stolen: lowest priority,
+// then lowest audibility (sound volume), then oldest; the request is dropped if every voice
+// is more important. Sound played again within SOUND_POOL_COALESCE_MS is merged
+void PlaySoundPooled(Sound sound, int priority)
+{
+    PlaySoundPoolVoice(sound, priority, NULL);
+}
+
+// Play an emitter sound on a pooled voice, spatialized from emitter position at play time
+// NOTE: Voice audibility (stealing) is the emitter volume attenuated by distance to listener,
+// the voice keeps following listener changes on UpdateAudioEmitters() calls
+void PlayAudioEmitterPooled(AudioEmitter emitter, int priority)
+{
+    PlaySoundPoolVoice(emitter.sound, priority, &emitter);
+}
+
+// Stop pooled voices playing a sound
+void StopSoundPooled(Sound sound)
+{
+    if ((sound.stream.buffer == NULL) || !AUDIO.System.isReady) return;
+
+    ma_mutex_lock(&AUDIO.System.lock);
+    StopSoundPoolVoices(sound.stream.buffer->data, false);
+    ma_mutex_unlock(&AUDIO.System.lock);
+}
+
 // Convert wave data to desired format
 void WaveFormat(Wave *wave, int sampleRate, int sampleSize, int channels)
 {
@@ -1324,75 +1874,255 @@ void UnloadWaveSamples(float *samples)
 }
 
 //----------------------------------------------------------------------------------
-// Module Functions Definition - Music loading and stream playing
+// Module Functions Definition - Spatial audio (listener and emitters)
 //----------------------------------------------------------------------------------
 
-// Load music stream from file
-Music LoadMusicStream(const char *fileName)
+// Set audio listener from camera, emitters are spatialized relative to it
+// NOTE: Emitters out of the camera view (fovy scaled by AUDIO_SPATIAL_VIEW_MARGIN) are culled, perspective camera only
+void SetAudioListener(Camera3D camera)
 {
-    Music music = { 0 };
-    bool musicLoaded = false;
+    float forward[3] = { camera.target.x - camera.position.x, camera.target.y - camera.position.y, camera.target.z - camera.position.z };
+    float length = sqrtf(forward[0]*forward[0] + forward[1]*forward[1] + forward[2]*forward[2]);
 
-    if (false) { }
-#if defined(SUPPORT_FILEFORMAT_WAV)
-    else if (IsFileExtension(fileName, ".wav"))
-    {
-        drwav *ctxWav = (drwav *)RL_CALLOC(1, sizeof(drwav));
-        bool success = drwav_init_file(ctxWav, fileName, NULL);
+    if (length <= 0.0f) return;
 
-        if (success)
-        {
-            music.ctxType = MUSIC_AUDIO_WAV;
-            music.ctxData = ctxWav;
-            int sampleSize = ctxWav->bitsPerSample;
-            if (ctxWav->bitsPerSample == 24) sampleSize = 16;   // Forcing conversion to s16 on UpdateMusicStream()
+    forward[0] /= length;
+    forward[1] /= length;
+    forward[2] /= length;
 
-            music.stream = LoadAudioStream(ctxWav->sampleRate, sampleSize, ctxWav->channels);
-            music.frameCount = (unsigned int)ctxWav->totalPCMFrameCount;
-            music.looping = true;   // Looping enabled by default
-            musicLoaded = true;
-        }
-        else
-        {
-            RL_FREE(ctxWav);
-        }
-    }
-#endif
-#if defined(SUPPORT_FILEFORMAT_OGG)
-    else if (IsFileExtension(fileName, ".ogg"))
-    {
-        // Open ogg audio stream
-        stb_vorbis *ctxOgg = stb_vorbis_open_filename(fileName, NULL, NULL);
+    // Right direction: forward x up
+    float right[3] = {
+        forward[1]*camera.up.z - forward[2]*camera.up.y,
+        forward[2]*camera.up.x - forward[0]*camera.up.z,
+        forward[0]*camera.up.y - forward[1]*camera.up.x
+    };
+    length = sqrtf(right[0]*right[0] + right[1]*right[1] + right[2]*right[2]);
 
-        if (ctxOgg != NULL)
-        {
-            music.ctxType = MUSIC_AUDIO_OGG;
-            music.ctxData = ctxOgg;
-            stb_vorbis_info info = stb_vorbis_get_info((stb_vorbis *)music.ctxData);  // Get Ogg file info
+    if (length <= 0.0f) return;
 
-            // OGG bit rate defaults to 16 bit, it's enough for compressed format
-            music.stream = LoadAudioStream(info.sample_rate, 16, info.channels);
+    float viewAngle = camera.fovy*0.5f*AUDIO_SPATIAL_VIEW_MARGIN*DEG2RAD;
 
-            // WARNING: It seems this function returns length in frames, not samples, so we multiply by channels
-            music.frameCount = (unsigned int)stb_vorbis_stream_length_in_samples((stb_vorbis *)music.ctxData);
-            music.looping = true;   // Looping enabled by default
-            musicLoaded = true;
-        }
-        else
-        {
-            stb_vorbis_close(ctxOgg);
-        }
-    }
-#endif
-#if defined(SUPPORT_FILEFORMAT_MP3)
-    else if (IsFileExtension(fileName, ".mp3"))
+    ma_mutex_lock(&AUDIO.System.lock);
+
+    AUDIO.Spatial.position[0] = camera.position.x;
+    AUDIO.Spatial.position[1] = camera.position.y;
+    AUDIO.Spatial.position[2] = camera.position.z;
+    for (int i = 0; i < 3; i++)
     {
-        drmp3 *ctxMp3 = (drmp3 *)RL_CALLOC(1, sizeof(drmp3));
-        int result = drmp3_init_file(ctxMp3, fileName, NULL);
+        AUDIO.Spatial.forward[i] = forward[i];
+        AUDIO.Spatial.right[i] = right[i]/length;
+    }
+    AUDIO.Spatial.viewCos = ((camera.projection == CAMERA_PERSPECTIVE) && (viewAngle < PI))? cosf(viewAngle) : -1.0f;
 
-        if (result > 0)
-        {
-            music.ctxType = MUSIC_AUDIO_MP3;
+    ma_mutex_unlock(&AUDIO.System.lock);
+}
+
+// Set emitters distance attenuation: full volume up to refDistance, no further attenuation beyond maxDistance
+// NOTE: Inverse distance clamped model: volume = refDistance/(refDistance + rolloff*(distance - refDistance))
+void SetAudioSpatialDistance(float refDistance, float maxDistance, float rolloff)
+{
+    ma_mutex_lock(&AUDIO.System.lock);
+    AUDIO.Spatial.refDistance = (refDistance > 0.001f)? refDistance : 0.001f;
+    AUDIO.Spatial.maxDistance = (maxDistance > AUDIO.Spatial.refDistance)? maxDistance : AUDIO.Spatial.refDistance;
+    AUDIO.Spatial.rolloff = (rolloff > 0.0f)? rolloff : 0.0f;
+    ma_mutex_unlock(&AUDIO.System.lock);
+}
+
+// Set emitters doppler pitch factor (1.0 is physical), 0.0 disables doppler
+void SetAudioDopplerFactor(float factor)
+{
+    ma_mutex_lock(&AUDIO.System.lock);
+    AUDIO.Spatial.dopplerFactor = (factor > 0.0f)? factor : 0.0f;
+    ma_mutex_unlock(&AUDIO.System.lock);
+}
+
+// Update emitters sounds volume, pan and pitch from their position relative to listener
+// NOTE: Emitters are spatialized in batches (SIMD) and only audible changes are queued to the mixer,
+// emitters inaudible or out of listener view are culled: not mixed, playback position still advanced.
+// Emitters sounds volume, pan and pitch are driven by this function, they should not be set directly.
+// Pooled voices played by PlayAudioEmitterPooled() are also spatialized, emitters could be NULL
+void UpdateAudioEmitters(const AudioEmitter *emitters, int count)
+{
+    if (!AUDIO.System.isReady) return;
+    if (emitters == NULL) count = 0;
+
+    AudioSpatialBatch batch = { 0 };
+
+    ma_mutex_lock(&AUDIO.System.lock);
+
+    for (int first = 0; first < count; first += AUDIO_SPATIAL_BATCH_SIZE)
+    {
+        int batchCount = ((count - first) < AUDIO_SPATIAL_BATCH_SIZE)? (count - first) : AUDIO_SPATIAL_BATCH_SIZE;
+
+        for (int i = 0; i < batchCount; i++)
+        {
+            const AudioEmitter *emitter = &emitters[first + i];
+
+            batch.x[i] = emitter->position.x;
+            batch.y[i] = emitter->position.y;
+            batch.z[i] = emitter->position.z;
+            batch.vx[i] = emitter->velocity.x;
+            batch.vy[i] = emitter->velocity.y;
+            batch.vz[i] = emitter->velocity.z;
+            batch.volume[i] = emitter->volume;
+            batch.pitch[i] = emitter->pitch;
+        }
+
+        SpatializeAudioBatch(&batch, batchCount);
+
+        for (int i = 0; i < batchCount; i++)
+        {
+            AudioBuffer *buffer = emitters[first + i].sound.stream.buffer;
+
+            if ((buffer == NULL) || !IsAudioBufferPlaying(buffer)) continue;
+
+            AudioSpatial spatial = GetAudioSpatial(&batch, i);
+
+            if (IsAudioSpatialChanged(&buffer->spatial, &spatial))
+            {
+                PushAudioCommand((AudioCommand){ .type = AUDIO_COMMAND_SPATIAL, .buffer = buffer, .spatial = spatial });
+                buffer->spatial = spatial;
+            }
+        }
+    }
+
+    // Pooled voices played from emitters, spatialized from their play position
+    // NOTE: MAX_SOUND_POOL_VOICES is not bigger than a batch, voices playing are spatialized at once
+    SoundPoolVoice *voices[AUDIO_SPATIAL_BATCH_SIZE] = { 0 };
+    int voiceCount = 0;
+
+    for (int i = 0; (i < AUDIO.Pool.voiceCount) && (voiceCount < AUDIO_SPATIAL_BATCH_SIZE); i++)
+    {
+        SoundPoolVoice *voice = &AUDIO.Pool.voices[i];
+
+        if (!voice->positional || !IsAudioBufferPlaying(voice->buffer)) continue;
+
+        batch.x[voiceCount] = voice->position.x;
+        batch.y[voiceCount] = voice->position.y;
+        batch.z[voiceCount] = voice->position.z;
+        batch.vx[voiceCount] = voice->velocity.x;
+        batch.vy[voiceCount] = voice->velocity.y;
+        batch.vz[voiceCount] = voice->velocity.z;
+        batch.volume[voiceCount] = voice->volume;
+        batch.pitch[voiceCount] = voice->pitch;
+        voices[voiceCount] = voice;
+        voiceCount++;
+    }
+
+    if (voiceCount > 0) SpatializeAudioBatch(&batch, voiceCount);
+
+    for (int i = 0; i < voiceCount; i++)
+    {
+        AudioBuffer *buffer = voices[i]->buffer;
+        AudioSpatial spatial = GetAudioSpatial(&batch, i);
+
+        if (IsAudioSpatialChanged(&buffer->spatial, &spatial))
+        {
+            PushAudioCommand((AudioCommand){ .type = AUDIO_COMMAND_SPATIAL, .buffer = buffer, .spatial = spatial });
+            buffer->spatial = spatial;
+        }
+    }
+
+    ma_mutex_unlock(&AUDIO.System.lock);
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition - Music loading and stream playing
+//----------------------------------------------------------------------------------
+
+// Load music stream from file
+// NOTE: Files mapped into memory are decoded in place, instead of being read into decoder buffers on every update,
+// files not found on disk (i.e. served by a custom file data callback) are streamed from memory too,
+// file data is kept until UnloadMusicStream()
+Music LoadMusicStream(const char *fileName)
+{
+    Music music = { 0 };
+    bool musicLoaded = false;
+
+#if !defined(RAUDIO_STANDALONE)
+#if defined(FILE_MAPPING_ENABLED)
+    bool streamFromMemory = true;
+#else
+    bool streamFromMemory = !FileExists(fileName);
+#endif
+
+    if (streamFromMemory)
+    {
+        int dataSize = 0;
+        unsigned char *fileData = LoadFileDataMapped(fileName, &dataSize);
+
+        if (fileData != NULL)
+        {
+            music = LoadMusicStreamFromMemory(GetFileExtension(fileName), fileData, dataSize);
+
+            if (music.stream.buffer != NULL) music.stream.buffer->fileData = fileData;
+            else UnloadFileDataMapped(fileData);
+        }
+
+        return music;
+    }
+#endif
+
+    if (false) { }
+#if defined(SUPPORT_FILEFORMAT_WAV)
+    else if (IsFileExtension(fileName, ".wav"))
+    {
+        drwav *ctxWav = (drwav *)RL_CALLOC(1, sizeof(drwav));
+        bool success = drwav_init_file(ctxWav, fileName, NULL);
+
+        if (success)
+        {
+            music.ctxType = MUSIC_AUDIO_WAV;
+            music.ctxData = ctxWav;
+            int sampleSize = ctxWav->bitsPerSample;
+            if (ctxWav->bitsPerSample == 24) sampleSize = 16;   // Forcing conversion to s16 on UpdateMusicStream()
+
+            music.stream = LoadAudioStream(ctxWav->sampleRate, sampleSize, ctxWav->channels);
+            music.frameCount = (unsigned int)ctxWav->totalPCMFrameCount;
+            music.looping = true;   // Looping enabled by default
+            musicLoaded = true;
+        }
+        else
+        {
+            RL_FREE(ctxWav);
+        }
+    }
+#endif
+#if defined(SUPPORT_FILEFORMAT_OGG)
+    else if (IsFileExtension(fileName, ".ogg"))
+    {
+        // Open ogg audio stream
+        stb_vorbis *ctxOgg = stb_vorbis_open_filename(fileName, NULL, NULL);
+
+        if (ctxOgg != NULL)
+        {
+            music.ctxType = MUSIC_AUDIO_OGG;
+            music.ctxData = ctxOgg;
+            stb_vorbis_info info = stb_vorbis_get_info((stb_vorbis *)music.ctxData);  // Get Ogg file info
+
+            // OGG bit rate defaults to 16 bit, it's enough for compressed format
+            music.stream = LoadAudioStream(info.sample_rate, 16, info.channels);
+
+            // WARNING: It seems this function returns length in frames, not samples, so we multiply by channels
+            music.frameCount = (unsigned int)stb_vorbis_stream_length_in_samples((stb_vorbis *)music.ctxData);
+            music.looping = true;   // Looping enabled by default
+            musicLoaded = true;
+        }
+        else
+        {
+            stb_vorbis_close(ctxOgg);
+        }
+    }
+#endif
+#if defined(SUPPORT_FILEFORMAT_MP3)
+    else if (IsFileExtension(fileName, ".mp3"))
+    {
+        drmp3 *ctxMp3 = (drmp3 *)RL_CALLOC(1, sizeof(drmp3));
+        int result = drmp3_init_file(ctxMp3, fileName, NULL);
+
+        if (result > 0)
+        {
+            music.ctxType = MUSIC_AUDIO_MP3;
             music.ctxData = ctxMp3;
             music.stream = LoadAudioStream(ctxMp3->sampleRate, 32, ctxMp3->channels);
             music.frameCount = (unsigned int)drmp3_get_pcm_frame_count(ctxMp3);
@@ -1507,6 +2237,8 @@ Music LoadMusicStream(const char *fileName)
     }
     else
     {
+        TrackMusicStream(&music);
+
         // Show some music stream info
         TRACELOG(LOG_INFO, "FILEIO: [%s] Music file loaded successfully", fileName);
         TRACELOG(LOG_INFO, "    > Sample rate:   %i Hz", music.stream.sampleRate);
@@ -1720,6 +2452,8 @@ Music LoadMusicStreamFromMemory(const char *fileType, const unsigned char *data,
     }
     else
     {
+        TrackMusicStream(&music);
+
         // Show some music stream info
         TRACELOG(LOG_INFO, "FILEIO: Music data loaded successfully");
         TRACELOG(LOG_INFO, "    > Sample rate:   %i Hz", music.stream.sampleRate);
@@ -1744,6 +2478,11 @@ bool IsMusicValid(Music music)
 // Unload music stream
 void UnloadMusicStream(Music music)
 {
+#if !defined(RAUDIO_STANDALONE)
+    unsigned char *fileData = (music.stream.buffer != NULL)? music.stream.buffer->fileData : NULL;
+#endif
+
+    UntrackMusicStream(music);    // Decoder not used by streaming thread any more
     UnloadAudioStream(music.stream);
 
     if (music.ctxData != NULL)
@@ -1771,12 +2510,25 @@ void UnloadMusicStream(Music music)
         else if (music.ctxType == MUSIC_MODULE_MOD) { jar_mod_unload((jar_mod_context_t *)music.ctxData); RL_FREE(music.ctxData); }
 #endif
     }
+
+#if !defined(RAUDIO_STANDALONE)
+    // Music file data must be kept until decoder is closed
+    if (fileData != NULL) UnloadFileDataMapped(fileData);
+#endif
 }
 
 // Start music playing (open stream) from beginning
 void PlayMusicStream(Music music)
 {
+    UpdateMusicStream(music);     // Looping state updated for streaming thread
+
+    // NOTE: Streaming thread is not decoding a chunk while play command is queued,
+    // stream restarted by audio thread is not overwritten by a chunk decoded before
+    if (ma_atomic_load_32(&AUDIO.Stream.running)) ma_mutex_lock(&AUDIO.Stream.lock);
+
     PlayAudioStream(music.stream);
+
+    if (ma_atomic_load_32(&AUDIO.Stream.running)) ma_mutex_unlock(&AUDIO.Stream.lock);
 }
 
 // Pause music playing
@@ -1794,33 +2546,12 @@ void ResumeMusicStream(Music music)
 // Stop music playing (close stream)
 void StopMusicStream(Music music)
 {
+    if (ma_atomic_load_32(&AUDIO.Stream.running)) ma_mutex_lock(&AUDIO.Stream.lock);
+
     StopAudioStream(music.stream);
+    RewindMusicFrames(music);
 
-    switch (music.ctxType)
-    {
-#if defined(SUPPORT_FILEFORMAT_WAV)
-        case MUSIC_AUDIO_WAV: drwav_seek_to_first_pcm_frame((drwav *)music.ctxData); break;
-#endif
-#if defined(SUPPORT_FILEFORMAT_OGG)
-        case MUSIC_AUDIO_OGG: stb_vorbis_seek_start((stb_vorbis *)music.ctxData); break;
-#endif
-#if defined(SUPPORT_FILEFORMAT_MP3)
-        case MUSIC_AUDIO_MP3: drmp3_seek_to_start_of_stream((drmp3 *)music.ctxData); break;
-#endif
-#if defined(SUPPORT_FILEFORMAT_QOA)
-        case MUSIC_AUDIO_QOA: qoaplay_rewind((qoaplay_desc *)music.ctxData); break;
-#endif
-#if defined(SUPPORT_FILEFORMAT_FLAC)
-        case MUSIC_AUDIO_FLAC: drflac__seek_to_first_frame((drflac *)music.ctxData); break;
-#endif
-#if defined(SUPPORT_FILEFORMAT_XM)
-        case MUSIC_MODULE_XM: jar_xm_reset((jar_xm_context_t *)music.ctxData); break;
-#endif
-#if defined(SUPPORT_FILEFORMAT_MOD)
-        case MUSIC_MODULE_MOD: jar_mod_seek_start((jar_mod_context_t *)music.ctxData); break;
-#endif
-        default: break;
-    }
+    if (ma_atomic_load_32(&AUDIO.Stream.running)) ma_mutex_unlock(&AUDIO.Stream.lock);
 }
 
 // Seek music to a certain position (in seconds)
@@ -1831,6 +2562,9 @@ void SeekMusicStream(Music music, float position)
 
     unsigned int positionInFrames = (unsigned int)(position*music.stream.sampleRate);
 
+    // NOTE: Decoder is not used by streaming thread until seek command is applied by audio thread
+    if (ma_atomic_load_32(&AUDIO.Stream.running)) ma_mutex_lock(&AUDIO.Stream.lock);
+
     switch (music.ctxType)
     {
 #if defined(SUPPORT_FILEFORMAT_WAV)
@@ -1858,20 +2592,37 @@ void SeekMusicStream(Music music, float position)
         default: break;
     }
 
+    // Stream data queued is discarded by audio thread, refilled on next update
     ma_mutex_lock(&AUDIO.System.lock);
-    music.stream.buffer->framesProcessed = positionInFrames;
-    music.stream.buffer->isSubBufferProcessed[0] = true;
-    music.stream.buffer->isSubBufferProcessed[1] = true;
+    PushAudioCommand((AudioCommand){ .type = AUDIO_COMMAND_SEEK, .buffer = music.stream.buffer, .frames = positionInFrames });
     ma_mutex_unlock(&AUDIO.System.lock);
+
+    if (ma_atomic_load_32(&AUDIO.Stream.running)) ma_mutex_unlock(&AUDIO.Stream.lock);
 }
 
 // Update (re-fill) music buffers if data already processed
+// NOTE: Music streams decoded by streaming thread only get their looping state updated
 void UpdateMusicStream(Music music)
 {
     if (music.stream.buffer == NULL) return;
 
+    if (music.stream.buffer->streamRing != NULL)
+    {
+        // NOTE: Streaming thread keeps music streams lock while decoding, looping state is set without it
+        ma_atomic_store_32(&music.stream.buffer->streamLooping, music.looping);
+
+        return;
+    }
+
     ma_mutex_lock(&AUDIO.System.lock);
 
+    // Stream state is reset by commands not applied yet (play, stop, seek), refilled on next update
+    if (ma_atomic_load_32(&music.stream.buffer->pendingCommands) > 0)
+    {
+        ma_mutex_unlock(&AUDIO.System.lock);
+        return;
+    }
+
     unsigned int subBufferSizeInFrames = music.stream.buffer->sizeInFrames/2;
 
     // On first call of this function we lazily pre-allocated a temp buffer to read audio files/memory data in
@@ -1888,128 +2639,19 @@ void UpdateMusicStream(Music music)
     // Check both sub-buffers to check if they require refilling
     for (int i = 0; i < 2; i++)
     {
-        if (!music.stream.buffer->isSubBufferProcessed[i]) continue; // No refilling required, move to next sub-buffer
+        if (!ma_atomic_load_32(&music.stream.buffer->isSubBufferProcessed[i])) continue; // No refilling required, move to next sub-buffer
 
-        unsigned int framesLeft = music.frameCount - music.stream.buffer->framesProcessed;  // Frames left to be processed
+        unsigned int framesLeft = music.frameCount - ma_atomic_load_32(&music.stream.buffer->framesProcessed);  // Frames left to be processed
         unsigned int framesToStream = 0;                 // Total frames to be streamed
 
         if ((framesLeft >= subBufferSizeInFrames) || music.looping) framesToStream = subBufferSizeInFrames;
         else framesToStream = framesLeft;
 
-        int frameCountStillNeeded = framesToStream;
-        int frameCountReadTotal = 0;
-
-        switch (music.ctxType)
-        {
-        #if defined(SUPPORT_FILEFORMAT_WAV)
-            case MUSIC_AUDIO_WAV:
-            {
-                if (music.stream.sampleSize == 16)
-                {
-                    while (true)
-                    {
-                        int frameCountRead = (int)drwav_read_pcm_frames_s16((drwav *)music.ctxData, frameCountStillNeeded, (short *)((char *)AUDIO.System.pcmBuffer + frameCountReadTotal*frameSize));
-                        frameCountReadTotal += frameCountRead;
-                        frameCountStillNeeded -= frameCountRead;
-                        if (frameCountStillNeeded == 0) break;
-                        else drwav_seek_to_first_pcm_frame((drwav *)music.ctxData);
-                    }
-                }
-                else if (music.stream.sampleSize == 32)
-                {
-                    while (true)
-                    {
-                        int frameCountRead = (int)drwav_read_pcm_frames_f32((drwav *)music.ctxData, frameCountStillNeeded, (float *)((char *)AUDIO.System.pcmBuffer + frameCountReadTotal*frameSize));
-                        frameCountReadTotal += frameCountRead;
-                        frameCountStillNeeded -= frameCountRead;
-                        if (frameCountStillNeeded == 0) break;
-                        else drwav_seek_to_first_pcm_frame((drwav *)music.ctxData);
-                    }
-                }
-            } break;
-        #endif
-        #if defined(SUPPORT_FILEFORMAT_OGG)
-            case MUSIC_AUDIO_OGG:
-            {
-                while (true)
-                {
-                    int frameCountRead = stb_vorbis_get_samples_short_interleaved((stb_vorbis *)music.ctxData, music.stream.channels, (short *)((char *)AUDIO.System.pcmBuffer + frameCountReadTotal*frameSize), frameCountStillNeeded*music.stream.channels);
-                    frameCountReadTotal += frameCountRead;
-                    frameCountStillNeeded -= frameCountRead;
-                    if (frameCountStillNeeded == 0) break;
-                    else stb_vorbis_seek_start((stb_vorbis *)music.ctxData);
-                }
-            } break;
-        #endif
-        #if defined(SUPPORT_FILEFORMAT_MP3)
-            case MUSIC_AUDIO_MP3:
-            {
-                while (true)
-                {
-                    int frameCountRead = (int)drmp3_read_pcm_frames_f32((drmp3 *)music.ctxData, frameCountStillNeeded, (float *)((char *)AUDIO.System.pcmBuffer + frameCountReadTotal*frameSize));
-                    frameCountReadTotal += frameCountRead;
-                    frameCountStillNeeded -= frameCountRead;
-                    if (frameCountStillNeeded == 0) break;
-                    else drmp3_seek_to_start_of_stream((drmp3 *)music.ctxData);
-                }
-            } break;
-        #endif
-        #if defined(SUPPORT_FILEFORMAT_QOA)
-            case MUSIC_AUDIO_QOA:
-            {
-                unsigned int frameCountRead = qoaplay_decode((qoaplay_desc *)music.ctxData, (float *)AUDIO.System.pcmBuffer, framesToStream);
-                frameCountReadTotal += frameCountRead;
-                /*
-                while (true)
-                {
-                    int frameCountRead = (int)qoaplay_decode((qoaplay_desc *)music.ctxData, (float *)((char *)AUDIO.System.pcmBuffer + frameCountReadTotal*frameSize),  frameCountStillNeeded);
-                    frameCountReadTotal += frameCountRead;
-                    frameCountStillNeeded -= frameCountRead;
-                    if (frameCountStillNeeded == 0) break;
-                    else qoaplay_rewind((qoaplay_desc *)music.ctxData);
-                }
-                */
-            } break;
-        #endif
-        #if defined(SUPPORT_FILEFORMAT_FLAC)
-            case MUSIC_AUDIO_FLAC:
-            {
-                while (true)
-                {
-                    int frameCountRead = (int)drflac_read_pcm_frames_s16((drflac *)music.ctxData, frameCountStillNeeded, (short *)((char *)AUDIO.System.pcmBuffer + frameCountReadTotal*frameSize));
-                    frameCountReadTotal += frameCountRead;
-                    frameCountStillNeeded -= frameCountRead;
-                    if (frameCountStillNeeded == 0) break;
-                    else drflac__seek_to_first_frame((drflac *)music.ctxData);
-                }
-            } break;
-        #endif
-        #if defined(SUPPORT_FILEFORMAT_XM)
-            case MUSIC_MODULE_XM:
-            {
-                // NOTE: Internally we consider 2 channels generation, so sampleCount/2
-                if (AUDIO_DEVICE_FORMAT == ma_format_f32) jar_xm_generate_samples((jar_xm_context_t *)music.ctxData, (float *)AUDIO.System.pcmBuffer, framesToStream);
-                else if (AUDIO_DEVICE_FORMAT == ma_format_s16) jar_xm_generate_samples_16bit((jar_xm_context_t *)music.ctxData, (short *)AUDIO.System.pcmBuffer, framesToStream);
-                else if (AUDIO_DEVICE_FORMAT == ma_format_u8) jar_xm_generate_samples_8bit((jar_xm_context_t *)music.ctxData, (char *)AUDIO.System.pcmBuffer, framesToStream);
-                //jar_xm_reset((jar_xm_context_t *)music.ctxData);
-
-            } break;
-        #endif
-        #if defined(SUPPORT_FILEFORMAT_MOD)
-            case MUSIC_MODULE_MOD:
-            {
-                // NOTE: 3rd parameter (nbsample) specify the number of stereo 16bits samples you want, so sampleCount/2
-                jar_mod_fillbuffer((jar_mod_context_t *)music.ctxData, (short *)AUDIO.System.pcmBuffer, framesToStream, 0);
-                //jar_mod_seek_start((jar_mod_context_t *)music.ctxData);
-
-            } break;
-        #endif
-            default: break;
-        }
+        ReadMusicFrames(music, AUDIO.System.pcmBuffer, framesToStream);
 
         UpdateAudioStreamInLockedState(music.stream, AUDIO.System.pcmBuffer, framesToStream);
 
-        music.stream.buffer->framesProcessed = music.stream.buffer->framesProcessed%music.frameCount;
+        AddAudioBufferFramesProcessed(music.stream.buffer, 0, music.frameCount);
 
         if (framesLeft <= subBufferSizeInFrames)
         {
@@ -2077,13 +2719,24 @@ float GetMusicTimePlayed(Music music)
         else
 #endif
         {
+            // NOTE: Stream state is updated by audio thread, values read could be one period apart
             ma_mutex_lock(&AUDIO.System.lock);
+            if (music.stream.buffer->streamRing != NULL)
+            {
+                // Frames decoded not played yet are still in stream ring
+                int framesPlayed = ((int)ma_atomic_load_32(&music.stream.buffer->framesProcessed) - (int)ma_pcm_rb_available_read(music.stream.buffer->streamRing))%(int)music.frameCount;
+                if (framesPlayed < 0) framesPlayed += music.frameCount;
+                secondsPlayed = (float)framesPlayed/music.stream.sampleRate;
+                ma_mutex_unlock(&AUDIO.System.lock);
+                return secondsPlayed;
+            }
+
             //ma_uint32 frameSizeInBytes = ma_get_bytes_per_sample(music.stream.buffer->dsp.formatConverterIn.config.formatIn)*music.stream.buffer->dsp.formatConverterIn.config.channels;
-            int framesProcessed = (int)music.stream.buffer->framesProcessed;
+            int framesProcessed = (int)ma_atomic_load_32(&music.stream.buffer->framesProcessed);
             int subBufferSize = (int)music.stream.buffer->sizeInFrames/2;
-            int framesInFirstBuffer = music.stream.buffer->isSubBufferProcessed[0]? 0 : subBufferSize;
-            int framesInSecondBuffer = music.stream.buffer->isSubBufferProcessed[1]? 0 : subBufferSize;
-            int framesSentToMix = music.stream.buffer->frameCursorPos%subBufferSize;
+            int framesInFirstBuffer = ma_atomic_load_32(&music.stream.buffer->isSubBufferProcessed[0])? 0 : subBufferSize;
+            int framesInSecondBuffer = ma_atomic_load_32(&music.stream.buffer->isSubBufferProcessed[1])? 0 : subBufferSize;
+            int framesSentToMix = ma_atomic_load_32(&music.stream.buffer->frameCursorPos)%subBufferSize;
             int framesPlayed = (framesProcessed - framesInFirstBuffer - framesInSecondBuffer + framesSentToMix)%(int)music.frameCount;
             if (framesPlayed < 0) framesPlayed += music.frameCount;
             secondsPlayed = (float)framesPlayed/music.stream.sampleRate;
@@ -2153,6 +2806,7 @@ void UnloadAudioStream(AudioStream stream)
 void UpdateAudioStream(AudioStream stream, const void *data, int frameCount)
 {
     ma_mutex_lock(&AUDIO.System.lock);
+    if (stream.buffer != NULL) WaitAudioBufferCommands(stream.buffer);     // Stream state could be reset by commands pending
     UpdateAudioStreamInLockedState(stream, data, frameCount);
     ma_mutex_unlock(&AUDIO.System.lock);
 }
@@ -2164,7 +2818,8 @@ bool IsAudioStreamProcessed(AudioStream stream)
 
     bool result = false;
     ma_mutex_lock(&AUDIO.System.lock);
-    result = stream.buffer->isSubBufferProcessed[0] || stream.buffer->isSubBufferProcessed[1];
+    result = (ma_atomic_load_32(&stream.buffer->pendingCommands) == 0) &&
+        (ma_atomic_load_32(&stream.buffer->isSubBufferProcessed[0]) || ma_atomic_load_32(&stream.buffer->isSubBufferProcessed[1]));
     ma_mutex_unlock(&AUDIO.System.lock);
     return result;
 }
@@ -2229,7 +2884,7 @@ void SetAudioStreamCallback(AudioStream stream, AudioCallback callback)
     if (stream.buffer != NULL)
     {
         ma_mutex_lock(&AUDIO.System.lock);
-        stream.buffer->callback = callback;
+        PushAudioCommand((AudioCommand){ .type = AUDIO_COMMAND_CALLBACK, .buffer = stream.buffer, .callback = callback });
         ma_mutex_unlock(&AUDIO.System.lock);
     }
 }
@@ -2244,18 +2899,7 @@ void AttachAudioStreamProcessor(AudioStream stream, AudioCallback process)
     rAudioProcessor *processor = (rAudioProcessor *)RL_CALLOC(1, sizeof(rAudioProcessor));
     processor->process = process;
 
-    rAudioProcessor *last = stream.buffer->processor;
-
-    while (last && last->next)
-    {
-        last = last->next;
-    }
-    if (last)
-    {
-        processor->prev = last;
-        last->next = processor;
-    }
-    else stream.buffer->processor = processor;
+    PushAudioCommand((AudioCommand){ .type = AUDIO_COMMAND_ATTACH_PROCESSOR, .buffer = stream.buffer, .processor = processor });
 
     ma_mutex_unlock(&AUDIO.System.lock);
 }
@@ -2264,26 +2908,7 @@ void AttachAudioStreamProcessor(AudioStream stream, AudioCallback process)
 void DetachAudioStreamProcessor(AudioStream stream, AudioCallback process)
 {
     ma_mutex_lock(&AUDIO.System.lock);
-
-    rAudioProcessor *processor = stream.buffer->processor;
-
-    while (processor)
-    {
-        rAudioProcessor *next = processor->next;
-        rAudioProcessor *prev = processor->prev;
-
-        if (processor->process == process)
-        {
-            if (stream.buffer->processor == processor) stream.buffer->processor = next;
-            if (prev) prev->next = next;
-            if (next) next->prev = prev;
-
-            RL_FREE(processor);
-        }
-
-        processor = next;
-    }
-
+    PushAudioCommand((AudioCommand){ .type = AUDIO_COMMAND_DETACH_PROCESSOR, .buffer = stream.buffer, .callback = process });
     ma_mutex_unlock(&AUDIO.System.lock);
 }
 
@@ -2297,18 +2922,7 @@ void AttachAudioMixedProcessor(AudioCallback process)
     rAudioProcessor *processor = (rAudioProcessor *)RL_CALLOC(1, sizeof(rAudioProcessor));
     processor->process = process;
 
-    rAudioProcessor *last = AUDIO.mixedProcessor;
-
-    while (last && last->next)
-    {
-        last = last->next;
-    }
-    if (last)
-    {
-        processor->prev = last;
-        last->next = processor;
-    }
-    else AUDIO.mixedProcessor = processor;
+    PushAudioCommand((AudioCommand){ .type = AUDIO_COMMAND_ATTACH_PROCESSOR, .buffer = NULL, .processor = processor });
 
     ma_mutex_unlock(&AUDIO.System.lock);
 }
@@ -2317,29 +2931,9 @@ void AttachAudioMixedProcessor(AudioCallback process)
 void DetachAudioMixedProcessor(AudioCallback process)
 {
     ma_mutex_lock(&AUDIO.System.lock);
-
-    rAudioProcessor *processor = AUDIO.mixedProcessor;
-
-    while (processor)
-    {
-        rAudioProcessor *next = processor->next;
-        rAudioProcessor *prev = processor->prev;
-
-        if (processor->process == process)
-        {
-            if (AUDIO.mixedProcessor == processor) AUDIO.mixedProcessor = next;
-            if (prev) prev->next = next;
-            if (next) next->prev = prev;
-
-            RL_FREE(processor);
-        }
-
-        processor = next;
-    }
-
-    ma_mutex_unlock(&AUDIO.System.lock);
-}
-
+    PushAudioCommand((AudioCommand){ .type = AUDIO_COMMAND_DETACH_PROCESSOR, .buffer = NULL, .callback = process });
+    ma_mutex_unlock(&AUDIO.System.lock);
+}
 
 //----------------------------------------------------------------------------------
 // Module specific Functions Definition
@@ -2358,11 +2952,14 @@ static ma_uint32 ReadAudioBufferFramesInInternalFormat(AudioBuffer *audioBuffer,
     if (audioBuffer->callback)
     {
         audioBuffer->callback(framesOut, frameCount);
-        audioBuffer->framesProcessed += frameCount;
+        AddAudioBufferFramesProcessed(audioBuffer, frameCount, 0);
 
         return frameCount;
     }
 
+    // Using music frames decoded ahead by streaming thread
+    if (audioBuffer->streamRing != NULL) return ReadMusicStreamRing(audioBuffer, framesOut, frameCount);
+
     ma_uint32 subBufferSizeInFrames = (audioBuffer->sizeInFrames > 1)? audioBuffer->sizeInFrames/2 : audioBuffer->sizeInFrames;
     ma_uint32 currentSubBufferIndex = audioBuffer->frameCursorPos/subBufferSizeInFrames;
 
@@ -2371,8 +2968,8 @@ static ma_uint32 ReadAudioBufferFramesInInternalFormat(AudioBuffer *audioBuffer,
     // Another thread can update the processed state of buffers, so
     // we just take a copy here to try and avoid potential synchronization problems
     bool isSubBufferProcessed[2] = { 0 };
-    isSubBufferProcessed[0] = audioBuffer->isSubBufferProcessed[0];
-    isSubBufferProcessed[1] = audioBuffer->isSubBufferProcessed[1];
+    isSubBufferProcessed[0] = ma_atomic_load_32(&audioBuffer->isSubBufferProcessed[0]);
+    isSubBufferProcessed[1] = ma_atomic_load_32(&audioBuffer->isSubBufferProcessed[1]);
 
     ma_uint32 frameSizeInBytes = ma_get_bytes_per_frame(audioBuffer->converter.formatIn, audioBuffer->converter.channelsIn);
 
@@ -2411,13 +3008,14 @@ static ma_uint32 ReadAudioBufferFramesInInternalFormat(AudioBuffer *audioBuffer,
         if (framesToRead > framesRemainingInOutputBuffer) framesToRead = framesRemainingInOutputBuffer;
 
         memcpy((unsigned char *)framesOut + (framesRead*frameSizeInBytes), audioBuffer->data + (audioBuffer->frameCursorPos*frameSizeInBytes), framesToRead*frameSizeInBytes);
-        audioBuffer->frameCursorPos = (audioBuffer->frameCursorPos + framesToRead)%audioBuffer->sizeInFrames;
+        ma_atomic_store_32(&audioBuffer->frameCursorPos, (audioBuffer->frameCursorPos + framesToRead)%audioBuffer->sizeInFrames);
         framesRead += framesToRead;
+        audioBuffer->streamPrimed = true;
 
         // If we've read to the end of the buffer, mark it as processed
         if (framesToRead == framesRemainingInOutputBuffer)
         {
-            audioBuffer->isSubBufferProcessed[currentSubBufferIndex] = true;
+            ma_atomic_store_32(&audioBuffer->isSubBufferProcessed[currentSubBufferIndex], true);
             isSubBufferProcessed[currentSubBufferIndex] = true;
 
             currentSubBufferIndex = (currentSubBufferIndex + 1)%2;
@@ -2425,7 +3023,7 @@ static ma_uint32 ReadAudioBufferFramesInInternalFormat(AudioBuffer *audioBuffer,
             // We need to break from this loop if we're not looping
             if (!audioBuffer->looping)
             {
-                StopAudioBufferInLockedState(audioBuffer);
+                StopAudioVoice(audioBuffer);
                 break;
             }
         }
@@ -2437,6 +3035,9 @@ static ma_uint32 ReadAudioBufferFramesInInternalFormat(AudioBuffer *audioBuffer,
     {
         memset((unsigned char *)framesOut + (framesRead*frameSizeInBytes), 0, totalFramesRemaining*frameSizeInBytes);
 
+        // Stream playing ran out of data, it was not refilled in time
+        if ((audioBuffer->usage == AUDIO_BUFFER_USAGE_STREAM) && audioBuffer->playing) RecordStreamUnderrun(audioBuffer);
+
         // For static buffers we can fill the remaining frames with silence for safety, but we don't want
         // to report those frames as "read". The reason for this is that the caller uses the return value
         // to know whether a non-looping sound has finished playback
@@ -2453,9 +3054,37 @@ static ma_uint32 ReadAudioBufferFramesInMixingFormat(AudioBuffer *audioBuffer, f
     // should be defined by the output format of the data converter. We do this until frameCount frames have been output. The important
     // detail to remember here is that we never, ever attempt to read more input data than is required for the specified number of output
     // frames. This can be achieved with ma_data_converter_get_required_input_frame_count()
-    ma_uint8 inputBuffer[4096] = { 0 };
+    // NOTE: Input buffer is always filled by ReadAudioBufferFramesInInternalFormat(), no need to clear it
+    ma_uint8 inputBuffer[4096];
     ma_uint32 inputBufferFrameCap = sizeof(inputBuffer)/ma_get_bytes_per_frame(audioBuffer->converter.formatIn, audioBuffer->converter.channelsIn);
 
+    // Buffers with device channels and sample rate, not pitched, bypass the converter
+    // NOTE: Sounds are converted to device format on loading, so they are read directly in mixing format
+    if ((audioBuffer->converter.formatOut == ma_format_f32) && (audioBuffer->pitch == 1.0f) &&
+        (audioBuffer->converter.channelsIn == audioBuffer->converter.channelsOut) &&
+        (audioBuffer->converter.sampleRateIn == audioBuffer->converter.sampleRateOut))
+    {
+        if (audioBuffer->converter.formatIn == ma_format_f32) return ReadAudioBufferFramesInInternalFormat(audioBuffer, framesOut, frameCount);
+
+        if (audioBuffer->converter.formatIn == ma_format_s16)
+        {
+            ma_uint32 totalFramesRead = 0;
+            while (totalFramesRead < frameCount)
+            {
+                ma_uint32 framesToRead = frameCount - totalFramesRead;
+                if (framesToRead > inputBufferFrameCap) framesToRead = inputBufferFrameCap;
+
+                ma_uint32 framesRead = ReadAudioBufferFramesInInternalFormat(audioBuffer, inputBuffer, framesToRead);
+                ConvertAudioSamplesS16ToF32(framesOut + (totalFramesRead*audioBuffer->converter.channelsOut), (const short *)inputBuffer, framesRead*audioBuffer->converter.channelsIn);
+                totalFramesRead += framesRead;
+
+                if (framesRead < framesToRead) break;  // Ran out of input data
+            }
+
+            return totalFramesRead;
+        }
+    }
+
     ma_uint32 totalOutputFramesProcessed = 0;
     while (totalOutputFramesProcessed < frameCount)
     {
@@ -2494,18 +3123,38 @@ static void OnSendAudioDataToDevice(ma_device *pDevice, void *pFramesOut, const
 {
     (void)pDevice;
 
+#if defined(SUPPORT_AUDIO_STATS)
+    double callbackStart = GetAudioStatsTime();
+#endif
+
     // Mixing is basically just an accumulation, we need to initialize the output buffer to 0
     memset(pFramesOut, 0, frameCount*pDevice->playback.channels*ma_get_bytes_per_sample(pDevice->playback.format));
 
-    // Using a mutex here for thread-safety which makes things not real-time
-    // This is unlikely to be necessary for this project, but may want to consider how you might want to avoid this
-    ma_mutex_lock(&AUDIO.System.lock);
+    // Commands queued by program threads are applied first, mixer state is only modified here
+    // NOTE: No lock is taken, the audio thread never waits for program threads (real-time)
+    ProcessAudioCommands();
     {
-        for (AudioBuffer *audioBuffer = AUDIO.Buffer.first; audioBuffer != NULL; audioBuffer = audioBuffer->next)
+        // NOTE: Temp buffer is always filled before mixing, no need to clear it
+        float tempBuffer[1024];     // Frames for stereo
+
+        // Voices are mixed backwards, a voice stopped is replaced by the last one (already mixed)
+        for (int i = AUDIO.Mixer.voiceCount - 1; i >= 0; i--)
         {
-            // Ignore stopped or paused sounds
-            if (!audioBuffer->playing || audioBuffer->paused) continue;
+            AudioBuffer *audioBuffer = AUDIO.Mixer.voices[i];
+
+            // Ignore paused sounds
+            if (audioBuffer->paused) continue;
+
+            // Culled sounds keep playing without being mixed (virtual voices)
+            if (audioBuffer->culled)
+            {
+                AdvanceAudioVoice(audioBuffer, frameCount);
+                continue;
+            }
 
+#if defined(SUPPORT_AUDIO_STATS)
+            double voiceStart = GetAudioStatsTime();
+#endif
             ma_uint32 framesRead = 0;
 
             while (1)
@@ -2517,8 +3166,6 @@ static void OnSendAudioDataToDevice(ma_device *pDevice, void *pFramesOut, const
 
                 while (framesToRead > 0)
                 {
-                    float tempBuffer[1024] = { 0 }; // Frames for stereo
-
                     ma_uint32 framesToReadRightNow = framesToRead;
                     if (framesToReadRightNow > sizeof(tempBuffer)/sizeof(tempBuffer[0])/AUDIO_DEVICE_CHANNELS)
                     {
@@ -2556,14 +3203,14 @@ static void OnSendAudioDataToDevice(ma_device *pDevice, void *pFramesOut, const
                     {
                         if (!audioBuffer->looping)
                         {
-                            StopAudioBufferInLockedState(audioBuffer);
+                            StopAudioVoice(audioBuffer);
                             break;
                         }
                         else
                         {
                             // Should never get here, but just for safety,
                             // move the cursor position back to the start and continue the loop
-                            audioBuffer->frameCursorPos = 0;
+                            ma_atomic_store_32(&audioBuffer->frameCursorPos, 0);
                             continue;
                         }
                     }
@@ -2573,6 +3220,9 @@ static void OnSendAudioDataToDevice(ma_device *pDevice, void *pFramesOut, const
                 // Not doing this could theoretically put us into an infinite loop
                 if (framesToRead > 0) break;
             }
+#if defined(SUPPORT_AUDIO_STATS)
+            RecordAudioVoice(voiceStart, GetAudioStatsTime());
+#endif
         }
     }
 
@@ -2583,7 +3233,11 @@ static void OnSendAudioDataToDevice(ma_device *pDevice, void *pFramesOut, const
         processor = processor->next;
     }
 
-    ma_mutex_unlock(&AUDIO.System.lock);
+    ma_atomic_fetch_add_32(&AUDIO.Mixer.framesMixed, frameCount);
+
+#if defined(SUPPORT_AUDIO_STATS)
+    RecordAudioCallback(callbackStart, GetAudioStatsTime(), frameCount);
+#endif
 }
 
 // Main mixing function, pretty simple in this project, just an accumulation
@@ -2601,59 +3255,937 @@ static void MixAudioFrames(float *framesOut, const float *framesIn, ma_uint32 fr
         // Fast sine approximation in [0..1] for pan law: y = 0.5f*x*(3 - x*x);
         const float levels[2] = { localVolume*0.5f*left*(3.0f - left*left), localVolume*0.5f*right*(3.0f - right*right) };
 
-        float *frameOut = framesOut;
-        const float *frameIn = framesIn;
+        MixAudioSamples(framesOut, framesIn, frameCount*2, levels);
+    }
+    else  // We do not consider panning
+    {
+        // Output accumulates input multiplied by volume to provided output (usually 0)
+        const float levels[2] = { localVolume, localVolume };
 
-        for (ma_uint32 frame = 0; frame < frameCount; frame++)
-        {
-            frameOut[0] += (frameIn[0]*levels[0]);
-            frameOut[1] += (frameIn[1]*levels[1]);
+        MixAudioSamples(framesOut, framesIn, frameCount*channels, levels);
+    }
+}
+
+// Accumulate samples multiplied by level, levels alternate for even and odd samples (stereo left and right)
+static void MixAudioSamples(float *samplesOut, const float *samplesIn, ma_uint32 sampleCount, const float levels[2])
+{
+    ma_uint32 i = 0;
+
+#if defined(RAUDIO_SIMD)
+    // Even sample count per vector, lanes keep left/right levels order
+    const float levelsVec[4] = { levels[0], levels[1], levels[0], levels[1] };
+    const raVec4 level = RAVEC_LOAD(levelsVec);
+
+    for (; (i + 8) <= sampleCount; i += 8)
+    {
+        raVec4 out0 = RAVEC_ADD(RAVEC_LOAD(samplesOut + i), RAVEC_MUL(RAVEC_LOAD(samplesIn + i), level));
+        raVec4 out1 = RAVEC_ADD(RAVEC_LOAD(samplesOut + i + 4), RAVEC_MUL(RAVEC_LOAD(samplesIn + i + 4), level));
+        RAVEC_STORE(samplesOut + i, out0);
+        RAVEC_STORE(samplesOut + i + 4, out1);
+    }
 
-            frameOut += 2;
-            frameIn += 2;
+    for (; (i + 4) <= sampleCount; i += 4)
+    {
+        RAVEC_STORE(samplesOut + i, RAVEC_ADD(RAVEC_LOAD(samplesOut + i), RAVEC_MUL(RAVEC_LOAD(samplesIn + i), level)));
+    }
+#endif
+
+    for (; i < sampleCount; i++) samplesOut[i] += (samplesIn[i]*levels[i%2]);
+}
+
+// Compute emitters attenuation, pan, doppler pitch, distance and facing relative to listener (AUDIO.System.lock locked)
+// NOTE: Batch arrays are padded to a multiple of 4 emitters, extra lanes results are not used
+static void SpatializeAudioBatch(AudioSpatialBatch *batch, int count)
+{
+    const float *position = AUDIO.Spatial.position;
+    const float *forward = AUDIO.Spatial.forward;
+    const float *right = AUDIO.Spatial.right;
+    const float refDistance = AUDIO.Spatial.refDistance;
+    const float maxDistance = AUDIO.Spatial.maxDistance;
+    const float rolloff = AUDIO.Spatial.rolloff;
+    const float speed = AUDIO_SPATIAL_SPEED_OF_SOUND;
+    const float doppler = AUDIO.Spatial.dopplerFactor;
+
+    int i = 0;
+
+#if defined(RAUDIO_SIMD) && defined(RAVEC_SQRT)
+    const raVec4 px = RAVEC_SET1(position[0]), py = RAVEC_SET1(position[1]), pz = RAVEC_SET1(position[2]);
+    const raVec4 fx = RAVEC_SET1(forward[0]), fy = RAVEC_SET1(forward[1]), fz = RAVEC_SET1(forward[2]);
+    const raVec4 rx = RAVEC_SET1(right[0]), ry = RAVEC_SET1(right[1]), rz = RAVEC_SET1(right[2]);
+    const raVec4 minDistanceSqr = RAVEC_SET1(1e-6f), ref = RAVEC_SET1(refDistance), max = RAVEC_SET1(maxDistance);
+    const raVec4 roll = RAVEC_SET1(rolloff), half = RAVEC_SET1(0.5f), one = RAVEC_SET1(1.0f);
+    const raVec4 c = RAVEC_SET1(speed), cMin = RAVEC_SET1(speed*0.5f), cMax = RAVEC_SET1(speed*2.0f), dop = RAVEC_SET1(doppler);
+
+    for (; i < count; i += 4)
+    {
+        raVec4 dx = RAVEC_SUB(RAVEC_LOAD(batch->x + i), px);
+        raVec4 dy = RAVEC_SUB(RAVEC_LOAD(batch->y + i), py);
+        raVec4 dz = RAVEC_SUB(RAVEC_LOAD(batch->z + i), pz);
+
+        raVec4 distance = RAVEC_SQRT(RAVEC_MAX(RAVEC_ADD(RAVEC_ADD(RAVEC_MUL(dx, dx), RAVEC_MUL(dy, dy)), RAVEC_MUL(dz, dz)), minDistanceSqr));
+        raVec4 invDistance = RAVEC_DIV(one, distance);
+
+        raVec4 clamped = RAVEC_MIN(RAVEC_MAX(distance, ref), max);
+        raVec4 attenuation = RAVEC_DIV(ref, RAVEC_ADD(ref, RAVEC_MUL(roll, RAVEC_SUB(clamped, ref))));
+
+        raVec4 side = RAVEC_MUL(RAVEC_ADD(RAVEC_ADD(RAVEC_MUL(dx, rx), RAVEC_MUL(dy, ry)), RAVEC_MUL(dz, rz)), invDistance);
+        raVec4 facing = RAVEC_MUL(RAVEC_ADD(RAVEC_ADD(RAVEC_MUL(dx, fx), RAVEC_MUL(dy, fy)), RAVEC_MUL(dz, fz)), invDistance);
+        raVec4 radial = RAVEC_MUL(RAVEC_ADD(RAVEC_ADD(RAVEC_MUL(RAVEC_LOAD(batch->vx + i), dx), RAVEC_MUL(RAVEC_LOAD(batch->vy + i), dy)), RAVEC_MUL(RAVEC_LOAD(batch->vz + i), dz)), invDistance);
+        raVec4 shift = RAVEC_DIV(c, RAVEC_MIN(RAVEC_MAX(RAVEC_ADD(c, RAVEC_MUL(dop, radial)), cMin), cMax));
+
+        RAVEC_STORE(batch->volume + i, RAVEC_MUL(RAVEC_LOAD(batch->volume + i), attenuation));
+        RAVEC_STORE(batch->pan + i, RAVEC_SUB(half, RAVEC_MUL(half, side)));
+        RAVEC_STORE(batch->pitch + i, RAVEC_MUL(RAVEC_LOAD(batch->pitch + i), shift));
+        RAVEC_STORE(batch->distance + i, distance);
+        RAVEC_STORE(batch->facing + i, facing);
+    }
+#endif
+
+    for (; i < count; i++)
+    {
+        float dx = batch->x[i] - position[0];
+        float dy = batch->y[i] - position[1];
+        float dz = batch->z[i] - position[2];
+
+        float distanceSqr = dx*dx + dy*dy + dz*dz;
+        float distance = sqrtf((distanceSqr > 1e-6f)? distanceSqr : 1e-6f);
+        float invDistance = 1.0f/distance;
+
+        float clamped = (distance > refDistance)? distance : refDistance;
+        if (clamped > maxDistance) clamped = maxDistance;
+        float attenuation = refDistance/(refDistance + rolloff*(clamped - refDistance));
+
+        float side = (dx*right[0] + dy*right[1] + dz*right[2])*invDistance;
+        float facing = (dx*forward[0] + dy*forward[1] + dz*forward[2])*invDistance;
+        float radial = (batch->vx[i]*dx + batch->vy[i]*dy + batch->vz[i]*dz)*invDistance;
+        float denominator = speed + doppler*radial;
+        if (denominator < speed*0.5f) denominator = speed*0.5f;
+        if (denominator > speed*2.0f) denominator = speed*2.0f;
+
+        // Pan 1.0 is left channel (MixAudioFrames), emitters on listener right move towards 0.0
+        batch->volume[i] *= attenuation;
+        batch->pan[i] = 0.5f - 0.5f*side;
+        batch->pitch[i] *= speed/denominator;
+        batch->distance[i] = distance;
+        batch->facing[i] = facing;
+    }
+}
+
+// Get emitter spatialization computed in batch, emitters inaudible or out of listener view are culled
+static AudioSpatial GetAudioSpatial(const AudioSpatialBatch *batch, int index)
+{
+    AudioSpatial spatial = { .volume = batch->volume[index], .pan = batch->pan[index], .pitch = batch->pitch[index] };
+    spatial.culled = (spatial.volume < AUDIO_SPATIAL_CULL_VOLUME) ||
+        ((batch->distance[index] > AUDIO.Spatial.refDistance) && (batch->facing[index] < AUDIO.Spatial.viewCos));
+
+    return spatial;
+}
+
+// Check if spatialization changed audibly, culling changes always
+static bool IsAudioSpatialChanged(const AudioSpatial *spatial, const AudioSpatial *other)
+{
+    return ((spatial->culled != other->culled) ||
+            (fabsf(spatial->volume - other->volume) > 0.001f) ||
+            (fabsf(spatial->pan - other->pan) > 0.001f) ||
+            (fabsf(spatial->pitch - other->pitch) > 0.001f));
+}
+
+// Convert samples from 16 bit signed integer to float, same scale as miniaudio converter
+static void ConvertAudioSamplesS16ToF32(float *samplesOut, const short *samplesIn, ma_uint32 sampleCount)
+{
+    const float scale = 1.0f/32768.0f;
+    ma_uint32 i = 0;
+
+#if defined(RAUDIO_SIMD)
+    const raVec4 scaleVec = RAVEC_SET1(scale);
+
+    for (; (i + 4) <= sampleCount; i += 4) RAVEC_STORE(samplesOut + i, RAVEC_MUL(RAVEC_LOAD_S16(samplesIn + i), scaleVec));
+#endif
+
+    for (; i < sampleCount; i++) samplesOut[i] = (float)samplesIn[i]*scale;
+}
+
+// Push command to queue, false if full
+// NOTE: Single producer, single consumer, command is published once written
+static bool PushAudioQueue(AudioCommandQueue *queue, const AudioCommand *command)
+{
+    ma_uint32 tail = queue->tail;
+
+    if ((tail - ma_atomic_load_32(&queue->head)) >= AUDIO_COMMAND_QUEUE_SIZE) return false;
+
+    queue->items[tail & (AUDIO_COMMAND_QUEUE_SIZE - 1)] = *command;
+    ma_atomic_store_32(&queue->tail, tail + 1);
+
+    return true;
+}
+
+// Pop command from queue, false if empty
+static bool PopAudioQueue(AudioCommandQueue *queue, AudioCommand *command)
+{
+    ma_uint32 head = queue->head;
+
+    if (head == ma_atomic_load_32(&queue->tail)) return false;
+
+    *command = queue->items[head & (AUDIO_COMMAND_QUEUE_SIZE - 1)];
+    ma_atomic_store_32(&queue->head, head + 1);
+
+    return true;
+}
+
+// Queue command to audio thread, assuming the audio system mutex has been locked
+// NOTE: Without audio device running, command is applied immediately
+static void PushAudioCommand(AudioCommand command)
+{
+    if (command.buffer != NULL) ma_atomic_fetch_add_32(&command.buffer->pendingCommands, 1);
+
+    if (AUDIO.System.isReady)
+    {
+        while (!PushAudioQueue(&AUDIO.Mixer.commands, &command))
+        {
+            // Queue full, commands are applied by the audio thread every period
+            WaitAudioThread();
         }
     }
-    else  // We do not consider panning
+    else ApplyAudioCommand(&command);
+
+    FreeAudioResources();
+}
+
+// Apply commands queued (audio thread)
+static void ProcessAudioCommands(void)
+{
+    AudioCommand command = { 0 };
+
+    while (PopAudioQueue(&AUDIO.Mixer.commands, &command)) ApplyAudioCommand(&command);
+}
+
+// Apply command to mixer state (audio thread)
+static void ApplyAudioCommand(const AudioCommand *command)
+{
+    AudioBuffer *buffer = command->buffer;
+
+    switch (command->type)
     {
-        for (ma_uint32 frame = 0; frame < frameCount; frame++)
+        case AUDIO_COMMAND_PLAY:
         {
-            for (ma_uint32 c = 0; c < channels; c++)
+            if ((buffer->voiceIndex < 0) && (AUDIO.Mixer.voiceCount < MAX_AUDIO_VOICES))
             {
-                float *frameOut = framesOut + (frame*channels);
-                const float *frameIn = framesIn + (frame*channels);
+                buffer->voiceIndex = AUDIO.Mixer.voiceCount;
+                AUDIO.Mixer.voices[AUDIO.Mixer.voiceCount] = buffer;
+                AUDIO.Mixer.voiceCount++;
+            }
+
+            // NOTE: Buffer is not played if all mixer voices are in use
+            ma_atomic_store_8((ma_uint8 *)&buffer->playing, (buffer->voiceIndex >= 0));
+            ma_atomic_store_8((ma_uint8 *)&buffer->paused, false);
+            ma_atomic_store_32(&buffer->frameCursorPos, 0);
+            ma_atomic_store_32(&buffer->framesProcessed, 0);
+            ma_atomic_store_32(&buffer->isSubBufferProcessed[0], true);
+            ma_atomic_store_32(&buffer->isSubBufferProcessed[1], true);
+            DiscardMusicStreamRing(buffer);
+        } break;
+        case AUDIO_COMMAND_STOP: StopAudioVoice(buffer); break;
+        case AUDIO_COMMAND_PAUSE: ma_atomic_store_8((ma_uint8 *)&buffer->paused, true); break;
+        case AUDIO_COMMAND_RESUME: ma_atomic_store_8((ma_uint8 *)&buffer->paused, false); break;
+        case AUDIO_COMMAND_VOLUME: buffer->volume = command->value; break;
+        case AUDIO_COMMAND_PITCH: SetAudioVoicePitch(buffer, command->value); break;
+        case AUDIO_COMMAND_PAN: buffer->pan = command->value; break;
+        case AUDIO_COMMAND_SEEK:
+        {
+            ma_atomic_store_32(&buffer->frameCursorPos, 0);
+            ma_atomic_store_32(&buffer->framesProcessed, command->frames);
+            ma_atomic_store_32(&buffer->isSubBufferProcessed[0], true);
+            ma_atomic_store_32(&buffer->isSubBufferProcessed[1], true);
+            DiscardMusicStreamRing(buffer);
+        } break;
+        case AUDIO_COMMAND_CALLBACK: buffer->callback = command->callback; break;
+        case AUDIO_COMMAND_SET_DATA:
+        {
+            ma_atomic_store_8((ma_uint8 *)&buffer->paused, false);
+            StopAudioVoice(buffer);
+            ma_data_converter_reset(&buffer->converter);
+
+            buffer->data = command->data;
+            buffer->sizeInFrames = command->frames;
+        } break;
+        case AUDIO_COMMAND_SPATIAL:
+        {
+            buffer->volume = command->spatial.volume;
+            buffer->pan = command->spatial.pan;
+            if (buffer->pitch != command->spatial.pitch) SetAudioVoicePitch(buffer, command->spatial.pitch);
+
+            // NOTE: Only static buffers playback can be advanced without reading them
+            buffer->culled = (command->spatial.culled && (buffer->usage == AUDIO_BUFFER_USAGE_STATIC) && (buffer->callback == NULL));
+        } break;
+        case AUDIO_COMMAND_ATTACH_PROCESSOR:
+        {
+            rAudioProcessor **first = (buffer != NULL)? &buffer->processor : &AUDIO.mixedProcessor;
+            rAudioProcessor *last = *first;
+
+            while (last && last->next) last = last->next;
+
+            if (last)
+            {
+                command->processor->prev = last;
+                last->next = command->processor;
+            }
+            else *first = command->processor;
+        } break;
+        case AUDIO_COMMAND_DETACH_PROCESSOR:
+        {
+            rAudioProcessor **first = (buffer != NULL)? &buffer->processor : &AUDIO.mixedProcessor;
+            rAudioProcessor *processor = *first;
+
+            while (processor)
+            {
+                rAudioProcessor *next = processor->next;
+                rAudioProcessor *prev = processor->prev;
+
+                if (processor->process == command->callback)
+                {
+                    if (*first == processor) *first = next;
+                    if (prev) prev->next = next;
+                    if (next) next->prev = prev;
 
-                // Output accumulates input multiplied by volume to provided output (usually 0)
-                frameOut[c] += (frameIn[c]*localVolume);
+                    ReleaseAudioResource(&(AudioCommand){ .type = AUDIO_COMMAND_DETACH_PROCESSOR, .processor = processor });
+                }
+
+                processor = next;
             }
+        } break;
+        case AUDIO_COMMAND_RELEASE:
+        {
+            RemoveAudioVoice(buffer);
+            ReleaseAudioResource(command);
+        } return;   // Buffer is not accessed any more
+        default: break;
+    }
+
+    if (buffer != NULL) ma_atomic_fetch_sub_32(&buffer->pendingCommands, 1);
+}
+
+// Return buffer or processor released to program threads, freed there (audio thread)
+static void ReleaseAudioResource(const AudioCommand *command)
+{
+    if (!PushAudioQueue(&AUDIO.Mixer.released, command)) FreeAudioResource(command);
+}
+
+// Free buffers and processors released, assuming the audio system mutex has been locked
+static void FreeAudioResources(void)
+{
+    AudioCommand command = { 0 };
+
+    while (PopAudioQueue(&AUDIO.Mixer.released, &command)) FreeAudioResource(&command);
+}
+
+// Free buffer or processor released
+static void FreeAudioResource(const AudioCommand *command)
+{
+    if (command->type == AUDIO_COMMAND_RELEASE)
+    {
+        ma_data_converter_uninit(&command->buffer->converter, NULL);
+        if (!command->buffer->sharedData) RL_FREE(command->buffer->data);
+        if (command->buffer->streamRing != NULL)
+        {
+            ma_pcm_rb_uninit(command->buffer->streamRing);
+            RL_FREE(command->buffer->streamRing);
         }
+        RL_FREE(command->buffer);
     }
+    else if (command->type == AUDIO_COMMAND_DETACH_PROCESSOR) RL_FREE(command->processor);
 }
 
-// Check if an audio buffer is playing, assuming the audio system mutex has been locked
-static bool IsAudioBufferPlayingInLockedState(AudioBuffer *buffer)
+// Wait for buffer commands to be applied by audio thread
+static void WaitAudioBufferCommands(AudioBuffer *buffer)
 {
-    bool result = false;
+    while (AUDIO.System.isReady && (ma_atomic_load_32(&buffer->pendingCommands) > 0)) WaitAudioThread();
+}
 
-    if (buffer != NULL) result = (buffer->playing && !buffer->paused);
+// Wait for audio thread to apply commands queued
+// NOTE: Audio callback runs on main thread on web, offline mixing runs on program thread
+static void WaitAudioThread(void)
+{
+#if defined(__EMSCRIPTEN__)
+    ProcessAudioCommands();
+#else
+    if (AUDIO.Offline.active) ProcessAudioCommands();
+    else ma_sleep(1);
+#endif
+}
 
-    return result;
+// Stop an audio buffer playing, removed from mixer voices (audio thread)
+static void StopAudioVoice(AudioBuffer *buffer)
+{
+    if (buffer->playing && !buffer->paused)
+    {
+        ma_atomic_store_8((ma_uint8 *)&buffer->playing, false);
+        ma_atomic_store_8((ma_uint8 *)&buffer->paused, false);
+        ma_atomic_store_32(&buffer->frameCursorPos, 0);
+        ma_atomic_store_32(&buffer->framesProcessed, 0);
+        ma_atomic_store_32(&buffer->isSubBufferProcessed[0], true);
+        ma_atomic_store_32(&buffer->isSubBufferProcessed[1], true);
+        DiscardMusicStreamRing(buffer);
+
+        RemoveAudioVoice(buffer);
+    }
 }
 
-// Stop an audio buffer, assuming the audio system mutex has been locked
-static void StopAudioBufferInLockedState(AudioBuffer *buffer)
+// Remove audio buffer from mixer voices, last voice takes its place (audio thread)
+static void RemoveAudioVoice(AudioBuffer *buffer)
 {
-    if (buffer != NULL)
+    int index = buffer->voiceIndex;
+
+    if (index < 0) return;
+
+    AUDIO.Mixer.voiceCount--;
+    AUDIO.Mixer.voices[index] = AUDIO.Mixer.voices[AUDIO.Mixer.voiceCount];
+    AUDIO.Mixer.voices[index]->voiceIndex = index;
+    buffer->voiceIndex = -1;
+}
+
+// Create pooled sounds voices, sample data of the sound played is bound to a voice
+static void LoadSoundPoolVoices(void)
+{
+    for (int i = 0; i < MAX_SOUND_POOL_VOICES; i++)
     {
-        if (IsAudioBufferPlayingInLockedState(buffer))
+        AudioBuffer *buffer = LoadAudioBuffer(AUDIO_DEVICE_FORMAT, AUDIO_DEVICE_CHANNELS, AUDIO.System.device.sampleRate, 0, AUDIO_BUFFER_USAGE_STATIC);
+        if (buffer == NULL) break;
+
+        buffer->sharedData = true;
+        AUDIO.Pool.voices[i] = (SoundPoolVoice){ .buffer = buffer };
+        AUDIO.Pool.voiceCount++;
+    }
+}
+
+// Advance a culled voice playback position without reading it, stopped at the end if not looping (audio thread)
+static void AdvanceAudioVoice(AudioBuffer *buffer, ma_uint32 frameCount)
+{
+    ma_uint32 frames = (ma_uint32)((float)frameCount*buffer->converter.sampleRateIn/buffer->converter.sampleRateOut*buffer->pitch);
+    ma_uint32 cursor = buffer->frameCursorPos + frames;
+
+    if (cursor >= buffer->sizeInFrames)
+    {
+        if (!buffer->looping || (buffer->sizeInFrames == 0))
         {
-            buffer->playing = false;
-            buffer->paused = false;
-            buffer->frameCursorPos = 0;
-            buffer->framesProcessed = 0;
-            buffer->isSubBufferProcessed[0] = true;
-            buffer->isSubBufferProcessed[1] = true;
+            StopAudioVoice(buffer);
+            return;
         }
+
+        cursor %= buffer->sizeInFrames;
     }
+
+    ma_atomic_store_32(&buffer->frameCursorPos, cursor);
+}
+
+// Set voice pitch (audio thread)
+// NOTE: Pitching is just an adjustment of the sample rate, that changes the duration of the sound:
+//  - higher pitches will make the sound faster
+//  - lower pitches make it slower
+static void SetAudioVoicePitch(AudioBuffer *buffer, float pitch)
+{
+    ma_uint32 outputSampleRate = (ma_uint32)((float)buffer->converter.sampleRateOut/pitch);
+    ma_data_converter_set_rate(&buffer->converter, buffer->converter.sampleRateIn, outputSampleRate);
+
+    buffer->pitch = pitch;
+}
+
+// Stop pooled voices playing sample data, assuming the audio system mutex has been locked
+// NOTE: Unbound voices do not reference the data any more, it can be freed
+static void StopSoundPoolVoices(unsigned char *data, bool unbind)
+{
+    for (int i = 0; i < AUDIO.Pool.voiceCount; i++)
+    {
+        SoundPoolVoice *voice = &AUDIO.Pool.voices[i];
+
+        if ((data == NULL) || (voice->data != data)) continue;
+
+        if (unbind)
+        {
+            PushAudioCommand((AudioCommand){ .type = AUDIO_COMMAND_SET_DATA, .buffer = voice->buffer, .data = NULL, .frames = 0 });
+            voice->data = NULL;
+        }
+        else PushAudioCommand((AudioCommand){ .type = AUDIO_COMMAND_STOP, .buffer = voice->buffer });
+
+        voice->buffer->playRequested = false;
+    }
+}
+
+// Check if pooled voice is less important than other: lower priority, lower audibility, then older
+static bool IsSoundPoolVoiceLess(const SoundPoolVoice *voice, const SoundPoolVoice *other, ma_uint32 frame)
+{
+    if (voice->priority != other->priority) return (voice->priority < other->priority);
+    if (voice->audibility != other->audibility) return (voice->audibility < other->audibility);
+
+    return ((frame - voice->startFrame) >= (frame - other->startFrame));
+}
+
+// Play sound on a pooled voice, spatialized from emitter if provided (emitter sound not used)
+static void PlaySoundPoolVoice(Sound sound, int priority, const AudioEmitter *emitter)
+{
+    AudioBuffer *source = sound.stream.buffer;
+
+    if ((source == NULL) || (source->data == NULL) || !AUDIO.System.isReady) return;
+
+    SoundPoolVoice request = { .data = source->data, .priority = priority };
+    request.startFrame = ma_atomic_load_32(&AUDIO.Mixer.framesMixed);
+
+    ma_uint32 coalesceFrames = SOUND_POOL_COALESCE_MS*AUDIO.System.device.sampleRate/1000;
+
+    ma_mutex_lock(&AUDIO.System.lock);
+
+    // Not positional voices play with sound volume, pan and pitch
+    AudioSpatial spatial = { .volume = source->volume, .pan = source->pan, .pitch = source->pitch, .culled = false };
+
+    if (emitter != NULL)
+    {
+        AudioSpatialBatch batch = { 0 };
+
+        batch.x[0] = emitter->position.x;
+        batch.y[0] = emitter->position.y;
+        batch.z[0] = emitter->position.z;
+        batch.vx[0] = emitter->velocity.x;
+        batch.vy[0] = emitter->velocity.y;
+        batch.vz[0] = emitter->velocity.z;
+        batch.volume[0] = emitter->volume;
+        batch.pitch[0] = emitter->pitch;
+
+        SpatializeAudioBatch(&batch, 1);
+        spatial = GetAudioSpatial(&batch, 0);
+
+        request.positional = true;
+        request.position = emitter->position;
+        request.velocity = emitter->velocity;
+        request.volume = emitter->volume;
+        request.pitch = emitter->pitch;
+    }
+
+    request.audibility = spatial.volume;
+
+    SoundPoolVoice *voice = NULL;       // Free voice
+    SoundPoolVoice *stolen = NULL;      // Least important voice playing
+
+    for (int i = 0; i < AUDIO.Pool.voiceCount; i++)
+    {
+        SoundPoolVoice *candidate = &AUDIO.Pool.voices[i];
+
+        if (!IsAudioBufferPlaying(candidate->buffer))
+        {
+            if (voice == NULL) voice = candidate;
+        }
+        else if ((candidate->data == request.data) && ((request.startFrame - candidate->startFrame) < coalesceFrames))
+        {
+            // Duplicate trigger, the voice playing keeps the most important request
+            if (priority > candidate->priority) candidate->priority = priority;
+            if (request.audibility > candidate->audibility) candidate->audibility = request.audibility;
+
+            ma_mutex_unlock(&AUDIO.System.lock);
+            return;
+        }
+        else if ((stolen == NULL) || IsSoundPoolVoiceLess(candidate, stolen, request.startFrame)) stolen = candidate;
+    }
+
+    if ((voice == NULL) && (stolen != NULL) && IsSoundPoolVoiceLess(stolen, &request, request.startFrame)) voice = stolen;
+
+    if (voice != NULL)
+    {
+        AudioBuffer *buffer = voice->buffer;
+
+        // NOTE: Spatialization is always queued, voice could keep culling from a previous play
+        PushAudioCommand((AudioCommand){ .type = AUDIO_COMMAND_SET_DATA, .buffer = buffer, .data = source->data, .frames = source->sizeInFrames });
+        PushAudioCommand((AudioCommand){ .type = AUDIO_COMMAND_SPATIAL, .buffer = buffer, .spatial = spatial });
+        PushAudioCommand((AudioCommand){ .type = AUDIO_COMMAND_PLAY, .buffer = buffer });
+        buffer->spatial = spatial;
+        buffer->playRequested = true;
+        buffer->pauseRequested = false;
+
+        request.buffer = buffer;
+        *voice = request;
+    }
+
+    ma_mutex_unlock(&AUDIO.System.lock);
+}
+
+// Decode music frames, decoder is rewound to continue reading when the end is reached
+static void ReadMusicFrames(Music music, void *framesOut, unsigned int frameCount)
+{
+    int frameSize = music.stream.channels*music.stream.sampleSize/8;
+    int frameCountStillNeeded = frameCount;
+    int frameCountReadTotal = 0;
+
+    switch (music.ctxType)
+    {
+    #if defined(SUPPORT_FILEFORMAT_WAV)
+        case MUSIC_AUDIO_WAV:
+        {
+            if (music.stream.sampleSize == 16)
+            {
+                while (true)
+                {
+                    int frameCountRead = (int)drwav_read_pcm_frames_s16((drwav *)music.ctxData, frameCountStillNeeded, (short *)((char *)framesOut + frameCountReadTotal*frameSize));
+                    frameCountReadTotal += frameCountRead;
+                    frameCountStillNeeded -= frameCountRead;
+                    if (frameCountStillNeeded == 0) break;
+                    else drwav_seek_to_first_pcm_frame((drwav *)music.ctxData);
+                }
+            }
+            else if (music.stream.sampleSize == 32)
+            {
+                while (true)
+                {
+                    int frameCountRead = (int)drwav_read_pcm_frames_f32((drwav *)music.ctxData, frameCountStillNeeded, (float *)((char *)framesOut + frameCountReadTotal*frameSize));
+                    frameCountReadTotal += frameCountRead;
+                    frameCountStillNeeded -= frameCountRead;
+                    if (frameCountStillNeeded == 0) break;
+                    else drwav_seek_to_first_pcm_frame((drwav *)music.ctxData);
+                }
+            }
+        } break;
+    #endif
+    #if defined(SUPPORT_FILEFORMAT_OGG)
+        case MUSIC_AUDIO_OGG:
+        {
+            while (true)
+            {
+                int frameCountRead = stb_vorbis_get_samples_short_interleaved((stb_vorbis *)music.ctxData, music.stream.channels, (short *)((char *)framesOut + frameCountReadTotal*frameSize), frameCountStillNeeded*music.stream.channels);
+                frameCountReadTotal += frameCountRead;
+                frameCountStillNeeded -= frameCountRead;
+                if (frameCountStillNeeded == 0) break;
+                else stb_vorbis_seek_start((stb_vorbis *)music.ctxData);
+            }
+        } break;
+    #endif
+    #if defined(SUPPORT_FILEFORMAT_MP3)
+        case MUSIC_AUDIO_MP3:
+        {
+            while (true)
+            {
+                int frameCountRead = (int)drmp3_read_pcm_frames_f32((drmp3 *)music.ctxData, frameCountStillNeeded, (float *)((char *)framesOut + frameCountReadTotal*frameSize));
+                frameCountReadTotal += frameCountRead;
+                frameCountStillNeeded -= frameCountRead;
+                if (frameCountStillNeeded == 0) break;
+                else drmp3_seek_to_start_of_stream((drmp3 *)music.ctxData);
+            }
+        } break;
+    #endif
+    #if defined(SUPPORT_FILEFORMAT_QOA)
+        case MUSIC_AUDIO_QOA:
+        {
+            unsigned int frameCountRead = qoaplay_decode((qoaplay_desc *)music.ctxData, (float *)framesOut, frameCount);
+            frameCountReadTotal += frameCountRead;
+            /*
+            while (true)
+            {
+                int frameCountRead = (int)qoaplay_decode((qoaplay_desc *)music.ctxData, (float *)((char *)framesOut + frameCountReadTotal*frameSize),  frameCountStillNeeded);
+                frameCountReadTotal += frameCountRead;
+                frameCountStillNeeded -= frameCountRead;
+                if (frameCountStillNeeded == 0) break;
+                else qoaplay_rewind((qoaplay_desc *)music.ctxData);
+            }
+            */
+        } break;
+    #endif
+    #if defined(SUPPORT_FILEFORMAT_FLAC)
+        case MUSIC_AUDIO_FLAC:
+        {
+            while (true)
+            {
+                int frameCountRead = (int)drflac_read_pcm_frames_s16((drflac *)music.ctxData, frameCountStillNeeded, (short *)((char *)framesOut + frameCountReadTotal*frameSize));
+                frameCountReadTotal += frameCountRead;
+                frameCountStillNeeded -= frameCountRead;
+                if (frameCountStillNeeded == 0) break;
+                else drflac__seek_to_first_frame((drflac *)music.ctxData);
+            }
+        } break;
+    #endif
+    #if defined(SUPPORT_FILEFORMAT_XM)
+        case MUSIC_MODULE_XM:
+        {
+            // NOTE: Internally we consider 2 channels generation, so sampleCount/2
+            if (AUDIO_DEVICE_FORMAT == ma_format_f32) jar_xm_generate_samples((jar_xm_context_t *)music.ctxData, (float *)framesOut, frameCount);
+            else if (AUDIO_DEVICE_FORMAT == ma_format_s16) jar_xm_generate_samples_16bit((jar_xm_context_t *)music.ctxData, (short *)framesOut, frameCount);
+            else if (AUDIO_DEVICE_FORMAT == ma_format_u8) jar_xm_generate_samples_8bit((jar_xm_context_t *)music.ctxData, (char *)framesOut, frameCount);
+            //jar_xm_reset((jar_xm_context_t *)music.ctxData);
+
+        } break;
+    #endif
+    #if defined(SUPPORT_FILEFORMAT_MOD)
+        case MUSIC_MODULE_MOD:
+        {
+            // NOTE: 3rd parameter (nbsample) specify the number of stereo 16bits samples you want, so sampleCount/2
+            jar_mod_fillbuffer((jar_mod_context_t *)music.ctxData, (short *)framesOut, frameCount, 0);
+            //jar_mod_seek_start((jar_mod_context_t *)music.ctxData);
+
+        } break;
+    #endif
+        default: break;
+    }
+}
+
+// Rewind music decoder to first frame
+static void RewindMusicFrames(Music music)
+{
+    switch (music.ctxType)
+    {
+#if defined(SUPPORT_FILEFORMAT_WAV)
+        case MUSIC_AUDIO_WAV: drwav_seek_to_first_pcm_frame((drwav *)music.ctxData); break;
+#endif
+#if defined(SUPPORT_FILEFORMAT_OGG)
+        case MUSIC_AUDIO_OGG: stb_vorbis_seek_start((stb_vorbis *)music.ctxData); break;
+#endif
+#if defined(SUPPORT_FILEFORMAT_MP3)
+        case MUSIC_AUDIO_MP3: drmp3_seek_to_start_of_stream((drmp3 *)music.ctxData); break;
+#endif
+#if defined(SUPPORT_FILEFORMAT_QOA)
+        case MUSIC_AUDIO_QOA: qoaplay_rewind((qoaplay_desc *)music.ctxData); break;
+#endif
+#if defined(SUPPORT_FILEFORMAT_FLAC)
+        case MUSIC_AUDIO_FLAC: drflac__seek_to_first_frame((drflac *)music.ctxData); break;
+#endif
+#if defined(SUPPORT_FILEFORMAT_XM)
+        case MUSIC_MODULE_XM: jar_xm_reset((jar_xm_context_t *)music.ctxData); break;
+#endif
+#if defined(SUPPORT_FILEFORMAT_MOD)
+        case MUSIC_MODULE_MOD: jar_mod_seek_start((jar_mod_context_t *)music.ctxData); break;
+#endif
+        default: break;
+    }
+}
+
+#if defined(SUPPORT_MUSIC_STREAM_THREAD)
+// Music streaming thread main loop, keeps music streams playing decoded ahead
+// NOTE: Music streams lock is taken per decoded chunk, program threads are not blocked for long
+static ma_thread_result MA_THREADCALL MusicStreamThread(void *data)
+{
+    (void)data;
+
+    while (ma_atomic_load_32(&AUDIO.Stream.running))
+    {
+        bool ringsFull = true;
+
+        for (int i = 0; i < MAX_MUSIC_STREAMS; i++)
+        {
+            ma_mutex_lock(&AUDIO.Stream.lock);
+            if ((i < AUDIO.Stream.musicCount) && UpdateMusicStreamRing(i)) ringsFull = false;
+            ma_mutex_unlock(&AUDIO.Stream.lock);
+        }
+
+        if (ringsFull) ma_sleep(MUSIC_STREAM_UPDATE_MS);
+    }
+
+    return (ma_thread_result)0;
+}
+#endif
+
+// Decode music frames ahead into stream ring, one chunk at most, music streams lock locked
+// NOTE: Returns false if there is nothing to decode (ring full, music not playing or ended)
+static bool UpdateMusicStreamRing(int index)
+{
+    Music music = AUDIO.Stream.music[index];
+    AudioBuffer *buffer = music.stream.buffer;
+
+    // Stream state is reset by commands not applied yet (play, stop, seek), ring is discarded by audio thread
+    if (ma_atomic_load_32(&buffer->pendingCommands) > 0) return false;
+    if (!ma_atomic_load_8((ma_uint8 *)&buffer->playing) || ma_atomic_load_8((ma_uint8 *)&buffer->paused)) return false;
+    if (ma_atomic_load_32(&buffer->streamEnded)) return false;
+
+    ma_uint32 frameCount = ma_pcm_rb_available_write(buffer->streamRing);
+    if (frameCount == 0) return false;
+
+    void *framesOut = NULL;
+    ma_pcm_rb_acquire_write(buffer->streamRing, &frameCount, &framesOut);
+
+    // Chunks are limited to a device period, decoding is interleaved with other music streams
+    if (frameCount > AUDIO.System.device.playback.internalPeriodSizeInFrames*2) frameCount = AUDIO.System.device.playback.internalPeriodSizeInFrames*2;
+
+    unsigned int framesLeft = music.frameCount - ma_atomic_load_32(&buffer->framesProcessed);   // Frames left to be decoded
+    bool ended = (!ma_atomic_load_32(&buffer->streamLooping) && (frameCount >= framesLeft));
+    if (ended) frameCount = framesLeft;
+
+    ReadMusicFrames(music, framesOut, frameCount);
+    ma_pcm_rb_commit_write(buffer->streamRing, frameCount);
+    RecordStreamRefill(buffer);
+    AddAudioBufferFramesProcessed(buffer, frameCount, music.frameCount);
+
+    if (ended)
+    {
+        // Streaming is ending, stopped by audio thread once ring is played
+        RewindMusicFrames(music);
+        ma_atomic_store_32(&buffer->streamEnded, true);
+    }
+
+    return true;
+}
+
+// Add music stream to streaming thread, stream ring allocated to keep music decoded ahead
+// NOTE: If streaming thread is not running, music is decoded by UpdateMusicStream()
+static void TrackMusicStream(Music *music)
+{
+    if (!ma_atomic_load_32(&AUDIO.Stream.running) || (music->stream.buffer == NULL)) return;
+
+    ma_mutex_lock(&AUDIO.Stream.lock);
+
+    if (AUDIO.Stream.musicCount < MAX_MUSIC_STREAMS)
+    {
+        ma_uint32 ringSizeInFrames = music->stream.sampleRate*MUSIC_STREAM_DECODE_AHEAD_MS/1000;
+        ma_pcm_rb *ring = (ma_pcm_rb *)RL_CALLOC(1, sizeof(ma_pcm_rb));
+
+        if (ma_pcm_rb_init(music->stream.buffer->converter.formatIn, music->stream.channels, ringSizeInFrames, NULL, NULL, ring) == MA_SUCCESS)
+        {
+            music->stream.buffer->streamRing = ring;
+            ma_atomic_store_32(&music->stream.buffer->streamLooping, music->looping);
+            AUDIO.Stream.music[AUDIO.Stream.musicCount] = *music;
+            AUDIO.Stream.musicCount++;
+        }
+        else RL_FREE(ring);
+    }
+    else TRACELOG(LOG_WARNING, "STREAM: Maximum music streams reached (%i), music decoded on update", MAX_MUSIC_STREAMS);
+
+    ma_mutex_unlock(&AUDIO.Stream.lock);
+}
+
+// Remove music stream from streaming thread
+// NOTE: Stream ring is freed with the audio buffer, it could still be read by audio thread
+static void UntrackMusicStream(Music music)
+{
+    if ((music.stream.buffer == NULL) || (music.stream.buffer->streamRing == NULL)) return;
+
+    ma_mutex_lock(&AUDIO.Stream.lock);
+
+    for (int i = 0; i < AUDIO.Stream.musicCount; i++)
+    {
+        if (AUDIO.Stream.music[i].stream.buffer == music.stream.buffer)
+        {
+            AUDIO.Stream.musicCount--;
+            AUDIO.Stream.music[i] = AUDIO.Stream.music[AUDIO.Stream.musicCount];
+            break;
+        }
+    }
+
+    ma_mutex_unlock(&AUDIO.Stream.lock);
+}
+
+// Read music frames decoded ahead by streaming thread (audio thread)
+// NOTE: Frames not decoded in time are filled with silence, music stops once the ring is played after its end
+static ma_uint32 ReadMusicStreamRing(AudioBuffer *buffer, void *framesOut, ma_uint32 frameCount)
+{
+    ma_uint32 frameSizeInBytes = ma_get_bytes_per_frame(buffer->converter.formatIn, buffer->converter.channelsIn);
+    ma_uint32 framesRead = 0;
+
+    while (framesRead < frameCount)
+    {
+        ma_uint32 framesToRead = frameCount - framesRead;
+        void *framesIn = NULL;
+
+        ma_pcm_rb_acquire_read(buffer->streamRing, &framesToRead, &framesIn);
+        if (framesToRead == 0) break;
+
+        memcpy((unsigned char *)framesOut + framesRead*frameSizeInBytes, framesIn, framesToRead*frameSizeInBytes);
+        ma_pcm_rb_commit_read(buffer->streamRing, framesToRead);
+        framesRead += framesToRead;
+        buffer->streamPrimed = true;
+    }
+
+    if (framesRead < frameCount)
+    {
+        memset((unsigned char *)framesOut + framesRead*frameSizeInBytes, 0, (frameCount - framesRead)*frameSizeInBytes);
+
+        if (ma_atomic_load_32(&buffer->streamEnded)) StopAudioVoice(buffer);
+        else RecordStreamUnderrun(buffer);
+    }
+
+    return frameCount;
+}
+
+// Discard music frames decoded ahead, stream is refilled from current decoder position (audio thread)
+// NOTE: Called when stream is restarted (played, stopped or seeked), silence read until refilled is not an underrun
+static void DiscardMusicStreamRing(AudioBuffer *buffer)
+{
+    buffer->streamPrimed = false;
+
+    if (buffer->streamRing == NULL) return;
+
+    ma_pcm_rb_seek_read(buffer->streamRing, ma_pcm_rb_available_read(buffer->streamRing));
+    ma_atomic_store_32(&buffer->streamEnded, false);
+}
+
+#if defined(SUPPORT_AUDIO_STATS)
+// Get stats clock time in seconds, clock started with the device
+static double GetAudioStatsTime(void)
+{
+    return ma_timer_get_time_in_seconds(&AUDIO.Stats.timer);
+}
+
+// Update stats maximum value, retried if updated meanwhile by another thread
+static void UpdateAudioStatsMax(ma_uint32 *max, ma_uint32 value)
+{
+    ma_uint32 current = ma_atomic_load_32(max);
+
+    while (value > current)
+    {
+        if (ma_atomic_compare_exchange_weak_32(max, &current, value)) break;
+    }
+}
+
+// Record audio callback duration over period and time since previous callback (audio thread)
+static void RecordAudioCallback(double start, double end, ma_uint32 frameCount)
+{
+    double duration = end - start;
+    double period = (double)frameCount/AUDIO.System.device.sampleRate;
+
+    int bucket = (int)(duration*10.0/period);
+    if (bucket > AUDIO_STATS_HISTOGRAM_SIZE - 1) bucket = AUDIO_STATS_HISTOGRAM_SIZE - 1;
+
+    ma_atomic_fetch_add_32(&AUDIO.Stats.callbackCount, 1);
+    ma_atomic_fetch_add_64(&AUDIO.Stats.callbackTime, (ma_uint64)(duration*1e9));
+    UpdateAudioStatsMax(&AUDIO.Stats.callbackTimeMax, (ma_uint32)(duration*1e9));
+    ma_atomic_fetch_add_32(&AUDIO.Stats.histogram[bucket], 1);
+
+    if (duration > period) ma_atomic_fetch_add_32(&AUDIO.Stats.overruns, 1);
+
+    // NOTE: Offline mixing is driven by program thread, callbacks interval is not device timing
+    if (!AUDIO.Offline.active && (AUDIO.Stats.lastCallback > 0.0))
+    {
+        double interval = start - AUDIO.Stats.lastCallback;
+
+        UpdateAudioStatsMax(&AUDIO.Stats.intervalMax, (ma_uint32)(interval*1e9));
+        if (interval > period*AUDIO_STATS_LATE_PERIODS) ma_atomic_fetch_add_32(&AUDIO.Stats.lateCallbacks, 1);
+    }
+
+    AUDIO.Stats.lastCallback = start;
+}
+
+// Record voice processing time: read, conversion, processors and mixing (audio thread)
+static void RecordAudioVoice(double start, double end)
+{
+    ma_uint32 duration = (ma_uint32)((end - start)*1e9);
+
+    ma_atomic_fetch_add_32(&AUDIO.Stats.voiceCount, 1);
+    ma_atomic_fetch_add_64(&AUDIO.Stats.voiceTime, duration);
+    UpdateAudioStatsMax(&AUDIO.Stats.voiceTimeMax, duration);
+}
+#endif
+
+// Record stream read with no data queued, silence played (audio thread)
+// NOTE: Only streams read since restarted are recorded, stream is flagged starved until refilled
+static void RecordStreamUnderrun(AudioBuffer *buffer)
+{
+#if defined(SUPPORT_AUDIO_STATS)
+    if (!buffer->streamPrimed) return;
+
+    if (ma_atomic_exchange_32(&buffer->streamStarved, true) == false) ma_atomic_fetch_add_32(&AUDIO.Stats.streamUnderruns, 1);
+#else
+    (void)buffer;
+#endif
+}
+
+// Record stream refill, counted late if stream ran out of data before it
+static void RecordStreamRefill(AudioBuffer *buffer)
+{
+#if defined(SUPPORT_AUDIO_STATS)
+    if (ma_atomic_exchange_32(&buffer->streamStarved, false)) ma_atomic_fetch_add_32(&AUDIO.Stats.lateRefills, 1);
+#else
+    (void)buffer;
+#endif
 }
 
 // Update audio stream, assuming the audio system mutex has been locked
@@ -2661,28 +4193,31 @@ static void UpdateAudioStreamInLockedState(AudioStream stream, const void *data,
 {
     if (stream.buffer != NULL)
     {
-        if (stream.buffer->isSubBufferProcessed[0] || stream.buffer->isSubBufferProcessed[1])
+        bool isSubBufferProcessed[2] = { 0 };
+        isSubBufferProcessed[0] = ma_atomic_load_32(&stream.buffer->isSubBufferProcessed[0]);
+        isSubBufferProcessed[1] = ma_atomic_load_32(&stream.buffer->isSubBufferProcessed[1]);
+
+        if (isSubBufferProcessed[0] || isSubBufferProcessed[1])
         {
             ma_uint32 subBufferToUpdate = 0;
+            ma_uint32 subBufferSizeInFrames = stream.buffer->sizeInFrames/2;
 
-            if (stream.buffer->isSubBufferProcessed[0] && stream.buffer->isSubBufferProcessed[1])
+            if (isSubBufferProcessed[0] && isSubBufferProcessed[1])
             {
                 // Both buffers are available for updating
-                // Update the first one and make sure the cursor is moved back to the front
-                subBufferToUpdate = 0;
-                stream.buffer->frameCursorPos = 0;
+                // Update the one at the cursor position first, the cursor is not moved by the mixer until then
+                subBufferToUpdate = (ma_atomic_load_32(&stream.buffer->frameCursorPos) >= subBufferSizeInFrames)? 1 : 0;
             }
             else
             {
                 // Just update whichever sub-buffer is processed
-                subBufferToUpdate = (stream.buffer->isSubBufferProcessed[0])? 0 : 1;
+                subBufferToUpdate = (isSubBufferProcessed[0])? 0 : 1;
             }
 
-            ma_uint32 subBufferSizeInFrames = stream.buffer->sizeInFrames/2;
             unsigned char *subBuffer = stream.buffer->data + ((subBufferSizeInFrames*stream.channels*(stream.sampleSize/8))*subBufferToUpdate);
 
             // Total frames processed in buffer is always the complete size, filled with 0 if required
-            stream.buffer->framesProcessed += subBufferSizeInFrames;
+            AddAudioBufferFramesProcessed(stream.buffer, subBufferSizeInFrames, 0);
 
             // Does this API expect a whole buffer to be updated in one go?
             // Assuming so, but if not will need to change this logic
@@ -2698,7 +4233,8 @@ static void UpdateAudioStreamInLockedState(AudioStream stream, const void *data,
 
                 if (leftoverFrameCount > 0) memset(subBuffer + bytesToWrite, 0, leftoverFrameCount*stream.channels*(stream.sampleSize/8));
 
-                stream.buffer->isSubBufferProcessed[subBufferToUpdate] = false;
+                ma_atomic_store_32(&stream.buffer->isSubBufferProcessed[subBufferToUpdate], false);    // Sub-buffer data published to mixer
+                RecordStreamRefill(stream.buffer);
             }
             else TRACELOG(LOG_WARNING, "STREAM: Attempting to write too many frames to buffer");
         }
@@ -2706,6 +4242,20 @@ static void UpdateAudioStreamInLockedState(AudioStream stream, const void *data,
     }
 }
 
+// Add frames processed to audio buffer, wrapped to music length if wrap is not 0
+// NOTE: Written by program, streaming and audio threads (play, seek, stop), retried if updated meanwhile
+static void AddAudioBufferFramesProcessed(AudioBuffer *buffer, ma_uint32 frameCount, ma_uint32 wrap)
+{
+    ma_uint32 current = ma_atomic_load_32(&buffer->framesProcessed);
+    ma_uint32 value = 0;
+
+    do
+    {
+        value = current + frameCount;
+        if (wrap > 0) value %= wrap;
+    } while (!ma_atomic_compare_exchange_weak_32(&buffer->framesProcessed, &current, value));
+}
+
 // Some required functions for audio standalone module version
 #if defined(RAUDIO_STANDALONE)
 // Check file extension
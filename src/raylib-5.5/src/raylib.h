@@ -426,6 +426,14 @@ typedef struct ModelAnimation {
     char name[32];          // Animation name
 } ModelAnimation;
 
+// ModelAnimationBaked, bone matrices precomputed for every animation frame
+typedef struct ModelAnimationBaked {
+    int boneCount;          // Number of bones
+    int frameCount;         // Number of animation frames
+    Matrix *frameBones;     // Bone matrices by frame (frameCount*boneCount), ready for skinning
+    Texture2D texture;      // Bone matrices texture (optional, for user skinning shaders): one row per frame, 4 RGBA32F texels (matrix columns) per bone
+} ModelAnimationBaked;
+
 // Ray, ray for raycasting
 typedef struct Ray {
     Vector3 position;       // Ray position (origin)
@@ -486,6 +494,51 @@ typedef struct Music {
     void *ctxData;              // Audio context data, depends on type
 } Music;
 
+// AudioEmitter, positional sound spatialized relative to audio listener
+typedef struct AudioEmitter {
+    Sound sound;                // Sound played by the emitter (volume, pan and pitch driven by emitter)
+    Vector3 position;           // Emitter position
+    Vector3 velocity;           // Emitter velocity (units per second), required for doppler
+    float volume;               // Emitter volume (1.0 is max level), attenuated by distance
+    float pitch;                // Emitter pitch (1.0 is base level), doppler shifted
+} AudioEmitter;
+
+// AudioStats, audio device callback timing and underruns recorded since device init (or reset)
+typedef struct AudioStats {
+    int sampleRate;                     // Device sample rate
+    int periodSize;                     // Device period size in frames
+    int periodCount;                    // Device periods count
+    float periodTime;                   // Device period duration (milliseconds)
+    unsigned int callbackCount;         // Audio callbacks recorded
+    float callbackTimeAvg;              // Audio callback average duration (milliseconds)
+    float callbackTimeMax;              // Audio callback maximum duration (milliseconds)
+    float callbackIntervalMax;          // Maximum time between audio callbacks start (milliseconds)
+    unsigned int callbackHistogram[12]; // Audio callbacks by duration over period: 10% buckets, last one 110% and over
+    unsigned int overruns;              // Audio callbacks longer than the period (mixing too slow)
+    unsigned int lateCallbacks;         // Audio callbacks started late, device likely played silence
+    unsigned int streamUnderruns;       // Music/audio stream reads with no data queued (silence played)
+    unsigned int lateRefills;           // Music/audio stream refills after an underrun
+    unsigned int voiceCount;            // Voices processed (read, conversion, processors and mixing)
+    float voiceTimeAvg;                 // Voice processing average duration (microseconds)
+    float voiceTimeMax;                 // Voice processing maximum duration (microseconds)
+} AudioStats;
+
+// FramePacingStats, frame time and pacing jitter recorded since window init (or reset)
+typedef struct FramePacingStats {
+    unsigned int frameCount;            // Frames recorded
+    float frameTimeAvg;                 // Frame time average (milliseconds)
+    float frameTimeMin;                 // Frame time minimum (milliseconds)
+    float frameTimeMax;                 // Frame time maximum (milliseconds)
+    float jitterAvg;                    // Frame time average deviation from target, from previous frame if no target (milliseconds)
+    float jitterMax;                    // Frame time maximum deviation (milliseconds)
+    unsigned int missedFrames;          // Frames ended after their deadline (target frame time exceeded)
+    float sleepSlack;                   // Sleep wake-up slack measured, busy waited at the end of frame (milliseconds)
+    float spinTimeAvg;                  // Busy wait average per frame (milliseconds)
+    unsigned int inputFrames;           // Frames presenting input events
+    float inputLatencyAvg;              // Input-to-swap latency average, input polled to frame swap submitted (milliseconds)
+    float inputLatencyMax;              // Input-to-swap latency maximum (milliseconds)
+} FramePacingStats;
+
 // VrDeviceInfo, Head-Mounted-Display device parameters
 typedef struct VrDeviceInfo {
     int hResolution;                // Horizontal resolution in pixels
@@ -802,7 +855,8 @@ typedef enum {
     SHADER_LOC_VERTEX_BONEIDS,      // Shader location: vertex attribute: boneIds
     SHADER_LOC_VERTEX_BONEWEIGHTS,  // Shader location: vertex attribute: boneWeights
     SHADER_LOC_BONE_MATRICES,       // Shader location: array of matrices uniform: boneMatrices
-    SHADER_LOC_VERTEX_INSTANCE_TX   // Shader location: vertex attribute: instanceTransform
+    SHADER_LOC_VERTEX_INSTANCE_TX,  // Shader location: vertex attribute: instanceTransform
+    SHADER_LOC_MATRIX_DEQUANTIZATION // Shader location: matrix uniform: quantized mesh vertex positions decoding
 } ShaderLocationIndex;
 
 #define SHADER_LOC_MAP_DIFFUSE      SHADER_LOC_MAP_ALBEDO
@@ -952,6 +1006,7 @@ typedef enum {
 // WARNING: These callbacks are intended for advanced users
 typedef void (*TraceLogCallback)(int logLevel, const char *text, va_list args);  // Logging: Redirect trace log messages
 typedef unsigned char *(*LoadFileDataCallback)(const char *fileName, int *dataSize);    // FileIO: Load binary data
+typedef void (*UnloadFileDataCallback)(unsigned char *data);            // FileIO: Unload binary data loaded by LoadFileDataCallback
 typedef bool (*SaveFileDataCallback)(const char *fileName, void *data, int dataSize);   // FileIO: Save binary data
 typedef char *(*LoadFileTextCallback)(const char *fileName);            // FileIO: Load text data
 typedef bool (*SaveFileTextCallback)(const char *fileName, const char *text); // FileIO: Save text data
@@ -1019,6 +1074,8 @@ RLAPI const char *GetClipboardText(void);                         // Get clipboa
 RLAPI Image GetClipboardImage(void);                              // Get clipboard image content
 RLAPI void EnableEventWaiting(void);                              // Enable waiting for events on EndDrawing(), no automatic event polling
 RLAPI void DisableEventWaiting(void);                             // Disable waiting for events on EndDrawing(), automatic events polling
+RLAPI void EnableLowLatencyInput(void);                           // Enable low latency input, events polled just before next frame update and frames presented before it
+RLAPI void DisableLowLatencyInput(void);                          // Disable low latency input, events polled after frame wait
 
 // Cursor-related functions
 RLAPI void ShowCursor(void);                                      // Shows cursor
@@ -1080,6 +1137,8 @@ RLAPI void SetTargetFPS(int fps);                                 // Set target
 RLAPI float GetFrameTime(void);                                   // Get time in seconds for last frame drawn (delta time)
 RLAPI double GetTime(void);                                       // Get elapsed time in seconds since InitWindow()
 RLAPI int GetFPS(void);                                           // Get current FPS
+RLAPI FramePacingStats GetFramePacingStats(void);                 // Get frame time and pacing jitter stats
+RLAPI void ResetFramePacingStats(void);                           // Reset frame pacing stats recorded
 
 // Custom frame control functions
 // NOTE: Those functions are intended for advanced users that want full control over the frame processing
@@ -1112,6 +1171,7 @@ RLAPI void MemFree(void *ptr);                                    // Internal me
 // WARNING: Callbacks setup is intended for advanced users
 RLAPI void SetTraceLogCallback(TraceLogCallback callback);         // Set custom trace log
 RLAPI void SetLoadFileDataCallback(LoadFileDataCallback callback); // Set custom file binary data loader
+RLAPI void SetUnloadFileDataCallback(UnloadFileDataCallback callback); // Set custom file binary data unloader
 RLAPI void SetSaveFileDataCallback(SaveFileDataCallback callback); // Set custom file binary data saver
 RLAPI void SetLoadFileTextCallback(LoadFileTextCallback callback); // Set custom file text data loader
 RLAPI void SetSaveFileTextCallback(SaveFileTextCallback callback); // Set custom file text data saver
@@ -1119,6 +1179,8 @@ RLAPI void SetSaveFileTextCallback(SaveFileTextCallback callback); // Set custom
 // Files management functions
 RLAPI unsigned char *LoadFileData(const char *fileName, int *dataSize); // Load file data as byte array (read)
 RLAPI void UnloadFileData(unsigned char *data);                   // Unload file data allocated by LoadFileData()
+RLAPI unsigned char *LoadFileDataMapped(const char *fileName, int *dataSize); // Load file data mapped into memory (copy-on-write), read if mapping not available
+RLAPI void UnloadFileDataMapped(unsigned char *data);             // Unload file data loaded by LoadFileDataMapped()
 RLAPI bool SaveFileData(const char *fileName, void *data, int dataSize); // Save data to file from byte array (write), returns true on success
 RLAPI bool ExportDataAsCode(const unsigned char *data, int dataSize, const char *fileName); // Export data to code (.h), returns true on success
 RLAPI char *LoadFileText(const char *fileName);                   // Load text data from file (read), returns a '\0' terminated string
@@ -1559,9 +1621,12 @@ RLAPI void DrawGrid(int slices, float spacing);
 
 // Model management functions
 RLAPI Model LoadModel(const char *fileName);                                                // Load model from files (meshes and materials)
+RLAPI Model LoadModelData(const char *fileName);                                            // Load model data from file into RAM, no GPU upload (can be called from any thread)
+RLAPI void UploadModel(Model *model);                                                       // Upload model data loaded to GPU (meshes and textures not uploaded)
 RLAPI Model LoadModelFromMesh(Mesh mesh);                                                   // Load model from generated mesh (default material)
 RLAPI bool IsModelValid(Model model);                                                       // Check if a model is valid (loaded in GPU, VAO/VBOs)
 RLAPI void UnloadModel(Model model);                                                        // Unload model (including meshes) from memory (RAM and/or VRAM)
+RLAPI bool ExportModel(Model model, const char *fileName);                                  // Export model data to file (.rmdl model cache), returns true on success
 RLAPI BoundingBox GetModelBoundingBox(Model model);                                         // Compute model bounding box limits (considers all meshes)
 
 // Model drawing functions
@@ -1578,12 +1643,15 @@ RLAPI void DrawBillboardPro(Camera camera, Texture2D texture, Rectangle source,
 
 // Mesh management functions
 RLAPI void UploadMesh(Mesh *mesh, bool dynamic);                                            // Upload mesh vertex data in GPU and provide VAO/VBO ids
+RLAPI void UploadMeshQuantized(Mesh *mesh);                                                 // Upload static mesh vertex data in GPU with a compact quantized vertex layout
 RLAPI void UpdateMeshBuffer(Mesh mesh, int index, const void *data, int dataSize, int offset); // Update mesh vertex data in GPU for a specific buffer index
 RLAPI void UnloadMesh(Mesh mesh);                                                           // Unload mesh data from CPU and GPU
 RLAPI void DrawMesh(Mesh mesh, Material material, Matrix transform);                        // Draw a 3d mesh with material and transform
 RLAPI void DrawMeshInstanced(Mesh mesh, Material material, const Matrix *transforms, int instances); // Draw multiple mesh instances with material and different transforms
 RLAPI BoundingBox GetMeshBoundingBox(Mesh mesh);                                            // Compute mesh bounding box limits
 RLAPI void GenMeshTangents(Mesh *mesh);                                                     // Compute mesh tangents
+RLAPI void OptimizeMesh(Mesh *mesh);                                                        // Optimize mesh triangles and vertices order for vertex cache and overdraw
+RLAPI float GetMeshACMR(Mesh mesh);                                                         // Get mesh average cache miss ratio (transformed vertices per triangle)
 RLAPI bool ExportMesh(Mesh mesh, const char *fileName);                                     // Export mesh data to file, returns true on success
 RLAPI bool ExportMeshAsCode(Mesh mesh, const char *fileName);                               // Export mesh as code file (.h) defining multiple arrays of vertex attributes
 
@@ -1615,6 +1683,10 @@ RLAPI void UpdateModelAnimationBones(Model model, ModelAnimation anim, int frame
 RLAPI void UnloadModelAnimation(ModelAnimation anim);                                       // Unload animation data
 RLAPI void UnloadModelAnimations(ModelAnimation *animations, int animCount);                // Unload animation array data
 RLAPI bool IsModelAnimationValid(Model model, ModelAnimation anim);                         // Check model animation skeleton match
+RLAPI ModelAnimationBaked LoadModelAnimationBaked(Model model, ModelAnimation anim, bool bakeTexture); // Load baked animation, bone matrices for every frame (optionally into a texture)
+RLAPI void UpdateModelAnimationBaked(Model model, ModelAnimationBaked baked, int frame);     // Update model animation pose from baked bone matrices (CPU), skipped if model already holds that pose
+RLAPI void UpdateModelAnimationBakedBones(Model model, ModelAnimationBaked baked, int frame); // Update model animation mesh bone matrices from baked animation (GPU skinning)
+RLAPI void UnloadModelAnimationBaked(ModelAnimationBaked baked);                            // Unload baked animation data
 
 // Collision detection functions
 RLAPI bool CheckCollisionSpheres(Vector3 center1, float radius1, Vector3 center2, float radius2); // Check collision between two spheres
@@ -1633,10 +1705,15 @@ typedef void (*AudioCallback)(void *bufferData, unsigned int frames);
 
 // Audio device management functions
 RLAPI void InitAudioDevice(void);                                     // Initialize audio device and context
+RLAPI void InitAudioDeviceOffline(int sampleRate, const char *fileName); // Initialize audio without playback device, output written to WAV file (or discarded if NULL)
+RLAPI void UpdateAudioDeviceOffline(int frameCount);                  // Mix audio frames in offline mode (virtual clock)
 RLAPI void CloseAudioDevice(void);                                    // Close the audio device and context
 RLAPI bool IsAudioDeviceReady(void);                                  // Check if audio device has been initialized successfully
 RLAPI void SetMasterVolume(float volume);                             // Set master volume (listener)
 RLAPI float GetMasterVolume(void);                                    // Get master volume (listener)
+RLAPI AudioStats GetAudioStats(void);                                 // Get audio callback timing and underruns stats
+RLAPI void ResetAudioStats(void);                                     // Reset audio stats recorded
+RLAPI bool ExportAudioStats(const char *fileName);                    // Export audio stats as CSV, returns true on success
 
 // Wave/Sound loading/unloading functions
 RLAPI Wave LoadWave(const char *fileName);                            // Load wave data from file
@@ -1662,12 +1739,21 @@ RLAPI bool IsSoundPlaying(Sound sound);                               // Check i
 RLAPI void SetSoundVolume(Sound sound, float volume);                 // Set volume for a sound (1.0 is max level)
 RLAPI void SetSoundPitch(Sound sound, float pitch);                   // Set pitch for a sound (1.0 is base level)
 RLAPI void SetSoundPan(Sound sound, float pan);                       // Set pan for a sound (0.5 is center)
+RLAPI void PlaySoundPooled(Sound sound, int priority);                // Play a sound on a pooled voice, least important voice stolen if pool is full
+RLAPI void StopSoundPooled(Sound sound);                              // Stop pooled voices playing a sound
 RLAPI Wave WaveCopy(Wave wave);                                       // Copy a wave to a new wave
 RLAPI void WaveCrop(Wave *wave, int initFrame, int finalFrame);       // Crop a wave to defined frames range
 RLAPI void WaveFormat(Wave *wave, int sampleRate, int sampleSize, int channels); // Convert wave data to desired format
 RLAPI float *LoadWaveSamples(Wave wave);                              // Load samples data from wave as a 32bit float data array
 RLAPI void UnloadWaveSamples(float *samples);                         // Unload samples data loaded with LoadWaveSamples()
 
+// Spatial audio functions
+RLAPI void SetAudioListener(Camera3D camera);                         // Set audio listener from camera, emitters out of view are culled
+RLAPI void SetAudioSpatialDistance(float refDistance, float maxDistance, float rolloff); // Set emitters distance attenuation (inverse distance clamped)
+RLAPI void SetAudioDopplerFactor(float factor);                       // Set emitters doppler pitch factor (0.0 disables doppler)
+RLAPI void UpdateAudioEmitters(const AudioEmitter *emitters, int count); // Update emitters sounds volume, pan and pitch relative to listener (batched)
+RLAPI void PlayAudioEmitterPooled(AudioEmitter emitter, int priority); // Play emitter sound on a pooled voice, spatialized from emitter position
+
 // Music management functions
 RLAPI Music LoadMusicStream(const char *fileName);                    // Load music stream from file
 RLAPI Music LoadMusicStreamFromMemory(const char *fileType, const unsigned char *data, int dataSize); // Load music stream from data
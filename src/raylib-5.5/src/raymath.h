@@ -30,6 +30,13 @@
 *       #define RAYMATH_DISABLE_CPP_OPERATORS
 *           Disables C++ operator overloads for raymath types.
 *
+*       #define RAYMATH_DISABLE_SIMD
+*           Disables SIMD implementation of matrix and bulk transform functions.
+*           By default SIMD is used when the target supports it: SSE2 (x86/x64 desktop, AVX targets
+*           included) or WebAssembly simd128 (web, compiled with -msimd128).
+*           Matrix multiply and vector transform results are identical to the scalar version,
+*           other functions match it within float tolerance.
+*
 *   LICENSE: zlib/libpng
 *
 *   Copyright (c) 2015-2025 Ramon Santamaria (@raysan5)
@@ -170,6 +177,56 @@ typedef struct float16 {
 
 #include <math.h>       // Required for: sinf(), cosf(), tan(), atan2f(), sqrtf(), floor(), fminf(), fmaxf(), fabsf()
 
+//----------------------------------------------------------------------------------
+// SIMD backend selection (internal)
+//----------------------------------------------------------------------------------
+#if !defined(RAYMATH_DISABLE_SIMD)
+    #if defined(__wasm_simd128__)
+        #include <wasm_simd128.h>
+        #define RAYMATH_SIMD_WASM
+    #elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2))
+        #include <emmintrin.h>
+        #define RAYMATH_SIMD_SSE
+    #endif
+#endif
+
+// NOTE: 4-wide float vector operations, shuffle takes lanes x, y from a and lanes z, w from b
+#if defined(RAYMATH_SIMD_SSE)
+    #define RAYMATH_SIMD
+    typedef __m128 rmVec4;
+    #define RMVEC_LOAD(p)                   _mm_loadu_ps(p)
+    #define RMVEC_STORE(p, v)               _mm_storeu_ps(p, v)
+    #define RMVEC_SET(x, y, z, w)           _mm_setr_ps(x, y, z, w)
+    #define RMVEC_SET1(s)                   _mm_set1_ps(s)
+    #define RMVEC_ADD(a, b)                 _mm_add_ps(a, b)
+    #define RMVEC_SUB(a, b)                 _mm_sub_ps(a, b)
+    #define RMVEC_MUL(a, b)                 _mm_mul_ps(a, b)
+    #define RMVEC_DIV(a, b)                 _mm_div_ps(a, b)
+    #define RMVEC_SHUFFLE(a, b, x, y, z, w) _mm_shuffle_ps(a, b, _MM_SHUFFLE(w, z, y, x))
+#elif defined(RAYMATH_SIMD_WASM)
+    #define RAYMATH_SIMD
+    typedef v128_t rmVec4;
+    #define RMVEC_LOAD(p)                   wasm_v128_load(p)
+    #define RMVEC_STORE(p, v)               wasm_v128_store(p, v)
+    #define RMVEC_SET(x, y, z, w)           wasm_f32x4_make(x, y, z, w)
+    #define RMVEC_SET1(s)                   wasm_f32x4_splat(s)
+    #define RMVEC_ADD(a, b)                 wasm_f32x4_add(a, b)
+    #define RMVEC_SUB(a, b)                 wasm_f32x4_sub(a, b)
+    #define RMVEC_MUL(a, b)                 wasm_f32x4_mul(a, b)
+    #define RMVEC_DIV(a, b)                 wasm_f32x4_div(a, b)
+    #define RMVEC_SHUFFLE(a, b, x, y, z, w) wasm_i32x4_shuffle(a, b, x, y, (z) + 4, (w) + 4)
+#endif
+
+#if defined(RAYMATH_SIMD)
+    #define RMVEC_SWIZZLE(v, x, y, z, w)    RMVEC_SHUFFLE(v, v, x, y, z, w)
+    #define RMVEC_SPLAT(v, i)               RMVEC_SHUFFLE(v, v, i, i, i, i)
+
+    // 2x2 matrix operations (row-major, stored as one vector), used by MatrixInvert()
+    #define RMVEC_MAT2_MUL(a, b)            RMVEC_ADD(RMVEC_MUL(a, RMVEC_SWIZZLE(b, 0, 3, 0, 3)), RMVEC_MUL(RMVEC_SWIZZLE(a, 1, 0, 3, 2), RMVEC_SWIZZLE(b, 2, 1, 2, 1)))
+    #define RMVEC_MAT2_ADJMUL(a, b)         RMVEC_SUB(RMVEC_MUL(RMVEC_SWIZZLE(a, 3, 3, 0, 0), b), RMVEC_MUL(RMVEC_SWIZZLE(a, 1, 1, 2, 2), RMVEC_SWIZZLE(b, 2, 3, 0, 1)))
+    #define RMVEC_MAT2_MULADJ(a, b)         RMVEC_SUB(RMVEC_MUL(a, RMVEC_SWIZZLE(b, 3, 0, 3, 0)), RMVEC_MUL(RMVEC_SWIZZLE(a, 1, 0, 3, 2), RMVEC_SWIZZLE(b, 2, 1, 2, 1)))
+#endif
+
 //----------------------------------------------------------------------------------
 // Module Functions Definition - Utils math
 //----------------------------------------------------------------------------------
@@ -863,13 +920,85 @@ RMAPI Vector3 Vector3Transform(Vector3 v, Matrix mat)
     float y = v.y;
     float z = v.z;
 
+#if defined(RAYMATH_SIMD)
+    // Matrix columns (m0, m1, m2, m3)... are gathered from memory rows
+    rmVec4 r0 = RMVEC_LOAD(&mat.m0);
+    rmVec4 r1 = RMVEC_LOAD(&mat.m1);
+    rmVec4 r2 = RMVEC_LOAD(&mat.m2);
+    rmVec4 r3 = RMVEC_LOAD(&mat.m3);
+    rmVec4 t0 = RMVEC_SHUFFLE(r0, r1, 0, 1, 0, 1);
+    rmVec4 t1 = RMVEC_SHUFFLE(r0, r1, 2, 3, 2, 3);
+    rmVec4 t2 = RMVEC_SHUFFLE(r2, r3, 0, 1, 0, 1);
+    rmVec4 t3 = RMVEC_SHUFFLE(r2, r3, 2, 3, 2, 3);
+
+    rmVec4 res = RMVEC_MUL(RMVEC_SHUFFLE(t0, t2, 0, 2, 0, 2), RMVEC_SET1(x));
+    res = RMVEC_ADD(res, RMVEC_MUL(RMVEC_SHUFFLE(t0, t2, 1, 3, 1, 3), RMVEC_SET1(y)));
+    res = RMVEC_ADD(res, RMVEC_MUL(RMVEC_SHUFFLE(t1, t3, 0, 2, 0, 2), RMVEC_SET1(z)));
+    res = RMVEC_ADD(res, RMVEC_SHUFFLE(t1, t3, 1, 3, 1, 3));
+
+    float values[4] = { 0 };
+    RMVEC_STORE(values, res);
+
+    result.x = values[0];
+    result.y = values[1];
+    result.z = values[2];
+#else
     result.x = mat.m0*x + mat.m4*y + mat.m8*z + mat.m12;
     result.y = mat.m1*x + mat.m5*y + mat.m9*z + mat.m13;
     result.z = mat.m2*x + mat.m6*y + mat.m10*z + mat.m14;
+#endif
 
     return result;
 }
 
+// Transforms an array of Vector3 by a given Matrix
+// NOTE: output can be the same array as input
+RMAPI void Vector3TransformArray(const Vector3 *input, Vector3 *output, int count, Matrix mat)
+{
+#if defined(RAYMATH_SIMD)
+    // Matrix columns are gathered once for all the vectors
+    rmVec4 r0 = RMVEC_LOAD(&mat.m0);
+    rmVec4 r1 = RMVEC_LOAD(&mat.m1);
+    rmVec4 r2 = RMVEC_LOAD(&mat.m2);
+    rmVec4 r3 = RMVEC_LOAD(&mat.m3);
+    rmVec4 t0 = RMVEC_SHUFFLE(r0, r1, 0, 1, 0, 1);
+    rmVec4 t1 = RMVEC_SHUFFLE(r0, r1, 2, 3, 2, 3);
+    rmVec4 t2 = RMVEC_SHUFFLE(r2, r3, 0, 1, 0, 1);
+    rmVec4 t3 = RMVEC_SHUFFLE(r2, r3, 2, 3, 2, 3);
+    rmVec4 c0 = RMVEC_SHUFFLE(t0, t2, 0, 2, 0, 2);
+    rmVec4 c1 = RMVEC_SHUFFLE(t0, t2, 1, 3, 1, 3);
+    rmVec4 c2 = RMVEC_SHUFFLE(t1, t3, 0, 2, 0, 2);
+    rmVec4 c3 = RMVEC_SHUFFLE(t1, t3, 1, 3, 1, 3);
+
+    float values[4] = { 0 };
+
+    for (int i = 0; i < count; i++)
+    {
+        rmVec4 res = RMVEC_MUL(c0, RMVEC_SET1(input[i].x));
+        res = RMVEC_ADD(res, RMVEC_MUL(c1, RMVEC_SET1(input[i].y)));
+        res = RMVEC_ADD(res, RMVEC_MUL(c2, RMVEC_SET1(input[i].z)));
+        res = RMVEC_ADD(res, c3);
+
+        RMVEC_STORE(values, res);
+
+        output[i].x = values[0];
+        output[i].y = values[1];
+        output[i].z = values[2];
+    }
+#else
+    for (int i = 0; i < count; i++)
+    {
+        float x = input[i].x;
+        float y = input[i].y;
+        float z = input[i].z;
+
+        output[i].x = mat.m0*x + mat.m4*y + mat.m8*z + mat.m12;
+        output[i].y = mat.m1*x + mat.m5*y + mat.m9*z + mat.m13;
+        output[i].z = mat.m2*x + mat.m6*y + mat.m10*z + mat.m14;
+    }
+#endif
+}
+
 // Transform a vector by quaternion rotation
 RMAPI Vector3 Vector3RotateByQuaternion(Vector3 v, Quaternion q)
 {
@@ -1539,6 +1668,52 @@ RMAPI Matrix MatrixInvert(Matrix mat)
 {
     Matrix result = { 0 };
 
+#if defined(RAYMATH_SIMD)
+    // Block-wise inversion using 2x2 sub-matrices (adjugates and determinants)
+    // NOTE: Memory rows are the columns of the math matrix, inverting the transposed
+    // matrix and storing it the same way gives the inverse
+    rmVec4 r0 = RMVEC_LOAD(&mat.m0);
+    rmVec4 r1 = RMVEC_LOAD(&mat.m1);
+    rmVec4 r2 = RMVEC_LOAD(&mat.m2);
+    rmVec4 r3 = RMVEC_LOAD(&mat.m3);
+
+    rmVec4 a = RMVEC_SHUFFLE(r0, r1, 0, 1, 0, 1);
+    rmVec4 b = RMVEC_SHUFFLE(r0, r1, 2, 3, 2, 3);
+    rmVec4 c = RMVEC_SHUFFLE(r2, r3, 0, 1, 0, 1);
+    rmVec4 d = RMVEC_SHUFFLE(r2, r3, 2, 3, 2, 3);
+
+    // Sub-matrices determinants: (|A|, |B|, |C|, |D|)
+    rmVec4 detSub = RMVEC_SUB(RMVEC_MUL(RMVEC_SHUFFLE(r0, r2, 0, 2, 0, 2), RMVEC_SHUFFLE(r1, r3, 1, 3, 1, 3)),
+                              RMVEC_MUL(RMVEC_SHUFFLE(r0, r2, 1, 3, 1, 3), RMVEC_SHUFFLE(r1, r3, 0, 2, 0, 2)));
+    rmVec4 detA = RMVEC_SPLAT(detSub, 0);
+    rmVec4 detB = RMVEC_SPLAT(detSub, 1);
+    rmVec4 detC = RMVEC_SPLAT(detSub, 2);
+    rmVec4 detD = RMVEC_SPLAT(detSub, 3);
+
+    rmVec4 dc = RMVEC_MAT2_ADJMUL(d, c);
+    rmVec4 ab = RMVEC_MAT2_ADJMUL(a, b);
+    rmVec4 x = RMVEC_SUB(RMVEC_MUL(detD, a), RMVEC_MAT2_MUL(b, dc));
+    rmVec4 w = RMVEC_SUB(RMVEC_MUL(detA, d), RMVEC_MAT2_MUL(c, ab));
+    rmVec4 y = RMVEC_SUB(RMVEC_MUL(detB, c), RMVEC_MAT2_MULADJ(d, ab));
+    rmVec4 z = RMVEC_SUB(RMVEC_MUL(detC, b), RMVEC_MAT2_MULADJ(a, dc));
+
+    // Matrix determinant: |A||D| + |B||C| - tr((A#B)(D#C))
+    rmVec4 tr = RMVEC_MUL(ab, RMVEC_SWIZZLE(dc, 0, 2, 1, 3));
+    tr = RMVEC_ADD(tr, RMVEC_SWIZZLE(tr, 1, 0, 3, 2));
+    tr = RMVEC_ADD(tr, RMVEC_SWIZZLE(tr, 2, 3, 0, 1));
+    rmVec4 det = RMVEC_SUB(RMVEC_ADD(RMVEC_MUL(detA, detD), RMVEC_MUL(detB, detC)), tr);
+
+    rmVec4 invDet = RMVEC_DIV(RMVEC_SET(1.0f, -1.0f, -1.0f, 1.0f), det);
+    x = RMVEC_MUL(x, invDet);
+    y = RMVEC_MUL(y, invDet);
+    z = RMVEC_MUL(z, invDet);
+    w = RMVEC_MUL(w, invDet);
+
+    RMVEC_STORE(&result.m0, RMVEC_SHUFFLE(x, y, 3, 1, 3, 1));
+    RMVEC_STORE(&result.m1, RMVEC_SHUFFLE(x, y, 2, 0, 2, 0));
+    RMVEC_STORE(&result.m2, RMVEC_SHUFFLE(z, w, 3, 1, 3, 1));
+    RMVEC_STORE(&result.m3, RMVEC_SHUFFLE(z, w, 2, 0, 2, 0));
+#else
     // Cache the matrix values (speed optimization)
     float a00 = mat.m0, a01 = mat.m1, a02 = mat.m2, a03 = mat.m3;
     float a10 = mat.m4, a11 = mat.m5, a12 = mat.m6, a13 = mat.m7;
@@ -1577,6 +1752,7 @@ RMAPI Matrix MatrixInvert(Matrix mat)
     result.m13 = (a00*b09 - a01*b07 + a02*b06)*invDet;
     result.m14 = (-a30*b03 + a31*b01 - a32*b00)*invDet;
     result.m15 = (a20*b03 - a21*b01 + a22*b00)*invDet;
+#endif
 
     return result;
 }
@@ -1648,6 +1824,25 @@ RMAPI Matrix MatrixMultiply(Matrix left, Matrix right)
 {
     Matrix result = { 0 };
 
+#if defined(RAYMATH_SIMD)
+    // Every result memory row is a combination of left memory rows,
+    // weighted by the elements of the same right memory row
+    rmVec4 l0 = RMVEC_LOAD(&left.m0);
+    rmVec4 l1 = RMVEC_LOAD(&left.m1);
+    rmVec4 l2 = RMVEC_LOAD(&left.m2);
+    rmVec4 l3 = RMVEC_LOAD(&left.m3);
+    const float *r = &right.m0;
+
+    for (int i = 0; i < 4; i++)
+    {
+        rmVec4 row = RMVEC_MUL(l0, RMVEC_SET1(r[i*4]));
+        row = RMVEC_ADD(row, RMVEC_MUL(l1, RMVEC_SET1(r[i*4 + 1])));
+        row = RMVEC_ADD(row, RMVEC_MUL(l2, RMVEC_SET1(r[i*4 + 2])));
+        row = RMVEC_ADD(row, RMVEC_MUL(l3, RMVEC_SET1(r[i*4 + 3])));
+
+        RMVEC_STORE(&result.m0 + i*4, row);
+    }
+#else
     result.m0 = left.m0*right.m0 + left.m1*right.m4 + left.m2*right.m8 + left.m3*right.m12;
     result.m1 = left.m0*right.m1 + left.m1*right.m5 + left.m2*right.m9 + left.m3*right.m13;
     result.m2 = left.m0*right.m2 + left.m1*right.m6 + left.m2*right.m10 + left.m3*right.m14;
@@ -1664,10 +1859,61 @@ RMAPI Matrix MatrixMultiply(Matrix left, Matrix right)
     result.m13 = left.m12*right.m1 + left.m13*right.m5 + left.m14*right.m9 + left.m15*right.m13;
     result.m14 = left.m12*right.m2 + left.m13*right.m6 + left.m14*right.m10 + left.m15*right.m14;
     result.m15 = left.m12*right.m3 + left.m13*right.m7 + left.m14*right.m11 + left.m15*right.m15;
+#endif
 
     return result;
 }
 
+// Get multiplication of matrices arrays, element by element
+// NOTE: result can be the same array as left or right
+RMAPI void MatrixMultiplyArray(const Matrix *left, const Matrix *right, Matrix *result, int count)
+{
+    for (int i = 0; i < count; i++)
+    {
+        Matrix res = { 0 };
+
+#if defined(RAYMATH_SIMD)
+        rmVec4 l0 = RMVEC_LOAD(&left[i].m0);
+        rmVec4 l1 = RMVEC_LOAD(&left[i].m1);
+        rmVec4 l2 = RMVEC_LOAD(&left[i].m2);
+        rmVec4 l3 = RMVEC_LOAD(&left[i].m3);
+        const float *r = &right[i].m0;
+
+        for (int j = 0; j < 4; j++)
+        {
+            rmVec4 row = RMVEC_MUL(l0, RMVEC_SET1(r[j*4]));
+            row = RMVEC_ADD(row, RMVEC_MUL(l1, RMVEC_SET1(r[j*4 + 1])));
+            row = RMVEC_ADD(row, RMVEC_MUL(l2, RMVEC_SET1(r[j*4 + 2])));
+            row = RMVEC_ADD(row, RMVEC_MUL(l3, RMVEC_SET1(r[j*4 + 3])));
+
+            RMVEC_STORE(&res.m0 + j*4, row);
+        }
+#else
+        Matrix l = left[i];
+        Matrix r = right[i];
+
+        res.m0 = l.m0*r.m0 + l.m1*r.m4 + l.m2*r.m8 + l.m3*r.m12;
+        res.m1 = l.m0*r.m1 + l.m1*r.m5 + l.m2*r.m9 + l.m3*r.m13;
+        res.m2 = l.m0*r.m2 + l.m1*r.m6 + l.m2*r.m10 + l.m3*r.m14;
+        res.m3 = l.m0*r.m3 + l.m1*r.m7 + l.m2*r.m11 + l.m3*r.m15;
+        res.m4 = l.m4*r.m0 + l.m5*r.m4 + l.m6*r.m8 + l.m7*r.m12;
+        res.m5 = l.m4*r.m1 + l.m5*r.m5 + l.m6*r.m9 + l.m7*r.m13;
+        res.m6 = l.m4*r.m2 + l.m5*r.m6 + l.m6*r.m10 + l.m7*r.m14;
+        res.m7 = l.m4*r.m3 + l.m5*r.m7 + l.m6*r.m11 + l.m7*r.m15;
+        res.m8 = l.m8*r.m0 + l.m9*r.m4 + l.m10*r.m8 + l.m11*r.m12;
+        res.m9 = l.m8*r.m1 + l.m9*r.m5 + l.m10*r.m9 + l.m11*r.m13;
+        res.m10 = l.m8*r.m2 + l.m9*r.m6 + l.m10*r.m10 + l.m11*r.m14;
+        res.m11 = l.m8*r.m3 + l.m9*r.m7 + l.m10*r.m11 + l.m11*r.m15;
+        res.m12 = l.m12*r.m0 + l.m13*r.m4 + l.m14*r.m8 + l.m15*r.m12;
+        res.m13 = l.m12*r.m1 + l.m13*r.m5 + l.m14*r.m9 + l.m15*r.m13;
+        res.m14 = l.m12*r.m2 + l.m13*r.m6 + l.m14*r.m10 + l.m15*r.m14;
+        res.m15 = l.m12*r.m3 + l.m13*r.m7 + l.m14*r.m11 + l.m15*r.m15;
+#endif
+
+        result[i] = res;
+    }
+}
+
 // Get translation matrix
 RMAPI Matrix MatrixTranslate(float x, float y, float z)
 {
@@ -1701,6 +1947,17 @@ RMAPI Matrix MatrixRotate(Vector3 axis, float angle)
     float cosres = cosf(angle);
     float t = 1.0f - cosres;
 
+#if defined(RAYMATH_SIMD)
+    // Memory row i: axis*axis[i]*t plus the cosine/sine terms
+    rmVec4 v = RMVEC_SET(x, y, z, 0.0f);
+    rmVec4 vt = RMVEC_SET1(t);
+    float xs = x*sinres, ys = y*sinres, zs = z*sinres;
+
+    RMVEC_STORE(&result.m0, RMVEC_ADD(RMVEC_MUL(RMVEC_MUL(RMVEC_SET1(x), v), vt), RMVEC_SET(cosres, -zs, ys, 0.0f)));
+    RMVEC_STORE(&result.m1, RMVEC_ADD(RMVEC_MUL(RMVEC_MUL(RMVEC_SET1(y), v), vt), RMVEC_SET(zs, cosres, -xs, 0.0f)));
+    RMVEC_STORE(&result.m2, RMVEC_ADD(RMVEC_MUL(RMVEC_MUL(RMVEC_SET1(z), v), vt), RMVEC_SET(-ys, xs, cosres, 0.0f)));
+    RMVEC_STORE(&result.m3, RMVEC_SET(0.0f, 0.0f, 0.0f, 1.0f));
+#else
     result.m0 = x*x*t + cosres;
     result.m1 = y*x*t + z*sinres;
     result.m2 = z*x*t - y*sinres;
@@ -1720,6 +1977,7 @@ RMAPI Matrix MatrixRotate(Vector3 axis, float angle)
     result.m13 = 0.0f;
     result.m14 = 0.0f;
     result.m15 = 1.0f;
+#endif
 
     return result;
 }
@@ -2367,6 +2625,32 @@ RMAPI Matrix QuaternionToMatrix(Quaternion q)
                       0.0f, 0.0f, 1.0f, 0.0f,
                       0.0f, 0.0f, 0.0f, 1.0f }; // MatrixIdentity()
 
+#if defined(RAYMATH_SIMD)
+    rmVec4 v = RMVEC_SET(q.x, q.y, q.z, 0.0f);
+    rmVec4 sq = RMVEC_MUL(v, v);                                        // (a2, b2, c2, 0)
+    rmVec4 cross = RMVEC_MUL(v, RMVEC_SWIZZLE(v, 2, 0, 1, 3));           // (ac, ab, bc, 0)
+    rmVec4 wv = RMVEC_MUL(RMVEC_SET1(q.w), RMVEC_SWIZZLE(v, 1, 2, 0, 3)); // (bd, cd, ad, 0)
+    rmVec4 two = RMVEC_SET1(2.0f);
+
+    float diag[4] = { 0 };      // 1 - 2*(b2 + c2), 1 - 2*(a2 + c2), 1 - 2*(a2 + b2)
+    float lower[4] = { 0 };     // 2*(ac - bd), 2*(ab + cd), 2*(bc + ad)
+    float upper[4] = { 0 };     // 2*(ac + bd), 2*(ab - cd), 2*(bc - ad)
+    RMVEC_STORE(diag, RMVEC_SUB(RMVEC_SET1(1.0f), RMVEC_MUL(two, RMVEC_ADD(RMVEC_SWIZZLE(sq, 1, 0, 0, 3), RMVEC_SWIZZLE(sq, 2, 2, 1, 3)))));
+    RMVEC_STORE(lower, RMVEC_MUL(two, RMVEC_ADD(cross, RMVEC_MUL(wv, RMVEC_SET(-1.0f, 1.0f, 1.0f, 0.0f)))));
+    RMVEC_STORE(upper, RMVEC_MUL(two, RMVEC_SUB(cross, RMVEC_MUL(wv, RMVEC_SET(-1.0f, 1.0f, 1.0f, 0.0f)))));
+
+    result.m0 = diag[0];
+    result.m1 = lower[1];
+    result.m2 = lower[0];
+
+    result.m4 = upper[1];
+    result.m5 = diag[1];
+    result.m6 = lower[2];
+
+    result.m8 = upper[0];
+    result.m9 = upper[2];
+    result.m10 = diag[2];
+#else
     float a2 = q.x*q.x;
     float b2 = q.y*q.y;
     float c2 = q.z*q.z;
@@ -2388,6 +2672,7 @@ RMAPI Matrix QuaternionToMatrix(Quaternion q)
     result.m8 = 2*(ac + bd);
     result.m9 = 2*(bc - ad);
     result.m10 = 1 - 2*(a2 + b2);
+#endif
 
     return result;
 }
@@ -26,6 +26,8 @@
 *           - Linux DRM subsystem (KMS mode)
 *       > PLATFORM_ANDROID:
 *           - Android (ARM, ARM64)
+*       > PLATFORM_NULL:
+*           - Linux/BSD headless (no display, GL stubbed, virtual time, scripted input)
 *
 *   CONFIGURATION:
 *       #define SUPPORT_DEFAULT_FONT (default)
@@ -48,6 +50,15 @@
 *       #define SUPPORT_PARTIALBUSY_WAIT_LOOP
 *           Use a partial-busy wait loop, in this case frame sleeps for most of the time and runs a busy-wait-loop at the end
 *
+*       #define SUPPORT_PRECISE_FRAME_PACING
+*           Frames end on absolute deadlines (no drift) and WaitTime() sleeps until an absolute time,
+*           clock_nanosleep(TIMER_ABSTIME) on Linux/BSD. Sleep wake-up latency is measured and sleep ends
+*           that slack earlier, only the slack is busy waited (FRAME_PACING_MAX_SLACK at most).
+*           With EnableLowLatencyInput(), frame wait ends the estimated frame work time before the deadline,
+*           input events are polled just before next frame update and presented close to the deadline
+*           WARNING: Early wake only shifts the frame phase, poll-to-swap latency is still update plus draw time;
+*           deadline is not synced to display refresh, only FLAG_VSYNC_HINT swap blocks until next vblank
+*
 *       #define SUPPORT_SCREEN_CAPTURE
 *           Allow automatic screen capture of current screen pressing F12, defined in KeyCallback()
 *
@@ -97,9 +108,9 @@
     #define _XOPEN_SOURCE 500 // Required for: readlink if compiled with c99 without gnu ext.
 #endif
 
-#if (defined(__linux__) || defined(PLATFORM_WEB) || defined(PLATFORM_WEB_RGFW)) && (_POSIX_C_SOURCE < 199309L)
+#if (defined(__linux__) || defined(PLATFORM_WEB) || defined(PLATFORM_WEB_RGFW)) && (_POSIX_C_SOURCE < 200112L)
     #undef _POSIX_C_SOURCE
-    #define _POSIX_C_SOURCE 199309L // Required for: CLOCK_MONOTONIC if compiled with c99 without gnu ext.
+    #define _POSIX_C_SOURCE 200112L // Required for: CLOCK_MONOTONIC, clock_nanosleep() if compiled with c99 without gnu ext.
 #endif
 
 #include "raylib.h"                 // Declares module functions
@@ -115,6 +126,7 @@
 #include <stdio.h>                  // Required for: sprintf() [Used in OpenURL()]
 #include <string.h>                 // Required for: strrchr(), strcmp(), strlen(), memset()
 #include <time.h>                   // Required for: time() [Used in InitTimer()]
+#include <errno.h>                  // Required for: EINTR [Used in WaitUntil()]
 #include <math.h>                   // Required for: tan() [Used in BeginMode3D()], atan2f() [Used in LoadVrStereoConfig()]
 
 #define RLGL_IMPLEMENTATION
@@ -264,6 +276,13 @@ __declspec(dllimport) unsigned int __stdcall timeEndPeriod(unsigned int uPeriod)
     #define MAX_AUTOMATION_EVENTS      16384        // Maximum number of automation events to record
 #endif
 
+#ifndef FRAME_PACING_MAX_SLACK
+    #define FRAME_PACING_MAX_SLACK     0.002        // Maximum sleep wake-up slack busy waited by frame pacing (seconds)
+#endif
+#ifndef LOW_LATENCY_INPUT_MARGIN
+    #define LOW_LATENCY_INPUT_MARGIN   0.001        // Low latency input, frame work time estimate margin (seconds)
+#endif
+
 #ifndef DIRECTORY_FILTER_TAG
     #define DIRECTORY_FILTER_TAG       "DIR"        // Name tag used to request directory inclusion on directory scan
 #endif                                              // NOTE: Used in ScanDirectoryFiles(), ScanDirectoryFilesRecursively() and LoadDirectoryFilesEx()
@@ -290,6 +309,7 @@ typedef struct CoreData {
         bool shouldClose;                   // Check if window set for closing
         bool resizedLastFrame;              // Check if window has been resized last frame
         bool eventWaiting;                  // Wait for events before ending frame
+        bool lowLatencyInput;               // Poll events just before frame update, frame presented before next one (GL sync)
         bool usingFbo;                      // Using FBO (RenderTexture) for rendering instead of default framebuffer
 
         Point position;                     // Window position (required on fullscreen toggle)
@@ -362,6 +382,9 @@ typedef struct CoreData {
             float axisState[MAX_GAMEPADS][MAX_GAMEPAD_AXES];                // Gamepad axes state
 
         } Gamepad;
+
+        double pollTime;                    // Time events were last polled
+        double eventTime;                   // Time events not presented yet were polled, 0.0 if none
     } Input;
     struct {
         double current;                     // Current time measure
@@ -373,6 +396,24 @@ typedef struct CoreData {
         unsigned long long int base;        // Base time measure for hi-res timer (PLATFORM_ANDROID, PLATFORM_DRM)
         unsigned int frameCounter;          // Frame counter
 
+        double deadline;                    // Current frame end time, advanced by target time (0.0 if not synced)
+        long long int deadlineBase;         // GetTime() origin on CLOCK_MONOTONIC (nanoseconds), deadlines converted to absolute wake-up times
+        double slack;                       // Sleep wake-up latency average, sleep ends earlier by slack
+        double slackDeviation;              // Sleep wake-up latency average deviation
+        double inputLead;                   // Frame work time estimate, low latency input polled this time before deadline
+        struct {
+            unsigned int frameCount;        // Frames recorded
+            double frameTime;               // Frames total time
+            double frameTimeMin;            // Frame time minimum
+            double frameTimeMax;            // Frame time maximum
+            double jitter;                  // Frames total deviation from target time
+            double jitterMax;               // Frame maximum deviation from target time
+            double spinTime;                // Frames total busy wait time
+            unsigned int missedFrames;      // Frames ended after their deadline
+            unsigned int inputFrames;       // Frames presenting input events
+            double inputLatency;            // Frames total input-to-swap latency
+            double inputLatencyMax;         // Frame maximum input-to-swap latency
+        } Pacing;                           // Frame pacing stats
     } Time;
 } CoreData;
 
@@ -495,6 +536,9 @@ static bool automationEventRecording = false;               // Recording automat
 extern void LoadFontDefault(void);      // [Module: text] Loads default font on InitWindow()
 extern void UnloadFontDefault(void);    // [Module: text] Unloads default font from GPU memory
 #endif
+#if defined(SUPPORT_MODULE_RMODELS)
+extern void UnloadMeshTables(void);     // [Module: models] Unloads meshes bounds and quantization tables
+#endif
 
 extern int InitPlatform(void);          // Initialize platform (graphics, inputs and more)
 extern void ClosePlatform(void);        // Close platform
@@ -502,6 +546,11 @@ extern void ClosePlatform(void);        // Close platform
 static void InitTimer(void);                                // Initialize timer, hi-resolution if available (required by InitPlatform())
 static void SetupFramebuffer(int width, int height);        // Setup main framebuffer (required by InitPlatform())
 static void SetupViewport(int width, int height);           // Set viewport for a provided width and height
+#if defined(SUPPORT_PRECISE_FRAME_PACING)
+static void WaitUntil(double time);                         // Wait until time is reached, sleep wake-up slack busy waited
+#endif
+static void RecordFramePacing(double frameTime, double previousFrameTime);  // Record frame time and jitter
+static void RecordInputEvents(void);                        // Timestamp input events polled, presented by next frame
 
 static void ScanDirectoryFiles(const char *basePath, FilePathList *list, const char *filter);   // Scan all files and directories in a base path
 static void ScanDirectoryFilesRecursively(const char *basePath, FilePathList *list, const char *filter);  // Scan all files and directories recursively from a base path
@@ -559,6 +608,8 @@ const char *TextFormat(const char *text, ...);              // Formatting of tex
     #include "platforms/rcore_drm.c"
 #elif defined(PLATFORM_ANDROID)
     #include "platforms/rcore_android.c"
+#elif defined(PLATFORM_NULL)
+    #include "platforms/rcore_null.c"
 #else
     // TODO: Include your custom platform backend!
     // i.e software rendering backend or console backend!
@@ -630,6 +681,8 @@ void InitWindow(int width, int height, const char *title)
     TRACELOG(LOG_INFO, "Platform backend: NATIVE DRM");
 #elif defined(PLATFORM_ANDROID)
     TRACELOG(LOG_INFO, "Platform backend: ANDROID");
+#elif defined(PLATFORM_NULL)
+    TRACELOG(LOG_INFO, "Platform backend: NULL (headless)");
 #else
     // TODO: Include your custom platform backend!
     // i.e software rendering backend or console backend!
@@ -695,6 +748,11 @@ void InitWindow(int width, int height, const char *title)
     rlglInit(CORE.Window.currentFbo.width, CORE.Window.currentFbo.height);
     isGpuReady = true; // Flag to note GPU has been initialized successfully
 
+#if defined(GRAPHICS_API_SOFTWARE) && defined(SUPPORT_WORKER_THREADS)
+    // Software rasterizer tiles are rasterized in parallel by worker threads
+    swSetTaskRunner(RunWorkerTasks);
+#endif
+
     // Setup default viewport
     SetupViewport(CORE.Window.currentFbo.width, CORE.Window.currentFbo.height);
 
@@ -753,8 +811,14 @@ void CloseWindow(void)
     UnloadFontDefault();        // WARNING: Module required: rtext
 #endif
 
+#if defined(SUPPORT_MODULE_RMODELS)
+    UnloadMeshTables();         // WARNING: Module required: rmodels
+#endif
+
     rlglClose();                // De-init rlgl
 
+    CloseWorkerThreads();       // Stop worker threads (if started)
+
     // De-initialize platform
     //--------------------------------------------------------------
     ClosePlatform();
@@ -862,6 +926,24 @@ void DisableEventWaiting(void)
     CORE.Window.eventWaiting = false;
 }
 
+// Enable low latency input on EndDrawing(): frame waits for GPU to present it (GL sync),
+// frame wait ends early by the frame work time estimate and events are polled just before next frame update
+// NOTE: Swap interval is not changed, FLAG_VSYNC_HINT keeps controlling it
+// WARNING: Poll-to-swap latency is not reduced below update plus draw time, the gain is in the wait
+// no longer sitting between poll and update, and in no frames queued by driver
+void EnableLowLatencyInput(void)
+{
+    CORE.Window.lowLatencyInput = true;
+    CORE.Time.deadline = 0.0;       // Frame deadline synced again on next frame
+}
+
+// Disable low latency input, events polled after frame wait
+void DisableLowLatencyInput(void)
+{
+    CORE.Window.lowLatencyInput = false;
+    CORE.Time.deadline = 0.0;       // Frame deadline synced again on next frame
+}
+
 // Check if cursor is not visible
 bool IsCursorHidden(void)
 {
@@ -955,13 +1037,70 @@ void EndDrawing(void)
 #if !defined(SUPPORT_CUSTOM_FRAME_CONTROL)
     SwapScreenBuffer();                  // Copy back buffer to front buffer (screen)
 
+    // Input-to-swap latency, events polled before frame update
+    // NOTE: Measured at the same point in both input modes, before low latency GPU wait,
+    // GPU work and frames queued by driver after swap are not accounted in any mode
+    if (CORE.Input.eventTime > 0.0)
+    {
+        double latency = GetTime() - CORE.Input.eventTime;
+
+        CORE.Time.Pacing.inputFrames++;
+        CORE.Time.Pacing.inputLatency += latency;
+        if (latency > CORE.Time.Pacing.inputLatencyMax) CORE.Time.Pacing.inputLatencyMax = latency;
+
+        CORE.Input.eventTime = 0.0;
+    }
+
+    // Low latency input, frame presented before next one starts, no frames queued by driver
+    if (CORE.Window.lowLatencyInput) rlFinish();
+
     // Frame time control system
     CORE.Time.current = GetTime();
     CORE.Time.draw = CORE.Time.current - CORE.Time.previous;
     CORE.Time.previous = CORE.Time.current;
 
+    double previousFrameTime = CORE.Time.frame;
     CORE.Time.frame = CORE.Time.update + CORE.Time.draw;
 
+#if defined(SUPPORT_PRECISE_FRAME_PACING)
+    if (CORE.Time.target > 0.0)
+    {
+        // Low latency input, wait ends the frame work time estimate before deadline, frame presented close to it
+        // NOTE: Estimate follows longer frames at once and shorter ones slowly
+        // WARNING: Deadline is a timer deadline, not the display present time, without FLAG_VSYNC_HINT
+        // frame is presented as soon as it is drawn, early wake only moves polling next to frame update
+        double lead = 0.0;
+
+        if (CORE.Window.lowLatencyInput)
+        {
+            if (CORE.Time.frame > CORE.Time.inputLead) CORE.Time.inputLead = CORE.Time.frame;
+            else CORE.Time.inputLead += (CORE.Time.frame - CORE.Time.inputLead)/16.0;
+
+            lead = CORE.Time.inputLead + LOW_LATENCY_INPUT_MARGIN;
+            if (lead > CORE.Time.target) lead = CORE.Time.target;
+        }
+
+        // Frames end on absolute deadlines, wake-up errors do not accumulate frame to frame
+        // NOTE: Deadline is synced on first frame and when missed, late frames are not caught up
+        bool synced = (CORE.Time.deadline > 0.0);
+        double deadline = synced? (CORE.Time.deadline + CORE.Time.target) : (CORE.Time.current - CORE.Time.frame + CORE.Time.target);
+
+        if (CORE.Time.current > deadline)
+        {
+            if (synced) CORE.Time.Pacing.missedFrames++;
+            deadline = CORE.Time.current;
+        }
+        else if (CORE.Time.current < (deadline - lead)) WaitUntil(deadline - lead);
+
+        CORE.Time.deadline = deadline;
+
+        CORE.Time.current = GetTime();
+        double waitTime = CORE.Time.current - CORE.Time.previous;
+        CORE.Time.previous = CORE.Time.current;
+
+        CORE.Time.frame += waitTime;    // Total frame time: update + draw + wait
+    }
+#else
     // Wait for some milliseconds...
     if (CORE.Time.frame < CORE.Time.target)
     {
@@ -973,8 +1112,13 @@ void EndDrawing(void)
 
         CORE.Time.frame += waitTime;    // Total frame time: update + draw + wait
     }
+    else if (CORE.Time.target > 0.0) CORE.Time.Pacing.missedFrames++;
+#endif
+
+    RecordFramePacing(CORE.Time.frame, previousFrameTime);
 
     PollInputEvents();      // Poll user events (before next frame update)
+    RecordInputEvents();
 #endif
 
 #if defined(SUPPORT_SCREEN_CAPTURE)
@@ -1377,6 +1521,15 @@ Shader LoadShaderFromMemory(const char *vsCode, const char *fsCode)
         shader.locs[SHADER_LOC_MATRIX_MODEL] = rlGetLocationUniform(shader.id, RL_DEFAULT_SHADER_UNIFORM_NAME_MODEL);
         shader.locs[SHADER_LOC_MATRIX_NORMAL] = rlGetLocationUniform(shader.id, RL_DEFAULT_SHADER_UNIFORM_NAME_NORMAL);
         shader.locs[SHADER_LOC_BONE_MATRICES] = rlGetLocationUniform(shader.id, RL_DEFAULT_SHADER_UNIFORM_NAME_BONE_MATRICES);
+        shader.locs[SHADER_LOC_MATRIX_DEQUANTIZATION] = rlGetLocationUniform(shader.id, RL_DEFAULT_SHADER_UNIFORM_NAME_DEQUANTIZATION);
+
+        // Quantized mesh vertex positions decoding defaults to identity, only set while drawing quantized meshes
+        if (shader.locs[SHADER_LOC_MATRIX_DEQUANTIZATION] != -1)
+        {
+            rlEnableShader(shader.id);
+            rlSetUniformMatrix(shader.locs[SHADER_LOC_MATRIX_DEQUANTIZATION], MatrixIdentity());
+            rlDisableShader();
+        }
 
         // Get handles to GLSL uniform locations (fragment shader)
         shader.locs[SHADER_LOC_COLOR_DIFFUSE] = rlGetLocationUniform(shader.id, RL_DEFAULT_SHADER_UNIFORM_NAME_COLOR);
@@ -1670,6 +1823,8 @@ void SetTargetFPS(int fps)
     if (fps < 1) CORE.Time.target = 0.0;
     else CORE.Time.target = 1.0/(double)fps;
 
+    CORE.Time.deadline = 0.0;       // Frame deadline synced again on next frame
+
     TRACELOG(LOG_INFO, "TIMER: Target time per frame: %02.03f milliseconds", (float)CORE.Time.target*1000.0f);
 }
 
@@ -1722,6 +1877,39 @@ float GetFrameTime(void)
     return (float)CORE.Time.frame;
 }
 
+// Get frame time and pacing jitter stats
+FramePacingStats GetFramePacingStats(void)
+{
+    FramePacingStats stats = { 0 };
+
+    stats.frameCount = CORE.Time.Pacing.frameCount;
+
+    if (stats.frameCount > 0)
+    {
+        stats.frameTimeAvg = (float)(CORE.Time.Pacing.frameTime*1000.0/stats.frameCount);
+        stats.frameTimeMin = (float)(CORE.Time.Pacing.frameTimeMin*1000.0);
+        stats.frameTimeMax = (float)(CORE.Time.Pacing.frameTimeMax*1000.0);
+        stats.jitterAvg = (float)(CORE.Time.Pacing.jitter*1000.0/stats.frameCount);
+        stats.jitterMax = (float)(CORE.Time.Pacing.jitterMax*1000.0);
+        stats.spinTimeAvg = (float)(CORE.Time.Pacing.spinTime*1000.0/stats.frameCount);
+    }
+
+    stats.missedFrames = CORE.Time.Pacing.missedFrames;
+    stats.inputFrames = CORE.Time.Pacing.inputFrames;
+    if (stats.inputFrames > 0) stats.inputLatencyAvg = (float)(CORE.Time.Pacing.inputLatency*1000.0/stats.inputFrames);
+    stats.inputLatencyMax = (float)(CORE.Time.Pacing.inputLatencyMax*1000.0);
+    stats.sleepSlack = (float)((CORE.Time.slack + 2.0*CORE.Time.slackDeviation)*1000.0);
+
+    return stats;
+}
+
+// Reset frame pacing stats recorded
+// NOTE: Sleep wake-up slack measured is kept
+void ResetFramePacingStats(void)
+{
+    memset(&CORE.Time.Pacing, 0, sizeof(CORE.Time.Pacing));
+}
+
 //----------------------------------------------------------------------------------
 // Module Functions Definition: Custom frame control
 //----------------------------------------------------------------------------------
@@ -1739,6 +1927,15 @@ void WaitTime(double seconds)
 {
     if (seconds < 0) return;    // Security check
 
+#if defined(PLATFORM_NULL)
+    // Virtual time, no need to wait, just advance it
+    platform.time += seconds;
+    return;
+#endif
+
+#if defined(SUPPORT_PRECISE_FRAME_PACING) && !defined(SUPPORT_BUSY_WAIT_LOOP)
+    WaitUntil(GetTime() + seconds);
+#else
 #if defined(SUPPORT_BUSY_WAIT_LOOP) || defined(SUPPORT_PARTIALBUSY_WAIT_LOOP)
     double destinationTime = GetTime() + seconds;
 #endif
@@ -1774,6 +1971,7 @@ void WaitTime(double seconds)
         while (GetTime() < destinationTime) { }
     #endif
 #endif
+#endif  // SUPPORT_PRECISE_FRAME_PACING
 }
 
 //----------------------------------------------------------------------------------
@@ -2050,7 +2248,7 @@ const char *GetFileNameWithoutExt(const char *filePath)
 {
     #define MAX_FILENAME_LENGTH     256
 
-    static char fileName[MAX_FILENAME_LENGTH] = { 0 };
+    static RL_THREAD_LOCAL char fileName[MAX_FILENAME_LENGTH] = { 0 };
     memset(fileName, 0, MAX_FILENAME_LENGTH);
 
     if (filePath != NULL)
@@ -2085,7 +2283,7 @@ const char *GetDirectoryPath(const char *filePath)
     #endif
     */
     const char *lastSlash = NULL;
-    static char dirPath[MAX_FILEPATH_LENGTH] = { 0 };
+    static RL_THREAD_LOCAL char dirPath[MAX_FILEPATH_LENGTH] = { 0 };
     memset(dirPath, 0, MAX_FILEPATH_LENGTH);
 
     // In case provided path does not contain a root drive letter (C:\, D:\) nor leading path separator (\, /),
@@ -2123,7 +2321,7 @@ const char *GetDirectoryPath(const char *filePath)
 // Get previous directory path for a given path
 const char *GetPrevDirectoryPath(const char *dirPath)
 {
-    static char prevDirPath[MAX_FILEPATH_LENGTH] = { 0 };
+    static RL_THREAD_LOCAL char prevDirPath[MAX_FILEPATH_LENGTH] = { 0 };
     memset(prevDirPath, 0, MAX_FILEPATH_LENGTH);
     int pathLen = (int)strlen(dirPath);
 
@@ -3587,6 +3785,107 @@ void InitTimer(void)
 #endif
 
     CORE.Time.previous = GetTime();     // Get time as double
+
+#if defined(SUPPORT_PRECISE_FRAME_PACING)
+    CORE.Time.slack = FRAME_PACING_MAX_SLACK;   // Conservative until wake-up latency is measured
+    CORE.Time.slackDeviation = 0.0;
+
+    #if defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__)
+    // NOTE: GetTime() origin depends on platform (i.e. glfwInit() on GLFW), it is measured
+    // once against CLOCK_MONOTONIC, frame deadlines are slept to without any relative time
+    if (clock_gettime(CLOCK_MONOTONIC, &now) == 0)
+    {
+        CORE.Time.deadlineBase = (long long int)now.tv_sec*1000000000LL + now.tv_nsec - (long long int)(GetTime()*1000000000.0);
+    }
+    #endif
+#endif
+}
+
+#if defined(SUPPORT_PRECISE_FRAME_PACING)
+// Wait until time is reached (GetTime() clock), sleeping until slack before it and busy waiting the rest
+// NOTE: Wake-up latency is measured on every sleep, slack is its average plus twice its deviation
+static void WaitUntil(double time)
+{
+#if defined(PLATFORM_NULL)
+    // Virtual time, no need to wait, just advance it
+    if (time > platform.time) platform.time = time;
+    return;
+#endif
+
+    double slack = CORE.Time.slack + 2.0*CORE.Time.slackDeviation;
+    if (slack > FRAME_PACING_MAX_SLACK) slack = FRAME_PACING_MAX_SLACK;
+    else if (slack < 0.0) slack = 0.0;
+
+    double wakeUp = time - slack;
+    double sleepSeconds = wakeUp - GetTime();
+
+    if (sleepSeconds > 0.0)
+    {
+    #if defined(_WIN32)
+        Sleep((unsigned long)(sleepSeconds*1000.0));
+    #elif defined(__linux__) || defined(__FreeBSD__) || defined(__OpenBSD__)
+        // Absolute wake-up time derived from the deadline, any delay before sleeping or
+        // sleep restarted after a signal does not extend it
+        long long int nsec = CORE.Time.deadlineBase + (long long int)(wakeUp*1000000000.0);
+        struct timespec wakeTime = { 0 };
+        wakeTime.tv_sec = (time_t)(nsec/1000000000LL);
+        wakeTime.tv_nsec = (long)(nsec%1000000000LL);
+
+        while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &wakeTime, NULL) == EINTR) continue;
+    #elif defined(__EMSCRIPTEN__)
+        struct timespec req = { 0 };
+        req.tv_sec = (time_t)sleepSeconds;
+        req.tv_nsec = (long)((sleepSeconds - req.tv_sec)*1000000000.0);
+
+        while (nanosleep(&req, &req) == -1) continue;
+    #elif defined(__APPLE__)
+        usleep(sleepSeconds*1000000.0);
+    #endif
+
+        // Wake-up latency averages, updated with 1/16 weight
+        double latency = GetTime() - wakeUp;
+        CORE.Time.slackDeviation += (fabs(latency - CORE.Time.slack) - CORE.Time.slackDeviation)/16.0;
+        CORE.Time.slack += (latency - CORE.Time.slack)/16.0;
+    }
+
+    double spinStart = GetTime();
+    while (GetTime() < time) { }
+    CORE.Time.Pacing.spinTime += GetTime() - spinStart;
+}
+#endif
+
+// Record frame time and jitter, deviation from target time (or from previous frame time if no target)
+static void RecordFramePacing(double frameTime, double previousFrameTime)
+{
+    double jitter = 0.0;
+
+    if (CORE.Time.target > 0.0) jitter = fabs(frameTime - CORE.Time.target);
+    else if (CORE.Time.Pacing.frameCount > 0) jitter = fabs(frameTime - previousFrameTime);
+
+    if ((CORE.Time.Pacing.frameCount == 0) || (frameTime < CORE.Time.Pacing.frameTimeMin)) CORE.Time.Pacing.frameTimeMin = frameTime;
+    if (frameTime > CORE.Time.Pacing.frameTimeMax) CORE.Time.Pacing.frameTimeMax = frameTime;
+    if (jitter > CORE.Time.Pacing.jitterMax) CORE.Time.Pacing.jitterMax = jitter;
+
+    CORE.Time.Pacing.frameCount++;
+    CORE.Time.Pacing.frameTime += frameTime;
+    CORE.Time.Pacing.jitter += jitter;
+}
+
+// Timestamp input events polled: keys, characters, buttons, mouse and touch changes
+// NOTE: Platforms do not provide events time, events are timestamped when polled
+static void RecordInputEvents(void)
+{
+    bool polled = (CORE.Input.Keyboard.keyPressedQueueCount > 0) || (CORE.Input.Keyboard.charPressedQueueCount > 0) ||
+        (memcmp(CORE.Input.Keyboard.currentKeyState, CORE.Input.Keyboard.previousKeyState, MAX_KEYBOARD_KEYS) != 0) ||
+        (memcmp(CORE.Input.Mouse.currentButtonState, CORE.Input.Mouse.previousButtonState, MAX_MOUSE_BUTTONS) != 0) ||
+        (CORE.Input.Mouse.currentPosition.x != CORE.Input.Mouse.previousPosition.x) ||
+        (CORE.Input.Mouse.currentPosition.y != CORE.Input.Mouse.previousPosition.y) ||
+        (CORE.Input.Mouse.currentWheelMove.x != 0.0f) || (CORE.Input.Mouse.currentWheelMove.y != 0.0f) ||
+        (memcmp(CORE.Input.Touch.currentTouchState, CORE.Input.Touch.previousTouchState, MAX_TOUCH_POINTS) != 0) ||
+        (memcmp(CORE.Input.Gamepad.currentButtonState, CORE.Input.Gamepad.previousButtonState, sizeof(CORE.Input.Gamepad.currentButtonState)) != 0);
+
+    CORE.Input.pollTime = GetTime();
+    CORE.Input.eventTime = polled? CORE.Input.pollTime : 0.0;
 }
 
 // Set viewport for a provided width and height
@@ -4107,8 +4406,9 @@ const char *TextFormat(const char *text, ...)
 #endif
 
     // We create an array of buffers so strings don't expire until MAX_TEXTFORMAT_BUFFERS invocations
-    static char buffers[MAX_TEXTFORMAT_BUFFERS][MAX_TEXT_BUFFER_LENGTH] = { 0 };
-    static int index = 0;
+    // NOTE: Buffers are kept per thread, assets can be loaded from worker threads
+    static RL_THREAD_LOCAL char buffers[MAX_TEXTFORMAT_BUFFERS][MAX_TEXT_BUFFER_LENGTH] = { 0 };
+    static RL_THREAD_LOCAL int index = 0;
 
     char *currentBuffer = buffers[index];
     memset(currentBuffer, 0, MAX_TEXT_BUFFER_LENGTH);   // Clear buffer before using
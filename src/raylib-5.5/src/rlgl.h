@@ -31,6 +31,10 @@
 *           Those preprocessor defines are only used on rlgl module, if OpenGL version is
 *           required by any other module, use rlGetVersion() to check it
 *
+*       #define GRAPHICS_API_SOFTWARE
+*           Use OpenGL 3.3 backend implemented by the rlsw software rasterizer (rlsw.h),
+*           no GPU or OpenGL driver required, GL functions are loaded from swGetProcAddress()
+*
 *       #define RLGL_IMPLEMENTATION
 *           Generates the implementation of the library into the included file
 *           If not defined, the library is in header only mode and can be included in other headers
@@ -46,6 +50,11 @@
 *       #define RLGL_ENABLE_OPENGL_DEBUG_CONTEXT
 *           Enable debug context (only available on OpenGL 4.3)
 *
+*       #define RLGL_ENABLE_STATE_CACHE
+*           Track bound shader program, textures, VAO, render states and uniform values,
+*           skipping OpenGL calls that would not change anything (not available on OpenGL 1.1)
+*           NOTE: If raw OpenGL calls are mixed with rlgl, call rlResetStateCache() after them
+*
 *       rlgl capabilities could be customized just defining some internal
 *       values before library inclusion (default values listed):
 *
@@ -56,6 +65,8 @@
 *
 *       #define RL_MAX_MATRIX_STACK_SIZE             32    // Maximum size of internal Matrix stack
 *       #define RL_MAX_SHADER_LOCATIONS              32    // Maximum number of shader locations supported
+*       #define RL_MAX_CACHED_TEXTURE_UNITS          16    // Maximum number of texture units tracked by state cache
+*       #define RL_MAX_CACHED_UNIFORMS              512    // Maximum number of uniform values tracked by state cache
 *       #define RL_CULL_DISTANCE_NEAR              0.05    // Default projection matrix near cull distance
 *       #define RL_CULL_DISTANCE_FAR             4000.0    // Default projection matrix far cull distance
 *
@@ -77,6 +88,7 @@
 *       #define RL_DEFAULT_SHADER_UNIFORM_NAME_NORMAL      "matNormal"         // normal matrix (transpose(inverse(matModelView)))
 *       #define RL_DEFAULT_SHADER_UNIFORM_NAME_COLOR       "colDiffuse"        // color diffuse (base tint color, multiplied by texture color)
 *       #define RL_DEFAULT_SHADER_UNIFORM_NAME_BONE_MATRICES  "boneMatrices"   // bone matrices
+*       #define RL_DEFAULT_SHADER_UNIFORM_NAME_DEQUANTIZATION "matDequantization" // quantized mesh vertex positions decoding matrix
 *       #define RL_DEFAULT_SHADER_SAMPLER2D_NAME_TEXTURE0  "texture0"          // texture0 (texture slot active 0)
 *       #define RL_DEFAULT_SHADER_SAMPLER2D_NAME_TEXTURE1  "texture1"          // texture1 (texture slot active 1)
 *       #define RL_DEFAULT_SHADER_SAMPLER2D_NAME_TEXTURE2  "texture2"          // texture2 (texture slot active 2)
@@ -148,6 +160,13 @@
     #define RL_FREE(p)        free(p)
 #endif
 
+// Software rasterizer implements the OpenGL 3.3 Core subset used by rlgl
+#if defined(GRAPHICS_API_SOFTWARE)
+    #if !defined(GRAPHICS_API_OPENGL_33)
+        #define GRAPHICS_API_OPENGL_33
+    #endif
+#endif
+
 // Security check in case no GRAPHICS_API_OPENGL_* defined
 #if !defined(GRAPHICS_API_OPENGL_11) && \
     !defined(GRAPHICS_API_OPENGL_21) && \
@@ -232,6 +251,14 @@
     #define RL_MAX_SHADER_LOCATIONS                 32      // Maximum number of shader locations supported
 #endif
 
+// State cache limits
+#ifndef RL_MAX_CACHED_TEXTURE_UNITS
+    #define RL_MAX_CACHED_TEXTURE_UNITS             16      // Maximum number of texture units tracked by state cache
+#endif
+#ifndef RL_MAX_CACHED_UNIFORMS
+    #define RL_MAX_CACHED_UNIFORMS                 512      // Maximum number of uniform values tracked by state cache (power of two)
+#endif
+
 // Projection matrix culling
 #ifndef RL_CULL_DISTANCE_NEAR
     #define RL_CULL_DISTANCE_NEAR                 0.05      // Default near cull distance
@@ -271,7 +298,9 @@
 #define RL_QUADS                                0x0007      // GL_QUADS
 
 // GL equivalent data types
+#define RL_BYTE                                 0x1400      // GL_BYTE
 #define RL_UNSIGNED_BYTE                        0x1401      // GL_UNSIGNED_BYTE
+#define RL_UNSIGNED_SHORT                       0x1403      // GL_UNSIGNED_SHORT
 #define RL_FLOAT                                0x1406      // GL_FLOAT
 
 // GL buffer usage hint
@@ -528,7 +557,12 @@ typedef enum {
     RL_SHADER_LOC_MAP_CUBEMAP,          // Shader location: samplerCube texture: cubemap
     RL_SHADER_LOC_MAP_IRRADIANCE,       // Shader location: samplerCube texture: irradiance
     RL_SHADER_LOC_MAP_PREFILTER,        // Shader location: samplerCube texture: prefilter
-    RL_SHADER_LOC_MAP_BRDF              // Shader location: sampler2d texture: brdf
+    RL_SHADER_LOC_MAP_BRDF,             // Shader location: sampler2d texture: brdf
+    RL_SHADER_LOC_VERTEX_BONEIDS,       // Shader location: vertex attribute: boneIds
+    RL_SHADER_LOC_VERTEX_BONEWEIGHTS,   // Shader location: vertex attribute: boneWeights
+    RL_SHADER_LOC_BONE_MATRICES,        // Shader location: array of matrices uniform: boneMatrices
+    RL_SHADER_LOC_VERTEX_INSTANCE_TX,   // Shader location: vertex attribute: instanceTransform
+    RL_SHADER_LOC_MATRIX_DEQUANTIZATION // Shader location: matrix uniform: quantized mesh vertex positions decoding
 } rlShaderLocationIndex;
 
 #define RL_SHADER_LOC_MAP_DIFFUSE       RL_SHADER_LOC_MAP_ALBEDO
@@ -699,9 +733,11 @@ RLAPI bool rlIsStereoRenderEnabled(void);               // Check if stereo rende
 RLAPI void rlClearColor(unsigned char r, unsigned char g, unsigned char b, unsigned char a); // Clear color buffer with color
 RLAPI void rlClearScreenBuffers(void);                  // Clear used screen buffers (color and depth)
 RLAPI void rlCheckErrors(void);                         // Check and log OpenGL error codes
+RLAPI void rlFinish(void);                              // Wait for GPU to complete all queued commands (GL sync)
 RLAPI void rlSetBlendMode(int mode);                    // Set blending mode
 RLAPI void rlSetBlendFactors(int glSrcFactor, int glDstFactor, int glEquation); // Set blending mode factor and equation (using OpenGL factors)
 RLAPI void rlSetBlendFactorsSeparate(int glSrcRGB, int glDstRGB, int glSrcAlpha, int glDstAlpha, int glEqRGB, int glEqAlpha); // Set blending mode factors and equations separately (using OpenGL factors)
+RLAPI void rlResetStateCache(void);                     // Reset OpenGL state cache (required after raw OpenGL state changes)
 
 //------------------------------------------------------------------------------------
 // Functions Declaration - rlgl functionality
@@ -777,6 +813,7 @@ RLAPI int rlGetLocationUniform(unsigned int shaderId, const char *uniformName);
 RLAPI int rlGetLocationAttrib(unsigned int shaderId, const char *attribName);   // Get shader location attribute
 RLAPI void rlSetUniform(int locIndex, const void *value, int uniformType, int count); // Set shader value uniform
 RLAPI void rlSetUniformMatrix(int locIndex, Matrix mat);                        // Set shader value matrix
+RLAPI void rlSetUniformMatrixNormal(int locIndex, Matrix model);                // Set shader normal matrix computed from model matrix (inverse transpose)
 RLAPI void rlSetUniformMatrices(int locIndex, const Matrix *mat, int count);    // Set shader value matrices
 RLAPI void rlSetUniformSampler(int locIndex, unsigned int textureId);           // Set shader value sampler
 RLAPI void rlSetShader(unsigned int id, int *locs);                             // Set shader currently active (id and locations)
@@ -860,6 +897,16 @@ RLAPI void rlLoadDrawQuad(void);     // Load and draw a quad
 
     #define GLAD_GL_IMPLEMENTATION
     #include "external/glad.h"          // GLAD extensions loading library, includes OpenGL headers
+
+    #if defined(GRAPHICS_API_SOFTWARE)
+        #define RLSW_MALLOC RL_MALLOC
+        #define RLSW_CALLOC RL_CALLOC
+        #define RLSW_REALLOC RL_REALLOC
+        #define RLSW_FREE RL_FREE
+
+        #define RLSW_IMPLEMENTATION
+        #include "rlsw.h"               // Software rasterizer, provides OpenGL functions loaded by glad
+    #endif
 #endif
 
 #if defined(GRAPHICS_API_OPENGL_ES3)
@@ -1027,6 +1074,9 @@ RLAPI void rlLoadDrawQuad(void);     // Load and draw a quad
 #ifndef RL_DEFAULT_SHADER_UNIFORM_NAME_BONE_MATRICES
     #define RL_DEFAULT_SHADER_UNIFORM_NAME_BONE_MATRICES  "boneMatrices"   // bone matrices
 #endif
+#ifndef RL_DEFAULT_SHADER_UNIFORM_NAME_DEQUANTIZATION
+    #define RL_DEFAULT_SHADER_UNIFORM_NAME_DEQUANTIZATION "matDequantization" // quantized mesh vertex positions decoding matrix
+#endif
 #ifndef RL_DEFAULT_SHADER_SAMPLER2D_NAME_TEXTURE0
     #define RL_DEFAULT_SHADER_SAMPLER2D_NAME_TEXTURE0  "texture0"          // texture0 (texture slot active 0)
 #endif
@@ -1037,9 +1087,29 @@ RLAPI void rlLoadDrawQuad(void);     // Load and draw a quad
     #define RL_DEFAULT_SHADER_SAMPLER2D_NAME_TEXTURE2  "texture2"          // texture2 (texture slot active 2)
 #endif
 
+// OpenGL state cache is not available for OpenGL 1.1 fixed pipeline
+#if defined(RLGL_ENABLE_STATE_CACHE) && defined(GRAPHICS_API_OPENGL_11)
+    #undef RLGL_ENABLE_STATE_CACHE
+#endif
+
+#define RL_CACHE_UNKNOWN_ID         0xFFFFFFFF      // Cached object id not known, next bind always reaches OpenGL
+#define RL_CACHE_UNIFORM_MATRIX             -1      // Cached uniform type for rlSetUniformMatrix() values
+#define RL_CACHE_UNIFORM_PROBES              8      // Cached uniform slots checked on lookup before evicting one
+
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
+#if defined(RLGL_ENABLE_STATE_CACHE)
+// Uniform value tracked by state cache
+typedef struct rlCachedUniform {
+    unsigned int program;                   // Shader program id (0 if slot is free)
+    int location;                           // Uniform location
+    int type;                               // Uniform type (RL_SHADER_UNIFORM_* or RL_CACHE_UNIFORM_MATRIX)
+    int size;                               // Uniform data size in bytes
+    unsigned char data[64];                 // Uniform data (up to a 4x4 float matrix)
+} rlCachedUniform;
+#endif
+
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
 typedef struct rlglData {
     rlRenderBatch *currentBatch;            // Current render batch
@@ -1090,6 +1160,23 @@ typedef struct rlglData {
         int framebufferHeight;              // Current framebuffer height
 
     } State;            // Renderer state
+#if defined(RLGL_ENABLE_STATE_CACHE)
+    struct {
+        unsigned int program;               // Shader program currently in use
+        int textureSlot;                    // Texture slot currently active (-1 if unknown)
+        unsigned int texture2D[RL_MAX_CACHED_TEXTURE_UNITS];        // 2D texture bound per texture slot
+        unsigned int textureCubemap[RL_MAX_CACHED_TEXTURE_UNITS];   // Cubemap texture bound per texture slot
+        unsigned int vertexArray;           // Vertex array object currently bound
+        int colorBlend;                     // Color blending enabled (-1 if unknown)
+        int depthTest;                      // Depth test enabled (-1 if unknown)
+        int depthMask;                      // Depth write enabled (-1 if unknown)
+        int backfaceCulling;                // Backface culling enabled (-1 if unknown)
+        rlCachedUniform uniforms[RL_MAX_CACHED_UNIFORMS];   // Last uniform values uploaded, per program and location
+        Matrix normalModel;                 // Model matrix the cached normal matrix was computed from
+        Matrix normal;                      // Normal matrix cached, inverse transpose of normalModel
+        bool normalValid;                   // Normal matrix cached is valid
+    } Cache;            // OpenGL state cache
+#endif
     struct {
         bool vao;                           // VAO support (OpenGL ES2 could not support VAO extension) (GL_ARB_vertex_array_object)
         bool instancing;                    // Instancing supported (GL_ANGLE_instanced_arrays, GL_EXT_draw_instanced + GL_EXT_instanced_arrays)
@@ -1153,6 +1240,22 @@ static const char *rlGetCompressedFormatName(int format); // Get compressed form
 
 static int rlGetPixelDataSize(int width, int height, int format);   // Get pixel data size in bytes (image or texture)
 
+// OpenGL state cache functions
+// NOTE: Without RLGL_ENABLE_STATE_CACHE they just call the equivalent OpenGL function
+static void rlCacheBindTexture(unsigned int target, unsigned int id);   // Bind texture to active texture slot
+static void rlCacheSetCapability(unsigned int cap, bool enabled);       // Enable/disable render state (blending, depth test, culling)
+static void rlCacheDepthMask(bool enabled);                             // Enable/disable depth write
+static void rlCacheForgetTexture(unsigned int id);                      // Forget bindings of a deleted texture
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+static void rlCacheUseProgram(unsigned int id);                         // Use shader program
+static void rlCacheActiveTexture(int slot);                             // Select active texture slot
+static void rlCacheBindVertexArray(unsigned int id);                    // Bind vertex array object
+static bool rlCacheUniform(int locIndex, int type, const void *value, int count); // Check if uniform value changed for current program (and cache it)
+static void rlCacheForgetUniforms(int locIndex, int count);             // Forget uniform values cached for current program
+static void rlCacheForgetProgram(unsigned int id);                      // Forget state cached for a deleted program
+static void rlCacheForgetVertexArray(unsigned int id);                  // Forget binding of a deleted vertex array object
+#endif
+
 // Auxiliar matrix math functions
 typedef struct rl_float16 {
     float v[16];
@@ -1687,7 +1790,7 @@ void rlSetTexture(unsigned int id)
 void rlActiveTextureSlot(int slot)
 {
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    glActiveTexture(GL_TEXTURE0 + slot);
+    rlCacheActiveTexture(slot);
 #endif
 }
 
@@ -1697,7 +1800,7 @@ void rlEnableTexture(unsigned int id)
 #if defined(GRAPHICS_API_OPENGL_11)
     glEnable(GL_TEXTURE_2D);
 #endif
-    glBindTexture(GL_TEXTURE_2D, id);
+    rlCacheBindTexture(GL_TEXTURE_2D, id);
 }
 
 // Disable texture
@@ -1706,14 +1809,14 @@ void rlDisableTexture(void)
 #if defined(GRAPHICS_API_OPENGL_11)
     glDisable(GL_TEXTURE_2D);
 #endif
-    glBindTexture(GL_TEXTURE_2D, 0);
+    rlCacheBindTexture(GL_TEXTURE_2D, 0);
 }
 
 // Enable texture cubemap
 void rlEnableTextureCubemap(unsigned int id)
 {
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    glBindTexture(GL_TEXTURE_CUBE_MAP, id);
+    rlCacheBindTexture(GL_TEXTURE_CUBE_MAP, id);
 #endif
 }
 
@@ -1721,14 +1824,14 @@ void rlEnableTextureCubemap(unsigned int id)
 void rlDisableTextureCubemap(void)
 {
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    glBindTexture(GL_TEXTURE_CUBE_MAP, 0);
+    rlCacheBindTexture(GL_TEXTURE_CUBE_MAP, 0);
 #endif
 }
 
 // Set texture parameters (wrap mode/filter mode)
 void rlTextureParameters(unsigned int id, int param, int value)
 {
-    glBindTexture(GL_TEXTURE_2D, id);
+    rlCacheBindTexture(GL_TEXTURE_2D, id);
 
 #if !defined(GRAPHICS_API_OPENGL_11)
     // Reset anisotropy filter, in case it was set
@@ -1769,14 +1872,14 @@ void rlTextureParameters(unsigned int id, int param, int value)
         default: break;
     }
 
-    glBindTexture(GL_TEXTURE_2D, 0);
+    rlCacheBindTexture(GL_TEXTURE_2D, 0);
 }
 
 // Set cubemap parameters (wrap mode/filter mode)
 void rlCubemapParameters(unsigned int id, int param, int value)
 {
 #if !defined(GRAPHICS_API_OPENGL_11)
-    glBindTexture(GL_TEXTURE_CUBE_MAP, id);
+    rlCacheBindTexture(GL_TEXTURE_CUBE_MAP, id);
 
     // Reset anisotropy filter, in case it was set
     glTexParameterf(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_MAX_ANISOTROPY_EXT, 1.0f);
@@ -1811,7 +1914,7 @@ void rlCubemapParameters(unsigned int id, int param, int value)
         default: break;
     }
 
-    glBindTexture(GL_TEXTURE_CUBE_MAP, 0);
+    rlCacheBindTexture(GL_TEXTURE_CUBE_MAP, 0);
 #endif
 }
 
@@ -1819,7 +1922,7 @@ void rlCubemapParameters(unsigned int id, int param, int value)
 void rlEnableShader(unsigned int id)
 {
 #if (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2))
-    glUseProgram(id);
+    rlCacheUseProgram(id);
 #endif
 }
 
@@ -1827,7 +1930,7 @@ void rlEnableShader(unsigned int id)
 void rlDisableShader(void)
 {
 #if (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2))
-    glUseProgram(0);
+    rlCacheUseProgram(0);
 #endif
 }
 
@@ -1911,28 +2014,28 @@ void rlActiveDrawBuffers(int count)
 //----------------------------------------------------------------------------------
 
 // Enable color blending
-void rlEnableColorBlend(void) { glEnable(GL_BLEND); }
+void rlEnableColorBlend(void) { rlCacheSetCapability(GL_BLEND, true); }
 
 // Disable color blending
-void rlDisableColorBlend(void) { glDisable(GL_BLEND); }
+void rlDisableColorBlend(void) { rlCacheSetCapability(GL_BLEND, false); }
 
 // Enable depth test
-void rlEnableDepthTest(void) { glEnable(GL_DEPTH_TEST); }
+void rlEnableDepthTest(void) { rlCacheSetCapability(GL_DEPTH_TEST, true); }
 
 // Disable depth test
-void rlDisableDepthTest(void) { glDisable(GL_DEPTH_TEST); }
+void rlDisableDepthTest(void) { rlCacheSetCapability(GL_DEPTH_TEST, false); }
 
 // Enable depth write
-void rlEnableDepthMask(void) { glDepthMask(GL_TRUE); }
+void rlEnableDepthMask(void) { rlCacheDepthMask(true); }
 
 // Disable depth write
-void rlDisableDepthMask(void) { glDepthMask(GL_FALSE); }
+void rlDisableDepthMask(void) { rlCacheDepthMask(false); }
 
 // Enable backface culling
-void rlEnableBackfaceCulling(void) { glEnable(GL_CULL_FACE); }
+void rlEnableBackfaceCulling(void) { rlCacheSetCapability(GL_CULL_FACE, true); }
 
 // Disable backface culling
-void rlDisableBackfaceCulling(void) { glDisable(GL_CULL_FACE); }
+void rlDisableBackfaceCulling(void) { rlCacheSetCapability(GL_CULL_FACE, false); }
 
 // Set color mask active for screen read/draw
 void rlColorMask(bool r, bool g, bool b, bool a) { glColorMask(r, g, b, a); }
@@ -2066,6 +2169,13 @@ void rlClearScreenBuffers(void)
     //glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT | GL_STENCIL_BUFFER_BIT);     // Stencil buffer not used...
 }
 
+// Wait for GPU to complete all queued commands (GL sync)
+// NOTE: Called after swapping buffers, frames queued by driver are limited to the one presented
+void rlFinish(void)
+{
+    glFinish();
+}
+
 // Check and log OpenGL error codes
 void rlCheckErrors(void)
 {
@@ -2166,6 +2276,32 @@ void rlSetBlendFactorsSeparate(int glSrcRGB, int glDstRGB, int glSrcAlpha, int g
 #endif
 }
 
+// Reset OpenGL state cache
+// NOTE: Required after any OpenGL state change not done through rlgl (raw OpenGL calls),
+// next bind/enable/uniform call of each kind always reaches OpenGL
+void rlResetStateCache(void)
+{
+#if defined(RLGL_ENABLE_STATE_CACHE)
+    RLGL.Cache.program = RL_CACHE_UNKNOWN_ID;
+    RLGL.Cache.textureSlot = -1;
+
+    for (int i = 0; i < RL_MAX_CACHED_TEXTURE_UNITS; i++)
+    {
+        RLGL.Cache.texture2D[i] = RL_CACHE_UNKNOWN_ID;
+        RLGL.Cache.textureCubemap[i] = RL_CACHE_UNKNOWN_ID;
+    }
+
+    RLGL.Cache.vertexArray = RL_CACHE_UNKNOWN_ID;
+    RLGL.Cache.colorBlend = -1;
+    RLGL.Cache.depthTest = -1;
+    RLGL.Cache.depthMask = -1;
+    RLGL.Cache.backfaceCulling = -1;
+
+    for (int i = 0; i < RL_MAX_CACHED_UNIFORMS; i++) RLGL.Cache.uniforms[i].program = 0;
+    RLGL.Cache.normalValid = false;
+#endif
+}
+
 //----------------------------------------------------------------------------------
 // Module Functions Definition - OpenGL Debug
 //----------------------------------------------------------------------------------
@@ -2233,6 +2369,10 @@ static void GLAPIENTRY rlDebugMessageCallback(GLenum source, GLenum type, GLuint
 // Initialize rlgl: OpenGL extensions, default buffers/shaders/textures, OpenGL states
 void rlglInit(int width, int height)
 {
+#if defined(GRAPHICS_API_SOFTWARE)
+    swResize(width, height);            // Software rasterizer default framebuffer
+#endif
+
     // Enable OpenGL debug context if required
 #if defined(RLGL_ENABLE_OPENGL_DEBUG_CONTEXT) && defined(GRAPHICS_API_OPENGL_43)
     if ((glDebugMessageCallback != NULL) && (glDebugMessageControl != NULL))
@@ -2248,6 +2388,9 @@ void rlglInit(int width, int height)
     }
 #endif
 
+    // Nothing is known about a new context state
+    rlResetStateCache();
+
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     // Init default white texture
     unsigned char pixels[4] = { 255, 255, 255, 255 };   // 1 pixel RGBA (4 bytes)
@@ -2283,17 +2426,17 @@ void rlglInit(int width, int height)
     //----------------------------------------------------------
     // Init state: Depth test
     glDepthFunc(GL_LEQUAL);                                 // Type of depth testing to apply
-    glDisable(GL_DEPTH_TEST);                               // Disable depth testing for 2D (only used for 3D)
+    rlCacheSetCapability(GL_DEPTH_TEST, false);             // Disable depth testing for 2D (only used for 3D)
 
     // Init state: Blending mode
     glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);      // Color blending function (how colors are mixed)
-    glEnable(GL_BLEND);                                     // Enable color blending (required to work with transparencies)
+    rlCacheSetCapability(GL_BLEND, true);                   // Enable color blending (required to work with transparencies)
 
     // Init state: Culling
     // NOTE: All shapes/models triangles are drawn CCW
     glCullFace(GL_BACK);                                    // Cull the back face (default)
     glFrontFace(GL_CCW);                                    // Front face are defined counter clockwise (default)
-    glEnable(GL_CULL_FACE);                                 // Enable backface culling
+    rlCacheSetCapability(GL_CULL_FACE, true);               // Enable backface culling
 
     // Init state: Cubemap seamless
 #if defined(GRAPHICS_API_OPENGL_33)
@@ -2329,9 +2472,13 @@ void rlglClose(void)
 
     rlUnloadShaderDefault();          // Unload default shader
 
-    glDeleteTextures(1, &RLGL.State.defaultTextureId); // Unload default texture
+    rlUnloadTexture(RLGL.State.defaultTextureId); // Unload default texture
     TRACELOG(RL_LOG_INFO, "TEXTURE: [ID %i] Default texture unloaded successfully", RLGL.State.defaultTextureId);
 #endif
+#if defined(GRAPHICS_API_SOFTWARE)
+    swClose();
+    TRACELOG(RL_LOG_INFO, "RLSW: Software rasterizer closed successfully");
+#endif
 }
 
 // Load OpenGL extensions
@@ -2339,6 +2486,13 @@ void rlglClose(void)
 void rlLoadExtensions(void *loader)
 {
 #if defined(GRAPHICS_API_OPENGL_33)     // Also defined for GRAPHICS_API_OPENGL_21
+#if defined(GRAPHICS_API_SOFTWARE)
+    // Software rasterizer replaces the platform context, default framebuffer is sized on rlglInit()
+    // NOTE: Platform loader is ignored, GL functions are provided by rlsw
+    if (!swInit(0, 0)) TRACELOG(RL_LOG_WARNING, "RLSW: Failed to initialize software rasterizer");
+    else TRACELOG(RL_LOG_INFO, "RLSW: Software rasterizer initialized successfully (tile size: %i)", RLSW_TILE_SIZE);
+    loader = (void *)swGetProcAddress;
+#endif
     // NOTE: glad is generated and contains only required OpenGL 3.3 Core extensions (and lower versions)
     if (gladLoadGL((GLADloadfunc)loader) == 0) TRACELOG(RL_LOG_WARNING, "GLAD: Cannot load OpenGL extensions");
     else TRACELOG(RL_LOG_INFO, "GLAD: OpenGL extensions loaded successfully");
@@ -2776,7 +2930,7 @@ rlRenderBatch rlLoadRenderBatch(int numBuffers, int bufferElements)
         {
             // Initialize Quads VAO
             glGenVertexArrays(1, &batch.vertexBuffer[i].vaoId);
-            glBindVertexArray(batch.vertexBuffer[i].vaoId);
+            rlCacheBindVertexArray(batch.vertexBuffer[i].vaoId);
         }
 
         // Quads - Vertex buffers binding and attributes enable
@@ -2822,7 +2976,7 @@ rlRenderBatch rlLoadRenderBatch(int numBuffers, int bufferElements)
     TRACELOG(RL_LOG_INFO, "RLGL: Render batch vertex buffers loaded successfully in VRAM (GPU)");
 
     // Unbind the current VAO
-    if (RLGL.ExtSupported.vao) glBindVertexArray(0);
+    if (RLGL.ExtSupported.vao) rlCacheBindVertexArray(0);
     //--------------------------------------------------------------------------------------------
 
     // Init draw calls tracking system
@@ -2855,6 +3009,8 @@ void rlUnloadRenderBatch(rlRenderBatch batch)
 {
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     // Unbind everything
+    // NOTE: VAO must be unbound first, element buffer binding is part of VAO state
+    if (RLGL.ExtSupported.vao) rlCacheBindVertexArray(0);
     glBindBuffer(GL_ARRAY_BUFFER, 0);
     glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
 
@@ -2864,12 +3020,12 @@ void rlUnloadRenderBatch(rlRenderBatch batch)
         // Unbind VAO attribs data
         if (RLGL.ExtSupported.vao)
         {
-            glBindVertexArray(batch.vertexBuffer[i].vaoId);
+            rlCacheBindVertexArray(batch.vertexBuffer[i].vaoId);
             glDisableVertexAttribArray(RL_DEFAULT_SHADER_ATTRIB_LOCATION_POSITION);
             glDisableVertexAttribArray(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD);
             glDisableVertexAttribArray(RL_DEFAULT_SHADER_ATTRIB_LOCATION_NORMAL);
             glDisableVertexAttribArray(RL_DEFAULT_SHADER_ATTRIB_LOCATION_COLOR);
-            glBindVertexArray(0);
+            rlCacheBindVertexArray(0);
         }
 
         // Delete VBOs from GPU (VRAM)
@@ -2880,7 +3036,11 @@ void rlUnloadRenderBatch(rlRenderBatch batch)
         glDeleteBuffers(1, &batch.vertexBuffer[i].vboId[4]);
 
         // Delete VAOs from GPU (VRAM)
-        if (RLGL.ExtSupported.vao) glDeleteVertexArrays(1, &batch.vertexBuffer[i].vaoId);
+        if (RLGL.ExtSupported.vao)
+        {
+            glDeleteVertexArrays(1, &batch.vertexBuffer[i].vaoId);
+            rlCacheForgetVertexArray(batch.vertexBuffer[i].vaoId);
+        }
 
         // Free vertex arrays memory from CPU (RAM)
         RL_FREE(batch.vertexBuffer[i].vertices);
@@ -2908,7 +3068,7 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
     if (RLGL.State.vertexCounter > 0)
     {
         // Activate elements VAO
-        if (RLGL.ExtSupported.vao) glBindVertexArray(batch->vertexBuffer[batch->currentBuffer].vaoId);
+        if (RLGL.ExtSupported.vao) rlCacheBindVertexArray(batch->vertexBuffer[batch->currentBuffer].vaoId);
 
         // Vertex positions buffer
         glBindBuffer(GL_ARRAY_BUFFER, batch->vertexBuffer[batch->currentBuffer].vboId[0]);
@@ -2945,8 +3105,11 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
         // }
         // glUnmapBuffer(GL_ARRAY_BUFFER);
 
+#if !defined(RLGL_ENABLE_STATE_CACHE)
         // Unbind the current VAO
+        // NOTE: With state cache enabled it is kept bound, drawing just below uses it
         if (RLGL.ExtSupported.vao) glBindVertexArray(0);
+#endif
     }
     //------------------------------------------------------------------------------------------------------------
 
@@ -2975,15 +3138,15 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
         if (RLGL.State.vertexCounter > 0)
         {
             // Set current shader and upload current MVP matrix
-            glUseProgram(RLGL.State.currentShaderId);
+            rlCacheUseProgram(RLGL.State.currentShaderId);
 
             // Create modelview-projection matrix and upload to shader
             Matrix matMVP = rlMatrixMultiply(RLGL.State.modelview, RLGL.State.projection);
-            glUniformMatrix4fv(RLGL.State.currentShaderLocs[RL_SHADER_LOC_MATRIX_MVP], 1, false, rlMatrixToFloat(matMVP));
+            rlSetUniformMatrix(RLGL.State.currentShaderLocs[RL_SHADER_LOC_MATRIX_MVP], matMVP);
 
             if (RLGL.State.currentShaderLocs[RL_SHADER_LOC_MATRIX_PROJECTION] != -1)
             {
-                glUniformMatrix4fv(RLGL.State.currentShaderLocs[RL_SHADER_LOC_MATRIX_PROJECTION], 1, false, rlMatrixToFloat(RLGL.State.projection));
+                rlSetUniformMatrix(RLGL.State.currentShaderLocs[RL_SHADER_LOC_MATRIX_PROJECTION], RLGL.State.projection);
             }
 
             // WARNING: For the following setup of the view, model, and normal matrices, it is expected that
@@ -2991,20 +3154,20 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
 
             if (RLGL.State.currentShaderLocs[RL_SHADER_LOC_MATRIX_VIEW] != -1)
             {
-                glUniformMatrix4fv(RLGL.State.currentShaderLocs[RL_SHADER_LOC_MATRIX_VIEW], 1, false, rlMatrixToFloat(RLGL.State.modelview));
+                rlSetUniformMatrix(RLGL.State.currentShaderLocs[RL_SHADER_LOC_MATRIX_VIEW], RLGL.State.modelview);
             }
 
             if (RLGL.State.currentShaderLocs[RL_SHADER_LOC_MATRIX_MODEL] != -1)
             {
-                glUniformMatrix4fv(RLGL.State.currentShaderLocs[RL_SHADER_LOC_MATRIX_MODEL], 1, false, rlMatrixToFloat(RLGL.State.transform));
+                rlSetUniformMatrix(RLGL.State.currentShaderLocs[RL_SHADER_LOC_MATRIX_MODEL], RLGL.State.transform);
             }
 
             if (RLGL.State.currentShaderLocs[RL_SHADER_LOC_MATRIX_NORMAL] != -1)
             {
-                glUniformMatrix4fv(RLGL.State.currentShaderLocs[RL_SHADER_LOC_MATRIX_NORMAL], 1, false, rlMatrixToFloat(rlMatrixTranspose(rlMatrixInvert(RLGL.State.transform))));
+                rlSetUniformMatrix(RLGL.State.currentShaderLocs[RL_SHADER_LOC_MATRIX_NORMAL], rlMatrixTranspose(rlMatrixInvert(RLGL.State.transform)));
             }
 
-            if (RLGL.ExtSupported.vao) glBindVertexArray(batch->vertexBuffer[batch->currentBuffer].vaoId);
+            if (RLGL.ExtSupported.vao) rlCacheBindVertexArray(batch->vertexBuffer[batch->currentBuffer].vaoId);
             else
             {
                 // Bind vertex attrib: position (shader-location = 0)
@@ -3031,8 +3194,10 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
             }
 
             // Setup some default shader values
-            glUniform4f(RLGL.State.currentShaderLocs[RL_SHADER_LOC_COLOR_DIFFUSE], 1.0f, 1.0f, 1.0f, 1.0f);
-            glUniform1i(RLGL.State.currentShaderLocs[RL_SHADER_LOC_MAP_DIFFUSE], 0);  // Active default sampler2D: texture0
+            float colDiffuse[4] = { 1.0f, 1.0f, 1.0f, 1.0f };
+            int mapDiffuse = 0;     // Active default sampler2D: texture0
+            rlSetUniform(RLGL.State.currentShaderLocs[RL_SHADER_LOC_COLOR_DIFFUSE], colDiffuse, RL_SHADER_UNIFORM_VEC4, 1);
+            rlSetUniform(RLGL.State.currentShaderLocs[RL_SHADER_LOC_MAP_DIFFUSE], &mapDiffuse, RL_SHADER_UNIFORM_INT, 1);
 
             // Activate additional sampler textures
             // Those additional textures will be common for all draw calls of the batch
@@ -3040,19 +3205,19 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
             {
                 if (RLGL.State.activeTextureId[i] > 0)
                 {
-                    glActiveTexture(GL_TEXTURE0 + 1 + i);
-                    glBindTexture(GL_TEXTURE_2D, RLGL.State.activeTextureId[i]);
+                    rlCacheActiveTexture(1 + i);
+                    rlCacheBindTexture(GL_TEXTURE_2D, RLGL.State.activeTextureId[i]);
                 }
             }
 
             // Activate default sampler2D texture0 (one texture is always active for default batch shader)
             // NOTE: Batch system accumulates calls by texture0 changes, additional textures are enabled for all the draw calls
-            glActiveTexture(GL_TEXTURE0);
+            rlCacheActiveTexture(0);
 
             for (int i = 0, vertexOffset = 0; i < batch->drawCounter; i++)
             {
                 // Bind current draw call texture, activated as GL_TEXTURE0 and bound to sampler2D texture0 by default
-                glBindTexture(GL_TEXTURE_2D, batch->draws[i].textureId);
+                rlCacheBindTexture(GL_TEXTURE_2D, batch->draws[i].textureId);
 
                 if ((batch->draws[i].mode == RL_LINES) || (batch->draws[i].mode == RL_TRIANGLES)) glDrawArrays(batch->draws[i].mode, vertexOffset, batch->draws[i].vertexCount);
                 else
@@ -3077,12 +3242,18 @@ void rlDrawRenderBatch(rlRenderBatch *batch)
                 glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, 0);
             }
 
+#if !defined(RLGL_ENABLE_STATE_CACHE)
             glBindTexture(GL_TEXTURE_2D, 0);    // Unbind textures
+#endif
         }
 
+        // NOTE: With state cache enabled, texture, VAO and shader program are kept bound,
+        // next draw only rebinds what actually changes
+#if !defined(RLGL_ENABLE_STATE_CACHE)
         if (RLGL.ExtSupported.vao) glBindVertexArray(0); // Unbind VAO
 
         glUseProgram(0);    // Unbind shader program
+#endif
     }
 
     // Restore viewport to default measures
@@ -3175,7 +3346,7 @@ unsigned int rlLoadTexture(const void *data, int width, int height, int format,
 {
     unsigned int id = 0;
 
-    glBindTexture(GL_TEXTURE_2D, 0);    // Free any old binding
+    rlCacheBindTexture(GL_TEXTURE_2D, 0);   // Free any old binding
 
     // Check texture format support by OpenGL 1.1 (compressed textures not supported)
 #if defined(GRAPHICS_API_OPENGL_11)
@@ -3222,7 +3393,7 @@ unsigned int rlLoadTexture(const void *data, int width, int height, int format,
 
     glGenTextures(1, &id);              // Generate texture id
 
-    glBindTexture(GL_TEXTURE_2D, id);
+    rlCacheBindTexture(GL_TEXTURE_2D, id);
 
     int mipWidth = width;
     int mipHeight = height;
@@ -3316,7 +3487,7 @@ unsigned int rlLoadTexture(const void *data, int width, int height, int format,
     // NOTE: If mipmaps were not in data, they are not generated automatically
 
     // Unbind current texture
-    glBindTexture(GL_TEXTURE_2D, 0);
+    rlCacheBindTexture(GL_TEXTURE_2D, 0);
 
     if (id > 0) TRACELOG(RL_LOG_INFO, "TEXTURE: [ID %i] Texture loaded successfully (%ix%i | %s | %i mipmaps)", id, width, height, rlGetPixelFormatName(format), mipmapCount);
     else TRACELOG(RL_LOG_WARNING, "TEXTURE: Failed to load texture");
@@ -3352,7 +3523,7 @@ unsigned int rlLoadTextureDepth(int width, int height, bool useRenderBuffer)
     if (!useRenderBuffer && RLGL.ExtSupported.texDepth)
     {
         glGenTextures(1, &id);
-        glBindTexture(GL_TEXTURE_2D, id);
+        rlCacheBindTexture(GL_TEXTURE_2D, id);
         glTexImage2D(GL_TEXTURE_2D, 0, glInternalFormat, width, height, 0, GL_DEPTH_COMPONENT, GL_UNSIGNED_INT, NULL);
 
         glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST);
@@ -3360,7 +3531,7 @@ unsigned int rlLoadTextureDepth(int width, int height, bool useRenderBuffer)
         glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE);
         glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE);
 
-        glBindTexture(GL_TEXTURE_2D, 0);
+        rlCacheBindTexture(GL_TEXTURE_2D, 0);
 
         TRACELOG(RL_LOG_INFO, "TEXTURE: Depth texture loaded successfully");
     }
@@ -3398,7 +3569,7 @@ unsigned int rlLoadTextureCubemap(const void *data, int size, int format, int mi
     unsigned int dataSize = rlGetPixelDataSize(size, size, format);
 
     glGenTextures(1, &id);
-    glBindTexture(GL_TEXTURE_CUBE_MAP, id);
+    rlCacheBindTexture(GL_TEXTURE_CUBE_MAP, id);
 
     unsigned int glInternalFormat, glFormat, glType;
     rlGetGlTextureFormats(format, &glInternalFormat, &glFormat, &glType);
@@ -3469,7 +3640,7 @@ unsigned int rlLoadTextureCubemap(const void *data, int size, int format, int mi
     glTexParameteri(GL_TEXTURE_CUBE_MAP, GL_TEXTURE_WRAP_R, GL_CLAMP_TO_EDGE);  // Flag not supported on OpenGL ES 2.0
 #endif
 
-    glBindTexture(GL_TEXTURE_CUBE_MAP, 0);
+    rlCacheBindTexture(GL_TEXTURE_CUBE_MAP, 0);
 #endif
 
     if (id > 0) TRACELOG(RL_LOG_INFO, "TEXTURE: [ID %i] Cubemap texture loaded successfully (%ix%i)", id, size, size);
@@ -3482,7 +3653,7 @@ unsigned int rlLoadTextureCubemap(const void *data, int size, int format, int mi
 // NOTE: We don't know safely if internal texture format is the expected one...
 void rlUpdateTexture(unsigned int id, int offsetX, int offsetY, int width, int height, int format, const void *data)
 {
-    glBindTexture(GL_TEXTURE_2D, id);
+    rlCacheBindTexture(GL_TEXTURE_2D, id);
 
     unsigned int glInternalFormat, glFormat, glType;
     rlGetGlTextureFormats(format, &glInternalFormat, &glFormat, &glType);
@@ -3571,6 +3742,7 @@ void rlGetGlTextureFormats(int format, unsigned int *glInternalFormat, unsigned
 void rlUnloadTexture(unsigned int id)
 {
     glDeleteTextures(1, &id);
+    rlCacheForgetTexture(id);
 }
 
 // Generate mipmap data for selected texture
@@ -3578,7 +3750,7 @@ void rlUnloadTexture(unsigned int id)
 void rlGenTextureMipmaps(unsigned int id, int width, int height, int format, int *mipmaps)
 {
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    glBindTexture(GL_TEXTURE_2D, id);
+    rlCacheBindTexture(GL_TEXTURE_2D, id);
 
     // Check if texture is power-of-two (POT)
     bool texIsPOT = false;
@@ -3599,7 +3771,7 @@ void rlGenTextureMipmaps(unsigned int id, int width, int height, int format, int
     }
     else TRACELOG(RL_LOG_WARNING, "TEXTURE: [ID %i] Failed to generate mipmaps", id);
 
-    glBindTexture(GL_TEXTURE_2D, 0);
+    rlCacheBindTexture(GL_TEXTURE_2D, 0);
 #else
     TRACELOG(RL_LOG_WARNING, "TEXTURE: [ID %i] GPU mipmap generation not supported", id);
 #endif
@@ -3611,7 +3783,7 @@ void *rlReadTexturePixels(unsigned int id, int width, int height, int format)
     void *pixels = NULL;
 
 #if defined(GRAPHICS_API_OPENGL_11) || defined(GRAPHICS_API_OPENGL_33)
-    glBindTexture(GL_TEXTURE_2D, id);
+    rlCacheBindTexture(GL_TEXTURE_2D, id);
 
     // NOTE: Using texture id, we can retrieve some texture info (but not on OpenGL ES 2.0)
     // Possible texture info: GL_TEXTURE_RED_SIZE, GL_TEXTURE_GREEN_SIZE, GL_TEXTURE_BLUE_SIZE, GL_TEXTURE_ALPHA_SIZE
@@ -3637,7 +3809,7 @@ void *rlReadTexturePixels(unsigned int id, int width, int height, int format)
     }
     else TRACELOG(RL_LOG_WARNING, "TEXTURE: [ID %i] Data retrieval not suported for pixel format (%i)", id, format);
 
-    glBindTexture(GL_TEXTURE_2D, 0);
+    rlCacheBindTexture(GL_TEXTURE_2D, 0);
 #endif
 
 #if defined(GRAPHICS_API_OPENGL_ES2)
@@ -3651,7 +3823,7 @@ void *rlReadTexturePixels(unsigned int id, int width, int height, int format)
     unsigned int fboId = rlLoadFramebuffer();
 
     glBindFramebuffer(GL_FRAMEBUFFER, fboId);
-    glBindTexture(GL_TEXTURE_2D, 0);
+    rlCacheBindTexture(GL_TEXTURE_2D, 0);
 
     // Attach our texture to FBO
     glFramebufferTexture2D(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, id, 0);
@@ -3810,7 +3982,7 @@ void rlUnloadFramebuffer(unsigned int id)
 
     unsigned int depthIdU = (unsigned int)depthId;
     if (depthType == GL_RENDERBUFFER) glDeleteRenderbuffers(1, &depthIdU);
-    else if (depthType == GL_TEXTURE) glDeleteTextures(1, &depthIdU);
+    else if (depthType == GL_TEXTURE) rlUnloadTexture(depthIdU);
 
     // NOTE: If a texture object is deleted while its image is attached to the *currently bound* framebuffer,
     // the texture image is automatically detached from the currently bound framebuffer
@@ -3899,6 +4071,10 @@ void rlUpdateVertexBuffer(unsigned int id, const void *data, int dataSize, int o
 void rlUpdateVertexBufferElements(unsigned int id, const void *data, int dataSize, int offset)
 {
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+#if defined(RLGL_ENABLE_STATE_CACHE)
+    // Make sure no VAO is kept bound from a previous draw, element buffer binding is part of VAO state
+    if (RLGL.ExtSupported.vao) rlCacheBindVertexArray(0);
+#endif
     glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, id);
     glBufferSubData(GL_ELEMENT_ARRAY_BUFFER, offset, dataSize, data);
 #endif
@@ -3911,7 +4087,7 @@ bool rlEnableVertexArray(unsigned int vaoId)
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     if (RLGL.ExtSupported.vao)
     {
-        glBindVertexArray(vaoId);
+        rlCacheBindVertexArray(vaoId);
         result = true;
     }
 #endif
@@ -3922,7 +4098,7 @@ bool rlEnableVertexArray(unsigned int vaoId)
 void rlDisableVertexArray(void)
 {
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    if (RLGL.ExtSupported.vao) glBindVertexArray(0);
+    if (RLGL.ExtSupported.vao) rlCacheBindVertexArray(0);
 #endif
 }
 
@@ -4042,8 +4218,9 @@ void rlUnloadVertexArray(unsigned int vaoId)
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     if (RLGL.ExtSupported.vao)
     {
-        glBindVertexArray(0);
+        rlCacheBindVertexArray(0);
         glDeleteVertexArrays(1, &vaoId);
+        rlCacheForgetVertexArray(vaoId);
         TRACELOG(RL_LOG_INFO, "VAO: [ID %i] Unloaded vertex array data from VRAM (GPU)", vaoId);
     }
 #endif
@@ -4275,6 +4452,7 @@ void rlUnloadShaderProgram(unsigned int id)
 {
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
     glDeleteProgram(id);
+    rlCacheForgetProgram(id);
 
     TRACELOG(RL_LOG_INFO, "SHADER: [ID %i] Unloaded shader program data from VRAM (GPU)", id);
 #endif
@@ -4310,6 +4488,9 @@ int rlGetLocationAttrib(unsigned int shaderId, const char *attribName)
 void rlSetUniform(int locIndex, const void *value, int uniformType, int count)
 {
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    // Skip upload if current shader program already holds that value
+    if (!rlCacheUniform(locIndex, uniformType, value, count)) return;
+
     switch (uniformType)
     {
         case RL_SHADER_UNIFORM_FLOAT: glUniform1fv(locIndex, count, (float *)value); break;
@@ -4353,19 +4534,41 @@ void rlSetVertexAttributeDefault(int locIndex, const void *value, int attribType
 void rlSetUniformMatrix(int locIndex, Matrix mat)
 {
 #if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
-    float matfloat[16] = {
-        mat.m0, mat.m1, mat.m2, mat.m3,
-        mat.m4, mat.m5, mat.m6, mat.m7,
-        mat.m8, mat.m9, mat.m10, mat.m11,
-        mat.m12, mat.m13, mat.m14, mat.m15
-    };
-    glUniformMatrix4fv(locIndex, 1, false, matfloat);
+    rl_float16 matfloat = rlMatrixToFloatV(mat);
+
+    // Skip upload if current shader program already holds that value
+    if (rlCacheUniform(locIndex, RL_CACHE_UNIFORM_MATRIX, matfloat.v, 1)) glUniformMatrix4fv(locIndex, 1, false, matfloat.v);
+#endif
+}
+
+// Set shader normal matrix computed from model matrix (inverse transpose)
+// NOTE: Consecutive meshes of a model share the same model matrix, with state cache
+// the normal matrix is only computed when it changes (upload is cached per program)
+void rlSetUniformMatrixNormal(int locIndex, Matrix model)
+{
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+#if defined(RLGL_ENABLE_STATE_CACHE)
+    if (!RLGL.Cache.normalValid || (memcmp(&RLGL.Cache.normalModel, &model, sizeof(Matrix)) != 0))
+    {
+        RLGL.Cache.normalModel = model;
+        RLGL.Cache.normal = rlMatrixTranspose(rlMatrixInvert(model));
+        RLGL.Cache.normalValid = true;
+    }
+
+    rlSetUniformMatrix(locIndex, RLGL.Cache.normal);
+#else
+    rlSetUniformMatrix(locIndex, rlMatrixTranspose(rlMatrixInvert(model)));
+#endif
 #endif
 }
 
 // Set shader value uniform matrix
 void rlSetUniformMatrices(int locIndex, const Matrix *matrices, int count)
 {
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+    // Matrix arrays are not cached, previous values for those locations are not known any more
+    rlCacheForgetUniforms(locIndex, count);
+#endif
 #if defined(GRAPHICS_API_OPENGL_33)
     glUniformMatrix4fv(locIndex, count, true, (const float *)matrices);
 #elif defined(GRAPHICS_API_OPENGL_ES2)
@@ -4384,7 +4587,8 @@ void rlSetUniformSampler(int locIndex, unsigned int textureId)
     {
         if (RLGL.State.activeTextureId[i] == textureId)
         {
-            glUniform1i(locIndex, 1 + i);
+            int slot = 1 + i;
+            rlSetUniform(locIndex, &slot, RL_SHADER_UNIFORM_INT, 1);
             return;
         }
     }
@@ -4395,7 +4599,8 @@ void rlSetUniformSampler(int locIndex, unsigned int textureId)
     {
         if (RLGL.State.activeTextureId[i] == 0)
         {
-            glUniform1i(locIndex, 1 + i);              // Activate new texture unit
+            int slot = 1 + i;
+            rlSetUniform(locIndex, &slot, RL_SHADER_UNIFORM_INT, 1);   // Activate new texture unit
             RLGL.State.activeTextureId[i] = textureId; // Save texture id for binding on drawing
             break;
         }
@@ -4711,7 +4916,7 @@ void rlLoadDrawQuad(void)
 
     // Gen VAO to contain VBO
     glGenVertexArrays(1, &quadVAO);
-    glBindVertexArray(quadVAO);
+    rlCacheBindVertexArray(quadVAO);
 
     // Gen and fill vertex buffer (VBO)
     glGenBuffers(1, &quadVBO);
@@ -4725,13 +4930,14 @@ void rlLoadDrawQuad(void)
     glVertexAttribPointer(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD, 2, GL_FLOAT, GL_FALSE, 5*sizeof(float), (void *)(3*sizeof(float))); // Texcoords
 
     // Draw quad
-    glBindVertexArray(quadVAO);
+    rlCacheBindVertexArray(quadVAO);
     glDrawArrays(GL_TRIANGLE_STRIP, 0, 4);
-    glBindVertexArray(0);
+    rlCacheBindVertexArray(0);
 
     // Delete buffers (VBO and VAO)
     glDeleteBuffers(1, &quadVBO);
     glDeleteVertexArrays(1, &quadVAO);
+    rlCacheForgetVertexArray(quadVAO);
 #endif
 }
 
@@ -4784,7 +4990,7 @@ void rlLoadDrawCube(void)
 
     // Gen VAO to contain VBO
     glGenVertexArrays(1, &cubeVAO);
-    glBindVertexArray(cubeVAO);
+    rlCacheBindVertexArray(cubeVAO);
 
     // Gen and fill vertex buffer (VBO)
     glGenBuffers(1, &cubeVBO);
@@ -4792,7 +4998,7 @@ void rlLoadDrawCube(void)
     glBufferData(GL_ARRAY_BUFFER, sizeof(vertices), vertices, GL_STATIC_DRAW);
 
     // Bind vertex attributes (position, normals, texcoords)
-    glBindVertexArray(cubeVAO);
+    rlCacheBindVertexArray(cubeVAO);
     glEnableVertexAttribArray(RL_DEFAULT_SHADER_ATTRIB_LOCATION_POSITION);
     glVertexAttribPointer(RL_DEFAULT_SHADER_ATTRIB_LOCATION_POSITION, 3, GL_FLOAT, GL_FALSE, 8*sizeof(float), (void *)0); // Positions
     glEnableVertexAttribArray(RL_DEFAULT_SHADER_ATTRIB_LOCATION_NORMAL);
@@ -4800,16 +5006,17 @@ void rlLoadDrawCube(void)
     glEnableVertexAttribArray(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD);
     glVertexAttribPointer(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD, 2, GL_FLOAT, GL_FALSE, 8*sizeof(float), (void *)(6*sizeof(float))); // Texcoords
     glBindBuffer(GL_ARRAY_BUFFER, 0);
-    glBindVertexArray(0);
+    rlCacheBindVertexArray(0);
 
     // Draw cube
-    glBindVertexArray(cubeVAO);
+    rlCacheBindVertexArray(cubeVAO);
     glDrawArrays(GL_TRIANGLES, 0, 36);
-    glBindVertexArray(0);
+    rlCacheBindVertexArray(0);
 
     // Delete VBO and VAO
     glDeleteBuffers(1, &cubeVBO);
     glDeleteVertexArrays(1, &cubeVAO);
+    rlCacheForgetVertexArray(cubeVAO);
 #endif
 }
 
@@ -4897,11 +5104,18 @@ static void rlLoadShaderDefault(void)
 #endif
 
     "uniform mat4 mvp;                  \n"
+#if defined(RL_SUPPORT_MESH_QUANTIZATION)
+    "uniform mat4 matDequantization;    \n"     // Identity, except while drawing quantized meshes
+#endif
     "void main()                        \n"
     "{                                  \n"
     "    fragTexCoord = vertexTexCoord; \n"
     "    fragColor = vertexColor;       \n"
+#if defined(RL_SUPPORT_MESH_QUANTIZATION)
+    "    gl_Position = mvp*(matDequantization*vec4(vertexPosition, 1.0)); \n"
+#else
     "    gl_Position = mvp*vec4(vertexPosition, 1.0); \n"
+#endif
     "}                                  \n";
 
     // Fragment shader directly defined, no external file required
@@ -4978,6 +5192,15 @@ static void rlLoadShaderDefault(void)
         RLGL.State.defaultShaderLocs[RL_SHADER_LOC_MATRIX_MVP] = glGetUniformLocation(RLGL.State.defaultShaderId, RL_DEFAULT_SHADER_UNIFORM_NAME_MVP);
         RLGL.State.defaultShaderLocs[RL_SHADER_LOC_COLOR_DIFFUSE] = glGetUniformLocation(RLGL.State.defaultShaderId, RL_DEFAULT_SHADER_UNIFORM_NAME_COLOR);
         RLGL.State.defaultShaderLocs[RL_SHADER_LOC_MAP_DIFFUSE] = glGetUniformLocation(RLGL.State.defaultShaderId, RL_DEFAULT_SHADER_SAMPLER2D_NAME_TEXTURE0);
+#if defined(RL_SUPPORT_MESH_QUANTIZATION)
+        RLGL.State.defaultShaderLocs[RL_SHADER_LOC_MATRIX_DEQUANTIZATION] = glGetUniformLocation(RLGL.State.defaultShaderId, RL_DEFAULT_SHADER_UNIFORM_NAME_DEQUANTIZATION);
+
+        // Vertex positions decoding defaults to identity, only quantized meshes drawing changes it
+        float identity[16] = { 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f };
+        rlCacheUseProgram(RLGL.State.defaultShaderId);
+        glUniformMatrix4fv(RLGL.State.defaultShaderLocs[RL_SHADER_LOC_MATRIX_DEQUANTIZATION], 1, false, identity);
+        rlCacheUseProgram(0);
+#endif
     }
     else TRACELOG(RL_LOG_WARNING, "SHADER: [ID %i] Failed to load default shader", RLGL.State.defaultShaderId);
 }
@@ -4986,7 +5209,7 @@ static void rlLoadShaderDefault(void)
 // NOTE: Unloads: RLGL.State.defaultShaderId, RLGL.State.defaultShaderLocs
 static void rlUnloadShaderDefault(void)
 {
-    glUseProgram(0);
+    rlCacheUseProgram(0);
 
     glDetachShader(RLGL.State.defaultShaderId, RLGL.State.defaultVShaderId);
     glDetachShader(RLGL.State.defaultShaderId, RLGL.State.defaultFShaderId);
@@ -4994,6 +5217,7 @@ static void rlUnloadShaderDefault(void)
     glDeleteShader(RLGL.State.defaultFShaderId);
 
     glDeleteProgram(RLGL.State.defaultShaderId);
+    rlCacheForgetProgram(RLGL.State.defaultShaderId);
 
     RL_FREE(RLGL.State.defaultShaderLocs);
 
@@ -5266,4 +5490,213 @@ static Matrix rlMatrixInvert(Matrix mat)
     return result;
 }
 
+// OpenGL state cache functions
+//----------------------------------------------------------------------------------------
+// Bind texture to active texture slot
+static void rlCacheBindTexture(unsigned int target, unsigned int id)
+{
+#if defined(RLGL_ENABLE_STATE_CACHE)
+    int slot = RLGL.Cache.textureSlot;
+
+    if ((slot >= 0) && (slot < RL_MAX_CACHED_TEXTURE_UNITS))
+    {
+        unsigned int *bound = (target == GL_TEXTURE_CUBE_MAP)? &RLGL.Cache.textureCubemap[slot] : &RLGL.Cache.texture2D[slot];
+
+        if (*bound == id) return;
+        *bound = id;
+    }
+#endif
+    glBindTexture(target, id);
+}
+
+// Enable/disable render state (blending, depth test, culling)
+static void rlCacheSetCapability(unsigned int cap, bool enabled)
+{
+#if defined(RLGL_ENABLE_STATE_CACHE)
+    int *state = NULL;
+
+    switch (cap)
+    {
+        case GL_BLEND: state = &RLGL.Cache.colorBlend; break;
+        case GL_DEPTH_TEST: state = &RLGL.Cache.depthTest; break;
+        case GL_CULL_FACE: state = &RLGL.Cache.backfaceCulling; break;
+        default: break;
+    }
+
+    if (state != NULL)
+    {
+        if (*state == (int)enabled) return;
+        *state = (int)enabled;
+    }
+#endif
+    if (enabled) glEnable(cap);
+    else glDisable(cap);
+}
+
+// Enable/disable depth write
+static void rlCacheDepthMask(bool enabled)
+{
+#if defined(RLGL_ENABLE_STATE_CACHE)
+    if (RLGL.Cache.depthMask == (int)enabled) return;
+    RLGL.Cache.depthMask = (int)enabled;
+#endif
+    glDepthMask(enabled? GL_TRUE : GL_FALSE);
+}
+
+// Forget bindings of a deleted texture
+// NOTE: OpenGL reverts deleted texture bindings to 0
+static void rlCacheForgetTexture(unsigned int id)
+{
+#if defined(RLGL_ENABLE_STATE_CACHE)
+    for (int i = 0; i < RL_MAX_CACHED_TEXTURE_UNITS; i++)
+    {
+        if (RLGL.Cache.texture2D[i] == id) RLGL.Cache.texture2D[i] = 0;
+        if (RLGL.Cache.textureCubemap[i] == id) RLGL.Cache.textureCubemap[i] = 0;
+    }
+#else
+    (void)id;
+#endif
+}
+
+#if defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2)
+// Use shader program
+static void rlCacheUseProgram(unsigned int id)
+{
+#if defined(RLGL_ENABLE_STATE_CACHE)
+    if (RLGL.Cache.program == id) return;
+    RLGL.Cache.program = id;
+#endif
+    glUseProgram(id);
+}
+
+// Select active texture slot
+static void rlCacheActiveTexture(int slot)
+{
+#if defined(RLGL_ENABLE_STATE_CACHE)
+    if (RLGL.Cache.textureSlot == slot) return;
+    RLGL.Cache.textureSlot = slot;
+#endif
+    glActiveTexture(GL_TEXTURE0 + slot);
+}
+
+// Bind vertex array object
+static void rlCacheBindVertexArray(unsigned int id)
+{
+#if defined(RLGL_ENABLE_STATE_CACHE)
+    if (RLGL.Cache.vertexArray == id) return;
+    RLGL.Cache.vertexArray = id;
+#endif
+    glBindVertexArray(id);
+}
+
+// Check if uniform value changed for current program (and cache it)
+// NOTE: Returns true if value must be uploaded, only single values are cached,
+// cache slots are searched with linear probing from (program, location) hash
+static bool rlCacheUniform(int locIndex, int type, const void *value, int count)
+{
+#if defined(RLGL_ENABLE_STATE_CACHE)
+    unsigned int program = RLGL.Cache.program;
+
+    if ((locIndex < 0) || (program == 0) || (program == RL_CACHE_UNKNOWN_ID)) return true;
+    if (count != 1)
+    {
+        rlCacheForgetUniforms(locIndex, count);
+        return true;
+    }
+
+    int size = 0;
+    switch (type)
+    {
+        case RL_CACHE_UNIFORM_MATRIX: size = 16*sizeof(float); break;
+        case RL_SHADER_UNIFORM_FLOAT: size = sizeof(float); break;
+        case RL_SHADER_UNIFORM_VEC2: size = 2*sizeof(float); break;
+        case RL_SHADER_UNIFORM_VEC3: size = 3*sizeof(float); break;
+        case RL_SHADER_UNIFORM_VEC4: size = 4*sizeof(float); break;
+        case RL_SHADER_UNIFORM_INT: size = sizeof(int); break;
+        case RL_SHADER_UNIFORM_IVEC2: size = 2*sizeof(int); break;
+        case RL_SHADER_UNIFORM_IVEC3: size = 3*sizeof(int); break;
+        case RL_SHADER_UNIFORM_IVEC4: size = 4*sizeof(int); break;
+        case RL_SHADER_UNIFORM_SAMPLER2D: size = sizeof(int); break;
+        default: return true;
+    }
+
+    unsigned int home = (program*31u + (unsigned int)locIndex)&(RL_MAX_CACHED_UNIFORMS - 1);
+    rlCachedUniform *slot = NULL;
+
+    for (int i = 0; i < RL_CACHE_UNIFORM_PROBES; i++)
+    {
+        rlCachedUniform *entry = &RLGL.Cache.uniforms[(home + i)&(RL_MAX_CACHED_UNIFORMS - 1)];
+
+        if ((entry->program == program) && (entry->location == locIndex))
+        {
+            if ((entry->type == type) && (memcmp(entry->data, value, size) == 0)) return false;
+            slot = entry;
+            break;
+        }
+        else if ((slot == NULL) && (entry->program == 0)) slot = entry;
+    }
+
+    // No free slot found, evict the one at home position
+    if (slot == NULL) slot = &RLGL.Cache.uniforms[home];
+
+    slot->program = program;
+    slot->location = locIndex;
+    slot->type = type;
+    slot->size = size;
+    memcpy(slot->data, value, size);
+#else
+    (void)locIndex; (void)type; (void)value; (void)count;
+#endif
+    return true;
+}
+
+// Forget uniform values cached for current program
+static void rlCacheForgetUniforms(int locIndex, int count)
+{
+#if defined(RLGL_ENABLE_STATE_CACHE)
+    unsigned int program = RLGL.Cache.program;
+
+    if ((locIndex < 0) || (program == 0)) return;
+
+    for (int i = 0; i < RL_MAX_CACHED_UNIFORMS; i++)
+    {
+        rlCachedUniform *entry = &RLGL.Cache.uniforms[i];
+
+        // NOTE: Unknown program clears locations of every program
+        if (((entry->program == program) || (program == RL_CACHE_UNKNOWN_ID)) &&
+            (entry->location >= locIndex) && (entry->location < locIndex + count)) entry->program = 0;
+    }
+#else
+    (void)locIndex; (void)count;
+#endif
+}
+
+// Forget state cached for a deleted program
+// NOTE: A new program could get the same id later, its uniforms start with default values
+static void rlCacheForgetProgram(unsigned int id)
+{
+#if defined(RLGL_ENABLE_STATE_CACHE)
+    for (int i = 0; i < RL_MAX_CACHED_UNIFORMS; i++)
+    {
+        if (RLGL.Cache.uniforms[i].program == id) RLGL.Cache.uniforms[i].program = 0;
+    }
+
+    if (RLGL.Cache.program == id) RLGL.Cache.program = RL_CACHE_UNKNOWN_ID;
+#else
+    (void)id;
+#endif
+}
+
+// Forget binding of a deleted vertex array object
+// NOTE: OpenGL reverts a deleted vertex array binding to 0
+static void rlCacheForgetVertexArray(unsigned int id)
+{
+#if defined(RLGL_ENABLE_STATE_CACHE)
+    if (RLGL.Cache.vertexArray == id) RLGL.Cache.vertexArray = 0;
+#else
+    (void)id;
+#endif
+}
+#endif  // GRAPHICS_API_OPENGL_33 || GRAPHICS_API_OPENGL_ES2
+
 #endif  // RLGL_IMPLEMENTATION
@@ -0,0 +1,2412 @@
+/**********************************************************************************************
+*
+*   rlsw v1.0 - Tile-based multi-threaded software rasterizer for rlgl (OpenGL 3.3 Core subset)
+*
+*   DESCRIPTION:
+*       Implements on the CPU the subset of OpenGL 3.3 Core used by rlgl, GL functions are exposed
+*       through swGetProcAddress() so glad can load them as if they were the driver entry points,
+*       rlgl (and any module on top of it) runs unmodified
+*
+*       Drawing is deferred: triangles are transformed, clipped and set up on submission and binned
+*       into screen tiles, tiles are rasterized in parallel when the queue is flushed (framebuffer
+*       change, clear, readback, texture update or swFinish())
+*
+*   FEATURES:
+*       - Buffers (vertex/index), vertex array objects, 8/16/32 bit indices
+*       - Attributes: float, (un)signed byte/short/int, normalized or not
+*       - Textures: stored as RGBA8 (any uncompressed format converted on upload), swizzle,
+*         nearest/bilinear filtering, repeat/clamp/mirrored repeat wrapping
+*       - Framebuffer objects: color texture attachment, depth texture/renderbuffer attachment
+*       - Depth test and write, face culling, scissor test, color mask
+*       - Blending: all blend factors, add/subtract/reverse subtract equations
+*       - Triangles, triangle strips/fans, lines (1 pixel wide quads)
+*       - Homogeneous clipping (near/far planes and guard band)
+*       - Coverage computed with fixed point edge functions (1/16 pixel precision, top-left rule),
+*         evaluated 4 pixels at a time using SSE2 when available
+*       - Rendering statistics: draw calls, triangles, binned triangles, fragments, flushes
+*
+*   LIMITATIONS:
+*       - GLSL is not executed: every program behaves as the rlgl default shader,
+*         vertex: mvp*vertexPosition, fragment: texture(texture0, vertexTexCoord)*colDiffuse*vertexColor
+*       - No instancing (instanced draws are rendered once), no mipmapping, no MSAA,
+*         no compressed textures (uploaded as white), no cubemaps, no wireframe polygon mode
+*       - Framebuffer size limited to RLSW_MAX_FRAMEBUFFER_SIZE
+*       - Presenting the default framebuffer is a platform responsibility (swGetFramebuffer())
+*
+*   CONFIGURATION:
+*       #define RLSW_IMPLEMENTATION
+*           Generates the implementation of the library into the included file
+*           NOTE: OpenGL types and enums (i.e. external/glad.h) must be available before implementation
+*
+*       #define RLSW_DISABLE_SIMD
+*           Use scalar coverage evaluation even if SSE2 is available
+*
+*       rlsw capabilities could be customized just defining some internal
+*       values before library inclusion (default values listed):
+*
+*       #define RLSW_TILE_SIZE                    64    // Tile size in pixels (binning and multi-threading granularity)
+*       #define RLSW_MAX_FRAMEBUFFER_SIZE       4096    // Maximum framebuffer width/height
+*       #define RLSW_MAX_QUEUED_TRIANGLES      65536    // Maximum triangles queued before forcing a flush
+*       #define RLSW_MAX_TEXTURE_UNITS            16    // Maximum texture units
+*       #define RLSW_MAX_VERTEX_ATTRIBS           16    // Maximum vertex attributes
+*       #define RLSW_MAX_UNIFORMS                 64    // Maximum uniforms per program
+*
+*   DEPENDENCIES:
+*       - OpenGL types and enums: GLenum, GLuint, GL_TRIANGLES... (provided by glad)
+*       - Worker threads (optional): provided by the user through swSetTaskRunner()
+*
+*
+*   LICENSE: zlib/libpng
+*
+*   Copyright (c) 2025 Ramon Santamaria (@raysan5) and contributors
+*
+*   This software is provided "as-is", without any express or implied warranty. In no event
+*   will the authors be held liable for any damages arising from the use of this software.
+*
+*   Permission is granted to anyone to use this software for any purpose, including commercial
+*   applications, and to alter it and redistribute it freely, subject to the following restrictions:
+*
+*     1. The origin of this software must not be misrepresented; you must not claim that you
+*     wrote the original software. If you use this software in a product, an acknowledgment
+*     in the product documentation would be appreciated but is not required.
+*
+*     2. Altered source versions must be plainly marked as such, and must not be misrepresented
+*     as being the original software.
+*
+*     3. This notice may not be removed or altered from any source distribution.
+*
+**********************************************************************************************/
+
+#ifndef RLSW_H
+#define RLSW_H
+
+#include <stdbool.h>                    // Required for: bool
+
+// Function specifiers in case library is build/used as a shared library
+// NOTE: Microsoft specifiers to tell compiler that symbols are imported/exported from a .dll
+// NOTE: visibility(default) attribute makes symbols "visible" when compiled with -fvisibility=hidden
+#if defined(_WIN32) && defined(BUILD_LIBTYPE_SHARED)
+    #define RLSWAPI __declspec(dllexport)
+#elif defined(BUILD_LIBTYPE_SHARED)
+    #define RLSWAPI __attribute__((visibility("default")))
+#elif defined(_WIN32) && defined(USE_LIBTYPE_SHARED)
+    #define RLSWAPI __declspec(dllimport)
+#endif
+
+#ifndef RLSWAPI
+    #define RLSWAPI       // Functions defined as 'extern' by default (implicit specifiers)
+#endif
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+// Rendering statistics
+typedef struct swStats {
+    unsigned int drawCalls;             // Draw calls submitted (glDraw*())
+    unsigned int triangles;             // Triangles submitted (every line counts as 2 triangles)
+    unsigned int trianglesCulled;       // Triangles discarded (culling, clipping, zero area)
+    unsigned int trianglesBinned;       // Triangle-tile pairs binned for rasterization
+    unsigned int flushes;               // Queue flushes (batches of tiles rasterized)
+    unsigned long long int fragments;   // Pixels covered by triangles
+    unsigned long long int fragmentsWritten; // Pixels passing depth test (written)
+} swStats;
+
+// Task callback, executes task 'index' of a group of tasks sharing 'data'
+typedef void (*swTaskCallback)(void *data, int index);
+
+// Task runner, executes 'count' tasks, returns when all of them completed
+typedef void (*swTaskRunner)(swTaskCallback callback, void *data, int count);
+
+#if defined(__cplusplus)
+extern "C" {            // Prevents name mangling of functions
+#endif
+
+RLSWAPI bool swInit(int width, int height);         // Initialize software rasterizer context and default framebuffer
+RLSWAPI void swClose(void);                         // Close software rasterizer, free all resources
+RLSWAPI void swResize(int width, int height);       // Resize default framebuffer
+RLSWAPI void *swGetProcAddress(const char *name);   // Get GL function implementation by name (glad loader)
+RLSWAPI void swSetTaskRunner(swTaskRunner runner);  // Set tasks runner used to rasterize tiles in parallel (NULL: serial)
+RLSWAPI void swFinish(void);                        // Rasterize all queued triangles
+RLSWAPI unsigned char *swGetFramebuffer(int *width, int *height); // Get default framebuffer color data (RGBA8, bottom-up rows)
+RLSWAPI swStats swGetStats(void);                   // Get rendering statistics (accumulated since last reset)
+RLSWAPI void swResetStats(void);                    // Reset rendering statistics
+
+#if defined(__cplusplus)
+}
+#endif
+
+#endif // RLSW_H
+
+/***********************************************************************************
+*
+*   RLSW IMPLEMENTATION
+*
+************************************************************************************/
+
+#if defined(RLSW_IMPLEMENTATION)
+
+#include <stdlib.h>                     // Required for: malloc(), calloc(), realloc(), free()
+#include <string.h>                     // Required for: memcpy(), memset(), strcmp(), strncpy()
+#include <math.h>                       // Required for: floorf(), sqrtf(), fabsf()
+
+#if !defined(RLSW_DISABLE_SIMD) && (defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && (_M_IX86_FP >= 2)))
+    #include <emmintrin.h>              // SSE2 intrinsics
+    #define RLSW_SIMD_SSE2
+#endif
+
+//----------------------------------------------------------------------------------
+// Defines and Macros
+//----------------------------------------------------------------------------------
+#ifndef RLSW_MALLOC
+    #define RLSW_MALLOC(sz)         malloc(sz)
+#endif
+#ifndef RLSW_CALLOC
+    #define RLSW_CALLOC(n,sz)       calloc(n,sz)
+#endif
+#ifndef RLSW_REALLOC
+    #define RLSW_REALLOC(n,sz)      realloc(n,sz)
+#endif
+#ifndef RLSW_FREE
+    #define RLSW_FREE(p)            free(p)
+#endif
+
+#ifndef RLSW_TILE_SIZE
+    #define RLSW_TILE_SIZE                    64    // Tile size in pixels
+#endif
+#ifndef RLSW_MAX_FRAMEBUFFER_SIZE
+    #define RLSW_MAX_FRAMEBUFFER_SIZE       4096    // Maximum framebuffer width/height
+#endif
+#ifndef RLSW_MAX_QUEUED_TRIANGLES
+    #define RLSW_MAX_QUEUED_TRIANGLES      65536    // Maximum triangles queued before forcing a flush
+#endif
+#ifndef RLSW_MAX_TEXTURE_UNITS
+    #define RLSW_MAX_TEXTURE_UNITS            16    // Maximum texture units
+#endif
+#ifndef RLSW_MAX_VERTEX_ATTRIBS
+    #define RLSW_MAX_VERTEX_ATTRIBS           16    // Maximum vertex attributes
+#endif
+#ifndef RLSW_MAX_UNIFORMS
+    #define RLSW_MAX_UNIFORMS                 64    // Maximum uniforms per program
+#endif
+
+// Attributes and uniforms providing the default shader inputs (matching rlgl defaults)
+#define RLSW_ATTRIB_NAME_POSITION       "vertexPosition"
+#define RLSW_ATTRIB_NAME_TEXCOORD       "vertexTexCoord"
+#define RLSW_ATTRIB_NAME_COLOR          "vertexColor"
+#define RLSW_UNIFORM_NAME_MVP           "mvp"
+#define RLSW_UNIFORM_NAME_COLOR         "colDiffuse"
+#define RLSW_UNIFORM_NAME_TEXTURE0      "texture0"
+
+#define RLSW_SUBPIXEL_BITS                 4    // Fixed point subpixel precision (1/16 pixel)
+#define RLSW_SUBPIXEL_SIZE                (1 << RLSW_SUBPIXEL_BITS)
+#define RLSW_GUARD_BAND                 2.0f    // Clipping guard band in NDC units (keeps edge functions in 32bit range)
+#define RLSW_MAX_TILES                  ((RLSW_MAX_FRAMEBUFFER_SIZE + RLSW_TILE_SIZE - 1)/RLSW_TILE_SIZE)
+#define RLSW_CLIP_MAX_VERTICES             9    // Maximum vertices of a triangle clipped by 6 planes
+#define RLSW_VARYINGS                      6    // Interpolated attributes: texcoord (2) + color (4)
+
+// Calling convention of GL entry points
+#if defined(_WIN32) && !defined(_WIN64) && !defined(__MINGW64__)
+    #define RLSW_GLAPI __stdcall
+#else
+    #define RLSW_GLAPI
+#endif
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+typedef enum {
+    SW_OBJECT_NONE = 0,
+    SW_OBJECT_BUFFER,
+    SW_OBJECT_TEXTURE,                  // Textures and renderbuffers
+    SW_OBJECT_FRAMEBUFFER,
+    SW_OBJECT_VERTEX_ARRAY,
+    SW_OBJECT_SHADER,
+    SW_OBJECT_PROGRAM
+} swObjectType;
+
+typedef struct swBuffer {
+    unsigned char *data;                // Buffer data
+    int size;                           // Buffer size in bytes
+} swBuffer;
+
+typedef struct swTexture {
+    int width;                          // Texture width
+    int height;                         // Texture height
+    unsigned char *pixels;              // Color data, RGBA8 (NULL for depth textures)
+    float *depth;                       // Depth data (only depth textures/renderbuffers)
+    bool renderbuffer;                  // Object created as a renderbuffer
+    GLenum minFilter;                   // Minification filter
+    GLenum magFilter;                   // Magnification filter
+    GLenum wrapS;                       // Wrap mode, horizontal
+    GLenum wrapT;                       // Wrap mode, vertical
+    GLint swizzle[4];                   // Channels swizzle (applied on upload)
+} swTexture;
+
+typedef struct swFramebuffer {
+    GLuint color;                       // Color attachment (texture id)
+    GLuint depth;                       // Depth attachment (texture or renderbuffer id)
+} swFramebuffer;
+
+typedef struct swAttrib {
+    bool enabled;                       // Attribute array enabled
+    GLuint buffer;                      // Source buffer (0: client memory pointer)
+    int size;                           // Components count
+    GLenum type;                        // Components type
+    bool normalized;                    // Integer components normalized
+    int stride;                         // Bytes between consecutive elements
+    size_t offset;                      // Offset into buffer (or client pointer)
+} swAttrib;
+
+typedef struct swVertexArray {
+    swAttrib attribs[RLSW_MAX_VERTEX_ATTRIBS];
+    GLuint elementBuffer;               // Bound index buffer
+} swVertexArray;
+
+typedef struct swUniform {
+    char name[64];                      // Uniform name
+    float value[16];                    // Uniform value (floats)
+    int ivalue;                         // Uniform value (samplers/ints)
+} swUniform;
+
+typedef struct swProgram {
+    char attribNames[RLSW_MAX_VERTEX_ATTRIBS][64]; // Attribute names bound to locations
+    swUniform uniforms[RLSW_MAX_UNIFORMS];
+    int uniformCount;
+    int locMvp;                         // Location of mvp uniform (-1 if unknown)
+    int locColor;                       // Location of colDiffuse uniform
+    int locTexture;                     // Location of texture0 sampler
+} swProgram;
+
+typedef struct swObject {
+    swObjectType type;
+    union {
+        swBuffer buffer;
+        swTexture texture;
+        swFramebuffer framebuffer;
+        swVertexArray *vertexArray;
+        swProgram *program;
+    };
+} swObject;
+
+// Render target (resolved from current framebuffer)
+typedef struct swTarget {
+    unsigned char *color;               // Color buffer (RGBA8), NULL if no color attachment
+    float *depth;                       // Depth buffer, NULL if no depth attachment
+    int width;
+    int height;
+} swTarget;
+
+// Fixed function state captured for queued triangles
+typedef struct swDrawState {
+    const swTexture *texture;           // Texture sampled (NULL: white)
+    bool bilinear;                      // Bilinear filtering
+    GLenum wrapS, wrapT;
+    bool depthTest;
+    bool depthMask;
+    GLenum depthFunc;
+    bool blend;
+    GLenum blendSrcRGB, blendDstRGB, blendSrcAlpha, blendDstAlpha;
+    GLenum blendEqRGB, blendEqAlpha;
+    bool colorMask[4];
+} swDrawState;
+
+// Clip space vertex
+typedef struct swVertex {
+    float position[4];                  // Clip space position
+    float varyings[RLSW_VARYINGS];      // texcoord.uv, color.rgba
+} swVertex;
+
+// Screen space triangle ready to be rasterized
+typedef struct swTriangle {
+    int x[3], y[3];                     // Fixed point window coordinates (1/16 pixel)
+    int minX, minY, maxX, maxY;         // Bounding box in pixels (clamped to target and scissor)
+    int state;                          // Draw state index
+    bool perspective;                   // Perspective correct interpolation required
+    float z[3];                         // Depth plane: dz/dx, dz/dy, z at origin
+    float iw[3];                        // 1/w plane
+    float varyings[RLSW_VARYINGS][3];   // Varyings planes (premultiplied by 1/w if perspective)
+} swTriangle;
+
+// Tile triangles bin
+typedef struct swBin {
+    unsigned int *triangles;            // Triangle indices, in submission order
+    int count;
+    int capacity;
+    unsigned long long int fragments;   // Statistics written by the tile task
+    unsigned long long int fragmentsWritten;
+} swBin;
+
+typedef struct swContext {
+    // Default framebuffer
+    int width, height;
+    unsigned char *colorBuffer;
+    float *depthBuffer;
+
+    // Objects (ids are indices, never reused)
+    swObject *objects;
+    unsigned int objectCount;
+    unsigned int objectCapacity;
+    swVertexArray defaultVertexArray;
+
+    // Bindings
+    GLuint arrayBuffer;
+    GLuint vertexArray;
+    GLuint program;
+    GLuint framebuffer;
+    GLuint renderbuffer;
+    int activeTexture;
+    GLuint textures[RLSW_MAX_TEXTURE_UNITS];
+
+    // Fixed function state
+    int viewport[4];
+    int scissor[4];
+    bool scissorTest;
+    bool cullFace;
+    GLenum cullMode;
+    GLenum frontFace;
+    float clearColor[4];
+    float clearDepth;
+    int unpackAlignment;
+    float attribDefaults[RLSW_MAX_VERTEX_ATTRIBS][4];
+    swDrawState state;
+
+    // Vertex processing scratch memory
+    swVertex *vertices;
+    int vertexCapacity;
+
+    // Deferred rasterization queue
+    swTarget target;                    // Target of queued triangles
+    swTriangle *triangles;
+    int triangleCount;
+    swDrawState *states;
+    int stateCount;
+    int stateCapacity;
+    swBin bins[RLSW_MAX_TILES*RLSW_MAX_TILES];
+    int tilesX, tilesY;
+    int activeTiles[RLSW_MAX_TILES*RLSW_MAX_TILES];
+
+    swTaskRunner runner;
+    swStats stats;
+    bool ready;
+} swContext;
+
+//----------------------------------------------------------------------------------
+// Global Variables Definition
+//----------------------------------------------------------------------------------
+static swContext SW = { 0 };
+
+//----------------------------------------------------------------------------------
+// Module specific Functions Declaration
+//----------------------------------------------------------------------------------
+static swObject *swGetObject(GLuint id, swObjectType type); // Get object by id, NULL if not matching type
+static GLuint swCreateObject(swObjectType type);            // Create object, returns id
+static void swDeleteObject(GLuint id);                      // Delete object and free its data
+static swVertexArray *swGetVertexArray(void);               // Get bound vertex array (default if none)
+static swTarget swGetTarget(void);                          // Resolve current render target
+static void swFlush(void);                                  // Rasterize queued triangles
+static void swRasterizeTile(void *data, int index);         // Rasterize one tile (task callback)
+static void swDraw(GLenum mode, int count, GLenum indexType, const void *indices, int first); // Process draw call
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition: Objects and helpers
+//----------------------------------------------------------------------------------
+static swObject *swGetObject(GLuint id, swObjectType type)
+{
+    if ((id == 0) || (id >= SW.objectCount)) return NULL;
+    if (SW.objects[id].type != type) return NULL;
+
+    return &SW.objects[id];
+}
+
+static GLuint swCreateObject(swObjectType type)
+{
+    if (SW.objectCount >= SW.objectCapacity)
+    {
+        unsigned int capacity = (SW.objectCapacity == 0)? 256 : SW.objectCapacity*2;
+        swObject *objects = (swObject *)RLSW_REALLOC(SW.objects, capacity*sizeof(swObject));
+        if (objects == NULL) return 0;
+
+        memset(objects + SW.objectCapacity, 0, (capacity - SW.objectCapacity)*sizeof(swObject));
+        SW.objects = objects;
+        SW.objectCapacity = capacity;
+        if (SW.objectCount == 0) SW.objectCount = 1;   // Id 0 is reserved
+    }
+
+    GLuint id = SW.objectCount++;
+    swObject *object = &SW.objects[id];
+    memset(object, 0, sizeof(swObject));
+    object->type = type;
+
+    switch (type)
+    {
+        case SW_OBJECT_TEXTURE:
+        {
+            object->texture.minFilter = GL_NEAREST_MIPMAP_LINEAR;
+            object->texture.magFilter = GL_LINEAR;
+            object->texture.wrapS = GL_REPEAT;
+            object->texture.wrapT = GL_REPEAT;
+            object->texture.swizzle[0] = GL_RED;
+            object->texture.swizzle[1] = GL_GREEN;
+            object->texture.swizzle[2] = GL_BLUE;
+            object->texture.swizzle[3] = GL_ALPHA;
+        } break;
+        case SW_OBJECT_VERTEX_ARRAY: object->vertexArray = (swVertexArray *)RLSW_CALLOC(1, sizeof(swVertexArray)); break;
+        case SW_OBJECT_PROGRAM:
+        {
+            object->program = (swProgram *)RLSW_CALLOC(1, sizeof(swProgram));
+            object->program->locMvp = -1;
+            object->program->locColor = -1;
+            object->program->locTexture = -1;
+        } break;
+        default: break;
+    }
+
+    return id;
+}
+
+static void swDeleteObject(GLuint id)
+{
+    if ((id == 0) || (id >= SW.objectCount)) return;
+
+    swObject *object = &SW.objects[id];
+
+    switch (object->type)
+    {
+        case SW_OBJECT_BUFFER: RLSW_FREE(object->buffer.data); break;
+        case SW_OBJECT_TEXTURE:
+        {
+            RLSW_FREE(object->texture.pixels);
+            RLSW_FREE(object->texture.depth);
+        } break;
+        case SW_OBJECT_VERTEX_ARRAY: RLSW_FREE(object->vertexArray); break;
+        case SW_OBJECT_PROGRAM: RLSW_FREE(object->program); break;
+        default: break;
+    }
+
+    memset(object, 0, sizeof(swObject));
+}
+
+static swVertexArray *swGetVertexArray(void)
+{
+    swObject *object = swGetObject(SW.vertexArray, SW_OBJECT_VERTEX_ARRAY);
+
+    return (object != NULL)? object->vertexArray : &SW.defaultVertexArray;
+}
+
+static swTarget swGetTarget(void)
+{
+    swTarget target = { 0 };
+
+    if (SW.framebuffer == 0)
+    {
+        target.color = SW.colorBuffer;
+        target.depth = SW.depthBuffer;
+        target.width = SW.width;
+        target.height = SW.height;
+    }
+    else
+    {
+        swObject *fbo = swGetObject(SW.framebuffer, SW_OBJECT_FRAMEBUFFER);
+        if (fbo == NULL) return target;
+
+        swObject *color = swGetObject(fbo->framebuffer.color, SW_OBJECT_TEXTURE);
+        swObject *depth = swGetObject(fbo->framebuffer.depth, SW_OBJECT_TEXTURE);
+
+        if ((color != NULL) && (color->texture.pixels != NULL))
+        {
+            target.color = color->texture.pixels;
+            target.width = color->texture.width;
+            target.height = color->texture.height;
+        }
+
+        if ((depth != NULL) && (depth->texture.depth != NULL))
+        {
+            target.depth = depth->texture.depth;
+            if (target.color == NULL)
+            {
+                target.width = depth->texture.width;
+                target.height = depth->texture.height;
+            }
+        }
+    }
+
+    if (target.width > RLSW_MAX_FRAMEBUFFER_SIZE) target.width = RLSW_MAX_FRAMEBUFFER_SIZE;
+    if (target.height > RLSW_MAX_FRAMEBUFFER_SIZE) target.height = RLSW_MAX_FRAMEBUFFER_SIZE;
+
+    return target;
+}
+
+// Convert 16bit half float to float
+static float swHalfToFloat(unsigned short h)
+{
+    unsigned int sign = (h >> 15) & 0x1;
+    unsigned int exponent = (h >> 10) & 0x1f;
+    unsigned int mantissa = h & 0x3ff;
+    float value = 0.0f;
+
+    if (exponent == 0) value = ldexpf((float)mantissa, -24);
+    else if (exponent == 31) value = (mantissa == 0)? INFINITY : NAN;
+    else value = ldexpf((float)(mantissa | 0x400), (int)exponent - 25);
+
+    return sign? -value : value;
+}
+
+static unsigned char swFloatToUnorm8(float value)
+{
+    if (value <= 0.0f) return 0;
+    if (value >= 1.0f) return 255;
+
+    return (unsigned char)(value*255.0f + 0.5f);
+}
+
+// Get components count of a pixel transfer format
+static int swGetFormatComponents(GLenum format)
+{
+    switch (format)
+    {
+        case GL_RED: case GL_DEPTH_COMPONENT: return 1;
+        case GL_RG: return 2;
+        case GL_RGB: return 3;
+        case GL_RGBA: return 4;
+        default: return 0;
+    }
+}
+
+// Convert pixels from a transfer format into RGBA8 (missing channels: 0 for color, 1 for alpha)
+static void swConvertPixels(const swTexture *texture, unsigned char *dst, const void *src, int width, int height, GLenum format, GLenum type)
+{
+    int components = swGetFormatComponents(format);
+    int pixelSize = 0;
+
+    switch (type)
+    {
+        case GL_UNSIGNED_BYTE: pixelSize = components; break;
+        case GL_UNSIGNED_SHORT_5_6_5:
+        case GL_UNSIGNED_SHORT_5_5_5_1:
+        case GL_UNSIGNED_SHORT_4_4_4_4: pixelSize = 2; break;
+        case GL_HALF_FLOAT: pixelSize = 2*components; break;
+        case GL_FLOAT: pixelSize = 4*components; break;
+        default: break;
+    }
+
+    if ((components == 0) || (pixelSize == 0) || (src == NULL))
+    {
+        memset(dst, (src == NULL)? 0 : 255, (size_t)width*height*4);
+        return;
+    }
+
+    int rowSize = width*pixelSize;
+    int stride = (rowSize + SW.unpackAlignment - 1)/SW.unpackAlignment*SW.unpackAlignment;
+
+    for (int y = 0; y < height; y++)
+    {
+        const unsigned char *row = (const unsigned char *)src + (size_t)y*stride;
+        unsigned char *out = dst + (size_t)y*width*4;
+
+        for (int x = 0; x < width; x++, out += 4)
+        {
+            unsigned char rgba[4] = { 0, 0, 0, 255 };
+            const unsigned char *p = row + x*pixelSize;
+
+            switch (type)
+            {
+                case GL_UNSIGNED_BYTE: for (int c = 0; c < components; c++) rgba[c] = p[c]; break;
+                case GL_UNSIGNED_SHORT_5_6_5:
+                {
+                    unsigned short v = (unsigned short)(p[0] | (p[1] << 8));
+                    rgba[0] = (unsigned char)(((v >> 11) & 0x1f)*255/31);
+                    rgba[1] = (unsigned char)(((v >> 5) & 0x3f)*255/63);
+                    rgba[2] = (unsigned char)((v & 0x1f)*255/31);
+                } break;
+                case GL_UNSIGNED_SHORT_5_5_5_1:
+                {
+                    unsigned short v = (unsigned short)(p[0] | (p[1] << 8));
+                    rgba[0] = (unsigned char)(((v >> 11) & 0x1f)*255/31);
+                    rgba[1] = (unsigned char)(((v >> 6) & 0x1f)*255/31);
+                    rgba[2] = (unsigned char)(((v >> 1) & 0x1f)*255/31);
+                    rgba[3] = (v & 0x1)? 255 : 0;
+                } break;
+                case GL_UNSIGNED_SHORT_4_4_4_4:
+                {
+                    unsigned short v = (unsigned short)(p[0] | (p[1] << 8));
+                    rgba[0] = (unsigned char)(((v >> 12) & 0xf)*17);
+                    rgba[1] = (unsigned char)(((v >> 8) & 0xf)*17);
+                    rgba[2] = (unsigned char)(((v >> 4) & 0xf)*17);
+                    rgba[3] = (unsigned char)((v & 0xf)*17);
+                } break;
+                case GL_HALF_FLOAT:
+                {
+                    for (int c = 0; c < components; c++)
+                    {
+                        unsigned short h = 0;
+                        memcpy(&h, p + c*2, 2);
+                        rgba[c] = swFloatToUnorm8(swHalfToFloat(h));
+                    }
+                } break;
+                case GL_FLOAT:
+                {
+                    for (int c = 0; c < components; c++)
+                    {
+                        float f = 0.0f;
+                        memcpy(&f, p + c*4, 4);
+                        rgba[c] = swFloatToUnorm8(f);
+                    }
+                } break;
+                default: break;
+            }
+
+            // Apply texture swizzle
+            for (int c = 0; c < 4; c++)
+            {
+                switch (texture->swizzle[c])
+                {
+                    case GL_RED: out[c] = rgba[0]; break;
+                    case GL_GREEN: out[c] = rgba[1]; break;
+                    case GL_BLUE: out[c] = rgba[2]; break;
+                    case GL_ALPHA: out[c] = rgba[3]; break;
+                    case GL_ZERO: out[c] = 0; break;
+                    case GL_ONE: out[c] = 255; break;
+                    default: out[c] = rgba[c]; break;
+                }
+            }
+        }
+    }
+}
+
+// Check if internal format is a depth format
+static bool swIsDepthFormat(GLenum format)
+{
+    return ((format == GL_DEPTH_COMPONENT) || (format == GL_DEPTH_COMPONENT16) ||
+            (format == GL_DEPTH_COMPONENT24) || (format == GL_DEPTH_COMPONENT32) ||
+            (format == GL_DEPTH_COMPONENT32F) || (format == GL_DEPTH24_STENCIL8));
+}
+
+// Allocate texture storage
+static void swAllocTexture(swTexture *texture, int width, int height, bool depth)
+{
+    RLSW_FREE(texture->pixels);
+    RLSW_FREE(texture->depth);
+    texture->pixels = NULL;
+    texture->depth = NULL;
+    texture->width = width;
+    texture->height = height;
+
+    if ((width <= 0) || (height <= 0)) return;
+
+    if (depth)
+    {
+        texture->depth = (float *)RLSW_MALLOC((size_t)width*height*sizeof(float));
+        for (int i = 0; i < width*height; i++) texture->depth[i] = 1.0f;
+    }
+    else texture->pixels = (unsigned char *)RLSW_CALLOC((size_t)width*height, 4);
+}
+
+static swTexture *swGetBoundTexture(GLenum target)
+{
+    if (target != GL_TEXTURE_2D) return NULL;
+
+    swObject *object = swGetObject(SW.textures[SW.activeTexture], SW_OBJECT_TEXTURE);
+
+    return (object != NULL)? &object->texture : NULL;
+}
+
+static swBuffer *swGetBoundBuffer(GLenum target)
+{
+    GLuint id = 0;
+
+    if (target == GL_ARRAY_BUFFER) id = SW.arrayBuffer;
+    else if (target == GL_ELEMENT_ARRAY_BUFFER) id = swGetVertexArray()->elementBuffer;
+
+    swObject *object = swGetObject(id, SW_OBJECT_BUFFER);
+
+    return (object != NULL)? &object->buffer : NULL;
+}
+
+static swProgram *swGetProgram(GLuint id)
+{
+    swObject *object = swGetObject(id, SW_OBJECT_PROGRAM);
+
+    return (object != NULL)? object->program : NULL;
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition: GL entry points
+//----------------------------------------------------------------------------------
+// Generic entry point for unsupported/unneeded functions, returns 0/NULL
+// NOTE: Called through mismatching function pointer types, only safe with caller-cleanup conventions
+static void *RLSW_GLAPI swglNoop(void) { return NULL; }
+
+static GLenum RLSW_GLAPI swglGetError(void) { return GL_NO_ERROR; }
+
+static const GLubyte *RLSW_GLAPI swglGetString(GLenum name)
+{
+    switch (name)
+    {
+        case GL_VENDOR: return (const GLubyte *)"raylib";
+        case GL_RENDERER: return (const GLubyte *)"rlsw (software rasterizer)";
+        case GL_VERSION: return (const GLubyte *)"3.3.0 rlsw";
+        case GL_SHADING_LANGUAGE_VERSION: return (const GLubyte *)"3.30 rlsw";
+        default: return (const GLubyte *)"";
+    }
+}
+
+static const GLubyte *RLSW_GLAPI swglGetStringi(GLenum name, GLuint index)
+{
+    // NOTE: glad requires at least one extension to consider the context valid
+    return (const GLubyte *)"GL_RAYLIB_software_rasterizer";
+}
+
+static void RLSW_GLAPI swglGetIntegerv(GLenum pname, GLint *data)
+{
+    switch (pname)
+    {
+        case GL_NUM_EXTENSIONS: data[0] = 1; break;
+        case GL_MAX_TEXTURE_SIZE: data[0] = RLSW_MAX_FRAMEBUFFER_SIZE; break;
+        case GL_MAX_TEXTURE_IMAGE_UNITS: data[0] = RLSW_MAX_TEXTURE_UNITS; break;
+        case GL_MAX_VERTEX_ATTRIBS: data[0] = RLSW_MAX_VERTEX_ATTRIBS; break;
+        case GL_MAX_DRAW_BUFFERS: data[0] = 1; break;
+        case GL_DRAW_FRAMEBUFFER_BINDING: data[0] = (GLint)SW.framebuffer; break;
+        case GL_VIEWPORT: for (int i = 0; i < 4; i++) data[i] = SW.viewport[i]; break;
+        case GL_SCISSOR_BOX: for (int i = 0; i < 4; i++) data[i] = SW.scissor[i]; break;
+        default: data[0] = 0; break;
+    }
+}
+
+static void RLSW_GLAPI swglGetFloatv(GLenum pname, GLfloat *data)
+{
+    if (pname == GL_LINE_WIDTH) data[0] = 1.0f;
+    else data[0] = 0.0f;
+}
+
+// Capabilities
+static void swSetCapability(GLenum cap, bool enabled)
+{
+    switch (cap)
+    {
+        case GL_DEPTH_TEST: SW.state.depthTest = enabled; break;
+        case GL_BLEND: SW.state.blend = enabled; break;
+        case GL_CULL_FACE: SW.cullFace = enabled; break;
+        case GL_SCISSOR_TEST: SW.scissorTest = enabled; break;
+        default: break;
+    }
+}
+
+static void RLSW_GLAPI swglEnable(GLenum cap) { swSetCapability(cap, true); }
+static void RLSW_GLAPI swglDisable(GLenum cap) { swSetCapability(cap, false); }
+static void RLSW_GLAPI swglDepthFunc(GLenum func) { SW.state.depthFunc = func; }
+static void RLSW_GLAPI swglDepthMask(GLboolean flag) { SW.state.depthMask = flag; }
+static void RLSW_GLAPI swglCullFace(GLenum mode) { SW.cullMode = mode; }
+static void RLSW_GLAPI swglFrontFace(GLenum mode) { SW.frontFace = mode; }
+static void RLSW_GLAPI swglClearColor(GLfloat r, GLfloat g, GLfloat b, GLfloat a) { SW.clearColor[0] = r; SW.clearColor[1] = g; SW.clearColor[2] = b; SW.clearColor[3] = a; }
+static void RLSW_GLAPI swglClearDepth(GLdouble depth) { SW.clearDepth = (float)depth; }
+static void RLSW_GLAPI swglPixelStorei(GLenum pname, GLint param) { if (pname == GL_UNPACK_ALIGNMENT) SW.unpackAlignment = (param > 0)? param : 1; }
+
+static void RLSW_GLAPI swglColorMask(GLboolean r, GLboolean g, GLboolean b, GLboolean a)
+{
+    SW.state.colorMask[0] = r;
+    SW.state.colorMask[1] = g;
+    SW.state.colorMask[2] = b;
+    SW.state.colorMask[3] = a;
+}
+
+static void RLSW_GLAPI swglBlendFunc(GLenum src, GLenum dst)
+{
+    SW.state.blendSrcRGB = SW.state.blendSrcAlpha = src;
+    SW.state.blendDstRGB = SW.state.blendDstAlpha = dst;
+}
+
+static void RLSW_GLAPI swglBlendFuncSeparate(GLenum srcRGB, GLenum dstRGB, GLenum srcAlpha, GLenum dstAlpha)
+{
+    SW.state.blendSrcRGB = srcRGB;
+    SW.state.blendDstRGB = dstRGB;
+    SW.state.blendSrcAlpha = srcAlpha;
+    SW.state.blendDstAlpha = dstAlpha;
+}
+
+static void RLSW_GLAPI swglBlendEquation(GLenum mode) { SW.state.blendEqRGB = SW.state.blendEqAlpha = mode; }
+static void RLSW_GLAPI swglBlendEquationSeparate(GLenum modeRGB, GLenum modeAlpha) { SW.state.blendEqRGB = modeRGB; SW.state.blendEqAlpha = modeAlpha; }
+
+static void RLSW_GLAPI swglViewport(GLint x, GLint y, GLsizei width, GLsizei height)
+{
+    SW.viewport[0] = x;
+    SW.viewport[1] = y;
+    SW.viewport[2] = width;
+    SW.viewport[3] = height;
+}
+
+static void RLSW_GLAPI swglScissor(GLint x, GLint y, GLsizei width, GLsizei height)
+{
+    SW.scissor[0] = x;
+    SW.scissor[1] = y;
+    SW.scissor[2] = width;
+    SW.scissor[3] = height;
+}
+
+static void RLSW_GLAPI swglClear(GLbitfield mask)
+{
+    swFlush();
+
+    swTarget target = swGetTarget();
+    int x0 = 0, y0 = 0, x1 = target.width, y1 = target.height;
+
+    if (SW.scissorTest)
+    {
+        if (SW.scissor[0] > x0) x0 = SW.scissor[0];
+        if (SW.scissor[1] > y0) y0 = SW.scissor[1];
+        if (SW.scissor[0] + SW.scissor[2] < x1) x1 = SW.scissor[0] + SW.scissor[2];
+        if (SW.scissor[1] + SW.scissor[3] < y1) y1 = SW.scissor[1] + SW.scissor[3];
+    }
+
+    if ((mask & GL_COLOR_BUFFER_BIT) && (target.color != NULL))
+    {
+        unsigned char clear[4] = {
+            swFloatToUnorm8(SW.clearColor[0]), swFloatToUnorm8(SW.clearColor[1]),
+            swFloatToUnorm8(SW.clearColor[2]), swFloatToUnorm8(SW.clearColor[3])
+        };
+        unsigned int value = 0;
+        memcpy(&value, clear, 4);
+
+        for (int y = y0; y < y1; y++)
+        {
+            unsigned int *row = (unsigned int *)(target.color + ((size_t)y*target.width + x0)*4);
+            for (int x = x0; x < x1; x++) *row++ = value;
+        }
+    }
+
+    if ((mask & GL_DEPTH_BUFFER_BIT) && (target.depth != NULL) && SW.state.depthMask)
+    {
+        for (int y = y0; y < y1; y++)
+        {
+            float *row = target.depth + (size_t)y*target.width + x0;
+            for (int x = x0; x < x1; x++) *row++ = SW.clearDepth;
+        }
+    }
+}
+
+// Buffers
+static void RLSW_GLAPI swglGenBuffers(GLsizei n, GLuint *ids) { for (int i = 0; i < n; i++) ids[i] = swCreateObject(SW_OBJECT_BUFFER); }
+
+static void RLSW_GLAPI swglDeleteBuffers(GLsizei n, const GLuint *ids)
+{
+    for (int i = 0; i < n; i++)
+    {
+        if (swGetObject(ids[i], SW_OBJECT_BUFFER) == NULL) continue;
+        if (SW.arrayBuffer == ids[i]) SW.arrayBuffer = 0;
+        swDeleteObject(ids[i]);
+    }
+}
+
+static void RLSW_GLAPI swglBindBuffer(GLenum target, GLuint id)
+{
+    if (target == GL_ARRAY_BUFFER) SW.arrayBuffer = id;
+    else if (target == GL_ELEMENT_ARRAY_BUFFER) swGetVertexArray()->elementBuffer = id;
+}
+
+static void RLSW_GLAPI swglBufferData(GLenum target, GLsizeiptr size, const void *data, GLenum usage)
+{
+    swBuffer *buffer = swGetBoundBuffer(target);
+    if (buffer == NULL) return;
+
+    if (buffer->size != (int)size)
+    {
+        unsigned char *memory = (unsigned char *)RLSW_REALLOC(buffer->data, (size > 0)? size : 1);
+        if (memory == NULL) return;
+
+        buffer->data = memory;
+        buffer->size = (int)size;
+    }
+
+    if (data != NULL) memcpy(buffer->data, data, size);
+    else memset(buffer->data, 0, size);
+}
+
+static void RLSW_GLAPI swglBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, const void *data)
+{
+    swBuffer *buffer = swGetBoundBuffer(target);
+
+    if ((buffer != NULL) && (data != NULL) && (offset >= 0) && (offset + size <= buffer->size)) memcpy(buffer->data + offset, data, size);
+}
+
+static void RLSW_GLAPI swglGetBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, void *data)
+{
+    swBuffer *buffer = swGetBoundBuffer(target);
+
+    if ((buffer != NULL) && (offset >= 0) && (offset + size <= buffer->size)) memcpy(data, buffer->data + offset, size);
+}
+
+static void *RLSW_GLAPI swglMapBuffer(GLenum target, GLenum access)
+{
+    swBuffer *buffer = swGetBoundBuffer(target);
+
+    return (buffer != NULL)? buffer->data : NULL;
+}
+
+static GLboolean RLSW_GLAPI swglUnmapBuffer(GLenum target) { return GL_TRUE; }
+
+// Vertex arrays
+static void RLSW_GLAPI swglGenVertexArrays(GLsizei n, GLuint *ids) { for (int i = 0; i < n; i++) ids[i] = swCreateObject(SW_OBJECT_VERTEX_ARRAY); }
+static void RLSW_GLAPI swglBindVertexArray(GLuint id) { SW.vertexArray = id; }
+
+static void RLSW_GLAPI swglDeleteVertexArrays(GLsizei n, const GLuint *ids)
+{
+    for (int i = 0; i < n; i++)
+    {
+        if (swGetObject(ids[i], SW_OBJECT_VERTEX_ARRAY) == NULL) continue;
+        if (SW.vertexArray == ids[i]) SW.vertexArray = 0;
+        swDeleteObject(ids[i]);
+    }
+}
+
+static void RLSW_GLAPI swglVertexAttribPointer(GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void *pointer)
+{
+    if (index >= RLSW_MAX_VERTEX_ATTRIBS) return;
+
+    swAttrib *attrib = &swGetVertexArray()->attribs[index];
+    attrib->buffer = SW.arrayBuffer;
+    attrib->size = size;
+    attrib->type = type;
+    attrib->normalized = normalized;
+    attrib->offset = (size_t)pointer;
+
+    if (stride == 0)
+    {
+        int typeSize = 4;
+        if ((type == GL_BYTE) || (type == GL_UNSIGNED_BYTE)) typeSize = 1;
+        else if ((type == GL_SHORT) || (type == GL_UNSIGNED_SHORT) || (type == GL_HALF_FLOAT)) typeSize = 2;
+        stride = size*typeSize;
+    }
+
+    attrib->stride = stride;
+}
+
+static void RLSW_GLAPI swglEnableVertexAttribArray(GLuint index) { if (index < RLSW_MAX_VERTEX_ATTRIBS) swGetVertexArray()->attribs[index].enabled = true; }
+static void RLSW_GLAPI swglDisableVertexAttribArray(GLuint index) { if (index < RLSW_MAX_VERTEX_ATTRIBS) swGetVertexArray()->attribs[index].enabled = false; }
+
+static void swSetAttribDefault(GLuint index, const GLfloat *v, int count)
+{
+    if (index >= RLSW_MAX_VERTEX_ATTRIBS) return;
+
+    float value[4] = { 0.0f, 0.0f, 0.0f, 1.0f };
+    for (int i = 0; i < count; i++) value[i] = v[i];
+    memcpy(SW.attribDefaults[index], value, sizeof(value));
+}
+
+static void RLSW_GLAPI swglVertexAttrib1fv(GLuint index, const GLfloat *v) { swSetAttribDefault(index, v, 1); }
+static void RLSW_GLAPI swglVertexAttrib2fv(GLuint index, const GLfloat *v) { swSetAttribDefault(index, v, 2); }
+static void RLSW_GLAPI swglVertexAttrib3fv(GLuint index, const GLfloat *v) { swSetAttribDefault(index, v, 3); }
+static void RLSW_GLAPI swglVertexAttrib4fv(GLuint index, const GLfloat *v) { swSetAttribDefault(index, v, 4); }
+
+// Textures
+static void RLSW_GLAPI swglGenTextures(GLsizei n, GLuint *ids) { for (int i = 0; i < n; i++) ids[i] = swCreateObject(SW_OBJECT_TEXTURE); }
+
+static void RLSW_GLAPI swglDeleteTextures(GLsizei n, const GLuint *ids)
+{
+    swFlush();
+
+    for (int i = 0; i < n; i++)
+    {
+        if (swGetObject(ids[i], SW_OBJECT_TEXTURE) == NULL) continue;
+        for (int u = 0; u < RLSW_MAX_TEXTURE_UNITS; u++) if (SW.textures[u] == ids[i]) SW.textures[u] = 0;
+        swDeleteObject(ids[i]);
+    }
+}
+
+static void RLSW_GLAPI swglActiveTexture(GLenum texture)
+{
+    int unit = (int)(texture - GL_TEXTURE0);
+    if ((unit >= 0) && (unit < RLSW_MAX_TEXTURE_UNITS)) SW.activeTexture = unit;
+}
+
+static void RLSW_GLAPI swglBindTexture(GLenum target, GLuint id) { if (target == GL_TEXTURE_2D) SW.textures[SW.activeTexture] = id; }
+
+static void RLSW_GLAPI swglTexImage2D(GLenum target, GLint level, GLint internalFormat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const void *pixels)
+{
+    swTexture *texture = swGetBoundTexture(target);
+    if ((texture == NULL) || (level != 0)) return;
+
+    swFlush();
+
+    bool depth = swIsDepthFormat((GLenum)internalFormat);
+    swAllocTexture(texture, width, height, depth);
+
+    if (!depth && (texture->pixels != NULL) && (pixels != NULL)) swConvertPixels(texture, texture->pixels, pixels, width, height, format, type);
+}
+
+static void RLSW_GLAPI swglCompressedTexImage2D(GLenum target, GLint level, GLenum internalFormat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const void *data)
+{
+    swTexture *texture = swGetBoundTexture(target);
+    if ((texture == NULL) || (level != 0)) return;
+
+    swFlush();
+
+    // Compressed formats are not decoded, texture is uploaded as white
+    swAllocTexture(texture, width, height, false);
+    if (texture->pixels != NULL) memset(texture->pixels, 255, (size_t)width*height*4);
+}
+
+static void RLSW_GLAPI swglTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels)
+{
+    swTexture *texture = swGetBoundTexture(target);
+    if ((texture == NULL) || (texture->pixels == NULL) || (level != 0) || (pixels == NULL)) return;
+    if ((xoffset < 0) || (yoffset < 0) || (xoffset + width > texture->width) || (yoffset + height > texture->height)) return;
+
+    swFlush();
+
+    unsigned char *region = (unsigned char *)RLSW_MALLOC((size_t)width*height*4);
+    if (region == NULL) return;
+
+    swConvertPixels(texture, region, pixels, width, height, format, type);
+    for (int y = 0; y < height; y++) memcpy(texture->pixels + ((size_t)(yoffset + y)*texture->width + xoffset)*4, region + (size_t)y*width*4, (size_t)width*4);
+
+    RLSW_FREE(region);
+}
+
+static void RLSW_GLAPI swglGetTexImage(GLenum target, GLint level, GLenum format, GLenum type, void *pixels)
+{
+    swTexture *texture = swGetBoundTexture(target);
+    if ((texture == NULL) || (texture->pixels == NULL) || (level != 0)) return;
+
+    swFlush();
+
+    if ((format == GL_RGBA) && (type == GL_UNSIGNED_BYTE)) memcpy(pixels, texture->pixels, (size_t)texture->width*texture->height*4);
+}
+
+static void swSetTextureParameter(GLenum target, GLenum pname, GLint param)
+{
+    swTexture *texture = swGetBoundTexture(target);
+    if (texture == NULL) return;
+
+    switch (pname)
+    {
+        case GL_TEXTURE_MIN_FILTER: texture->minFilter = (GLenum)param; break;
+        case GL_TEXTURE_MAG_FILTER: texture->magFilter = (GLenum)param; break;
+        case GL_TEXTURE_WRAP_S: texture->wrapS = (GLenum)param; break;
+        case GL_TEXTURE_WRAP_T: texture->wrapT = (GLenum)param; break;
+        default: break;
+    }
+}
+
+static void RLSW_GLAPI swglTexParameteri(GLenum target, GLenum pname, GLint param) { swSetTextureParameter(target, pname, param); }
+static void RLSW_GLAPI swglTexParameterf(GLenum target, GLenum pname, GLfloat param) { swSetTextureParameter(target, pname, (GLint)param); }
+
+static void RLSW_GLAPI swglTexParameteriv(GLenum target, GLenum pname, const GLint *params)
+{
+    swTexture *texture = swGetBoundTexture(target);
+    if ((texture == NULL) || (pname != GL_TEXTURE_SWIZZLE_RGBA)) return;
+
+    swFlush();
+
+    // Swizzle is applied to stored data (previously stored data was not swizzled)
+    unsigned char *pixels = texture->pixels;
+    for (int i = 0; (pixels != NULL) && (i < texture->width*texture->height); i++, pixels += 4)
+    {
+        unsigned char rgba[4] = { pixels[0], pixels[1], pixels[2], pixels[3] };
+
+        for (int c = 0; c < 4; c++)
+        {
+            switch (params[c])
+            {
+                case GL_RED: pixels[c] = rgba[0]; break;
+                case GL_GREEN: pixels[c] = rgba[1]; break;
+                case GL_BLUE: pixels[c] = rgba[2]; break;
+                case GL_ALPHA: pixels[c] = rgba[3]; break;
+                case GL_ZERO: pixels[c] = 0; break;
+                case GL_ONE: pixels[c] = 255; break;
+                default: break;
+            }
+        }
+    }
+
+    for (int c = 0; c < 4; c++) texture->swizzle[c] = params[c];
+}
+
+// Framebuffers and renderbuffers
+static void RLSW_GLAPI swglGenFramebuffers(GLsizei n, GLuint *ids) { for (int i = 0; i < n; i++) ids[i] = swCreateObject(SW_OBJECT_FRAMEBUFFER); }
+static void RLSW_GLAPI swglGenRenderbuffers(GLsizei n, GLuint *ids)
+{
+    for (int i = 0; i < n; i++)
+    {
+        ids[i] = swCreateObject(SW_OBJECT_TEXTURE);
+        if (ids[i] != 0) SW.objects[ids[i]].texture.renderbuffer = true;
+    }
+}
+
+static void RLSW_GLAPI swglBindFramebuffer(GLenum target, GLuint id)
+{
+    if (SW.framebuffer != id) swFlush();
+    SW.framebuffer = id;
+}
+
+static void RLSW_GLAPI swglBindRenderbuffer(GLenum target, GLuint id) { SW.renderbuffer = id; }
+
+static void RLSW_GLAPI swglDeleteFramebuffers(GLsizei n, const GLuint *ids)
+{
+    swFlush();
+
+    for (int i = 0; i < n; i++)
+    {
+        if (swGetObject(ids[i], SW_OBJECT_FRAMEBUFFER) == NULL) continue;
+        if (SW.framebuffer == ids[i]) SW.framebuffer = 0;
+        swDeleteObject(ids[i]);
+    }
+}
+
+static void RLSW_GLAPI swglRenderbufferStorage(GLenum target, GLenum internalFormat, GLsizei width, GLsizei height)
+{
+    swObject *object = swGetObject(SW.renderbuffer, SW_OBJECT_TEXTURE);
+    if (object == NULL) return;
+
+    swFlush();
+    swAllocTexture(&object->texture, width, height, swIsDepthFormat(internalFormat));
+}
+
+static void swAttach(GLenum attachment, GLuint id)
+{
+    swObject *fbo = swGetObject(SW.framebuffer, SW_OBJECT_FRAMEBUFFER);
+    if (fbo == NULL) return;
+
+    swFlush();
+
+    if (attachment == GL_COLOR_ATTACHMENT0) fbo->framebuffer.color = id;
+    else if ((attachment == GL_DEPTH_ATTACHMENT) || (attachment == GL_DEPTH_STENCIL_ATTACHMENT)) fbo->framebuffer.depth = id;
+}
+
+static void RLSW_GLAPI swglFramebufferTexture2D(GLenum target, GLenum attachment, GLenum texTarget, GLuint texture, GLint level)
+{
+    if (texTarget == GL_TEXTURE_2D) swAttach(attachment, texture);
+}
+
+static void RLSW_GLAPI swglFramebufferRenderbuffer(GLenum target, GLenum attachment, GLenum rbTarget, GLuint renderbuffer) { swAttach(attachment, renderbuffer); }
+
+static GLenum RLSW_GLAPI swglCheckFramebufferStatus(GLenum target)
+{
+    swTarget current = swGetTarget();
+
+    return ((current.color != NULL) || (current.depth != NULL))? GL_FRAMEBUFFER_COMPLETE : GL_FRAMEBUFFER_INCOMPLETE_MISSING_ATTACHMENT;
+}
+
+static void RLSW_GLAPI swglGetFramebufferAttachmentParameteriv(GLenum target, GLenum attachment, GLenum pname, GLint *params)
+{
+    swObject *fbo = swGetObject(SW.framebuffer, SW_OBJECT_FRAMEBUFFER);
+    GLuint id = 0;
+
+    params[0] = 0;
+    if (fbo == NULL) return;
+
+    if (attachment == GL_COLOR_ATTACHMENT0) id = fbo->framebuffer.color;
+    else if (attachment == GL_DEPTH_ATTACHMENT) id = fbo->framebuffer.depth;
+
+    swObject *object = swGetObject(id, SW_OBJECT_TEXTURE);
+    if (object == NULL) return;
+
+    if (pname == GL_FRAMEBUFFER_ATTACHMENT_OBJECT_TYPE) params[0] = object->texture.renderbuffer? GL_RENDERBUFFER : GL_TEXTURE;
+    else if (pname == GL_FRAMEBUFFER_ATTACHMENT_OBJECT_NAME) params[0] = (GLint)id;
+}
+
+static void RLSW_GLAPI swglDeleteRenderbuffers(GLsizei n, const GLuint *ids)
+{
+    swFlush();
+
+    for (int i = 0; i < n; i++)
+    {
+        swObject *object = swGetObject(ids[i], SW_OBJECT_TEXTURE);
+        if ((object != NULL) && object->texture.renderbuffer) swDeleteObject(ids[i]);
+    }
+}
+
+static void RLSW_GLAPI swglReadPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, void *pixels)
+{
+    swFlush();
+
+    swTarget target = swGetTarget();
+    if ((target.color == NULL) || (format != GL_RGBA) || (type != GL_UNSIGNED_BYTE)) return;
+
+    for (int row = 0; row < height; row++)
+    {
+        unsigned char *dst = (unsigned char *)pixels + (size_t)row*width*4;
+
+        for (int col = 0; col < width; col++, dst += 4)
+        {
+            int sx = x + col, sy = y + row;
+
+            if ((sx >= 0) && (sy >= 0) && (sx < target.width) && (sy < target.height)) memcpy(dst, target.color + ((size_t)sy*target.width + sx)*4, 4);
+            else memset(dst, 0, 4);
+        }
+    }
+}
+
+static void RLSW_GLAPI swglFinish(void) { swFlush(); }
+
+// Shaders and programs
+// NOTE: GLSL is not compiled, programs only keep track of attributes and uniforms
+static GLuint RLSW_GLAPI swglCreateShader(GLenum type) { return swCreateObject(SW_OBJECT_SHADER); }
+static void RLSW_GLAPI swglDeleteShader(GLuint id) { if (swGetObject(id, SW_OBJECT_SHADER) != NULL) swDeleteObject(id); }
+static GLuint RLSW_GLAPI swglCreateProgram(void) { return swCreateObject(SW_OBJECT_PROGRAM); }
+static void RLSW_GLAPI swglDeleteProgram(GLuint id) { if (swGetObject(id, SW_OBJECT_PROGRAM) != NULL) swDeleteObject(id); if (SW.program == id) SW.program = 0; }
+static void RLSW_GLAPI swglUseProgram(GLuint id) { SW.program = id; }
+
+static void RLSW_GLAPI swglGetShaderiv(GLuint id, GLenum pname, GLint *params)
+{
+    // Shaders always compile and link successfully
+    params[0] = ((pname == GL_COMPILE_STATUS) || (pname == GL_LINK_STATUS))? GL_TRUE : 0;
+}
+
+static void RLSW_GLAPI swglBindAttribLocation(GLuint id, GLuint index, const GLchar *name)
+{
+    swProgram *program = swGetProgram(id);
+    if ((program == NULL) || (index >= RLSW_MAX_VERTEX_ATTRIBS)) return;
+
+    strncpy(program->attribNames[index], name, sizeof(program->attribNames[index]) - 1);
+}
+
+static GLint RLSW_GLAPI swglGetAttribLocation(GLuint id, const GLchar *name)
+{
+    swProgram *program = swGetProgram(id);
+    if (program == NULL) return -1;
+
+    for (int i = 0; i < RLSW_MAX_VERTEX_ATTRIBS; i++)
+    {
+        if (strcmp(program->attribNames[i], name) == 0) return i;
+    }
+
+    return -1;
+}
+
+static GLint RLSW_GLAPI swglGetUniformLocation(GLuint id, const GLchar *name)
+{
+    swProgram *program = swGetProgram(id);
+    if (program == NULL) return -1;
+
+    for (int i = 0; i < program->uniformCount; i++)
+    {
+        if (strcmp(program->uniforms[i].name, name) == 0) return i;
+    }
+
+    if (program->uniformCount >= RLSW_MAX_UNIFORMS) return -1;
+
+    int location = program->uniformCount++;
+    swUniform *uniform = &program->uniforms[location];
+    strncpy(uniform->name, name, sizeof(uniform->name) - 1);
+
+    if (strcmp(name, RLSW_UNIFORM_NAME_MVP) == 0) program->locMvp = location;
+    else if (strcmp(name, RLSW_UNIFORM_NAME_COLOR) == 0)
+    {
+        program->locColor = location;
+        for (int i = 0; i < 4; i++) uniform->value[i] = 1.0f;
+    }
+    else if (strcmp(name, RLSW_UNIFORM_NAME_TEXTURE0) == 0) program->locTexture = location;
+
+    return location;
+}
+
+static swUniform *swGetUniform(GLint location)
+{
+    swProgram *program = swGetProgram(SW.program);
+
+    if ((program == NULL) || (location < 0) || (location >= program->uniformCount)) return NULL;
+
+    return &program->uniforms[location];
+}
+
+static void swSetUniformFloats(GLint location, const GLfloat *value, int components)
+{
+    swUniform *uniform = swGetUniform(location);
+    if (uniform != NULL) for (int i = 0; i < components; i++) uniform->value[i] = value[i];
+}
+
+static void swSetUniformInts(GLint location, const GLint *value, int components)
+{
+    swUniform *uniform = swGetUniform(location);
+    if (uniform == NULL) return;
+
+    uniform->ivalue = value[0];
+    for (int i = 0; i < components; i++) uniform->value[i] = (float)value[i];
+}
+
+static void RLSW_GLAPI swglUniform1fv(GLint location, GLsizei count, const GLfloat *value) { swSetUniformFloats(location, value, 1); }
+static void RLSW_GLAPI swglUniform2fv(GLint location, GLsizei count, const GLfloat *value) { swSetUniformFloats(location, value, 2); }
+static void RLSW_GLAPI swglUniform3fv(GLint location, GLsizei count, const GLfloat *value) { swSetUniformFloats(location, value, 3); }
+static void RLSW_GLAPI swglUniform4fv(GLint location, GLsizei count, const GLfloat *value) { swSetUniformFloats(location, value, 4); }
+static void RLSW_GLAPI swglUniform1iv(GLint location, GLsizei count, const GLint *value) { swSetUniformInts(location, value, 1); }
+static void RLSW_GLAPI swglUniform2iv(GLint location, GLsizei count, const GLint *value) { swSetUniformInts(location, value, 2); }
+static void RLSW_GLAPI swglUniform3iv(GLint location, GLsizei count, const GLint *value) { swSetUniformInts(location, value, 3); }
+static void RLSW_GLAPI swglUniform4iv(GLint location, GLsizei count, const GLint *value) { swSetUniformInts(location, value, 4); }
+static void RLSW_GLAPI swglUniform1i(GLint location, GLint value) { swSetUniformInts(location, &value, 1); }
+static void RLSW_GLAPI swglUniform1f(GLint location, GLfloat value) { swSetUniformFloats(location, &value, 1); }
+
+static void RLSW_GLAPI swglUniformMatrix4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value)
+{
+    swUniform *uniform = swGetUniform(location);
+    if (uniform == NULL) return;
+
+    for (int i = 0; i < 16; i++) uniform->value[i] = transpose? value[(i%4)*4 + i/4] : value[i];
+}
+
+// Drawing
+static void RLSW_GLAPI swglDrawArrays(GLenum mode, GLint first, GLsizei count) { swDraw(mode, count, 0, NULL, first); }
+static void RLSW_GLAPI swglDrawElements(GLenum mode, GLsizei count, GLenum type, const void *indices) { swDraw(mode, count, type, indices, 0); }
+static void RLSW_GLAPI swglDrawArraysInstanced(GLenum mode, GLint first, GLsizei count, GLsizei instances) { swDraw(mode, count, 0, NULL, first); }
+static void RLSW_GLAPI swglDrawElementsInstanced(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instances) { swDraw(mode, count, type, indices, 0); }
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition: Vertex processing and triangles setup
+//----------------------------------------------------------------------------------
+// Fetch vertex attribute as float[4]
+static void swFetchAttrib(const swAttrib *attrib, const float *defaultValue, int index, float *out)
+{
+    const unsigned char *data = NULL;
+    int dataSize = 0;
+
+    if (attrib->enabled)
+    {
+        if (attrib->buffer == 0) data = (const unsigned char *)attrib->offset;
+        else
+        {
+            swObject *object = swGetObject(attrib->buffer, SW_OBJECT_BUFFER);
+            if (object != NULL)
+            {
+                data = object->buffer.data + attrib->offset;
+                dataSize = object->buffer.size - (int)attrib->offset;
+            }
+        }
+    }
+
+    int typeSize = 4;
+    if ((attrib->type == GL_BYTE) || (attrib->type == GL_UNSIGNED_BYTE)) typeSize = 1;
+    else if ((attrib->type == GL_SHORT) || (attrib->type == GL_UNSIGNED_SHORT) || (attrib->type == GL_HALF_FLOAT)) typeSize = 2;
+
+    size_t position = (size_t)index*attrib->stride;
+
+    if ((data == NULL) || ((attrib->buffer != 0) && ((long long int)position + attrib->size*typeSize > dataSize)))
+    {
+        memcpy(out, defaultValue, 4*sizeof(float));
+        return;
+    }
+
+    const unsigned char *p = data + position;
+    out[0] = 0.0f; out[1] = 0.0f; out[2] = 0.0f; out[3] = 1.0f;
+
+    for (int c = 0; (c < attrib->size) && (c < 4); c++)
+    {
+        switch (attrib->type)
+        {
+            case GL_FLOAT: memcpy(&out[c], p + c*4, 4); break;
+            case GL_HALF_FLOAT: { unsigned short h = 0; memcpy(&h, p + c*2, 2); out[c] = swHalfToFloat(h); } break;
+            case GL_UNSIGNED_BYTE: out[c] = attrib->normalized? p[c]/255.0f : (float)p[c]; break;
+            case GL_BYTE:
+            {
+                signed char v = (signed char)p[c];
+                out[c] = attrib->normalized? fmaxf(v/127.0f, -1.0f) : (float)v;
+            } break;
+            case GL_UNSIGNED_SHORT:
+            {
+                unsigned short v = 0;
+                memcpy(&v, p + c*2, 2);
+                out[c] = attrib->normalized? v/65535.0f : (float)v;
+            } break;
+            case GL_SHORT:
+            {
+                short v = 0;
+                memcpy(&v, p + c*2, 2);
+                out[c] = attrib->normalized? fmaxf(v/32767.0f, -1.0f) : (float)v;
+            } break;
+            case GL_UNSIGNED_INT: { unsigned int v = 0; memcpy(&v, p + c*4, 4); out[c] = (float)v; } break;
+            case GL_INT: { int v = 0; memcpy(&v, p + c*4, 4); out[c] = (float)v; } break;
+            default: break;
+        }
+    }
+}
+
+// Get index value from index buffer
+static unsigned int swGetIndex(const unsigned char *indices, GLenum type, int i)
+{
+    switch (type)
+    {
+        case GL_UNSIGNED_BYTE: return indices[i];
+        case GL_UNSIGNED_SHORT: { unsigned short v = 0; memcpy(&v, indices + i*2, 2); return v; }
+        case GL_UNSIGNED_INT: { unsigned int v = 0; memcpy(&v, indices + i*4, 4); return v; }
+        default: return 0;
+    }
+}
+
+// Get current fixed function state sampling provided texture
+static swDrawState swGetDrawState(const swTexture *texture)
+{
+    swDrawState state;
+
+    memcpy(&state, &SW.state, sizeof(swDrawState));     // Keeps zeroed padding bytes (compared with memcmp())
+    state.texture = texture;
+    state.bilinear = (texture != NULL) && (texture->magFilter == GL_LINEAR);
+    state.wrapS = (texture != NULL)? texture->wrapS : GL_REPEAT;
+    state.wrapT = (texture != NULL)? texture->wrapT : GL_REPEAT;
+
+    return state;
+}
+
+// Get (or push) queued draw state index, consecutive draws usually share the same state
+static int swPushDrawState(const swDrawState *state)
+{
+    if ((SW.stateCount > 0) && (memcmp(&SW.states[SW.stateCount - 1], state, sizeof(swDrawState)) == 0)) return SW.stateCount - 1;
+
+    if (SW.stateCount >= SW.stateCapacity)
+    {
+        int capacity = (SW.stateCapacity == 0)? 64 : SW.stateCapacity*2;
+        swDrawState *states = (swDrawState *)RLSW_REALLOC(SW.states, capacity*sizeof(swDrawState));
+        if (states == NULL) return -1;
+
+        SW.states = states;
+        SW.stateCapacity = capacity;
+    }
+
+    memcpy(&SW.states[SW.stateCount], state, sizeof(swDrawState));
+
+    return SW.stateCount++;
+}
+
+// Clip polygon against plane: dot(plane, position) >= 0
+static int swClipPolygon(const swVertex *input, int count, swVertex *output, const float *plane)
+{
+    int outCount = 0;
+
+    for (int i = 0; i < count; i++)
+    {
+        const swVertex *a = &input[i];
+        const swVertex *b = &input[(i + 1)%count];
+        float da = plane[0]*a->position[0] + plane[1]*a->position[1] + plane[2]*a->position[2] + plane[3]*a->position[3];
+        float db = plane[0]*b->position[0] + plane[1]*b->position[1] + plane[2]*b->position[2] + plane[3]*b->position[3];
+
+        if (da >= 0.0f) output[outCount++] = *a;
+
+        if ((da >= 0.0f) != (db >= 0.0f))
+        {
+            float t = da/(da - db);
+            swVertex *v = &output[outCount++];
+
+            for (int k = 0; k < 4; k++) v->position[k] = a->position[k] + (b->position[k] - a->position[k])*t;
+            for (int k = 0; k < RLSW_VARYINGS; k++) v->varyings[k] = a->varyings[k] + (b->varyings[k] - a->varyings[k])*t;
+        }
+    }
+
+    return outCount;
+}
+
+// Compute screen space plane equation (value = a*x + b*y + c) from 3 vertices values
+static void swComputePlane(const double *x, const double *y, double invDet, const float *values, float *plane)
+{
+    double dv1 = (double)values[1] - values[0];
+    double dv2 = (double)values[2] - values[0];
+    double a = (dv1*(y[2] - y[0]) - dv2*(y[1] - y[0]))*invDet;
+    double b = (dv2*(x[1] - x[0]) - dv1*(x[2] - x[0]))*invDet;
+
+    plane[0] = (float)a;
+    plane[1] = (float)b;
+    plane[2] = (float)(values[0] - a*x[0] - b*y[0]);
+}
+
+// Setup screen space triangle and bin it into the tiles it overlaps
+// NOTE: Vertices are already clipped, culling applied if requested
+static void swSetupTriangle(const swVertex *v0, const swVertex *v1, const swVertex *v2, int state, bool cull)
+{
+    const swVertex *v[3] = { v0, v1, v2 };
+    double wx[3], wy[3];
+    float wz[3], iw[3];
+    int fx[3], fy[3];
+
+    for (int i = 0; i < 3; i++)
+    {
+        iw[i] = 1.0f/v[i]->position[3];
+        wx[i] = SW.viewport[0] + (v[i]->position[0]*iw[i] + 1.0)*0.5*SW.viewport[2];
+        wy[i] = SW.viewport[1] + (v[i]->position[1]*iw[i] + 1.0)*0.5*SW.viewport[3];
+        wz[i] = (v[i]->position[2]*iw[i])*0.5f + 0.5f;
+
+        // Snap to subpixel grid
+        fx[i] = (int)floor(wx[i]*RLSW_SUBPIXEL_SIZE + 0.5);
+        fy[i] = (int)floor(wy[i]*RLSW_SUBPIXEL_SIZE + 0.5);
+    }
+
+    long long int area = (long long int)(fx[1] - fx[0])*(fy[2] - fy[0]) - (long long int)(fx[2] - fx[0])*(fy[1] - fy[0]);
+
+    if (area == 0)
+    {
+        SW.stats.trianglesCulled++;
+        return;
+    }
+
+    if (cull && SW.cullFace)
+    {
+        bool front = (SW.frontFace == GL_CW)? (area < 0) : (area > 0);
+        bool culled = (SW.cullMode == GL_FRONT_AND_BACK) || ((SW.cullMode == GL_FRONT) && front) || ((SW.cullMode == GL_BACK) && !front);
+
+        if (culled)
+        {
+            SW.stats.trianglesCulled++;
+            return;
+        }
+    }
+
+    // Keep counter-clockwise orientation (positive area)
+    int order[3] = { 0, 1, 2 };
+    if (area < 0) { order[1] = 2; order[2] = 1; }
+
+    swTarget target = SW.target;
+    int minX = 0, minY = 0, maxX = target.width - 1, maxY = target.height - 1;
+
+    if (SW.scissorTest)
+    {
+        if (SW.scissor[0] > minX) minX = SW.scissor[0];
+        if (SW.scissor[1] > minY) minY = SW.scissor[1];
+        if (SW.scissor[0] + SW.scissor[2] - 1 < maxX) maxX = SW.scissor[0] + SW.scissor[2] - 1;
+        if (SW.scissor[1] + SW.scissor[3] - 1 < maxY) maxY = SW.scissor[1] + SW.scissor[3] - 1;
+    }
+
+    int bx0 = fx[0], bx1 = fx[0], by0 = fy[0], by1 = fy[0];
+    for (int i = 1; i < 3; i++)
+    {
+        if (fx[i] < bx0) bx0 = fx[i];
+        if (fx[i] > bx1) bx1 = fx[i];
+        if (fy[i] < by0) by0 = fy[i];
+        if (fy[i] > by1) by1 = fy[i];
+    }
+
+    // Pixels whose center (x + 0.5) lies inside the subpixel bounding box
+    bx0 = (bx0 - RLSW_SUBPIXEL_SIZE/2 + RLSW_SUBPIXEL_SIZE - 1) >> RLSW_SUBPIXEL_BITS;
+    by0 = (by0 - RLSW_SUBPIXEL_SIZE/2 + RLSW_SUBPIXEL_SIZE - 1) >> RLSW_SUBPIXEL_BITS;
+    bx1 = (bx1 - RLSW_SUBPIXEL_SIZE/2) >> RLSW_SUBPIXEL_BITS;
+    by1 = (by1 - RLSW_SUBPIXEL_SIZE/2) >> RLSW_SUBPIXEL_BITS;
+    if (bx0 > minX) minX = bx0;
+    if (by0 > minY) minY = by0;
+    if (bx1 < maxX) maxX = bx1;
+    if (by1 < maxY) maxY = by1;
+
+    if ((minX > maxX) || (minY > maxY))
+    {
+        SW.stats.trianglesCulled++;
+        return;
+    }
+
+    if (SW.triangleCount >= RLSW_MAX_QUEUED_TRIANGLES)
+    {
+        // Flushing resets queued states, current one is pushed again
+        swDrawState current = SW.states[state];
+        swFlush();
+        state = swPushDrawState(&current);
+        if (state < 0) return;
+    }
+
+    swTriangle *tri = &SW.triangles[SW.triangleCount];
+    double x[3], y[3];
+    float z[3], w[3];
+    float varyings[RLSW_VARYINGS][3];
+
+    tri->perspective = (iw[0] != iw[1]) || (iw[0] != iw[2]);
+
+    for (int i = 0; i < 3; i++)
+    {
+        int k = order[i];
+        tri->x[i] = fx[k];
+        tri->y[i] = fy[k];
+        x[i] = (double)fx[k]/RLSW_SUBPIXEL_SIZE;
+        y[i] = (double)fy[k]/RLSW_SUBPIXEL_SIZE;
+        z[i] = wz[k];
+        w[i] = iw[k];
+
+        for (int j = 0; j < RLSW_VARYINGS; j++) varyings[j][i] = tri->perspective? v[k]->varyings[j]*iw[k] : v[k]->varyings[j];
+    }
+
+    double invDet = 1.0/((x[1] - x[0])*(y[2] - y[0]) - (x[2] - x[0])*(y[1] - y[0]));
+    swComputePlane(x, y, invDet, z, tri->z);
+    swComputePlane(x, y, invDet, w, tri->iw);
+    for (int j = 0; j < RLSW_VARYINGS; j++) swComputePlane(x, y, invDet, varyings[j], tri->varyings[j]);
+
+    tri->minX = minX;
+    tri->minY = minY;
+    tri->maxX = maxX;
+    tri->maxY = maxY;
+    tri->state = state;
+
+    // Bin triangle into overlapped tiles
+    unsigned int index = (unsigned int)SW.triangleCount++;
+
+    for (int ty = minY/RLSW_TILE_SIZE; ty <= maxY/RLSW_TILE_SIZE; ty++)
+    {
+        for (int tx = minX/RLSW_TILE_SIZE; tx <= maxX/RLSW_TILE_SIZE; tx++)
+        {
+            swBin *bin = &SW.bins[ty*SW.tilesX + tx];
+
+            if (bin->count >= bin->capacity)
+            {
+                int capacity = (bin->capacity == 0)? 256 : bin->capacity*2;
+                unsigned int *triangles = (unsigned int *)RLSW_REALLOC(bin->triangles, capacity*sizeof(unsigned int));
+                if (triangles == NULL) continue;
+
+                bin->triangles = triangles;
+                bin->capacity = capacity;
+            }
+
+            bin->triangles[bin->count++] = index;
+            SW.stats.trianglesBinned++;
+        }
+    }
+}
+
+// Clip triangle against near/far planes and guard band, setup resulting polygon
+static void swProcessTriangle(const swVertex *v0, const swVertex *v1, const swVertex *v2, int state, bool cull)
+{
+    static const float planes[6][4] = {
+        { 0.0f, 0.0f, 1.0f, 1.0f },                 // Near: z >= -w
+        { 0.0f, 0.0f, -1.0f, 1.0f },                // Far: z <= w
+        { 1.0f, 0.0f, 0.0f, RLSW_GUARD_BAND },      // Left guard band
+        { -1.0f, 0.0f, 0.0f, RLSW_GUARD_BAND },     // Right guard band
+        { 0.0f, 1.0f, 0.0f, RLSW_GUARD_BAND },      // Bottom guard band
+        { 0.0f, -1.0f, 0.0f, RLSW_GUARD_BAND }      // Top guard band
+    };
+
+    const swVertex *v[3] = { v0, v1, v2 };
+    unsigned int outside[3] = { 0 };
+
+    SW.stats.triangles++;
+
+    for (int i = 0; i < 3; i++)
+    {
+        for (int p = 0; p < 6; p++)
+        {
+            float d = planes[p][0]*v[i]->position[0] + planes[p][1]*v[i]->position[1] + planes[p][2]*v[i]->position[2] + planes[p][3]*v[i]->position[3];
+            if (d < 0.0f) outside[i] |= (1u << p);
+        }
+    }
+
+    // Trivial reject: all vertices outside the same plane
+    if (outside[0] & outside[1] & outside[2])
+    {
+        SW.stats.trianglesCulled++;
+        return;
+    }
+
+    // Trivial accept
+    if ((outside[0] | outside[1] | outside[2]) == 0)
+    {
+        swSetupTriangle(v0, v1, v2, state, cull);
+        return;
+    }
+
+    swVertex polygon[2][RLSW_CLIP_MAX_VERTICES + 3];
+    int count = 3;
+    polygon[0][0] = *v0;
+    polygon[0][1] = *v1;
+    polygon[0][2] = *v2;
+
+    int current = 0;
+    unsigned int crossed = outside[0] | outside[1] | outside[2];
+
+    for (int p = 0; (p < 6) && (count >= 3); p++)
+    {
+        if (!(crossed & (1u << p))) continue;
+
+        count = swClipPolygon(polygon[current], count, polygon[1 - current], planes[p]);
+        current = 1 - current;
+    }
+
+    if (count < 3)
+    {
+        SW.stats.trianglesCulled++;
+        return;
+    }
+
+    // Triangulate clipped polygon (fan)
+    for (int i = 1; i < count - 1; i++) swSetupTriangle(&polygon[current][0], &polygon[current][i], &polygon[current][i + 1], state, cull);
+}
+
+// Process line as a 1 pixel wide screen space quad
+static void swProcessLine(const swVertex *v0, const swVertex *v1, int state)
+{
+    swVertex a = *v0, b = *v1;
+
+    // Clip against near plane (lines crossing the camera)
+    float da = a.position[2] + a.position[3];
+    float db = b.position[2] + b.position[3];
+    if ((da < 0.0f) && (db < 0.0f)) return;
+    if ((da < 0.0f) || (db < 0.0f))
+    {
+        float t = da/(da - db);
+        swVertex c = a;
+        for (int k = 0; k < 4; k++) c.position[k] = a.position[k] + (b.position[k] - a.position[k])*t;
+        for (int k = 0; k < RLSW_VARYINGS; k++) c.varyings[k] = a.varyings[k] + (b.varyings[k] - a.varyings[k])*t;
+        if (da < 0.0f) a = c;
+        else b = c;
+    }
+
+    // Line direction in pixels, offset by half a pixel perpendicular to it (in clip space)
+    float dx = (b.position[0]/b.position[3] - a.position[0]/a.position[3])*SW.viewport[2];
+    float dy = (b.position[1]/b.position[3] - a.position[1]/a.position[3])*SW.viewport[3];
+    float length = sqrtf(dx*dx + dy*dy);
+    if (length < 1e-6f) return;
+
+    float nx = -dy/length/SW.viewport[2];
+    float ny = dx/length/SW.viewport[3];
+
+    swVertex quad[4] = { a, a, b, b };
+    quad[0].position[0] += nx*a.position[3]; quad[0].position[1] += ny*a.position[3];
+    quad[1].position[0] -= nx*a.position[3]; quad[1].position[1] -= ny*a.position[3];
+    quad[2].position[0] -= nx*b.position[3]; quad[2].position[1] -= ny*b.position[3];
+    quad[3].position[0] += nx*b.position[3]; quad[3].position[1] += ny*b.position[3];
+
+    swProcessTriangle(&quad[0], &quad[1], &quad[2], state, false);
+    swProcessTriangle(&quad[0], &quad[2], &quad[3], state, false);
+}
+
+// Process draw call: vertex fetch and transform, primitive assembly, clipping and binning
+static void swDraw(GLenum mode, int count, GLenum indexType, const void *indices, int first)
+{
+    if ((count <= 0) || !SW.ready) return;
+    if ((mode == GL_POINTS) || (SW.viewport[2] <= 0) || (SW.viewport[3] <= 0)) return;
+
+    SW.stats.drawCalls++;
+
+    // Resolve render target, queued triangles could target a different one
+    swTarget target = swGetTarget();
+    if ((target.width <= 0) || (target.height <= 0)) return;
+    if ((target.color != SW.target.color) || (target.depth != SW.target.depth) ||
+        (target.width != SW.target.width) || (target.height != SW.target.height))
+    {
+        swFlush();
+        SW.target = target;
+        SW.tilesX = (target.width + RLSW_TILE_SIZE - 1)/RLSW_TILE_SIZE;
+        SW.tilesY = (target.height + RLSW_TILE_SIZE - 1)/RLSW_TILE_SIZE;
+    }
+
+    // Default shader inputs
+    swProgram *program = swGetProgram(SW.program);
+    float mvp[16] = { 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1 };
+    float color[4] = { 1.0f, 1.0f, 1.0f, 1.0f };
+    int unit = 0;
+    int locPosition = 0, locTexCoord = 1, locColor = 3;
+
+    if (program != NULL)
+    {
+        if (program->locMvp >= 0) memcpy(mvp, program->uniforms[program->locMvp].value, sizeof(mvp));
+        if (program->locColor >= 0) memcpy(color, program->uniforms[program->locColor].value, sizeof(color));
+        if (program->locTexture >= 0) unit = program->uniforms[program->locTexture].ivalue;
+
+        for (int i = 0; i < RLSW_MAX_VERTEX_ATTRIBS; i++)
+        {
+            if (strcmp(program->attribNames[i], RLSW_ATTRIB_NAME_POSITION) == 0) locPosition = i;
+            else if (strcmp(program->attribNames[i], RLSW_ATTRIB_NAME_TEXCOORD) == 0) locTexCoord = i;
+            else if (strcmp(program->attribNames[i], RLSW_ATTRIB_NAME_COLOR) == 0) locColor = i;
+        }
+    }
+
+    swObject *texture = ((unit >= 0) && (unit < RLSW_MAX_TEXTURE_UNITS))? swGetObject(SW.textures[unit], SW_OBJECT_TEXTURE) : NULL;
+    swDrawState drawState = swGetDrawState(((texture != NULL) && (texture->texture.pixels != NULL))? &texture->texture : NULL);
+    int state = swPushDrawState(&drawState);
+    if (state < 0) return;
+
+    // Get vertices range referenced
+    swVertexArray *vao = swGetVertexArray();
+    const unsigned char *indexData = NULL;
+    unsigned int minIndex = (unsigned int)first, maxIndex = (unsigned int)(first + count - 1);
+
+    if (indexType != 0)
+    {
+        swObject *buffer = swGetObject(vao->elementBuffer, SW_OBJECT_BUFFER);
+        int indexSize = (indexType == GL_UNSIGNED_BYTE)? 1 : ((indexType == GL_UNSIGNED_SHORT)? 2 : 4);
+
+        if (buffer != NULL)
+        {
+            if ((size_t)indices + (size_t)count*indexSize > (size_t)buffer->buffer.size) return;
+            indexData = buffer->buffer.data + (size_t)indices;
+        }
+        else indexData = (const unsigned char *)indices;
+
+        if (indexData == NULL) return;
+
+        minIndex = 0xffffffff;
+        maxIndex = 0;
+        for (int i = 0; i < count; i++)
+        {
+            unsigned int index = swGetIndex(indexData, indexType, i);
+            if (index < minIndex) minIndex = index;
+            if (index > maxIndex) maxIndex = index;
+        }
+    }
+
+    int vertexCount = (int)(maxIndex - minIndex + 1);
+    if (vertexCount > SW.vertexCapacity)
+    {
+        swVertex *vertices = (swVertex *)RLSW_REALLOC(SW.vertices, vertexCount*sizeof(swVertex));
+        if (vertices == NULL) return;
+
+        SW.vertices = vertices;
+        SW.vertexCapacity = vertexCount;
+    }
+
+    // Vertex shader: mvp*vertexPosition, varyings: vertexTexCoord, vertexColor*colDiffuse
+    for (int i = 0; i < vertexCount; i++)
+    {
+        swVertex *vertex = &SW.vertices[i];
+        float position[4], texcoord[4], vcolor[4];
+        int index = (int)minIndex + i;
+
+        swFetchAttrib(&vao->attribs[locPosition], SW.attribDefaults[locPosition], index, position);
+        swFetchAttrib(&vao->attribs[locTexCoord], SW.attribDefaults[locTexCoord], index, texcoord);
+        swFetchAttrib(&vao->attribs[locColor], SW.attribDefaults[locColor], index, vcolor);
+
+#if defined(RLSW_SIMD_SSE2)
+        __m128 clip = _mm_add_ps(
+            _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(&mvp[0]), _mm_set1_ps(position[0])), _mm_mul_ps(_mm_loadu_ps(&mvp[4]), _mm_set1_ps(position[1]))),
+            _mm_add_ps(_mm_mul_ps(_mm_loadu_ps(&mvp[8]), _mm_set1_ps(position[2])), _mm_mul_ps(_mm_loadu_ps(&mvp[12]), _mm_set1_ps(position[3]))));
+        _mm_storeu_ps(vertex->position, clip);
+#else
+        for (int k = 0; k < 4; k++) vertex->position[k] = (mvp[k]*position[0] + mvp[4 + k]*position[1]) + (mvp[8 + k]*position[2] + mvp[12 + k]*position[3]);
+#endif
+        vertex->varyings[0] = texcoord[0];
+        vertex->varyings[1] = texcoord[1];
+        for (int k = 0; k < 4; k++) vertex->varyings[2 + k] = vcolor[k]*color[k];
+    }
+
+    // Primitive assembly
+    #define SW_VERTEX(i) (&SW.vertices[((indexData != NULL)? swGetIndex(indexData, indexType, (i)) : (unsigned int)(first + (i))) - minIndex])
+
+    switch (mode)
+    {
+        case GL_TRIANGLES: for (int i = 0; i + 2 < count; i += 3) swProcessTriangle(SW_VERTEX(i), SW_VERTEX(i + 1), SW_VERTEX(i + 2), state, true); break;
+        case GL_TRIANGLE_STRIP:
+        {
+            for (int i = 0; i + 2 < count; i++)
+            {
+                if (i%2 == 0) swProcessTriangle(SW_VERTEX(i), SW_VERTEX(i + 1), SW_VERTEX(i + 2), state, true);
+                else swProcessTriangle(SW_VERTEX(i + 1), SW_VERTEX(i), SW_VERTEX(i + 2), state, true);
+            }
+        } break;
+        case GL_TRIANGLE_FAN: for (int i = 1; i + 1 < count; i++) swProcessTriangle(SW_VERTEX(0), SW_VERTEX(i), SW_VERTEX(i + 1), state, true); break;
+        case GL_LINES: for (int i = 0; i + 1 < count; i += 2) swProcessLine(SW_VERTEX(i), SW_VERTEX(i + 1), state); break;
+        case GL_LINE_STRIP: for (int i = 0; i + 1 < count; i++) swProcessLine(SW_VERTEX(i), SW_VERTEX(i + 1), state); break;
+        case GL_LINE_LOOP:
+        {
+            for (int i = 0; i + 1 < count; i++) swProcessLine(SW_VERTEX(i), SW_VERTEX(i + 1), state);
+            if (count > 2) swProcessLine(SW_VERTEX(count - 1), SW_VERTEX(0), state);
+        } break;
+        default: break;
+    }
+
+    #undef SW_VERTEX
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition: Rasterization
+//----------------------------------------------------------------------------------
+// Wrap texture coordinate into texel index
+static int swWrapCoord(int coord, int size, GLenum wrap)
+{
+    if ((coord >= 0) && (coord < size)) return coord;   // Fast path, no wrapping required
+
+    switch (wrap)
+    {
+        case GL_CLAMP_TO_EDGE: return (coord < 0)? 0 : ((coord >= size)? size - 1 : coord);
+        case GL_MIRRORED_REPEAT:
+        {
+            int period = 2*size;
+            int c = coord%period;
+            if (c < 0) c += period;
+            return (c < size)? c : period - 1 - c;
+        }
+        default:
+        {
+            int c = coord%size;
+            return (c < 0)? c + size : c;
+        }
+    }
+}
+
+// Sample texture color (RGBA, 0..1)
+static void swSampleTexture(const swDrawState *state, float u, float v, float *out)
+{
+    const swTexture *texture = state->texture;
+    const unsigned char *pixels = texture->pixels;
+    int width = texture->width, height = texture->height;
+
+    if (!state->bilinear)
+    {
+        int x = swWrapCoord((int)floorf(u*width), width, state->wrapS);
+        int y = swWrapCoord((int)floorf(v*height), height, state->wrapT);
+        const unsigned char *p = pixels + ((size_t)y*width + x)*4;
+
+        for (int c = 0; c < 4; c++) out[c] = p[c]*(1.0f/255.0f);
+    }
+    else
+    {
+        float fu = u*width - 0.5f, fv = v*height - 0.5f;
+        float fx = floorf(fu), fy = floorf(fv);
+        float tx = fu - fx, ty = fv - fy;
+        int x0 = swWrapCoord((int)fx, width, state->wrapS), x1 = swWrapCoord((int)fx + 1, width, state->wrapS);
+        int y0 = swWrapCoord((int)fy, height, state->wrapT), y1 = swWrapCoord((int)fy + 1, height, state->wrapT);
+        const unsigned char *p00 = pixels + ((size_t)y0*width + x0)*4;
+        const unsigned char *p10 = pixels + ((size_t)y0*width + x1)*4;
+        const unsigned char *p01 = pixels + ((size_t)y1*width + x0)*4;
+        const unsigned char *p11 = pixels + ((size_t)y1*width + x1)*4;
+
+        for (int c = 0; c < 4; c++)
+        {
+            float top = p00[c] + (p10[c] - p00[c])*tx;
+            float bottom = p01[c] + (p11[c] - p01[c])*tx;
+            out[c] = (top + (bottom - top)*ty)*(1.0f/255.0f);
+        }
+    }
+}
+
+// Get blend factor for one channel
+static float swBlendFactor(GLenum factor, const float *src, const float *dst, int c)
+{
+    switch (factor)
+    {
+        case GL_ZERO: return 0.0f;
+        case GL_ONE: return 1.0f;
+        case GL_SRC_COLOR: return src[c];
+        case GL_ONE_MINUS_SRC_COLOR: return 1.0f - src[c];
+        case GL_DST_COLOR: return dst[c];
+        case GL_ONE_MINUS_DST_COLOR: return 1.0f - dst[c];
+        case GL_SRC_ALPHA: return src[3];
+        case GL_ONE_MINUS_SRC_ALPHA: return 1.0f - src[3];
+        case GL_DST_ALPHA: return dst[3];
+        case GL_ONE_MINUS_DST_ALPHA: return 1.0f - dst[3];
+        case GL_SRC_ALPHA_SATURATE: return (c == 3)? 1.0f : fminf(src[3], 1.0f - dst[3]);
+        default: return 1.0f;
+    }
+}
+
+static bool swDepthTest(GLenum func, float z, float depth)
+{
+    switch (func)
+    {
+        case GL_NEVER: return false;
+        case GL_LESS: return z < depth;
+        case GL_EQUAL: return z == depth;
+        case GL_LEQUAL: return z <= depth;
+        case GL_GREATER: return z > depth;
+        case GL_NOTEQUAL: return z != depth;
+        case GL_GEQUAL: return z >= depth;
+        default: return true;
+    }
+}
+
+// Shade one fragment: texture*color, blending and write
+static bool swShadeFragment(const swTriangle *tri, const swDrawState *state, unsigned char *color, float *depth, float px, float py)
+{
+    float z = tri->z[0]*px + tri->z[1]*py + tri->z[2];
+
+    if (depth != NULL)
+    {
+        if (state->depthTest && !swDepthTest(state->depthFunc, z, *depth)) return false;
+        if (state->depthTest && state->depthMask) *depth = z;
+    }
+
+    if (color == NULL) return true;
+
+    float varyings[RLSW_VARYINGS];
+    if (tri->perspective)
+    {
+        float w = 1.0f/(tri->iw[0]*px + tri->iw[1]*py + tri->iw[2]);
+        for (int i = 0; i < RLSW_VARYINGS; i++) varyings[i] = (tri->varyings[i][0]*px + tri->varyings[i][1]*py + tri->varyings[i][2])*w;
+    }
+    else for (int i = 0; i < RLSW_VARYINGS; i++) varyings[i] = tri->varyings[i][0]*px + tri->varyings[i][1]*py + tri->varyings[i][2];
+
+    float src[4] = { varyings[2], varyings[3], varyings[4], varyings[5] };
+
+    if (state->texture != NULL)
+    {
+        float texel[4];
+        swSampleTexture(state, varyings[0], varyings[1], texel);
+        for (int c = 0; c < 4; c++) src[c] *= texel[c];
+    }
+
+    for (int c = 0; c < 4; c++) src[c] = (src[c] < 0.0f)? 0.0f : ((src[c] > 1.0f)? 1.0f : src[c]);
+
+    if (state->blend && (state->blendSrcRGB == GL_SRC_ALPHA) && (state->blendDstRGB == GL_ONE_MINUS_SRC_ALPHA) &&
+        (state->blendSrcAlpha == GL_SRC_ALPHA) && (state->blendDstAlpha == GL_ONE_MINUS_SRC_ALPHA) &&
+        (state->blendEqRGB == GL_FUNC_ADD) && (state->blendEqAlpha == GL_FUNC_ADD))
+    {
+        // Alpha blending fast path (rlgl default blend mode)
+        float alpha = src[3];
+        if (alpha <= 0.0f) return true;
+        for (int c = 0; c < 4; c++) src[c] = src[c]*alpha + color[c]*(1.0f/255.0f)*(1.0f - alpha);
+    }
+    else if (state->blend)
+    {
+        float dst[4] = { color[0]/255.0f, color[1]/255.0f, color[2]/255.0f, color[3]/255.0f };
+
+        for (int c = 0; c < 4; c++)
+        {
+            GLenum srcFactor = (c < 3)? state->blendSrcRGB : state->blendSrcAlpha;
+            GLenum dstFactor = (c < 3)? state->blendDstRGB : state->blendDstAlpha;
+            GLenum equation = (c < 3)? state->blendEqRGB : state->blendEqAlpha;
+            float s = src[c]*swBlendFactor(srcFactor, src, dst, c);
+            float d = dst[c]*swBlendFactor(dstFactor, src, dst, c);
+
+            switch (equation)
+            {
+                case GL_FUNC_SUBTRACT: src[c] = s - d; break;
+                case GL_FUNC_REVERSE_SUBTRACT: src[c] = d - s; break;
+                case GL_MIN: src[c] = fminf(src[c], dst[c]); break;
+                case GL_MAX: src[c] = fmaxf(src[c], dst[c]); break;
+                default: src[c] = s + d; break;
+            }
+        }
+    }
+
+    for (int c = 0; c < 4; c++) if (state->colorMask[c]) color[c] = swFloatToUnorm8(src[c]);
+
+    return true;
+}
+
+// Rasterize all triangles binned into one tile, in submission order
+static void swRasterizeTile(void *data, int index)
+{
+    int tile = SW.activeTiles[index];
+    swBin *bin = &SW.bins[tile];
+    swTarget target = SW.target;
+    int tileX0 = (tile%SW.tilesX)*RLSW_TILE_SIZE;
+    int tileY0 = (tile/SW.tilesX)*RLSW_TILE_SIZE;
+    int tileX1 = tileX0 + RLSW_TILE_SIZE - 1;
+    int tileY1 = tileY0 + RLSW_TILE_SIZE - 1;
+    unsigned long long int fragments = 0, fragmentsWritten = 0;
+
+    for (int t = 0; t < bin->count; t++)
+    {
+        const swTriangle *tri = &SW.triangles[bin->triangles[t]];
+        const swDrawState *state = &SW.states[tri->state];
+        int x0 = (tri->minX > tileX0)? tri->minX : tileX0;
+        int y0 = (tri->minY > tileY0)? tri->minY : tileY0;
+        int x1 = (tri->maxX < tileX1)? tri->maxX : tileX1;
+        int y1 = (tri->maxY < tileY1)? tri->maxY : tileY1;
+
+        if ((x0 > x1) || (y0 > y1)) continue;
+
+        // Edge functions: E(p) = A*(px - xa) + B*(py - ya), inside if E >= 0 (counter-clockwise)
+        // NOTE: Edges crossing the rectangle are evaluated incrementally in 32bit (bounded by guard band
+        // and tile size), edges fully covering the rectangle are skipped, top-left rule applied as bias
+        int edgeCount = 0;
+        int rowE[3], stepX[3], stepY[3];
+        bool rejected = false;
+
+        for (int e = 0; e < 3; e++)
+        {
+            int a = e, b = (e + 1)%3;
+            long long int A = -(long long int)(tri->y[b] - tri->y[a]);
+            long long int B = (long long int)(tri->x[b] - tri->x[a]);
+            bool topLeft = (tri->y[b] < tri->y[a]) || ((tri->y[b] == tri->y[a]) && (tri->x[b] < tri->x[a]));
+            long long int bias = topLeft? 0 : -1;
+            long long int px = (long long int)x0*RLSW_SUBPIXEL_SIZE + RLSW_SUBPIXEL_SIZE/2 - tri->x[a];
+            long long int py = (long long int)y0*RLSW_SUBPIXEL_SIZE + RLSW_SUBPIXEL_SIZE/2 - tri->y[a];
+            long long int e00 = A*px + B*py + bias;
+            long long int dx = A*RLSW_SUBPIXEL_SIZE*(x1 - x0), dy = B*RLSW_SUBPIXEL_SIZE*(y1 - y0);
+            long long int corners[4] = { e00, e00 + dx, e00 + dy, e00 + dx + dy };
+            long long int minE = corners[0], maxE = corners[0];
+
+            for (int c = 1; c < 4; c++)
+            {
+                if (corners[c] < minE) minE = corners[c];
+                if (corners[c] > maxE) maxE = corners[c];
+            }
+
+            if (maxE < 0) { rejected = true; break; }
+            if (minE >= 0) continue;    // Edge covers whole rectangle
+
+            rowE[edgeCount] = (int)e00;
+            stepX[edgeCount] = (int)(A*RLSW_SUBPIXEL_SIZE);
+            stepY[edgeCount] = (int)(B*RLSW_SUBPIXEL_SIZE);
+            edgeCount++;
+        }
+
+        if (rejected) continue;
+
+#if defined(RLSW_SIMD_SSE2)
+        __m128i laneStepX[3];
+        for (int k = 0; k < edgeCount; k++) laneStepX[k] = _mm_set_epi32(3*stepX[k], 2*stepX[k], stepX[k], 0);
+#endif
+
+        for (int y = y0; y <= y1; y++)
+        {
+            int e[3] = { rowE[0], rowE[1], rowE[2] };
+            size_t rowOffset = (size_t)y*target.width;
+            float py = (float)y + 0.5f;
+
+            for (int x = x0; x <= x1; x += 4)
+            {
+                // Coverage mask of 4 pixels
+                int remaining = x1 - x + 1;
+                int mask = (remaining >= 4)? 0xf : ((1 << remaining) - 1);
+#if defined(RLSW_SIMD_SSE2)
+                __m128i inside = _mm_set1_epi32(-1);
+                for (int k = 0; k < edgeCount; k++)
+                {
+                    __m128i values = _mm_add_epi32(_mm_set1_epi32(e[k]), laneStepX[k]);
+                    inside = _mm_and_si128(inside, _mm_cmpgt_epi32(values, _mm_set1_epi32(-1)));
+                }
+                mask &= _mm_movemask_ps(_mm_castsi128_ps(inside));
+#else
+                for (int k = 0; k < edgeCount; k++)
+                {
+                    for (int lane = 0; lane < 4; lane++) if ((e[k] + lane*stepX[k]) < 0) mask &= ~(1 << lane);
+                }
+#endif
+                for (int k = 0; k < edgeCount; k++) e[k] += 4*stepX[k];
+
+                while (mask)
+                {
+                    int lane = 0;
+                    while (!(mask & (1 << lane))) lane++;
+                    mask &= ~(1 << lane);
+
+                    size_t offset = rowOffset + x + lane;
+                    fragments++;
+
+                    if (swShadeFragment(tri, state, (target.color != NULL)? target.color + offset*4 : NULL,
+                        (target.depth != NULL)? target.depth + offset : NULL, (float)(x + lane) + 0.5f, py)) fragmentsWritten++;
+                }
+            }
+
+            for (int k = 0; k < edgeCount; k++) rowE[k] += stepY[k];
+        }
+    }
+
+    bin->fragments = fragments;
+    bin->fragmentsWritten = fragmentsWritten;
+}
+
+// Rasterize queued triangles, tiles are distributed across task runner threads
+static void swFlush(void)
+{
+    if (SW.triangleCount == 0) return;
+
+    int activeCount = 0;
+    for (int i = 0; i < SW.tilesX*SW.tilesY; i++) if (SW.bins[i].count > 0) SW.activeTiles[activeCount++] = i;
+
+    if (SW.runner != NULL) SW.runner(swRasterizeTile, NULL, activeCount);
+    else for (int i = 0; i < activeCount; i++) swRasterizeTile(NULL, i);
+
+    for (int i = 0; i < activeCount; i++)
+    {
+        swBin *bin = &SW.bins[SW.activeTiles[i]];
+        SW.stats.fragments += bin->fragments;
+        SW.stats.fragmentsWritten += bin->fragmentsWritten;
+        bin->count = 0;
+    }
+
+    SW.stats.flushes++;
+    SW.triangleCount = 0;
+    SW.stateCount = 0;
+}
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+// Initialize software rasterizer context and default framebuffer
+bool swInit(int width, int height)
+{
+    if (SW.ready) swClose();
+
+    SW.triangles = (swTriangle *)RLSW_MALLOC(RLSW_MAX_QUEUED_TRIANGLES*sizeof(swTriangle));
+    if (SW.triangles == NULL) return false;
+
+    SW.state.depthFunc = GL_LESS;
+    SW.state.depthMask = true;
+    SW.state.blendSrcRGB = SW.state.blendSrcAlpha = GL_ONE;
+    SW.state.blendDstRGB = SW.state.blendDstAlpha = GL_ZERO;
+    SW.state.blendEqRGB = SW.state.blendEqAlpha = GL_FUNC_ADD;
+    for (int i = 0; i < 4; i++) SW.state.colorMask[i] = true;
+    SW.cullMode = GL_BACK;
+    SW.frontFace = GL_CCW;
+    SW.clearDepth = 1.0f;
+    SW.unpackAlignment = 4;
+    for (int i = 0; i < RLSW_MAX_VERTEX_ATTRIBS; i++) SW.attribDefaults[i][3] = 1.0f;
+
+    SW.ready = true;
+    swResize(width, height);
+
+    return true;
+}
+
+// Close software rasterizer, free all resources
+void swClose(void)
+{
+    for (unsigned int i = 1; i < SW.objectCount; i++) swDeleteObject(i);
+    for (int i = 0; i < RLSW_MAX_TILES*RLSW_MAX_TILES; i++) RLSW_FREE(SW.bins[i].triangles);
+
+    RLSW_FREE(SW.objects);
+    RLSW_FREE(SW.colorBuffer);
+    RLSW_FREE(SW.depthBuffer);
+    RLSW_FREE(SW.vertices);
+    RLSW_FREE(SW.triangles);
+    RLSW_FREE(SW.states);
+
+    // Task runner and statistics are kept, statistics could be queried after closing
+    swTaskRunner runner = SW.runner;
+    swStats stats = SW.stats;
+    memset(&SW, 0, sizeof(swContext));
+    SW.runner = runner;
+    SW.stats = stats;
+}
+
+// Resize default framebuffer
+void swResize(int width, int height)
+{
+    if (!SW.ready) return;
+
+    swFlush();
+
+    if (width > RLSW_MAX_FRAMEBUFFER_SIZE) width = RLSW_MAX_FRAMEBUFFER_SIZE;
+    if (height > RLSW_MAX_FRAMEBUFFER_SIZE) height = RLSW_MAX_FRAMEBUFFER_SIZE;
+    if ((width <= 0) || (height <= 0)) return;
+
+    RLSW_FREE(SW.colorBuffer);
+    RLSW_FREE(SW.depthBuffer);
+    SW.colorBuffer = (unsigned char *)RLSW_CALLOC((size_t)width*height, 4);
+    SW.depthBuffer = (float *)RLSW_MALLOC((size_t)width*height*sizeof(float));
+    for (int i = 0; (SW.depthBuffer != NULL) && (i < width*height); i++) SW.depthBuffer[i] = 1.0f;
+
+    SW.width = width;
+    SW.height = height;
+    SW.target = (swTarget){ 0 };
+    swglViewport(0, 0, width, height);
+    swglScissor(0, 0, width, height);
+}
+
+// Set tasks runner used to rasterize tiles in parallel
+void swSetTaskRunner(swTaskRunner runner)
+{
+    SW.runner = runner;
+}
+
+// Rasterize all queued triangles
+void swFinish(void)
+{
+    swFlush();
+}
+
+// Get default framebuffer color data (RGBA8, bottom-up rows)
+unsigned char *swGetFramebuffer(int *width, int *height)
+{
+    swFlush();
+
+    if (width != NULL) *width = SW.width;
+    if (height != NULL) *height = SW.height;
+
+    return SW.colorBuffer;
+}
+
+// Get rendering statistics
+swStats swGetStats(void)
+{
+    return SW.stats;
+}
+
+// Reset rendering statistics
+void swResetStats(void)
+{
+    memset(&SW.stats, 0, sizeof(swStats));
+}
+
+// Get GL function implementation by name (glad loader)
+void *swGetProcAddress(const char *name)
+{
+    static const struct { const char *name; void *proc; } procs[] = {
+        { "glGetError", (void *)swglGetError },
+        { "glGetString", (void *)swglGetString },
+        { "glGetStringi", (void *)swglGetStringi },
+        { "glGetIntegerv", (void *)swglGetIntegerv },
+        { "glGetFloatv", (void *)swglGetFloatv },
+        { "glEnable", (void *)swglEnable },
+        { "glDisable", (void *)swglDisable },
+        { "glDepthFunc", (void *)swglDepthFunc },
+        { "glDepthMask", (void *)swglDepthMask },
+        { "glCullFace", (void *)swglCullFace },
+        { "glFrontFace", (void *)swglFrontFace },
+        { "glColorMask", (void *)swglColorMask },
+        { "glBlendFunc", (void *)swglBlendFunc },
+        { "glBlendFuncSeparate", (void *)swglBlendFuncSeparate },
+        { "glBlendEquation", (void *)swglBlendEquation },
+        { "glBlendEquationSeparate", (void *)swglBlendEquationSeparate },
+        { "glViewport", (void *)swglViewport },
+        { "glScissor", (void *)swglScissor },
+        { "glClearColor", (void *)swglClearColor },
+        { "glClearDepth", (void *)swglClearDepth },
+        { "glClear", (void *)swglClear },
+        { "glPixelStorei", (void *)swglPixelStorei },
+        { "glGenBuffers", (void *)swglGenBuffers },
+        { "glDeleteBuffers", (void *)swglDeleteBuffers },
+        { "glBindBuffer", (void *)swglBindBuffer },
+        { "glBufferData", (void *)swglBufferData },
+        { "glBufferSubData", (void *)swglBufferSubData },
+        { "glGetBufferSubData", (void *)swglGetBufferSubData },
+        { "glMapBuffer", (void *)swglMapBuffer },
+        { "glUnmapBuffer", (void *)swglUnmapBuffer },
+        { "glGenVertexArrays", (void *)swglGenVertexArrays },
+        { "glDeleteVertexArrays", (void *)swglDeleteVertexArrays },
+        { "glBindVertexArray", (void *)swglBindVertexArray },
+        { "glVertexAttribPointer", (void *)swglVertexAttribPointer },
+        { "glEnableVertexAttribArray", (void *)swglEnableVertexAttribArray },
+        { "glDisableVertexAttribArray", (void *)swglDisableVertexAttribArray },
+        { "glVertexAttrib1fv", (void *)swglVertexAttrib1fv },
+        { "glVertexAttrib2fv", (void *)swglVertexAttrib2fv },
+        { "glVertexAttrib3fv", (void *)swglVertexAttrib3fv },
+        { "glVertexAttrib4fv", (void *)swglVertexAttrib4fv },
+        { "glGenTextures", (void *)swglGenTextures },
+        { "glDeleteTextures", (void *)swglDeleteTextures },
+        { "glActiveTexture", (void *)swglActiveTexture },
+        { "glBindTexture", (void *)swglBindTexture },
+        { "glTexImage2D", (void *)swglTexImage2D },
+        { "glCompressedTexImage2D", (void *)swglCompressedTexImage2D },
+        { "glTexSubImage2D", (void *)swglTexSubImage2D },
+        { "glGetTexImage", (void *)swglGetTexImage },
+        { "glTexParameteri", (void *)swglTexParameteri },
+        { "glTexParameterf", (void *)swglTexParameterf },
+        { "glTexParameteriv", (void *)swglTexParameteriv },
+        { "glGenFramebuffers", (void *)swglGenFramebuffers },
+        { "glDeleteFramebuffers", (void *)swglDeleteFramebuffers },
+        { "glBindFramebuffer", (void *)swglBindFramebuffer },
+        { "glFramebufferTexture2D", (void *)swglFramebufferTexture2D },
+        { "glFramebufferRenderbuffer", (void *)swglFramebufferRenderbuffer },
+        { "glCheckFramebufferStatus", (void *)swglCheckFramebufferStatus },
+        { "glGetFramebufferAttachmentParameteriv", (void *)swglGetFramebufferAttachmentParameteriv },
+        { "glGenRenderbuffers", (void *)swglGenRenderbuffers },
+        { "glDeleteRenderbuffers", (void *)swglDeleteRenderbuffers },
+        { "glBindRenderbuffer", (void *)swglBindRenderbuffer },
+        { "glRenderbufferStorage", (void *)swglRenderbufferStorage },
+        { "glReadPixels", (void *)swglReadPixels },
+        { "glFinish", (void *)swglFinish },
+        { "glFlush", (void *)swglFinish },
+        { "glCreateShader", (void *)swglCreateShader },
+        { "glDeleteShader", (void *)swglDeleteShader },
+        { "glGetShaderiv", (void *)swglGetShaderiv },
+        { "glCreateProgram", (void *)swglCreateProgram },
+        { "glDeleteProgram", (void *)swglDeleteProgram },
+        { "glGetProgramiv", (void *)swglGetShaderiv },
+        { "glUseProgram", (void *)swglUseProgram },
+        { "glBindAttribLocation", (void *)swglBindAttribLocation },
+        { "glGetAttribLocation", (void *)swglGetAttribLocation },
+        { "glGetUniformLocation", (void *)swglGetUniformLocation },
+        { "glUniform1f", (void *)swglUniform1f },
+        { "glUniform1i", (void *)swglUniform1i },
+        { "glUniform1fv", (void *)swglUniform1fv },
+        { "glUniform2fv", (void *)swglUniform2fv },
+        { "glUniform3fv", (void *)swglUniform3fv },
+        { "glUniform4fv", (void *)swglUniform4fv },
+        { "glUniform1iv", (void *)swglUniform1iv },
+        { "glUniform2iv", (void *)swglUniform2iv },
+        { "glUniform3iv", (void *)swglUniform3iv },
+        { "glUniform4iv", (void *)swglUniform4iv },
+        { "glUniformMatrix4fv", (void *)swglUniformMatrix4fv },
+        { "glDrawArrays", (void *)swglDrawArrays },
+        { "glDrawElements", (void *)swglDrawElements },
+        { "glDrawArraysInstanced", (void *)swglDrawArraysInstanced },
+        { "glDrawElementsInstanced", (void *)swglDrawElementsInstanced },
+    };
+
+    for (int i = 0; i < (int)(sizeof(procs)/sizeof(procs[0])); i++)
+    {
+        if (strcmp(name, procs[i].name) == 0) return procs[i].proc;
+    }
+
+    return (void *)swglNoop;
+}
+
+#endif  // RLSW_IMPLEMENTATION
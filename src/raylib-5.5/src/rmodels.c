@@ -12,7 +12,10 @@
 *       #define SUPPORT_FILEFORMAT_GLTF
 *       #define SUPPORT_FILEFORMAT_VOX
 *       #define SUPPORT_FILEFORMAT_M3D
+*       #define SUPPORT_FILEFORMAT_RMDL
 *           Selected desired fileformats to be supported for model data loading.
+*           NOTE: RMDL is a GPU-ready model cache generated with ExportModel(): interleaved welded
+*           vertex data, 16bit indices, precomputed bounds and pixel data, loaded with a single read
 *
 *       #define SUPPORT_MESH_GENERATION
 *           Support procedural mesh generation functions, uses external par_shapes.h library
@@ -58,6 +61,10 @@
 #include <string.h>         // Required for: memcmp(), strlen(), strncpy()
 #include <math.h>           // Required for: sinf(), cosf(), sqrtf(), fabsf()
 
+#if defined(_MSC_VER)
+    #include <intrin.h>     // Required for: _InterlockedExchange() [Used by pending textures lock]
+#endif
+
 #if defined(SUPPORT_FILEFORMAT_OBJ) || defined(SUPPORT_FILEFORMAT_MTL)
     #define TINYOBJ_MALLOC RL_MALLOC
     #define TINYOBJ_CALLOC RL_CALLOC
@@ -132,16 +139,243 @@
 #ifndef MAX_MESH_VERTEX_BUFFERS
     #define MAX_MESH_VERTEX_BUFFERS  9    // Maximum vertex buffers (VBO) per mesh
 #endif
+#ifndef SKINNING_TASK_VERTEX_COUNT
+    #define SKINNING_TASK_VERTEX_COUNT  2048    // Vertex count per CPU skinning task (split across worker threads)
+#endif
+#ifndef MAX_SKINNED_POSES
+    #define MAX_SKINNED_POSES       32    // Maximum number of models tracked with their skinned baked pose (pose sharing)
+#endif
+#ifndef MESH_VERTEX_CACHE_SIZE
+    #define MESH_VERTEX_CACHE_SIZE  16    // Post-transform vertex cache size (FIFO) simulated to measure mesh ACMR
+#endif
+
+#define VERTEX_CACHE_SCORE_SIZE     32    // LRU cache size used to score triangles on mesh optimization (Forsyth)
+#define VERTEX_CACHE_MAX_VALENCE    32    // Maximum remaining triangles per vertex considered on triangles scoring
+#define MESH_OVERDRAW_THRESHOLD  1.05f    // Maximum ACMR increase accepted when sorting triangle clusters for overdraw
+
+// Pending textures list lock, model data can be loaded from several threads at once
+#if defined(_MSC_VER)
+    #define LOCK_PENDING_TEXTURES()     while (_InterlockedExchange(&pendingTexturesLock, 1) != 0) { }
+    #define UNLOCK_PENDING_TEXTURES()   _InterlockedExchange(&pendingTexturesLock, 0)
+#elif defined(__GNUC__) || defined(__clang__)
+    #define LOCK_PENDING_TEXTURES()     while (__sync_lock_test_and_set(&pendingTexturesLock, 1) != 0) { }
+    #define UNLOCK_PENDING_TEXTURES()   __sync_lock_release(&pendingTexturesLock)
+#else
+    #define LOCK_PENDING_TEXTURES()
+    #define UNLOCK_PENDING_TEXTURES()
+#endif
+
+// Resources cache lock, shared textures are looked up from loading threads
+#if defined(_MSC_VER)
+    #define LOCK_RESOURCE_CACHE()       while (_InterlockedExchange(&resourceCacheLock, 1) != 0) { }
+    #define UNLOCK_RESOURCE_CACHE()     _InterlockedExchange(&resourceCacheLock, 0)
+#elif defined(__GNUC__) || defined(__clang__)
+    #define LOCK_RESOURCE_CACHE()       while (__sync_lock_test_and_set(&resourceCacheLock, 1) != 0) { }
+    #define UNLOCK_RESOURCE_CACHE()     __sync_lock_release(&resourceCacheLock)
+#else
+    #define LOCK_RESOURCE_CACHE()
+    #define UNLOCK_RESOURCE_CACHE()
+#endif
+
+#if defined(SUPPORT_FILEFORMAT_RMDL)
+    #define RMDL_FILE_VERSION        1    // Model cache file version, files with a different version are rejected
+    #define RMDL_MATERIAL_MAPS      12    // Material maps stored per material
+    #define RMDL_DATA_ALIGNMENT     16    // Data blocks alignment in file (bytes)
+
+    // Optional vertex attributes, interleaved in shader location order:
+    // position (3 floats), texcoord (2 floats), [normal (3 floats)], [color (4 ubytes)], [tangent (4 floats)], [texcoord2 (2 floats)]
+    #define RMDL_ATTRIB_NORMAL       0x1
+    #define RMDL_ATTRIB_COLOR        0x2
+    #define RMDL_ATTRIB_TANGENT      0x4
+    #define RMDL_ATTRIB_TEXCOORD2    0x8
+#endif
 
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
-// ...
+// CPU skinning task, range of vertices of one mesh
+typedef struct SkinningTask {
+    Mesh *mesh;                 // Mesh to be skinned
+    const float16 *bones;       // Bone matrices, column-major (MatrixToFloatV())
+    const float16 *normalBones; // Bone normal matrices (transposed inverse), column-major
+    int start;                  // First vertex
+    int end;                    // Last vertex (not included)
+    bool updated;               // Some vertex has been transformed
+} SkinningTask;
+
+// Animation baking task data
+typedef struct BakingTask {
+    Model model;                // Model to be animated
+    ModelAnimation anim;        // Animation to be baked
+    Matrix *frameBones;         // Bone matrices by frame (output)
+} BakingTask;
+
+// Baked pose currently skinned into a model meshes (CPU skinning)
+typedef struct SkinnedPose {
+    const Mesh *meshes;         // Model meshes (identifies the model)
+    const Matrix *bones;        // Baked frame bone matrices (identifies animation and frame)
+} SkinnedPose;
+
+#if defined(SUPPORT_MESH_QUANTIZATION)
+// Quantized mesh vertex positions decoding
+typedef struct MeshQuantization {
+    bool quantized;             // Mesh uploaded with quantized vertex layout
+    Matrix dequantization;      // Vertex positions decoding transform (mesh bounds)
+} MeshQuantization;
+#endif
+
+// Triangles cluster of a mesh index buffer, sorted to reduce overdraw
+typedef struct TriangleCluster {
+    float key;                  // Sort key, outer facing clusters first
+    int start;                  // First triangle
+    int count;                  // Number of triangles
+} TriangleCluster;
+
+// Precomputed bounds of a mesh uploaded without CPU vertex data (model cache)
+typedef struct MeshBounds {
+    unsigned int vaoId;         // Mesh vertex array object (identifies the mesh)
+    BoundingBox bounds;         // Mesh bounds (AABB)
+} MeshBounds;
+
+#if defined(SUPPORT_FILEFORMAT_GLTF)
+// glTF primitive loading task, primitive converted into a mesh
+typedef struct PrimitiveTaskGLTF {
+    cgltf_primitive *primitive; // Primitive to be loaded (triangles)
+    Matrix worldMatrix;         // Node world transform
+    Matrix worldMatrixNormals;  // Node world transform for normals (transposed inverse)
+    Mesh *mesh;                 // Mesh to be loaded
+    bool generateTangents;      // Generate tangents if not provided (normal mapped material)
+    const char *fileName;       // Model file name (log messages)
+} PrimitiveTaskGLTF;
+
+// glTF loading batch: images decoding tasks followed by primitive tasks
+typedef struct LoadBatchGLTF {
+    cgltf_data *data;           // glTF data, buffers loaded
+    char *texPath;              // Images path (external images)
+    Image *images;              // Images decoded, by glTF image index
+    int *imageUses;             // Material maps using every image
+    unsigned long long *imageHashes;    // Images encoded data hash, by glTF image index (0 if unknown)
+    Texture2D *cachedTextures;  // Material maps textures already loaded, by material index and map type
+    int *decodeIndices;         // glTF image index by decoding task
+    int decodeCount;            // Image decoding tasks count
+    PrimitiveTaskGLTF *primitives;  // Primitive tasks, by mesh index
+} LoadBatchGLTF;
+#endif
+
+// Material map texture decoded by LoadModelData(), waiting for UploadModel()
+typedef struct PendingTexture {
+    Material *material;         // Material the texture belongs to (identifies the model)
+    int mapType;                // Material map index
+    Image image;                // Decoded image data
+    unsigned long long sourceHash;  // Encoded image data hash (0 if unknown)
+    struct PendingTexture *next;    // Next pending texture
+} PendingTexture;
+
+#if defined(SUPPORT_MODEL_RESOURCE_CACHE)
+// Texture shared by models materials, identified by image content
+typedef struct CachedTexture {
+    unsigned long long hash;        // Image content hash (pixel data, size and format)
+    unsigned long long sourceHash;  // Encoded image data hash (0 if unknown), textures found by it skip image decoding
+    Texture2D texture;              // Texture shared
+    int dataSize;                   // Texture data size in bytes
+    int refCount;                   // Material maps using the texture
+} CachedTexture;
+
+// Material maps shared by models, identified by material content
+typedef struct CachedMaterial {
+    Material material;              // Material shared, maps owned by the cache
+    unsigned long long hash;        // Material content hash (shader, maps and params)
+    int refCount;                   // Model materials using the maps
+} CachedMaterial;
+
+// Resources cache statistics
+typedef struct ResourceCacheStats {
+    int texturesShared;             // Textures not uploaded, an identical texture was loaded
+    int imagesSkipped;              // Images not decoded, their texture was loaded from identical image data
+    int materialsShared;            // Material maps not allocated, an identical material was loaded
+    unsigned int bytesSaved;        // Texture data (VRAM) and material maps (RAM) not duplicated
+} ResourceCacheStats;
+#endif
+
+#if defined(SUPPORT_FILEFORMAT_RMDL)
+// RMDL file header (64 bytes)
+typedef struct RMDLHeader {
+    char id[4];                 // File identifier: "rMDL"
+    unsigned int version;       // File version: RMDL_FILE_VERSION
+    int meshCount;              // Meshes count (RMDLMesh table follows header)
+    int materialCount;          // Materials count (RMDLMaterial table follows meshes table)
+    BoundingBox bounds;         // Model bounds (all meshes)
+    unsigned int fileSize;      // File size in bytes
+    unsigned int reserved[5];   // Reserved for future use
+} RMDLHeader;
+
+// RMDL mesh info (56 bytes)
+typedef struct RMDLMesh {
+    int vertexCount;            // Vertex count (welded, first use order)
+    int indexCount;             // Index count (16bit indices, 3 per triangle)
+    unsigned int attributes;    // Optional vertex attributes available: RMDL_ATTRIB_*
+    int vertexStride;           // Interleaved vertex size in bytes
+    int materialIndex;          // Material index
+    unsigned int vertexOffset;  // Interleaved vertex data offset from file start
+    unsigned int indexOffset;   // Index data offset from file start
+    BoundingBox bounds;         // Mesh bounds
+    unsigned int reserved;      // Reserved for future use
+} RMDLMesh;
+
+// RMDL material map (32 bytes)
+typedef struct RMDLMaterialMap {
+    unsigned char color[4];     // Map color
+    float value;                // Map value
+    int width;                  // Texture width (0 if no texture)
+    int height;                 // Texture height
+    int mipmaps;                // Texture mipmap levels stored
+    int format;                 // Texture pixel format (PixelFormat type, compressed formats supported)
+    unsigned int dataOffset;    // Pixel data offset from file start
+    unsigned int dataSize;      // Pixel data size in bytes
+} RMDLMaterialMap;
+
+// RMDL material (400 bytes)
+typedef struct RMDLMaterial {
+    RMDLMaterialMap maps[RMDL_MATERIAL_MAPS];   // Material maps
+    float params[4];            // Material generic parameters
+} RMDLMaterial;
+#endif
 
 //----------------------------------------------------------------------------------
 // Global Variables Definition
 //----------------------------------------------------------------------------------
-// ...
+static SkinnedPose skinnedPoses[MAX_SKINNED_POSES] = { 0 };     // Baked poses skinned by models, shared by all units drawn with them
+static int skinnedPoseNext = 0;                                 // Next skinned pose slot to be replaced
+static MeshBounds *meshBounds = NULL;                           // Precomputed bounds of meshes without CPU vertex data, indexed by VAO id
+static int meshBoundsCount = 0;                                 // Mesh bounds entries allocated
+static int meshBoundsLoaded = 0;                                // Mesh bounds currently kept (table freed when none left)
+#if defined(SUPPORT_MESH_QUANTIZATION)
+static MeshQuantization *meshQuantization = NULL;               // Quantized meshes positions decoding, indexed by VAO id
+static int meshQuantizationCount = 0;                           // Quantized meshes decoding entries allocated
+static int meshQuantizedCount = 0;                              // Quantized meshes currently loaded (table freed when none left)
+#endif
+
+static RL_THREAD_LOCAL bool modelUploadDeferred = false;        // Model data loaded without GPU upload (LoadModelData())
+static PendingTexture *pendingTextures = NULL;                  // Textures decoded by LoadModelData(), uploaded by UploadModel()
+#if defined(_MSC_VER)
+static volatile long pendingTexturesLock = 0;                   // Pending textures list lock
+#else
+static volatile int pendingTexturesLock = 0;                    // Pending textures list lock
+#endif
+
+#if defined(SUPPORT_MODEL_RESOURCE_CACHE)
+static CachedTexture *cachedTextures = NULL;                    // Textures shared by models materials, reference counted
+static int cachedTextureCount = 0;                              // Textures shared count
+static CachedMaterial *cachedMaterials = NULL;                  // Material maps shared by models, reference counted
+static int cachedMaterialCount = 0;                             // Material maps shared count
+static ResourceCacheStats resourceCacheStats = { 0 };           // Resources shared since initialization
+static ResourceCacheStats resourceCacheStatsLogged = { 0 };     // Resources shared on last stats log
+#if defined(_MSC_VER)
+static volatile long resourceCacheLock = 0;                     // Resources cache lock
+#else
+static volatile int resourceCacheLock = 0;                      // Resources cache lock
+#endif
+#endif
 
 //----------------------------------------------------------------------------------
 // Module specific Functions Declaration
@@ -164,9 +398,41 @@ static Model LoadVOX(const char *filename);     // Load VOX mesh data
 static Model LoadM3D(const char *filename);     // Load M3D mesh data
 static ModelAnimation *LoadModelAnimationsM3D(const char *fileName, int *animCount);   // Load M3D animation data
 #endif
+#if defined(SUPPORT_FILEFORMAT_RMDL)
+static Model LoadRMDL(const char *fileName);    // Load RMDL model cache data (meshes uploaded to GPU)
+static bool ExportRMDL(Model model, const char *fileName);  // Export RMDL model cache data
+#endif
 #if defined(SUPPORT_FILEFORMAT_OBJ) || defined(SUPPORT_FILEFORMAT_MTL)
 static void ProcessMaterialsOBJ(Material *rayMaterials, tinyobj_material_t *materials, int materialCount);  // Process obj materials
 #endif
+static void GetAnimationBoneMatrices(Model model, ModelAnimation anim, int frame, Matrix *boneMatrices); // Get animation bone matrices for a frame
+static void SkinModelMeshes(Model model);                   // Skin model meshes vertices with current bone matrices (CPU)
+static void SkinMeshVertices(void *data, int taskIndex);   // Skin vertex range of a mesh (worker task)
+static void BakeAnimationFrame(void *data, int frame);      // Bake bone matrices of an animation frame (worker task)
+static SkinnedPose *GetSkinnedPose(const Mesh *meshes);     // Get skinned pose tracked for a model (NULL if none)
+static Model LoadModelFile(const char *fileName);           // Load model data from file, selecting loader by extension
+static void LoadMaterialMapTexture(Material *material, int mapType, Image image, unsigned long long sourceHash);  // Load material map texture from image (image data is consumed)
+static void ProcessPendingTextures(Model model, bool upload);  // Upload or discard model textures pending from LoadModelData()
+static unsigned long long HashData(const void *data, int dataSize, unsigned long long seed); // Hash data content (64bit, not cryptographic)
+static Texture2D LoadTextureCached(Image image, unsigned long long sourceHash);    // Load texture from image, shared if an identical image texture is loaded
+static Texture2D GetCachedTexture(unsigned long long sourceHash);  // Get texture loaded from encoded image data, shared (id 0 if not loaded)
+static void ReleaseTextureCached(Texture2D texture);        // Release cache reference to texture loaded by LoadTextureCached() or GetCachedTexture()
+static void ShareModelMaterials(Model *model);              // Share model materials maps with identical materials loaded
+static void UnloadMaterialCached(Material material);        // Release material maps shared by ShareModelMaterials()
+#if defined(SUPPORT_MESH_QUANTIZATION)
+static void UploadMeshVertexQuantized(Mesh *mesh);          // Upload mesh vertex data in GPU with a compact interleaved vertex layout (VAO enabled)
+static bool IsMeshQuantized(Mesh mesh);                     // Check if mesh was uploaded with quantized vertex layout
+static Matrix GetMeshDequantization(Mesh mesh);             // Get mesh vertex positions decoding transform
+static void UnloadMeshQuantization(void);                   // Unload quantized meshes decoding table
+#endif
+extern void UnloadMeshTables(void);                         // Unload meshes bounds and quantization tables (also used by CloseWindow())
+static void OptimizeModelMesh(void *data, int meshIndex);   // Optimize a model mesh (worker task)
+static int SimulateVertexCache(const unsigned short *indices, int indexCount, unsigned int *timestamps, unsigned int *time); // Simulate vertex cache, returns misses
+static float GetVertexCacheMissRatio(const unsigned short *indices, int triangleCount, int vertexCount);  // Get index buffer ACMR
+static int OptimizeVertexCache(unsigned short *outIndices, const unsigned short *indices, int triangleCount, int vertexCount, int *clusters); // Reorder triangles for vertex cache
+static int SplitTriangleClusters(const unsigned short *indices, int triangleCount, int vertexCount, int *clusters, int clusterCount); // Split triangle clusters for sorting
+static void SortTriangleClusters(unsigned short *outIndices, const unsigned short *indices, const float *vertices, int vertexCount, const int *clusters, int clusterCount); // Sort clusters for overdraw
+static void *RemapVertexData(void *data, const int *remap, int vertexCount, int stride);    // Reorder vertex data with remap table
 
 //----------------------------------------------------------------------------------
 // Module Functions Definition
@@ -1095,6 +1361,48 @@ void DrawGrid(int slices, float spacing)
 
 // Load model from files (mesh and material)
 Model LoadModel(const char *fileName)
+{
+    Model model = LoadModelFile(fileName);
+
+    UploadModel(&model);
+
+    return model;
+}
+
+// Load model data from file into CPU memory (RAM), no GPU upload
+// NOTE: Can be called from any thread, textures are decoded but kept
+// in RAM until UploadModel() is called from the graphics thread
+// WARNING: OBJ loading changes working directory, OBJ models should not be loaded concurrently
+Model LoadModelData(const char *fileName)
+{
+    modelUploadDeferred = true;
+    Model model = LoadModelFile(fileName);
+    modelUploadDeferred = false;
+
+    return model;
+}
+
+// Upload model data to GPU (VRAM), meshes and textures not uploaded yet
+void UploadModel(Model *model)
+{
+    if (model->meshes != NULL)
+    {
+        // Upload vertex data to GPU (static meshes)
+        // NOTE: Meshes loaded from model cache are already uploaded by the loader
+        for (int i = 0; i < model->meshCount; i++)
+        {
+            if ((model->meshes[i].vboId == NULL) && (model->meshes[i].vertexCount > 0)) UploadMesh(&model->meshes[i], false);
+        }
+    }
+
+    ProcessPendingTextures(*model, true);
+
+    // Share textures and materials with identical content, stats logged when resources are shared
+    ShareModelMaterials(model);
+}
+
+// Load model data from file, selecting loader by extension
+static Model LoadModelFile(const char *fileName)
 {
     Model model = { 0 };
 
@@ -1113,16 +1421,35 @@ Model LoadModel(const char *fileName)
 #if defined(SUPPORT_FILEFORMAT_M3D)
     if (IsFileExtension(fileName, ".m3d")) model = LoadM3D(fileName);
 #endif
+#if defined(SUPPORT_FILEFORMAT_RMDL)
+    if (IsFileExtension(fileName, ".rmdl")) model = LoadRMDL(fileName);
+#endif
 
     // Make sure model transform is set to identity matrix!
     model.transform = MatrixIdentity();
 
-    if ((model.meshCount != 0) && (model.meshes != NULL))
+    if ((model.meshCount == 0) || (model.meshes == NULL)) TRACELOG(LOG_WARNING, "MESH: [%s] Failed to load model mesh(es) data", fileName);
+#if defined(SUPPORT_MESH_OPTIMIZATION)
+    // Optimize imported meshes for vertex cache and overdraw, model cache files are already optimized
+    else if (!IsFileExtension(fileName, ".rmdl"))
     {
-        // Upload vertex data to GPU (static meshes)
-        for (int i = 0; i < model.meshCount; i++) UploadMesh(&model.meshes[i], false);
+        float missesBefore = 0.0f;
+        float missesAfter = 0.0f;
+        int triangleCount = 0;
+
+        for (int i = 0; i < model.meshCount; i++)
+        {
+            missesBefore += GetMeshACMR(model.meshes[i])*model.meshes[i].triangleCount;
+            triangleCount += model.meshes[i].triangleCount;
+        }
+
+        RunWorkerTasks(OptimizeModelMesh, model.meshes, model.meshCount);
+
+        for (int i = 0; i < model.meshCount; i++) missesAfter += GetMeshACMR(model.meshes[i])*model.meshes[i].triangleCount;
+
+        if (triangleCount > 0) TRACELOG(LOG_INFO, "MODEL: [%s] Meshes optimized, ACMR: %.3f -> %.3f", fileName, missesBefore/triangleCount, missesAfter/triangleCount);
     }
-    else TRACELOG(LOG_WARNING, "MESH: [%s] Failed to load model mesh(es) data", fileName);
+#endif
 
     if (model.materialCount == 0)
     {
@@ -1178,6 +1505,9 @@ bool IsModelValid(Model model)
     for (int i = 0; i < model.meshCount; i++)
     {
         if ((model.meshes[i].vertices != NULL) && (model.meshes[i].vboId[0] == 0)) { result = false; break; }  // Vertex position buffer not uploaded to GPU
+#if defined(SUPPORT_MESH_QUANTIZATION)
+        if (IsMeshQuantized(model.meshes[i])) continue;     // All vertex attributes uploaded in position buffer
+#endif
         if ((model.meshes[i].texcoords != NULL) && (model.meshes[i].vboId[1] == 0)) { result = false; break; }  // Vertex textcoords buffer not uploaded to GPU
         if ((model.meshes[i].normals != NULL) && (model.meshes[i].vboId[2] == 0)) { result = false; break; }  // Vertex normals buffer not uploaded to GPU
         if ((model.meshes[i].colors != NULL) && (model.meshes[i].vboId[3] == 0)) { result = false; break; }  // Vertex colors buffer not uploaded to GPU
@@ -1206,7 +1536,16 @@ void UnloadModel(Model model)
     // NOTE: As the user could be sharing shaders and textures between models,
     // we don't unload the material but just free its maps,
     // the user is responsible for freeing models shaders and textures
-    for (int i = 0; i < model.materialCount; i++) RL_FREE(model.materials[i].maps);
+    // NOTE: Textures loaded with the model could be shared through resources cache (if supported),
+    // their cache references are released with the maps but textures are still owned by the user
+    for (int i = 0; i < model.materialCount; i++) UnloadMaterialCached(model.materials[i]);
+
+    // Discard textures never uploaded (model data loaded but not uploaded)
+    ProcessPendingTextures(model, false);
+
+    // Model meshes do not hold any skinned pose any more
+    SkinnedPose *pose = GetSkinnedPose(model.meshes);
+    if (pose != NULL) pose->meshes = NULL;
 
     // Unload arrays
     RL_FREE(model.meshes);
@@ -1220,6 +1559,21 @@ void UnloadModel(Model model)
     TRACELOG(LOG_INFO, "MODEL: Unloaded model (and meshes) from RAM and VRAM");
 }
 
+// Export model data to file, returns true on success
+// NOTE: Only RMDL model cache (.rmdl) supported, model meshes must keep CPU vertex data (LoadModel() does)
+bool ExportModel(Model model, const char *fileName)
+{
+    bool success = false;
+
+#if defined(SUPPORT_FILEFORMAT_RMDL)
+    if (IsFileExtension(fileName, ".rmdl")) success = ExportRMDL(model, fileName);
+    else
+#endif
+    TRACELOG(LOG_WARNING, "MODEL: [%s] Model export file format not supported", fileName);
+
+    return success;
+}
+
 // Compute model bounding box limits (considers all meshes)
 BoundingBox GetModelBoundingBox(Model model)
 {
@@ -1412,9 +1766,52 @@ void UploadMesh(Mesh *mesh, bool dynamic)
 #endif
 }
 
+// Upload static mesh vertex data in GPU with a compact quantized vertex layout
+// NOTE: Falls back to UploadMesh() for meshes that can not be quantized (bone data, no VAO support)
+// WARNING: Shaders drawing the mesh must apply matDequantization uniform to vertexPosition
+void UploadMeshQuantized(Mesh *mesh)
+{
+#if defined(SUPPORT_MESH_QUANTIZATION) && (defined(GRAPHICS_API_OPENGL_33) || defined(GRAPHICS_API_OPENGL_ES2))
+    if (mesh->vaoId > 0)
+    {
+        // Check if mesh has already been loaded in GPU
+        TRACELOG(LOG_WARNING, "VAO: [ID %i] Trying to re-load an already loaded mesh", mesh->vaoId);
+        return;
+    }
+
+    // Meshes with bone data are updated by skinning, keep float vertex layout
+    if ((mesh->vertices != NULL) && (mesh->boneIds == NULL) && (mesh->boneWeights == NULL))
+    {
+        unsigned int vaoId = rlLoadVertexArray();
+
+        // Quantized layout decoding requires VAO support
+        if (vaoId > 0)
+        {
+            mesh->vboId = (unsigned int *)RL_CALLOC(MAX_MESH_VERTEX_BUFFERS, sizeof(unsigned int));
+            mesh->vaoId = vaoId;
+            rlEnableVertexArray(mesh->vaoId);
+
+            UploadMeshVertexQuantized(mesh);
+            return;
+        }
+    }
+
+    TRACELOG(LOG_INFO, "MESH: Mesh can not be quantized, uploaded with float vertex layout");
+#endif
+    UploadMesh(mesh, false);
+}
+
 // Update mesh vertex data in GPU for a specific buffer index
 void UpdateMeshBuffer(Mesh mesh, int index, const void *data, int dataSize, int offset)
 {
+#if defined(SUPPORT_MESH_QUANTIZATION)
+    if (IsMeshQuantized(mesh))
+    {
+        TRACELOG(LOG_WARNING, "VAO: [ID %i] Quantized mesh vertex buffers can not be updated", mesh.vaoId);
+        return;
+    }
+#endif
+
     rlUpdateVertexBuffer(mesh.vboId[index], data, dataSize, offset);
 }
 
@@ -1515,7 +1912,14 @@ void DrawMesh(Mesh mesh, Material material, Matrix transform)
     matModelView = MatrixMultiply(matModel, matView);
 
     // Upload model normal matrix (if locations available)
-    if (material.shader.locs[SHADER_LOC_MATRIX_NORMAL] != -1) rlSetUniformMatrix(material.shader.locs[SHADER_LOC_MATRIX_NORMAL], MatrixTranspose(MatrixInvert(matModel)));
+    // NOTE: Normal matrix is computed by rlgl, only when model matrix changes
+    if (material.shader.locs[SHADER_LOC_MATRIX_NORMAL] != -1) rlSetUniformMatrixNormal(material.shader.locs[SHADER_LOC_MATRIX_NORMAL], matModel);
+
+#if defined(SUPPORT_MESH_QUANTIZATION)
+    // Quantized mesh vertex positions decoding, restored to identity after drawing
+    bool quantized = IsMeshQuantized(mesh) && (material.shader.locs[SHADER_LOC_MATRIX_DEQUANTIZATION] != -1);
+    if (quantized) rlSetUniformMatrix(material.shader.locs[SHADER_LOC_MATRIX_DEQUANTIZATION], GetMeshDequantization(mesh));
+#endif
 
 #ifdef RL_SUPPORT_MESH_GPU_SKINNING
     // Upload Bone Transforms
@@ -1621,7 +2025,7 @@ void DrawMesh(Mesh mesh, Material material, Matrix transform)
         }
 #endif
 
-        if (mesh.indices != NULL) rlEnableVertexBufferElement(mesh.vboId[RL_DEFAULT_SHADER_ATTRIB_LOCATION_INDICES]);
+        if (mesh.vboId[RL_DEFAULT_SHADER_ATTRIB_LOCATION_INDICES] != 0) rlEnableVertexBufferElement(mesh.vboId[RL_DEFAULT_SHADER_ATTRIB_LOCATION_INDICES]);
     }
 
     int eyeCount = 1;
@@ -1643,10 +2047,16 @@ void DrawMesh(Mesh mesh, Material material, Matrix transform)
         rlSetUniformMatrix(material.shader.locs[SHADER_LOC_MATRIX_MVP], matModelViewProjection);
 
         // Draw mesh
-        if (mesh.indices != NULL) rlDrawVertexArrayElements(0, mesh.triangleCount*3, 0);
+        // NOTE: Indexed drawing depends on GPU index buffer, model cache meshes keep no CPU copy of indices
+        if (mesh.vboId[RL_DEFAULT_SHADER_ATTRIB_LOCATION_INDICES] != 0) rlDrawVertexArrayElements(0, mesh.triangleCount*3, 0);
         else rlDrawVertexArray(0, mesh.vertexCount);
     }
 
+#if defined(SUPPORT_MESH_QUANTIZATION)
+    if (quantized) rlSetUniformMatrix(material.shader.locs[SHADER_LOC_MATRIX_DEQUANTIZATION], MatrixIdentity());
+#endif
+
+#if !defined(RLGL_ENABLE_STATE_CACHE)
     // Unbind all bound texture maps
     for (int i = 0; i < MAX_MATERIAL_MAPS; i++)
     {
@@ -1670,6 +2080,9 @@ void DrawMesh(Mesh mesh, Material material, Matrix transform)
 
     // Disable shader program
     rlDisableShader();
+#endif
+    // NOTE: With rlgl state cache enabled, textures, vertex array and shader are kept bound,
+    // next mesh drawn with the same material only rebinds what actually changes
 
     // Restore rlgl internal modelview and projection matrices
     rlSetMatrixModelview(matView);
@@ -1763,6 +2176,12 @@ void DrawMeshInstanced(Mesh mesh, Material material, const Matrix *transforms, i
     // Upload model normal matrix (if locations available)
     if (material.shader.locs[SHADER_LOC_MATRIX_NORMAL] != -1) rlSetUniformMatrix(material.shader.locs[SHADER_LOC_MATRIX_NORMAL], MatrixTranspose(MatrixInvert(matModel)));
 
+#if defined(SUPPORT_MESH_QUANTIZATION)
+    // Quantized mesh vertex positions decoding, restored to identity after drawing
+    bool quantized = IsMeshQuantized(mesh) && (material.shader.locs[SHADER_LOC_MATRIX_DEQUANTIZATION] != -1);
+    if (quantized) rlSetUniformMatrix(material.shader.locs[SHADER_LOC_MATRIX_DEQUANTIZATION], GetMeshDequantization(mesh));
+#endif
+
 #ifdef RL_SUPPORT_MESH_GPU_SKINNING
     // Upload Bone Transforms
     if ((material.shader.locs[SHADER_LOC_BONE_MATRICES] != -1) && mesh.boneMatrices)
@@ -1866,7 +2285,7 @@ void DrawMeshInstanced(Mesh mesh, Material material, const Matrix *transforms, i
         }
 #endif
 
-        if (mesh.indices != NULL) rlEnableVertexBufferElement(mesh.vboId[RL_DEFAULT_SHADER_ATTRIB_LOCATION_INDICES]);
+        if (mesh.vboId[RL_DEFAULT_SHADER_ATTRIB_LOCATION_INDICES] != 0) rlEnableVertexBufferElement(mesh.vboId[RL_DEFAULT_SHADER_ATTRIB_LOCATION_INDICES]);
     }
 
     int eyeCount = 1;
@@ -1888,10 +2307,14 @@ void DrawMeshInstanced(Mesh mesh, Material material, const Matrix *transforms, i
         rlSetUniformMatrix(material.shader.locs[SHADER_LOC_MATRIX_MVP], matModelViewProjection);
 
         // Draw mesh instanced
-        if (mesh.indices != NULL) rlDrawVertexArrayElementsInstanced(0, mesh.triangleCount*3, 0, instances);
+        if (mesh.vboId[RL_DEFAULT_SHADER_ATTRIB_LOCATION_INDICES] != 0) rlDrawVertexArrayElementsInstanced(0, mesh.triangleCount*3, 0, instances);
         else rlDrawVertexArrayInstanced(0, mesh.vertexCount, instances);
     }
 
+#if defined(SUPPORT_MESH_QUANTIZATION)
+    if (quantized) rlSetUniformMatrix(material.shader.locs[SHADER_LOC_MATRIX_DEQUANTIZATION], MatrixIdentity());
+#endif
+
     // Unbind all bound texture maps
     for (int i = 0; i < MAX_MATERIAL_MAPS; i++)
     {
@@ -1925,6 +2348,30 @@ void DrawMeshInstanced(Mesh mesh, Material material, const Matrix *transforms, i
 // Unload mesh from memory (RAM and VRAM)
 void UnloadMesh(Mesh mesh)
 {
+    // Mesh precomputed bounds are not valid any more (VAO id could be reused)
+    if ((mesh.vaoId > 0) && (mesh.vaoId < (unsigned int)meshBoundsCount) && (meshBounds[mesh.vaoId].vaoId == mesh.vaoId))
+    {
+        meshBounds[mesh.vaoId].vaoId = 0;
+        meshBoundsLoaded--;
+
+        if (meshBoundsLoaded == 0)
+        {
+            RL_FREE(meshBounds);
+            meshBounds = NULL;
+            meshBoundsCount = 0;
+        }
+    }
+
+#if defined(SUPPORT_MESH_QUANTIZATION)
+    if (IsMeshQuantized(mesh))
+    {
+        meshQuantization[mesh.vaoId].quantized = false;
+        meshQuantizedCount--;
+
+        if (meshQuantizedCount == 0) UnloadMeshQuantization();
+    }
+#endif
+
     // Unload rlgl mesh vboId data
     rlUnloadVertexArray(mesh.vaoId);
 
@@ -2139,21 +2586,21 @@ static void ProcessMaterialsOBJ(Material *materials, tinyobj_material_t *mats, i
         // NOTE: rlgl default texture is a 1x1 pixel UNCOMPRESSED_R8G8B8A8
         materials[m].maps[MATERIAL_MAP_DIFFUSE].texture = (Texture2D){ rlGetTextureIdDefault(), 1, 1, 1, PIXELFORMAT_UNCOMPRESSED_R8G8B8A8 };
 
-        if (mats[m].diffuse_texname != NULL) materials[m].maps[MATERIAL_MAP_DIFFUSE].texture = LoadTexture(mats[m].diffuse_texname);  //char *diffuse_texname; // map_Kd
+        if (mats[m].diffuse_texname != NULL) LoadMaterialMapTexture(&materials[m], MATERIAL_MAP_DIFFUSE, LoadImage(mats[m].diffuse_texname), 0);  //char *diffuse_texname; // map_Kd
         else materials[m].maps[MATERIAL_MAP_DIFFUSE].color = (Color){ (unsigned char)(mats[m].diffuse[0]*255.0f), (unsigned char)(mats[m].diffuse[1]*255.0f), (unsigned char)(mats[m].diffuse[2]*255.0f), 255 }; //float diffuse[3];
         materials[m].maps[MATERIAL_MAP_DIFFUSE].value = 0.0f;
 
-        if (mats[m].specular_texname != NULL) materials[m].maps[MATERIAL_MAP_SPECULAR].texture = LoadTexture(mats[m].specular_texname);  //char *specular_texname; // map_Ks
+        if (mats[m].specular_texname != NULL) LoadMaterialMapTexture(&materials[m], MATERIAL_MAP_SPECULAR, LoadImage(mats[m].specular_texname), 0);  //char *specular_texname; // map_Ks
         materials[m].maps[MATERIAL_MAP_SPECULAR].color = (Color){ (unsigned char)(mats[m].specular[0]*255.0f), (unsigned char)(mats[m].specular[1]*255.0f), (unsigned char)(mats[m].specular[2]*255.0f), 255 }; //float specular[3];
         materials[m].maps[MATERIAL_MAP_SPECULAR].value = 0.0f;
 
-        if (mats[m].bump_texname != NULL) materials[m].maps[MATERIAL_MAP_NORMAL].texture = LoadTexture(mats[m].bump_texname);  //char *bump_texname; // map_bump, bump
+        if (mats[m].bump_texname != NULL) LoadMaterialMapTexture(&materials[m], MATERIAL_MAP_NORMAL, LoadImage(mats[m].bump_texname), 0);  //char *bump_texname; // map_bump, bump
         materials[m].maps[MATERIAL_MAP_NORMAL].color = WHITE;
         materials[m].maps[MATERIAL_MAP_NORMAL].value = mats[m].shininess;
 
         materials[m].maps[MATERIAL_MAP_EMISSION].color = (Color){ (unsigned char)(mats[m].emission[0]*255.0f), (unsigned char)(mats[m].emission[1]*255.0f), (unsigned char)(mats[m].emission[2]*255.0f), 255 }; //float emission[3];
 
-        if (mats[m].displacement_texname != NULL) materials[m].maps[MATERIAL_MAP_HEIGHT].texture = LoadTexture(mats[m].displacement_texname);  //char *displacement_texname; // disp
+        if (mats[m].displacement_texname != NULL) LoadMaterialMapTexture(&materials[m], MATERIAL_MAP_HEIGHT, LoadImage(mats[m].displacement_texname), 0);  //char *displacement_texname; // disp
     }
 }
 #endif
@@ -2299,22 +2746,7 @@ void UpdateModelAnimationBones(Model model, ModelAnimation anim, int frame)
         if (firstMeshWithBones != -1)
         {
             // Update all bones and boneMatrices of first mesh with bones.
-            for (int boneId = 0; boneId < anim.boneCount; boneId++)
-            {
-                Transform *bindTransform = &model.bindPose[boneId];
-                Matrix bindMatrix = MatrixMultiply(MatrixMultiply(
-                    MatrixScale(bindTransform->scale.x, bindTransform->scale.y, bindTransform->scale.z),
-                    QuaternionToMatrix(bindTransform->rotation)),
-                    MatrixTranslate(bindTransform->translation.x, bindTransform->translation.y, bindTransform->translation.z));
-
-                Transform *targetTransform = &anim.framePoses[frame][boneId];
-                Matrix targetMatrix = MatrixMultiply(MatrixMultiply(
-                    MatrixScale(targetTransform->scale.x, targetTransform->scale.y, targetTransform->scale.z),
-                    QuaternionToMatrix(targetTransform->rotation)),
-                    MatrixTranslate(targetTransform->translation.x, targetTransform->translation.y, targetTransform->translation.z));
-
-                model.meshes[firstMeshWithBones].boneMatrices[boneId] = MatrixMultiply(MatrixInvert(bindMatrix), targetMatrix);
-            }
+            GetAnimationBoneMatrices(model, anim, frame, model.meshes[firstMeshWithBones].boneMatrices);
 
             // Update remaining meshes with bones
             // NOTE: Using deep copy because shallow copy results in double free with 'UnloadModel()'
@@ -2329,75 +2761,129 @@ void UpdateModelAnimationBones(Model model, ModelAnimation anim, int frame)
             }
         }
     }
+
+    // Model meshes bones do not match any baked pose any more
+    SkinnedPose *pose = GetSkinnedPose(model.meshes);
+    if (pose != NULL) pose->meshes = NULL;
 }
 
-// at least 2x speed up vs the old method
 // Update model animated vertex data (positions and normals) for a given frame
 // NOTE: Updated data is uploaded to GPU
 void UpdateModelAnimation(Model model, ModelAnimation anim, int frame)
 {
     UpdateModelAnimationBones(model,anim,frame);
+    SkinModelMeshes(model);
+}
 
-    for (int m = 0; m < model.meshCount; m++)
+// Load baked animation, bone matrices for every frame (optionally into a texture)
+// NOTE: Frames are baked in parallel on worker threads, texture requires float textures support,
+// it is meant to be sampled by user skinning shaders (no default shader samples it)
+ModelAnimationBaked LoadModelAnimationBaked(Model model, ModelAnimation anim, bool bakeTexture)
+{
+    ModelAnimationBaked baked = { 0 };
+
+    if ((anim.frameCount <= 0) || (anim.boneCount <= 0) || (anim.framePoses == NULL) || (model.bindPose == NULL))
     {
-        Mesh mesh = model.meshes[m];
-        Vector3 animVertex = { 0 };
-        Vector3 animNormal = { 0 };
-        int boneId = 0;
-        int boneCounter = 0;
-        float boneWeight = 0.0;
-        bool updated = false; // Flag to check when anim vertex information is updated
-        const int vValues = mesh.vertexCount*3;
+        TRACELOG(LOG_WARNING, "ANIM: Animation can not be baked, missing frames or bind pose data");
+        return baked;
+    }
 
-        // Skip if missing bone data, causes segfault without on some models
-        if ((mesh.boneWeights == NULL) || (mesh.boneIds == NULL)) continue;
+    baked.boneCount = anim.boneCount;
+    baked.frameCount = anim.frameCount;
+    baked.frameBones = (Matrix *)RL_MALLOC(anim.frameCount*anim.boneCount*sizeof(Matrix));
 
-        for (int vCounter = 0; vCounter < vValues; vCounter += 3)
-        {
-            mesh.animVertices[vCounter] = 0;
-            mesh.animVertices[vCounter + 1] = 0;
-            mesh.animVertices[vCounter + 2] = 0;
-            if (mesh.animNormals != NULL)
-            {
-                mesh.animNormals[vCounter] = 0;
-                mesh.animNormals[vCounter + 1] = 0;
-                mesh.animNormals[vCounter + 2] = 0;
-            }
+    BakingTask task = { model, anim, baked.frameBones };
+    RunWorkerTasks(BakeAnimationFrame, &task, anim.frameCount);
 
-            // Iterates over 4 bones per vertex
-            for (int j = 0; j < 4; j++, boneCounter++)
-            {
-                boneWeight = mesh.boneWeights[boneCounter];
-                boneId = mesh.boneIds[boneCounter];
-
-                // Early stop when no transformation will be applied
-                if (boneWeight == 0.0f) continue;
-                animVertex = (Vector3){ mesh.vertices[vCounter], mesh.vertices[vCounter + 1], mesh.vertices[vCounter + 2] };
-                animVertex = Vector3Transform(animVertex,model.meshes[m].boneMatrices[boneId]);
-                mesh.animVertices[vCounter] += animVertex.x*boneWeight;
-                mesh.animVertices[vCounter+1] += animVertex.y*boneWeight;
-                mesh.animVertices[vCounter+2] += animVertex.z*boneWeight;
-                updated = true;
-
-                // Normals processing
-                // NOTE: We use meshes.baseNormals (default normal) to calculate meshes.normals (animated normals)
-                if ((mesh.normals != NULL) && (mesh.animNormals != NULL ))
-                {
-                    animNormal = (Vector3){ mesh.normals[vCounter], mesh.normals[vCounter + 1], mesh.normals[vCounter + 2] };
-                    animNormal = Vector3Transform(animNormal, MatrixTranspose(MatrixInvert(model.meshes[m].boneMatrices[boneId])));
-                    mesh.animNormals[vCounter] += animNormal.x*boneWeight;
-                    mesh.animNormals[vCounter + 1] += animNormal.y*boneWeight;
-                    mesh.animNormals[vCounter + 2] += animNormal.z*boneWeight;
-                }
-            }
+    if (bakeTexture)
+    {
+        // Texture layout: one row per frame, 4 texels per bone, every texel is a matrix column (m0, m1, m2, m3)...
+        float16 *texels = (float16 *)RL_MALLOC(anim.frameCount*anim.boneCount*sizeof(float16));
+        for (int i = 0; i < anim.frameCount*anim.boneCount; i++) texels[i] = MatrixToFloatV(baked.frameBones[i]);
+
+        baked.texture.id = rlLoadTexture(texels, anim.boneCount*4, anim.frameCount, PIXELFORMAT_UNCOMPRESSED_R32G32B32A32, 1);
+        baked.texture.width = anim.boneCount*4;
+        baked.texture.height = anim.frameCount;
+        baked.texture.mipmaps = 1;
+        baked.texture.format = PIXELFORMAT_UNCOMPRESSED_R32G32B32A32;
+
+        // Bone matrices must be fetched exactly, no filtering
+        if (baked.texture.id > 0)
+        {
+            rlTextureParameters(baked.texture.id, RL_TEXTURE_MIN_FILTER, RL_TEXTURE_FILTER_NEAREST);
+            rlTextureParameters(baked.texture.id, RL_TEXTURE_MAG_FILTER, RL_TEXTURE_FILTER_NEAREST);
         }
 
-        if (updated)
+        RL_FREE(texels);
+    }
+
+    TRACELOG(LOG_INFO, "ANIM: Animation baked successfully (%i frames, %i bones)", baked.frameCount, baked.boneCount);
+
+    return baked;
+}
+
+// Update model animation mesh bone matrices from baked animation (GPU skinning)
+// NOTE: Bone matrices are just copied, no per-bone computation required
+void UpdateModelAnimationBakedBones(Model model, ModelAnimationBaked baked, int frame)
+{
+    if ((baked.frameCount <= 0) || (baked.frameBones == NULL)) return;
+
+    if (frame >= baked.frameCount) frame = frame%baked.frameCount;
+    const Matrix *bones = &baked.frameBones[frame*baked.boneCount];
+
+    for (int i = 0; i < model.meshCount; i++)
+    {
+        if (model.meshes[i].boneMatrices != NULL)
         {
-            rlUpdateVertexBuffer(mesh.vboId[0], mesh.animVertices, mesh.vertexCount*3*sizeof(float), 0); // Update vertex position
-            if (mesh.normals != NULL) rlUpdateVertexBuffer(mesh.vboId[2], mesh.animNormals, mesh.vertexCount*3*sizeof(float), 0); // Update vertex normals
+            int boneCount = (model.meshes[i].boneCount < baked.boneCount)? model.meshes[i].boneCount : baked.boneCount;
+            memcpy(model.meshes[i].boneMatrices, bones, boneCount*sizeof(Matrix));
         }
     }
+
+    // Model meshes bones do not match their skinned vertices any more
+    SkinnedPose *pose = GetSkinnedPose(model.meshes);
+    if (pose != NULL) pose->meshes = NULL;
+}
+
+// Update model animation pose from baked bone matrices (CPU)
+// NOTE: Skinning is skipped if the model already holds that pose, so units drawn with the same
+// model share one skinned result per (animation, frame): draw them grouped by animation and frame
+void UpdateModelAnimationBaked(Model model, ModelAnimationBaked baked, int frame)
+{
+    if ((baked.frameCount <= 0) || (baked.frameBones == NULL) || (model.meshCount <= 0)) return;
+
+    if (frame >= baked.frameCount) frame = frame%baked.frameCount;
+    const Matrix *bones = &baked.frameBones[frame*baked.boneCount];
+
+    SkinnedPose *pose = GetSkinnedPose(model.meshes);
+    if ((pose != NULL) && (pose->bones == bones)) return;
+
+    UpdateModelAnimationBakedBones(model, baked, frame);
+    SkinModelMeshes(model);
+
+    // Track pose now held by model meshes
+    if (pose == NULL)
+    {
+        pose = &skinnedPoses[skinnedPoseNext];
+        skinnedPoseNext = (skinnedPoseNext + 1)%MAX_SKINNED_POSES;
+    }
+
+    pose->meshes = model.meshes;
+    pose->bones = bones;
+}
+
+// Unload baked animation data
+void UnloadModelAnimationBaked(ModelAnimationBaked baked)
+{
+    // Models can not hold any pose from this animation any more
+    for (int i = 0; i < MAX_SKINNED_POSES; i++)
+    {
+        if ((skinnedPoses[i].bones >= baked.frameBones) &&
+            (skinnedPoses[i].bones < baked.frameBones + baked.frameCount*baked.boneCount)) skinnedPoses[i].meshes = NULL;
+    }
+
+    if (baked.texture.id > 0) rlUnloadTexture(baked.texture.id);
+    RL_FREE(baked.frameBones);
 }
 
 // Unload animation array data
@@ -3598,6 +4084,15 @@ BoundingBox GetMeshBoundingBox(Mesh mesh)
             maxVertex = Vector3Max(maxVertex, (Vector3){ mesh.vertices[i*3], mesh.vertices[i*3 + 1], mesh.vertices[i*3 + 2] });
         }
     }
+    else if (mesh.vaoId > 0)
+    {
+        // Mesh uploaded without CPU vertex data (model cache), use precomputed bounds
+        if ((mesh.vaoId < (unsigned int)meshBoundsCount) && (meshBounds[mesh.vaoId].vaoId == mesh.vaoId))
+        {
+            minVertex = meshBounds[mesh.vaoId].bounds.min;
+            maxVertex = meshBounds[mesh.vaoId].bounds.max;
+        }
+    }
 
     // Create the bounding box
     BoundingBox box = { 0 };
@@ -3775,6 +4270,87 @@ void GenMeshTangents(Mesh *mesh)
     TRACELOG(LOG_INFO, "MESH: Tangents data computed and uploaded for provided mesh");
 }
 
+// Optimize mesh triangles and vertices order for GPU vertex cache and overdraw
+// NOTE: Only indexed meshes are reordered, mesh must be optimized before being uploaded to GPU
+// Triangles are reordered for post-transform vertex cache locality (Forsyth), then triangle
+// clusters are sorted to draw outer facing ones first (overdraw) as long as cache efficiency is kept,
+// finally vertices are reordered by first use for vertex fetch locality
+void OptimizeMesh(Mesh *mesh)
+{
+    if ((mesh->indices == NULL) || (mesh->triangleCount == 0) || (mesh->vertexCount == 0)) return;
+
+    if (mesh->vboId != NULL)
+    {
+        TRACELOG(LOG_WARNING, "MESH: Mesh already uploaded to GPU, optimization skipped");
+        return;
+    }
+
+    int indexCount = mesh->triangleCount*3;
+    unsigned short *indices = (unsigned short *)RL_MALLOC(indexCount*sizeof(unsigned short));
+    int *clusters = (int *)RL_MALLOC((mesh->triangleCount + 1)*sizeof(int));
+
+    // Reorder triangles for vertex cache, getting the clusters of connected triangles emitted
+    int clusterCount = OptimizeVertexCache(indices, mesh->indices, mesh->triangleCount, mesh->vertexCount, clusters);
+
+    // Sort triangle clusters to reduce overdraw, only kept if vertex cache efficiency is not degraded
+    if (mesh->vertices != NULL)
+    {
+        unsigned short *sortedIndices = (unsigned short *)RL_MALLOC(indexCount*sizeof(unsigned short));
+
+        clusterCount = SplitTriangleClusters(indices, mesh->triangleCount, mesh->vertexCount, clusters, clusterCount);
+        SortTriangleClusters(sortedIndices, indices, mesh->vertices, mesh->vertexCount, clusters, clusterCount);
+
+        if (GetVertexCacheMissRatio(sortedIndices, mesh->triangleCount, mesh->vertexCount) <=
+            GetVertexCacheMissRatio(indices, mesh->triangleCount, mesh->vertexCount)*MESH_OVERDRAW_THRESHOLD)
+        {
+            RL_FREE(indices);
+            indices = sortedIndices;
+        }
+        else RL_FREE(sortedIndices);
+    }
+
+    RL_FREE(clusters);
+
+    // Reorder vertices by first use in index buffer, unreferenced vertices are moved to the end
+    int *remap = (int *)RL_MALLOC(mesh->vertexCount*sizeof(int));
+    int nextVertex = 0;
+
+    for (int i = 0; i < mesh->vertexCount; i++) remap[i] = -1;
+
+    for (int i = 0; i < indexCount; i++)
+    {
+        if (remap[indices[i]] < 0) remap[indices[i]] = nextVertex++;
+        indices[i] = (unsigned short)remap[indices[i]];
+    }
+
+    for (int i = 0; i < mesh->vertexCount; i++) if (remap[i] < 0) remap[i] = nextVertex++;
+
+    mesh->vertices = (float *)RemapVertexData(mesh->vertices, remap, mesh->vertexCount, 3*sizeof(float));
+    mesh->texcoords = (float *)RemapVertexData(mesh->texcoords, remap, mesh->vertexCount, 2*sizeof(float));
+    mesh->texcoords2 = (float *)RemapVertexData(mesh->texcoords2, remap, mesh->vertexCount, 2*sizeof(float));
+    mesh->normals = (float *)RemapVertexData(mesh->normals, remap, mesh->vertexCount, 3*sizeof(float));
+    mesh->tangents = (float *)RemapVertexData(mesh->tangents, remap, mesh->vertexCount, 4*sizeof(float));
+    mesh->colors = (unsigned char *)RemapVertexData(mesh->colors, remap, mesh->vertexCount, 4*sizeof(unsigned char));
+    mesh->animVertices = (float *)RemapVertexData(mesh->animVertices, remap, mesh->vertexCount, 3*sizeof(float));
+    mesh->animNormals = (float *)RemapVertexData(mesh->animNormals, remap, mesh->vertexCount, 3*sizeof(float));
+    mesh->boneIds = (unsigned char *)RemapVertexData(mesh->boneIds, remap, mesh->vertexCount, 4*sizeof(unsigned char));
+    mesh->boneWeights = (float *)RemapVertexData(mesh->boneWeights, remap, mesh->vertexCount, 4*sizeof(float));
+
+    RL_FREE(remap);
+    RL_FREE(mesh->indices);
+    mesh->indices = indices;
+}
+
+// Get mesh average cache miss ratio (ACMR), transformed vertices per triangle with a simulated vertex cache
+// NOTE: Ranges from 0.5 (ideal regular grid) to 3.0 (no vertex reuse, also non-indexed meshes)
+float GetMeshACMR(Mesh mesh)
+{
+    if (mesh.triangleCount == 0) return 0.0f;
+    if (mesh.indices == NULL) return 3.0f;
+
+    return GetVertexCacheMissRatio(mesh.indices, mesh.triangleCount, mesh.vertexCount);
+}
+
 // Draw a model (with texture if set)
 void DrawModel(Model model, Vector3 position, float scale, Color tint)
 {
@@ -4246,75 +4822,1123 @@ RayCollision GetRayCollisionQuad(Ray ray, Vector3 p1, Vector3 p2, Vector3 p3, Ve
 //----------------------------------------------------------------------------------
 // Module specific Functions Definition
 //----------------------------------------------------------------------------------
-#if defined(SUPPORT_FILEFORMAT_IQM) || defined(SUPPORT_FILEFORMAT_GLTF)
-// Build pose from parent joints
-// NOTE: Required for animations loading (required by IQM and GLTF)
-static void BuildPoseFromParentJoints(BoneInfo *bones, int boneCount, Transform *transforms)
+// Get animation bone matrices for a frame
+// NOTE: Bone matrix transforms from bind pose to animation pose
+static void GetAnimationBoneMatrices(Model model, ModelAnimation anim, int frame, Matrix *boneMatrices)
 {
-    for (int i = 0; i < boneCount; i++)
+    for (int boneId = 0; boneId < anim.boneCount; boneId++)
     {
-        if (bones[i].parent >= 0)
-        {
-            if (bones[i].parent > i)
-            {
-                TRACELOG(LOG_WARNING, "Assumes bones are toplogically sorted, but bone %d has parent %d. Skipping.", i, bones[i].parent);
-                continue;
-            }
-            transforms[i].rotation = QuaternionMultiply(transforms[bones[i].parent].rotation, transforms[i].rotation);
-            transforms[i].translation = Vector3RotateByQuaternion(transforms[i].translation, transforms[bones[i].parent].rotation);
-            transforms[i].translation = Vector3Add(transforms[i].translation, transforms[bones[i].parent].translation);
-            transforms[i].scale = Vector3Multiply(transforms[i].scale, transforms[bones[i].parent].scale);
-        }
+        Transform *bindTransform = &model.bindPose[boneId];
+        Matrix bindMatrix = MatrixMultiply(MatrixMultiply(
+            MatrixScale(bindTransform->scale.x, bindTransform->scale.y, bindTransform->scale.z),
+            QuaternionToMatrix(bindTransform->rotation)),
+            MatrixTranslate(bindTransform->translation.x, bindTransform->translation.y, bindTransform->translation.z));
+
+        Transform *targetTransform = &anim.framePoses[frame][boneId];
+        Matrix targetMatrix = MatrixMultiply(MatrixMultiply(
+            MatrixScale(targetTransform->scale.x, targetTransform->scale.y, targetTransform->scale.z),
+            QuaternionToMatrix(targetTransform->rotation)),
+            MatrixTranslate(targetTransform->translation.x, targetTransform->translation.y, targetTransform->translation.z));
+
+        boneMatrices[boneId] = MatrixMultiply(MatrixInvert(bindMatrix), targetMatrix);
     }
 }
-#endif
 
-#if defined(SUPPORT_FILEFORMAT_OBJ)
-// Load OBJ mesh data
-//
-// Keep the following information in mind when reading this
-//  - A mesh is created for every material present in the obj file
-//  - the model.meshCount is therefore the materialCount returned from tinyobj
-//  - the mesh is automatically triangulated by tinyobj
-static Model LoadOBJ(const char *fileName)
+// Bake bone matrices of an animation frame (worker task)
+static void BakeAnimationFrame(void *data, int frame)
 {
-    tinyobj_attrib_t objAttributes = { 0 };
-    tinyobj_shape_t *objShapes = NULL;
-    unsigned int objShapeCount = 0;
-
-    tinyobj_material_t *objMaterials = NULL;
-    unsigned int objMaterialCount = 0;
+    BakingTask *task = (BakingTask *)data;
 
-    Model model = { 0 };
-    model.transform = MatrixIdentity();
+    GetAnimationBoneMatrices(task->model, task->anim, frame, &task->frameBones[frame*task->anim.boneCount]);
+}
 
-    char *fileText = LoadFileText(fileName);
+// Get skinned pose tracked for a model (NULL if none)
+static SkinnedPose *GetSkinnedPose(const Mesh *meshes)
+{
+    if (meshes == NULL) return NULL;
 
-    if (fileText == NULL)
+    for (int i = 0; i < MAX_SKINNED_POSES; i++)
     {
-        TRACELOG(LOG_ERROR, "MODEL: [%s] Unable to read obj file", fileName);
-        return model;
+        if (skinnedPoses[i].meshes == meshes) return &skinnedPoses[i];
     }
 
-    char currentDir[1024] = { 0 };
-    strcpy(currentDir, GetWorkingDirectory()); // Save current working directory
-    const char *workingDir = GetDirectoryPath(fileName); // Switch to OBJ directory for material path correctness
-    if (CHDIR(workingDir) != 0) TRACELOG(LOG_WARNING, "MODEL: [%s] Failed to change working directory", workingDir);
-
-    unsigned int dataSize = (unsigned int)strlen(fileText);
+    return NULL;
+}
 
-    unsigned int flags = TINYOBJ_FLAG_TRIANGULATE;
-    int ret = tinyobj_parse_obj(&objAttributes, &objShapes, &objShapeCount, &objMaterials, &objMaterialCount, fileText, dataSize, flags);
+// Load material map texture from image (image data is consumed)
+// NOTE: On model data loading (LoadModelData()) the image is kept pending until UploadModel(),
+// sourceHash identifies the encoded data the image was decoded from (0 if unknown)
+static void LoadMaterialMapTexture(Material *material, int mapType, Image image, unsigned long long sourceHash)
+{
+    if (image.data == NULL) return;
 
-    if (ret != TINYOBJ_SUCCESS)
+    if (modelUploadDeferred)
     {
-        TRACELOG(LOG_ERROR, "MODEL: Unable to read obj data %s", fileName);
-        return model;
-    }
+        PendingTexture *pending = (PendingTexture *)RL_MALLOC(sizeof(PendingTexture));
 
-    UnloadFileText(fileText);
+        pending->material = material;
+        pending->mapType = mapType;
+        pending->image = image;
+        pending->sourceHash = sourceHash;
 
-    unsigned int faceVertIndex = 0;
+        LOCK_PENDING_TEXTURES();
+        pending->next = pendingTextures;
+        pendingTextures = pending;
+        UNLOCK_PENDING_TEXTURES();
+    }
+    else
+    {
+        material->maps[mapType].texture = LoadTextureCached(image, sourceHash);
+        UnloadImage(image);
+    }
+}
+
+// Upload or discard model textures pending from LoadModelData()
+// NOTE: Textures are uploaded out of the list lock, loading threads are not blocked by GPU uploads
+static void ProcessPendingTextures(Model model, bool upload)
+{
+    if ((model.materials == NULL) || (model.materialCount <= 0)) return;
+
+    PendingTexture *modelTextures = NULL;
+
+    LOCK_PENDING_TEXTURES();
+    PendingTexture **link = &pendingTextures;
+    while (*link != NULL)
+    {
+        PendingTexture *pending = *link;
+
+        if ((pending->material >= model.materials) && (pending->material < (model.materials + model.materialCount)))
+        {
+            *link = pending->next;
+            pending->next = modelTextures;
+            modelTextures = pending;
+        }
+        else link = &pending->next;
+    }
+    UNLOCK_PENDING_TEXTURES();
+
+    while (modelTextures != NULL)
+    {
+        PendingTexture *pending = modelTextures;
+        modelTextures = pending->next;
+
+        if (upload) pending->material->maps[pending->mapType].texture = LoadTextureCached(pending->image, pending->sourceHash);
+        UnloadImage(pending->image);
+        RL_FREE(pending);
+    }
+}
+
+// Hash data content (64bit, not cryptographic)
+// NOTE: Data is mixed in 8 bytes words, remaining bytes are mixed one by one
+static unsigned long long HashData(const void *data, int dataSize, unsigned long long seed)
+{
+    const unsigned char *bytes = (const unsigned char *)data;
+    unsigned long long hash = seed ^ (0x9E3779B97F4A7C15ULL*(unsigned long long)(dataSize + 1));
+    int i = 0;
+
+    for (; (i + 8) <= dataSize; i += 8)
+    {
+        unsigned long long word = 0;
+        memcpy(&word, bytes + i, 8);
+        hash = (hash ^ (word*0xFF51AFD7ED558CCDULL))*0x100000001B3ULL;
+        hash ^= hash >> 29;
+    }
+
+    for (; i < dataSize; i++) hash = (hash ^ bytes[i])*0x100000001B3ULL;
+
+    // Final avalanche mixing
+    hash ^= hash >> 33;
+    hash *= 0xC4CEB9FE1A85EC53ULL;
+    hash ^= hash >> 33;
+
+    return hash;
+}
+
+// Load texture from image, shared if an identical image texture is loaded
+// NOTE: Image content is hashed (all mipmaps), sourceHash is kept to find the texture by encoded data
+static Texture2D LoadTextureCached(Image image, unsigned long long sourceHash)
+{
+#if defined(SUPPORT_MODEL_RESOURCE_CACHE)
+    if (image.data == NULL) return (Texture2D){ 0 };
+
+    int dataSize = 0;
+    for (int i = 0, width = image.width, height = image.height; i < image.mipmaps; i++)
+    {
+        dataSize += GetPixelDataSize(width, height, image.format);
+        width = (width > 1)? width/2 : 1;
+        height = (height > 1)? height/2 : 1;
+    }
+
+    int layout[4] = { image.width, image.height, image.format, image.mipmaps };
+    unsigned long long hash = HashData(image.data, dataSize, HashData(layout, sizeof(layout), 0));
+
+    LOCK_RESOURCE_CACHE();
+    for (int i = 0; i < cachedTextureCount; i++)
+    {
+        CachedTexture *cached = &cachedTextures[i];
+
+        if ((cached->hash == hash) && (cached->texture.width == image.width) && (cached->texture.height == image.height) &&
+            (cached->texture.format == image.format) && (cached->texture.mipmaps == image.mipmaps))
+        {
+            cached->refCount++;
+            if (cached->sourceHash == 0) cached->sourceHash = sourceHash;
+            resourceCacheStats.texturesShared++;
+            resourceCacheStats.bytesSaved += cached->dataSize;
+
+            Texture2D texture = cached->texture;
+            UNLOCK_RESOURCE_CACHE();
+            return texture;
+        }
+    }
+    UNLOCK_RESOURCE_CACHE();
+
+    // Texture uploaded out of the cache lock, loading threads are not blocked by GPU uploads
+    Texture2D texture = LoadTextureFromImage(image);
+
+    if (texture.id > 0)
+    {
+        LOCK_RESOURCE_CACHE();
+        cachedTextures = (CachedTexture *)RL_REALLOC(cachedTextures, (cachedTextureCount + 1)*sizeof(CachedTexture));
+        cachedTextures[cachedTextureCount].hash = hash;
+        cachedTextures[cachedTextureCount].sourceHash = sourceHash;
+        cachedTextures[cachedTextureCount].texture = texture;
+        cachedTextures[cachedTextureCount].dataSize = dataSize;
+        cachedTextures[cachedTextureCount].refCount = 1;
+        cachedTextureCount++;
+        UNLOCK_RESOURCE_CACHE();
+    }
+
+    return texture;
+#else
+    (void)sourceHash;
+    return LoadTextureFromImage(image);
+#endif
+}
+
+// Get texture loaded from encoded image data, shared (id 0 if not loaded)
+// NOTE: Image data is not decoded when its texture is found (any thread)
+static Texture2D GetCachedTexture(unsigned long long sourceHash)
+{
+    Texture2D texture = { 0 };
+
+#if defined(SUPPORT_MODEL_RESOURCE_CACHE)
+    if (sourceHash == 0) return texture;
+
+    LOCK_RESOURCE_CACHE();
+    for (int i = 0; i < cachedTextureCount; i++)
+    {
+        if (cachedTextures[i].sourceHash == sourceHash)
+        {
+            cachedTextures[i].refCount++;
+            resourceCacheStats.texturesShared++;
+            resourceCacheStats.imagesSkipped++;
+            resourceCacheStats.bytesSaved += cachedTextures[i].dataSize;
+            texture = cachedTextures[i].texture;
+            break;
+        }
+    }
+    UNLOCK_RESOURCE_CACHE();
+#else
+    (void)sourceHash;
+#endif
+
+    return texture;
+}
+
+// Release cache reference to texture loaded by LoadTextureCached() or GetCachedTexture()
+// NOTE: Texture is removed from cache once no material map uses it but not unloaded,
+// textures are owned by the user (as textures of models loaded without cache)
+static void ReleaseTextureCached(Texture2D texture)
+{
+#if defined(SUPPORT_MODEL_RESOURCE_CACHE)
+    if (texture.id == 0) return;
+
+    LOCK_RESOURCE_CACHE();
+    for (int i = 0; i < cachedTextureCount; i++)
+    {
+        if (cachedTextures[i].texture.id == texture.id)
+        {
+            cachedTextures[i].refCount--;
+
+            if (cachedTextures[i].refCount <= 0)
+            {
+                cachedTextures[i] = cachedTextures[cachedTextureCount - 1];
+                cachedTextureCount--;
+            }
+            break;
+        }
+    }
+    UNLOCK_RESOURCE_CACHE();
+#else
+    (void)texture;
+#endif
+}
+
+// Share model materials maps with identical materials loaded
+// NOTE: Materials are compared by content (shader, maps textures, colors and values, params),
+// duplicated maps are freed and their textures cache references released, models point to the maps shared
+static void ShareModelMaterials(Model *model)
+{
+#if defined(SUPPORT_MODEL_RESOURCE_CACHE)
+    if ((model->materials == NULL) || (model->materialCount <= 0)) return;
+
+    for (int m = 0; m < model->materialCount; m++)
+    {
+        Material *material = &model->materials[m];
+
+        if (material->maps == NULL) continue;
+
+        unsigned long long hash = HashData(material->maps, MAX_MATERIAL_MAPS*sizeof(MaterialMap),
+            HashData(material->params, sizeof(material->params), (unsigned long long)material->shader.id));
+
+        CachedMaterial *shared = NULL;
+
+        LOCK_RESOURCE_CACHE();
+        for (int i = 0; i < cachedMaterialCount; i++)
+        {
+            CachedMaterial *cached = &cachedMaterials[i];
+
+            if (cached->material.maps == material->maps) break;     // Already shared
+
+            if ((cached->hash == hash) && (cached->material.shader.id == material->shader.id) &&
+                (cached->material.shader.locs == material->shader.locs) &&
+                (memcmp(cached->material.params, material->params, sizeof(material->params)) == 0) &&
+                (memcmp(cached->material.maps, material->maps, MAX_MATERIAL_MAPS*sizeof(MaterialMap)) == 0))
+            {
+                cached->refCount++;
+                resourceCacheStats.materialsShared++;
+                resourceCacheStats.bytesSaved += MAX_MATERIAL_MAPS*sizeof(MaterialMap);
+                shared = cached;
+                break;
+            }
+        }
+
+        bool found = (shared != NULL);
+        for (int i = 0; !found && (i < cachedMaterialCount); i++) found = (cachedMaterials[i].material.maps == material->maps);
+
+        if (!found)
+        {
+            cachedMaterials = (CachedMaterial *)RL_REALLOC(cachedMaterials, (cachedMaterialCount + 1)*sizeof(CachedMaterial));
+            cachedMaterials[cachedMaterialCount].material = *material;
+            cachedMaterials[cachedMaterialCount].hash = hash;
+            cachedMaterials[cachedMaterialCount].refCount = 1;
+            cachedMaterialCount++;
+        }
+        UNLOCK_RESOURCE_CACHE();
+
+        if (shared != NULL)
+        {
+            // Textures referenced by duplicated maps are the ones referenced by shared maps (same ids)
+            for (int i = 0; i < MAX_MATERIAL_MAPS; i++) ReleaseTextureCached(material->maps[i].texture);
+
+            RL_FREE(material->maps);
+            material->maps = shared->material.maps;
+        }
+    }
+
+    if (memcmp(&resourceCacheStats, &resourceCacheStatsLogged, sizeof(ResourceCacheStats)) != 0)
+    {
+        resourceCacheStatsLogged = resourceCacheStats;
+        TRACELOG(LOG_INFO, "MODEL: Resources cache: %i textures shared (%i images not decoded), %i materials shared, %u KB saved",
+            resourceCacheStats.texturesShared, resourceCacheStats.imagesSkipped, resourceCacheStats.materialsShared, resourceCacheStats.bytesSaved/1024);
+    }
+#else
+    (void)model;
+#endif
+}
+
+// Release material maps shared by ShareModelMaterials()
+// NOTE: Maps are freed with the last model using them, textures are not unloaded (owned by user)
+static void UnloadMaterialCached(Material material)
+{
+    if (material.maps == NULL) return;
+
+#if defined(SUPPORT_MODEL_RESOURCE_CACHE)
+    bool release = true;
+
+    LOCK_RESOURCE_CACHE();
+    for (int i = 0; i < cachedMaterialCount; i++)
+    {
+        if (cachedMaterials[i].material.maps == material.maps)
+        {
+            cachedMaterials[i].refCount--;
+
+            if (cachedMaterials[i].refCount > 0) release = false;
+            else
+            {
+                cachedMaterials[i] = cachedMaterials[cachedMaterialCount - 1];
+                cachedMaterialCount--;
+            }
+            break;
+        }
+    }
+    UNLOCK_RESOURCE_CACHE();
+
+    if (!release) return;
+
+    for (int i = 0; i < MAX_MATERIAL_MAPS; i++) ReleaseTextureCached(material.maps[i].texture);
+#endif
+
+    RL_FREE(material.maps);
+}
+
+// Skin model meshes vertices with current bone matrices (CPU)
+// NOTE: Bone (and normal) matrices are computed once per call, vertices are skinned
+// in ranges split across worker threads, updated data is uploaded to GPU
+static void SkinModelMeshes(Model model)
+{
+    // Get required bone matrices and skinning tasks for all meshes
+    int paletteSize = 0;
+    int taskCount = 0;
+
+    for (int m = 0; m < model.meshCount; m++)
+    {
+        Mesh *mesh = &model.meshes[m];
+
+        // Skip if missing bone data, causes segfault without on some models
+        if ((mesh->boneWeights == NULL) || (mesh->boneIds == NULL) || (mesh->boneMatrices == NULL) || (mesh->animVertices == NULL)) continue;
+
+        paletteSize += mesh->boneCount;
+        taskCount += (mesh->vertexCount + SKINNING_TASK_VERTEX_COUNT - 1)/SKINNING_TASK_VERTEX_COUNT;
+    }
+
+    if (taskCount == 0) return;
+
+    float16 *palette = (float16 *)RL_MALLOC(paletteSize*2*sizeof(float16));
+    SkinningTask *tasks = (SkinningTask *)RL_CALLOC(taskCount, sizeof(SkinningTask));
+    int paletteOffset = 0;
+    int taskIndex = 0;
+
+    for (int m = 0; m < model.meshCount; m++)
+    {
+        Mesh *mesh = &model.meshes[m];
+
+        if ((mesh->boneWeights == NULL) || (mesh->boneIds == NULL) || (mesh->boneMatrices == NULL) || (mesh->animVertices == NULL)) continue;
+
+        // Bone matrices and normal matrices, computed once for all vertices of the mesh
+        float16 *bones = palette + paletteOffset;
+        float16 *normalBones = palette + paletteOffset + mesh->boneCount;
+        paletteOffset += mesh->boneCount*2;
+
+        for (int b = 0; b < mesh->boneCount; b++)
+        {
+            bones[b] = MatrixToFloatV(mesh->boneMatrices[b]);
+            normalBones[b] = MatrixToFloatV(MatrixTranspose(MatrixInvert(mesh->boneMatrices[b])));
+        }
+
+        for (int start = 0; start < mesh->vertexCount; start += SKINNING_TASK_VERTEX_COUNT)
+        {
+            tasks[taskIndex].mesh = mesh;
+            tasks[taskIndex].bones = bones;
+            tasks[taskIndex].normalBones = normalBones;
+            tasks[taskIndex].start = start;
+            tasks[taskIndex].end = ((start + SKINNING_TASK_VERTEX_COUNT) < mesh->vertexCount)? (start + SKINNING_TASK_VERTEX_COUNT) : mesh->vertexCount;
+            taskIndex++;
+        }
+    }
+
+    RunWorkerTasks(SkinMeshVertices, tasks, taskCount);
+
+    // Upload updated meshes to GPU (main thread)
+    for (int i = 0; i < taskCount; )
+    {
+        Mesh *mesh = tasks[i].mesh;
+        bool updated = false; // Flag to check when anim vertex information is updated
+
+        for (; (i < taskCount) && (tasks[i].mesh == mesh); i++) updated |= tasks[i].updated;
+
+        if (updated)
+        {
+            rlUpdateVertexBuffer(mesh->vboId[0], mesh->animVertices, mesh->vertexCount*3*sizeof(float), 0); // Update vertex position
+            if (mesh->normals != NULL) rlUpdateVertexBuffer(mesh->vboId[2], mesh->animNormals, mesh->vertexCount*3*sizeof(float), 0); // Update vertex normals
+        }
+    }
+
+    RL_FREE(tasks);
+    RL_FREE(palette);
+}
+
+// Skin vertex range of a mesh (worker task)
+// NOTE: Every vertex is the weighted sum of up to 4 bone transforms of the base vertex,
+// normals use the bones normal matrices, base data is kept at mesh.vertices and mesh.normals
+static void SkinMeshVertices(void *data, int taskIndex)
+{
+    SkinningTask *task = &((SkinningTask *)data)[taskIndex];
+    Mesh *mesh = task->mesh;
+    bool skinNormals = ((mesh->normals != NULL) && (mesh->animNormals != NULL));
+
+    for (int v = task->start; v < task->end; v++)
+    {
+        const float *vertex = &mesh->vertices[v*3];
+        const float *normal = skinNormals? &mesh->normals[v*3] : NULL;
+        const float *weights = &mesh->boneWeights[v*4];
+        const unsigned char *ids = &mesh->boneIds[v*4];
+
+#if defined(RAYMATH_SIMD)
+        rmVec4 x = RMVEC_SET1(vertex[0]);
+        rmVec4 y = RMVEC_SET1(vertex[1]);
+        rmVec4 z = RMVEC_SET1(vertex[2]);
+        rmVec4 position = RMVEC_SET1(0.0f);
+        rmVec4 nx = skinNormals? RMVEC_SET1(normal[0]) : position;
+        rmVec4 ny = skinNormals? RMVEC_SET1(normal[1]) : position;
+        rmVec4 nz = skinNormals? RMVEC_SET1(normal[2]) : position;
+        rmVec4 direction = position;
+
+        // Iterates over 4 bones per vertex
+        for (int j = 0; j < 4; j++)
+        {
+            // Early stop when no transformation will be applied
+            if (weights[j] == 0.0f) continue;
+
+            const float *bone = task->bones[ids[j]].v;
+            rmVec4 weight = RMVEC_SET1(weights[j]);
+            rmVec4 p = RMVEC_MUL(RMVEC_LOAD(bone), x);
+            p = RMVEC_ADD(p, RMVEC_MUL(RMVEC_LOAD(bone + 4), y));
+            p = RMVEC_ADD(p, RMVEC_MUL(RMVEC_LOAD(bone + 8), z));
+            p = RMVEC_ADD(p, RMVEC_LOAD(bone + 12));
+            position = RMVEC_ADD(position, RMVEC_MUL(p, weight));
+            task->updated = true;
+
+            if (skinNormals)
+            {
+                const float *normalBone = task->normalBones[ids[j]].v;
+                rmVec4 n = RMVEC_MUL(RMVEC_LOAD(normalBone), nx);
+                n = RMVEC_ADD(n, RMVEC_MUL(RMVEC_LOAD(normalBone + 4), ny));
+                n = RMVEC_ADD(n, RMVEC_MUL(RMVEC_LOAD(normalBone + 8), nz));
+                n = RMVEC_ADD(n, RMVEC_LOAD(normalBone + 12));
+                direction = RMVEC_ADD(direction, RMVEC_MUL(n, weight));
+            }
+        }
+
+        float result[4] = { 0 };
+        RMVEC_STORE(result, position);
+        memcpy(&mesh->animVertices[v*3], result, 3*sizeof(float));
+
+        if (mesh->animNormals != NULL)
+        {
+            RMVEC_STORE(result, direction);
+            memcpy(&mesh->animNormals[v*3], result, 3*sizeof(float));
+        }
+#else
+        float position[3] = { 0 };
+        float direction[3] = { 0 };
+
+        // Iterates over 4 bones per vertex
+        for (int j = 0; j < 4; j++)
+        {
+            // Early stop when no transformation will be applied
+            if (weights[j] == 0.0f) continue;
+
+            const float *bone = task->bones[ids[j]].v;
+            float weight = weights[j];
+
+            for (int k = 0; k < 3; k++) position[k] += (bone[k]*vertex[0] + bone[4 + k]*vertex[1] + bone[8 + k]*vertex[2] + bone[12 + k])*weight;
+            task->updated = true;
+
+            if (skinNormals)
+            {
+                const float *normalBone = task->normalBones[ids[j]].v;
+
+                for (int k = 0; k < 3; k++) direction[k] += (normalBone[k]*normal[0] + normalBone[4 + k]*normal[1] + normalBone[8 + k]*normal[2] + normalBone[12 + k])*weight;
+            }
+        }
+
+        memcpy(&mesh->animVertices[v*3], position, 3*sizeof(float));
+        if (mesh->animNormals != NULL) memcpy(&mesh->animNormals[v*3], direction, 3*sizeof(float));
+#endif
+    }
+}
+
+#if defined(SUPPORT_MESH_QUANTIZATION)
+// Upload mesh vertex data in GPU with a compact interleaved vertex layout (VAO must be enabled)
+// NOTE: Positions are 16bit normalized relative to mesh bounds, decoded by matDequantization shader uniform,
+// normals and tangents are 8bit signed normalized (xyz, not octahedral encoded: decoded by vertex attribute fetch,
+// no shader changes), texcoords are 16bit normalized when in [0..1] range
+static void UploadMeshVertexQuantized(Mesh *mesh)
+{
+    BoundingBox bounds = GetMeshBoundingBox(*mesh);
+    Vector3 extent = Vector3Subtract(bounds.max, bounds.min);
+
+    if (extent.x == 0.0f) extent.x = 1.0f;
+    if (extent.y == 0.0f) extent.y = 1.0f;
+    if (extent.z == 0.0f) extent.z = 1.0f;
+
+    bool texcoordsPacked = true;
+    bool texcoords2Packed = true;
+
+    for (int i = 0; (mesh->texcoords != NULL) && texcoordsPacked && (i < mesh->vertexCount*2); i++) texcoordsPacked = (mesh->texcoords[i] >= 0.0f) && (mesh->texcoords[i] <= 1.0f);
+    for (int i = 0; (mesh->texcoords2 != NULL) && texcoords2Packed && (i < mesh->vertexCount*2); i++) texcoords2Packed = (mesh->texcoords2[i] >= 0.0f) && (mesh->texcoords2[i] <= 1.0f);
+
+    // Vertex layout, all attributes aligned to 4 bytes:
+    // position (3 ushort + padding), [normal (3 byte + padding)], [texcoord (2 ushort or 2 floats)],
+    // [color (4 ubytes)], [tangent (4 bytes)], [texcoord2 (2 ushort or 2 floats)]
+    int stride = 8;
+    int normalOffset = stride;
+    if (mesh->normals != NULL) stride += 4;
+    int texcoordOffset = stride;
+    if (mesh->texcoords != NULL) stride += texcoordsPacked? 4 : 8;
+    int colorOffset = stride;
+    if (mesh->colors != NULL) stride += 4;
+    int tangentOffset = stride;
+    if (mesh->tangents != NULL) stride += 4;
+    int texcoord2Offset = stride;
+    if (mesh->texcoords2 != NULL) stride += texcoords2Packed? 4 : 8;
+
+    unsigned char *data = (unsigned char *)RL_CALLOC(mesh->vertexCount, stride);
+
+    for (int v = 0; v < mesh->vertexCount; v++)
+    {
+        unsigned char *vertex = data + v*stride;
+        unsigned short *position = (unsigned short *)vertex;
+
+        position[0] = (unsigned short)((mesh->vertices[v*3] - bounds.min.x)/extent.x*65535.0f + 0.5f);
+        position[1] = (unsigned short)((mesh->vertices[v*3 + 1] - bounds.min.y)/extent.y*65535.0f + 0.5f);
+        position[2] = (unsigned short)((mesh->vertices[v*3 + 2] - bounds.min.z)/extent.z*65535.0f + 0.5f);
+
+        if (mesh->normals != NULL)
+        {
+            signed char *normal = (signed char *)(vertex + normalOffset);
+            for (int c = 0; c < 3; c++) normal[c] = (signed char)roundf(Clamp(mesh->normals[v*3 + c], -1.0f, 1.0f)*127.0f);
+        }
+
+        if (mesh->texcoords != NULL)
+        {
+            if (texcoordsPacked)
+            {
+                unsigned short *texcoord = (unsigned short *)(vertex + texcoordOffset);
+                for (int c = 0; c < 2; c++) texcoord[c] = (unsigned short)(mesh->texcoords[v*2 + c]*65535.0f + 0.5f);
+            }
+            else memcpy(vertex + texcoordOffset, &mesh->texcoords[v*2], 2*sizeof(float));
+        }
+
+        if (mesh->colors != NULL) memcpy(vertex + colorOffset, &mesh->colors[v*4], 4);
+
+        if (mesh->tangents != NULL)
+        {
+            signed char *tangent = (signed char *)(vertex + tangentOffset);
+            for (int c = 0; c < 4; c++) tangent[c] = (signed char)roundf(Clamp(mesh->tangents[v*4 + c], -1.0f, 1.0f)*127.0f);
+        }
+
+        if (mesh->texcoords2 != NULL)
+        {
+            if (texcoords2Packed)
+            {
+                unsigned short *texcoord2 = (unsigned short *)(vertex + texcoord2Offset);
+                for (int c = 0; c < 2; c++) texcoord2[c] = (unsigned short)(mesh->texcoords2[v*2 + c]*65535.0f + 0.5f);
+            }
+            else memcpy(vertex + texcoord2Offset, &mesh->texcoords2[v*2], 2*sizeof(float));
+        }
+    }
+
+    // All vertex attributes are loaded in a single buffer, referenced by position buffer id
+    mesh->vboId[RL_DEFAULT_SHADER_ATTRIB_LOCATION_POSITION] = rlLoadVertexBuffer(data, mesh->vertexCount*stride, false);
+    RL_FREE(data);
+
+    rlSetVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_POSITION, 3, RL_UNSIGNED_SHORT, 1, stride, 0);
+    rlEnableVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_POSITION);
+
+    // WARNING: Default values are provided to shader for attributes not available in mesh
+    if (mesh->texcoords != NULL)
+    {
+        rlSetVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD, 2, texcoordsPacked? RL_UNSIGNED_SHORT : RL_FLOAT, texcoordsPacked, stride, texcoordOffset);
+        rlEnableVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD);
+    }
+    else
+    {
+        float value[2] = { 0.0f, 0.0f };
+        rlSetVertexAttributeDefault(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD, value, SHADER_ATTRIB_VEC2, 2);
+        rlDisableVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD);
+    }
+
+    if (mesh->normals != NULL)
+    {
+        rlSetVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_NORMAL, 3, RL_BYTE, 1, stride, normalOffset);
+        rlEnableVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_NORMAL);
+    }
+    else
+    {
+        float value[3] = { 0.0f, 0.0f, 1.0f };
+        rlSetVertexAttributeDefault(RL_DEFAULT_SHADER_ATTRIB_LOCATION_NORMAL, value, SHADER_ATTRIB_VEC3, 3);
+        rlDisableVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_NORMAL);
+    }
+
+    if (mesh->colors != NULL)
+    {
+        rlSetVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_COLOR, 4, RL_UNSIGNED_BYTE, 1, stride, colorOffset);
+        rlEnableVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_COLOR);
+    }
+    else
+    {
+        float value[4] = { 1.0f, 1.0f, 1.0f, 1.0f };    // WHITE
+        rlSetVertexAttributeDefault(RL_DEFAULT_SHADER_ATTRIB_LOCATION_COLOR, value, SHADER_ATTRIB_VEC4, 4);
+        rlDisableVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_COLOR);
+    }
+
+    if (mesh->tangents != NULL)
+    {
+        rlSetVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TANGENT, 4, RL_BYTE, 1, stride, tangentOffset);
+        rlEnableVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TANGENT);
+    }
+    else
+    {
+        float value[4] = { 1.0f, 0.0f, 0.0f, 1.0f };
+        rlSetVertexAttributeDefault(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TANGENT, value, SHADER_ATTRIB_VEC4, 4);
+        rlDisableVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TANGENT);
+    }
+
+    if (mesh->texcoords2 != NULL)
+    {
+        rlSetVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD2, 2, texcoords2Packed? RL_UNSIGNED_SHORT : RL_FLOAT, texcoords2Packed, stride, texcoord2Offset);
+        rlEnableVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD2);
+    }
+    else
+    {
+        float value[2] = { 0.0f, 0.0f };
+        rlSetVertexAttributeDefault(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD2, value, SHADER_ATTRIB_VEC2, 2);
+        rlDisableVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD2);
+    }
+
+#ifdef RL_SUPPORT_MESH_GPU_SKINNING
+    // Quantized meshes are not skinned
+    float boneIds[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+    float boneWeights[4] = { 0.0f, 0.0f, 0.0f, 0.0f };
+    rlSetVertexAttributeDefault(RL_DEFAULT_SHADER_ATTRIB_LOCATION_BONEIDS, boneIds, SHADER_ATTRIB_VEC4, 4);
+    rlDisableVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_BONEIDS);
+    rlSetVertexAttributeDefault(RL_DEFAULT_SHADER_ATTRIB_LOCATION_BONEWEIGHTS, boneWeights, SHADER_ATTRIB_VEC4, 4);
+    rlDisableVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_BONEWEIGHTS);
+#endif
+
+    if (mesh->indices != NULL)
+    {
+        mesh->vboId[RL_DEFAULT_SHADER_ATTRIB_LOCATION_INDICES] = rlLoadVertexBufferElement(mesh->indices, mesh->triangleCount*3*sizeof(unsigned short), false);
+    }
+
+    // Keep positions decoding transform, indexed by VAO id
+    if (mesh->vaoId >= (unsigned int)meshQuantizationCount)
+    {
+        int count = mesh->vaoId + 64;
+        meshQuantization = (MeshQuantization *)RL_REALLOC(meshQuantization, count*sizeof(MeshQuantization));
+        memset(meshQuantization + meshQuantizationCount, 0, (count - meshQuantizationCount)*sizeof(MeshQuantization));
+        meshQuantizationCount = count;
+    }
+
+    meshQuantization[mesh->vaoId].quantized = true;
+    meshQuantizedCount++;
+    meshQuantization[mesh->vaoId].dequantization = MatrixMultiply(MatrixScale(extent.x, extent.y, extent.z), MatrixTranslate(bounds.min.x, bounds.min.y, bounds.min.z));
+
+    TRACELOG(LOG_INFO, "VAO: [ID %i] Mesh uploaded successfully to VRAM (GPU), quantized vertex layout: %i bytes per vertex", mesh->vaoId, stride);
+
+    rlDisableVertexArray();
+}
+
+// Check if mesh was uploaded with quantized vertex layout
+static bool IsMeshQuantized(Mesh mesh)
+{
+    return ((mesh.vaoId > 0) && (mesh.vaoId < (unsigned int)meshQuantizationCount) && meshQuantization[mesh.vaoId].quantized);
+}
+
+// Get mesh vertex positions decoding transform (identity if mesh is not quantized)
+static Matrix GetMeshDequantization(Mesh mesh)
+{
+    if (IsMeshQuantized(mesh)) return meshQuantization[mesh.vaoId].dequantization;
+
+    return MatrixIdentity();
+}
+
+// Unload quantized meshes decoding table
+// NOTE: Called when last quantized mesh is unloaded and on CloseWindow()
+static void UnloadMeshQuantization(void)
+{
+    RL_FREE(meshQuantization);
+    meshQuantization = NULL;
+    meshQuantizationCount = 0;
+    meshQuantizedCount = 0;
+}
+#endif
+
+// Unload meshes precomputed bounds and quantization tables
+// NOTE: Called on CloseWindow(), tables of meshes not unloaded by user are freed
+extern void UnloadMeshTables(void)
+{
+    RL_FREE(meshBounds);
+    meshBounds = NULL;
+    meshBoundsCount = 0;
+    meshBoundsLoaded = 0;
+
+#if defined(SUPPORT_MESH_QUANTIZATION)
+    UnloadMeshQuantization();
+#endif
+}
+
+// Optimize a model mesh (worker task)
+static void OptimizeModelMesh(void *data, int meshIndex)
+{
+    OptimizeMesh(&((Mesh *)data)[meshIndex]);
+}
+
+// Simulate a FIFO post-transform vertex cache, returns the number of cache misses
+// NOTE: Vertex is in cache if it was transformed less than MESH_VERTEX_CACHE_SIZE misses ago,
+// time can be advanced by MESH_VERTEX_CACHE_SIZE + 1 to flush the cache
+static int SimulateVertexCache(const unsigned short *indices, int indexCount, unsigned int *timestamps, unsigned int *time)
+{
+    int misses = 0;
+
+    for (int i = 0; i < indexCount; i++)
+    {
+        if ((*time - timestamps[indices[i]]) > MESH_VERTEX_CACHE_SIZE)
+        {
+            timestamps[indices[i]] = (*time)++;
+            misses++;
+        }
+    }
+
+    return misses;
+}
+
+// Get average cache miss ratio (ACMR) of an index buffer
+static float GetVertexCacheMissRatio(const unsigned short *indices, int triangleCount, int vertexCount)
+{
+    unsigned int *timestamps = (unsigned int *)RL_CALLOC(vertexCount, sizeof(unsigned int));
+    unsigned int time = MESH_VERTEX_CACHE_SIZE + 1;
+    int misses = SimulateVertexCache(indices, triangleCount*3, timestamps, &time);
+
+    RL_FREE(timestamps);
+
+    return (float)misses/triangleCount;
+}
+
+// Reorder triangles for vertex cache locality, returns the number of clusters emitted
+// NOTE: Tom Forsyth's linear-speed vertex cache optimization, a new cluster starts
+// every time no triangle remains connected to the vertices in simulated cache
+static int OptimizeVertexCache(unsigned short *outIndices, const unsigned short *indices, int triangleCount, int vertexCount, int *clusters)
+{
+    // Vertex score tables, by cache position and by remaining triangles (valence)
+    float cacheScores[VERTEX_CACHE_SCORE_SIZE] = { 0 };
+    float valenceScores[VERTEX_CACHE_MAX_VALENCE] = { 0 };
+
+    for (int i = 0; i < VERTEX_CACHE_SCORE_SIZE; i++)
+    {
+        // Last triangle vertices get a fixed score, so there is no preference between them
+        if (i < 3) cacheScores[i] = 0.75f;
+        else cacheScores[i] = powf(1.0f - (float)(i - 3)/(VERTEX_CACHE_SCORE_SIZE - 3), 1.5f);
+    }
+
+    for (int i = 1; i < VERTEX_CACHE_MAX_VALENCE; i++) valenceScores[i] = 2.0f/sqrtf((float)i);
+
+    // Triangles adjacent to every vertex, removed from vertex list when emitted
+    int *triangleCounts = (int *)RL_CALLOC(vertexCount, sizeof(int));
+    int *triangleOffsets = (int *)RL_MALLOC(vertexCount*sizeof(int));
+    int *vertexTriangles = (int *)RL_MALLOC(triangleCount*3*sizeof(int));
+    int *cachePositions = (int *)RL_MALLOC(vertexCount*sizeof(int));
+    float *vertexScores = (float *)RL_MALLOC(vertexCount*sizeof(float));
+    bool *triangleEmitted = (bool *)RL_CALLOC(triangleCount, sizeof(bool));
+
+    for (int i = 0; i < triangleCount*3; i++) triangleCounts[indices[i]]++;
+
+    for (int v = 0, offset = 0; v < vertexCount; v++)
+    {
+        triangleOffsets[v] = offset;
+        offset += triangleCounts[v];
+        triangleCounts[v] = 0;
+    }
+
+    for (int i = 0; i < triangleCount*3; i++)
+    {
+        int v = indices[i];
+        vertexTriangles[triangleOffsets[v] + triangleCounts[v]] = i/3;
+        triangleCounts[v]++;
+    }
+
+    for (int v = 0; v < vertexCount; v++)
+    {
+        cachePositions[v] = -1;
+        vertexScores[v] = valenceScores[(triangleCounts[v] < VERTEX_CACHE_MAX_VALENCE)? triangleCounts[v] : VERTEX_CACHE_MAX_VALENCE - 1];
+    }
+
+    int cache[VERTEX_CACHE_SCORE_SIZE + 3] = { 0 };
+    int newCache[VERTEX_CACHE_SCORE_SIZE + 3] = { 0 };
+    int cacheCount = 0;
+    int clusterCount = 0;
+    int bestTriangle = -1;
+    int nextTriangle = 0;
+
+    for (int emitted = 0; emitted < triangleCount; emitted++)
+    {
+        if (bestTriangle < 0)
+        {
+            // No triangle connected to cache, start a new cluster with next triangle not emitted
+            while (triangleEmitted[nextTriangle]) nextTriangle++;
+
+            bestTriangle = nextTriangle;
+            clusters[clusterCount++] = emitted;
+        }
+
+        const unsigned short *triangle = &indices[bestTriangle*3];
+        int newCacheCount = 0;
+
+        triangleEmitted[bestTriangle] = true;
+
+        for (int k = 0; k < 3; k++)
+        {
+            int v = triangle[k];
+            int *vertexList = &vertexTriangles[triangleOffsets[v]];
+
+            outIndices[emitted*3 + k] = (unsigned short)v;
+
+            // Remove emitted triangle from vertex adjacency (degenerate triangles repeat vertices)
+            for (int j = 0; j < triangleCounts[v]; j++)
+            {
+                if (vertexList[j] == bestTriangle)
+                {
+                    vertexList[j] = vertexList[triangleCounts[v] - 1];
+                    triangleCounts[v]--;
+                    break;
+                }
+            }
+
+            if ((k == 0) || ((v != triangle[0]) && ((k == 1) || (v != triangle[1])))) newCache[newCacheCount++] = v;
+        }
+
+        // Move triangle vertices to the front of the LRU cache
+        for (int i = 0; i < cacheCount; i++)
+        {
+            int v = cache[i];
+            if ((v != triangle[0]) && (v != triangle[1]) && (v != triangle[2])) newCache[newCacheCount++] = v;
+        }
+
+        // Update scores of vertices in cache, including the ones just evicted
+        for (int i = 0; i < newCacheCount; i++)
+        {
+            int v = newCache[i];
+            int valence = (triangleCounts[v] < VERTEX_CACHE_MAX_VALENCE)? triangleCounts[v] : VERTEX_CACHE_MAX_VALENCE - 1;
+
+            cachePositions[v] = (i < VERTEX_CACHE_SCORE_SIZE)? i : -1;
+            vertexScores[v] = (triangleCounts[v] == 0)? 0.0f : valenceScores[valence] + ((cachePositions[v] >= 0)? cacheScores[i] : 0.0f);
+        }
+
+        cacheCount = (newCacheCount < VERTEX_CACHE_SCORE_SIZE)? newCacheCount : VERTEX_CACHE_SCORE_SIZE;
+        for (int i = 0; i < cacheCount; i++) cache[i] = newCache[i];
+
+        // Next triangle is the best scored one connected to cache vertices
+        float bestScore = 0.0f;
+        bestTriangle = -1;
+
+        for (int i = 0; i < cacheCount; i++)
+        {
+            int v = cache[i];
+
+            for (int j = 0; j < triangleCounts[v]; j++)
+            {
+                int t = vertexTriangles[triangleOffsets[v] + j];
+                float score = vertexScores[indices[t*3]] + vertexScores[indices[t*3 + 1]] + vertexScores[indices[t*3 + 2]];
+
+                if (score > bestScore)
+                {
+                    bestScore = score;
+                    bestTriangle = t;
+                }
+            }
+        }
+    }
+
+    clusters[clusterCount] = triangleCount;
+
+    RL_FREE(triangleCounts);
+    RL_FREE(triangleOffsets);
+    RL_FREE(vertexTriangles);
+    RL_FREE(cachePositions);
+    RL_FREE(vertexScores);
+    RL_FREE(triangleEmitted);
+
+    return clusterCount;
+}
+
+// Split triangle clusters at points where cache efficiency already reached cluster average
+// NOTE: Clusters array must have space for triangleCount + 1 entries, returns new cluster count
+static int SplitTriangleClusters(const unsigned short *indices, int triangleCount, int vertexCount, int *clusters, int clusterCount)
+{
+    int *splitClusters = (int *)RL_MALLOC((triangleCount + 1)*sizeof(int));
+    unsigned int *timestamps = (unsigned int *)RL_CALLOC(vertexCount, sizeof(unsigned int));
+    unsigned int time = 0;
+    int splitCount = 0;
+
+    for (int c = 0; c < clusterCount; c++)
+    {
+        int start = clusters[c];
+        int end = clusters[c + 1];
+
+        time += MESH_VERTEX_CACHE_SIZE + 1;
+        float clusterRatio = (float)SimulateVertexCache(&indices[start*3], (end - start)*3, timestamps, &time)/(end - start);
+        int misses = 0;
+
+        time += MESH_VERTEX_CACHE_SIZE + 1;
+        splitClusters[splitCount++] = start;
+
+        for (int t = start; t < end; t++)
+        {
+            misses += SimulateVertexCache(&indices[t*3], 3, timestamps, &time);
+
+            // Start a new cluster with an empty cache
+            if ((t + 1 < end) && ((float)misses/(t + 1 - splitClusters[splitCount - 1]) <= clusterRatio*MESH_OVERDRAW_THRESHOLD))
+            {
+                splitClusters[splitCount++] = t + 1;
+                time += MESH_VERTEX_CACHE_SIZE + 1;
+                misses = 0;
+            }
+        }
+    }
+
+    for (int i = 0; i < splitCount; i++) clusters[i] = splitClusters[i];
+    clusters[splitCount] = triangleCount;
+
+    RL_FREE(splitClusters);
+    RL_FREE(timestamps);
+
+    return splitCount;
+}
+
+// Compare triangle clusters by sort key, descending
+static int CompareTriangleClusters(const void *a, const void *b)
+{
+    float keyA = ((const TriangleCluster *)a)->key;
+    float keyB = ((const TriangleCluster *)b)->key;
+
+    return (keyA < keyB) - (keyA > keyB);
+}
+
+// Sort triangle clusters to draw outer facing ones first, reducing overdraw
+// NOTE: Sort key is the cluster centroid distance from mesh centroid along cluster normal
+static void SortTriangleClusters(unsigned short *outIndices, const unsigned short *indices, const float *vertices, int vertexCount, const int *clusters, int clusterCount)
+{
+    TriangleCluster *sorted = (TriangleCluster *)RL_MALLOC(clusterCount*sizeof(TriangleCluster));
+    Vector3 meshCentroid = { 0 };
+
+    for (int v = 0; v < vertexCount; v++) meshCentroid = Vector3Add(meshCentroid, (Vector3){ vertices[v*3], vertices[v*3 + 1], vertices[v*3 + 2] });
+    meshCentroid = Vector3Scale(meshCentroid, 1.0f/vertexCount);
+
+    for (int c = 0; c < clusterCount; c++)
+    {
+        Vector3 centroid = { 0 };
+        Vector3 normal = { 0 };
+        float area = 0.0f;
+
+        for (int t = clusters[c]; t < clusters[c + 1]; t++)
+        {
+            const unsigned short *triangle = &indices[t*3];
+            Vector3 v1 = { vertices[triangle[0]*3], vertices[triangle[0]*3 + 1], vertices[triangle[0]*3 + 2] };
+            Vector3 v2 = { vertices[triangle[1]*3], vertices[triangle[1]*3 + 1], vertices[triangle[1]*3 + 2] };
+            Vector3 v3 = { vertices[triangle[2]*3], vertices[triangle[2]*3 + 1], vertices[triangle[2]*3 + 2] };
+
+            // Triangle normal length is twice its area, used to weight centroid and normal
+            Vector3 triangleNormal = Vector3CrossProduct(Vector3Subtract(v2, v1), Vector3Subtract(v3, v1));
+            float triangleArea = Vector3Length(triangleNormal);
+
+            centroid = Vector3Add(centroid, Vector3Scale(Vector3Add(Vector3Add(v1, v2), v3), triangleArea/3.0f));
+            normal = Vector3Add(normal, triangleNormal);
+            area += triangleArea;
+        }
+
+        if (area > 0.0f) centroid = Vector3Scale(centroid, 1.0f/area);
+
+        sorted[c].key = Vector3DotProduct(Vector3Subtract(centroid, meshCentroid), Vector3Normalize(normal));
+        sorted[c].start = clusters[c];
+        sorted[c].count = clusters[c + 1] - clusters[c];
+    }
+
+    qsort(sorted, clusterCount, sizeof(TriangleCluster), CompareTriangleClusters);
+
+    for (int c = 0, offset = 0; c < clusterCount; c++)
+    {
+        memcpy(&outIndices[offset*3], &indices[sorted[c].start*3], sorted[c].count*3*sizeof(unsigned short));
+        offset += sorted[c].count;
+    }
+
+    RL_FREE(sorted);
+}
+
+// Reorder vertex data with a remap table, returns new data (provided data is freed)
+static void *RemapVertexData(void *data, const int *remap, int vertexCount, int stride)
+{
+    if (data == NULL) return NULL;
+
+    unsigned char *remapped = (unsigned char *)RL_MALLOC(vertexCount*stride);
+
+    for (int i = 0; i < vertexCount; i++) memcpy(remapped + remap[i]*stride, (unsigned char *)data + i*stride, stride);
+
+    RL_FREE(data);
+
+    return remapped;
+}
+
+#if defined(SUPPORT_FILEFORMAT_IQM) || defined(SUPPORT_FILEFORMAT_GLTF)
+// Build pose from parent joints
+// NOTE: Required for animations loading (required by IQM and GLTF)
+static void BuildPoseFromParentJoints(BoneInfo *bones, int boneCount, Transform *transforms)
+{
+    for (int i = 0; i < boneCount; i++)
+    {
+        if (bones[i].parent >= 0)
+        {
+            if (bones[i].parent > i)
+            {
+                TRACELOG(LOG_WARNING, "Assumes bones are toplogically sorted, but bone %d has parent %d. Skipping.", i, bones[i].parent);
+                continue;
+            }
+            transforms[i].rotation = QuaternionMultiply(transforms[bones[i].parent].rotation, transforms[i].rotation);
+            transforms[i].translation = Vector3RotateByQuaternion(transforms[i].translation, transforms[bones[i].parent].rotation);
+            transforms[i].translation = Vector3Add(transforms[i].translation, transforms[bones[i].parent].translation);
+            transforms[i].scale = Vector3Multiply(transforms[i].scale, transforms[bones[i].parent].scale);
+        }
+    }
+}
+#endif
+
+#if defined(SUPPORT_FILEFORMAT_OBJ)
+// Load OBJ mesh data
+//
+// Keep the following information in mind when reading this
+//  - A mesh is created for every material present in the obj file
+//  - the model.meshCount is therefore the materialCount returned from tinyobj
+//  - the mesh is automatically triangulated by tinyobj
+static Model LoadOBJ(const char *fileName)
+{
+    tinyobj_attrib_t objAttributes = { 0 };
+    tinyobj_shape_t *objShapes = NULL;
+    unsigned int objShapeCount = 0;
+
+    tinyobj_material_t *objMaterials = NULL;
+    unsigned int objMaterialCount = 0;
+
+    Model model = { 0 };
+    model.transform = MatrixIdentity();
+
+    char *fileText = LoadFileText(fileName);
+
+    if (fileText == NULL)
+    {
+        TRACELOG(LOG_ERROR, "MODEL: [%s] Unable to read obj file", fileName);
+        return model;
+    }
+
+    char currentDir[1024] = { 0 };
+    strcpy(currentDir, GetWorkingDirectory()); // Save current working directory
+    const char *workingDir = GetDirectoryPath(fileName); // Switch to OBJ directory for material path correctness
+    if (CHDIR(workingDir) != 0) TRACELOG(LOG_WARNING, "MODEL: [%s] Failed to change working directory", workingDir);
+
+    unsigned int dataSize = (unsigned int)strlen(fileText);
+
+    unsigned int flags = TINYOBJ_FLAG_TRIANGULATE;
+    int ret = tinyobj_parse_obj(&objAttributes, &objShapes, &objShapeCount, &objMaterials, &objMaterialCount, fileText, dataSize, flags);
+
+    if (ret != TINYOBJ_SUCCESS)
+    {
+        TRACELOG(LOG_ERROR, "MODEL: Unable to read obj data %s", fileName);
+        return model;
+    }
+
+    UnloadFileText(fileText);
+
+    unsigned int faceVertIndex = 0;
     unsigned int nextShape = 1;
     int lastMaterial = -1;
     unsigned int meshIndex = 0;
@@ -4668,7 +6292,7 @@ static Model LoadIQM(const char *fileName)
         memcpy(material, fileDataPtr + iqmHeader->ofs_text + imesh[i].material, MATERIAL_NAME_LENGTH*sizeof(char));
 
         model.materials[i] = LoadMaterialDefault();
-        model.materials[i].maps[MATERIAL_MAP_ALBEDO].texture = LoadTexture(TextFormat("%s/%s", basePath, material));
+        LoadMaterialMapTexture(&model.materials[i], MATERIAL_MAP_ALBEDO, LoadImage(TextFormat("%s/%s", basePath, material)), 0);
 
         model.meshMaterial[i] = i;
 
@@ -5071,189 +6695,624 @@ static ModelAnimation *LoadModelAnimationsIQM(const char *fileName, int *animCou
                     dcounter++;
                 }
 
-                animations[a].framePoses[frame][i].scale.x = poses[i].channeloffset[7];
+                animations[a].framePoses[frame][i].scale.x = poses[i].channeloffset[7];
+
+                if (poses[i].mask & 0x80)
+                {
+                    animations[a].framePoses[frame][i].scale.x += framedata[dcounter]*poses[i].channelscale[7];
+                    dcounter++;
+                }
+
+                animations[a].framePoses[frame][i].scale.y = poses[i].channeloffset[8];
+
+                if (poses[i].mask & 0x100)
+                {
+                    animations[a].framePoses[frame][i].scale.y += framedata[dcounter]*poses[i].channelscale[8];
+                    dcounter++;
+                }
+
+                animations[a].framePoses[frame][i].scale.z = poses[i].channeloffset[9];
+
+                if (poses[i].mask & 0x200)
+                {
+                    animations[a].framePoses[frame][i].scale.z += framedata[dcounter]*poses[i].channelscale[9];
+                    dcounter++;
+                }
+
+                animations[a].framePoses[frame][i].rotation = QuaternionNormalize(animations[a].framePoses[frame][i].rotation);
+            }
+        }
+
+        // Build frameposes
+        for (unsigned int frame = 0; frame < anim[a].num_frames; frame++)
+        {
+            for (int i = 0; i < animations[a].boneCount; i++)
+            {
+                if (animations[a].bones[i].parent >= 0)
+                {
+                    animations[a].framePoses[frame][i].rotation = QuaternionMultiply(animations[a].framePoses[frame][animations[a].bones[i].parent].rotation, animations[a].framePoses[frame][i].rotation);
+                    animations[a].framePoses[frame][i].translation = Vector3RotateByQuaternion(animations[a].framePoses[frame][i].translation, animations[a].framePoses[frame][animations[a].bones[i].parent].rotation);
+                    animations[a].framePoses[frame][i].translation = Vector3Add(animations[a].framePoses[frame][i].translation, animations[a].framePoses[frame][animations[a].bones[i].parent].translation);
+                    animations[a].framePoses[frame][i].scale = Vector3Multiply(animations[a].framePoses[frame][i].scale, animations[a].framePoses[frame][animations[a].bones[i].parent].scale);
+                }
+            }
+        }
+    }
+
+    UnloadFileData(fileData);
+
+    RL_FREE(joints);
+    RL_FREE(framedata);
+    RL_FREE(poses);
+    RL_FREE(anim);
+
+    return animations;
+}
+
+#endif
+
+#if defined(SUPPORT_FILEFORMAT_GLTF)
+// Load file data callback for cgltf
+static cgltf_result LoadFileGLTFCallback(const struct cgltf_memory_options *memoryOptions, const struct cgltf_file_options *fileOptions, const char *path, cgltf_size *size, void **data)
+{
+    int filesize;
+    unsigned char *filedata = LoadFileDataMapped(path, &filesize);
+
+    if (filedata == NULL) return cgltf_result_io_error;
+
+    *size = filesize;
+    *data = filedata;
+
+    return cgltf_result_success;
+}
+
+// Release file data callback for cgltf
+static void ReleaseFileGLTFCallback(const struct cgltf_memory_options *memoryOptions, const struct cgltf_file_options *fileOptions, void *data)
+{
+    UnloadFileDataMapped(data);
+}
+
+// Load image from different glTF provided methods (uri, path, buffer_view)
+static Image LoadImageFromCgltfImage(cgltf_image *cgltfImage, const char *texPath)
+{
+    Image image = { 0 };
+
+    if (cgltfImage == NULL) return image;
+
+    if (cgltfImage->uri != NULL)     // Check if image data is provided as an uri (base64 or path)
+    {
+        if ((strlen(cgltfImage->uri) > 5) &&
+            (cgltfImage->uri[0] == 'd') &&
+            (cgltfImage->uri[1] == 'a') &&
+            (cgltfImage->uri[2] == 't') &&
+            (cgltfImage->uri[3] == 'a') &&
+            (cgltfImage->uri[4] == ':'))     // Check if image is provided as base64 text data
+        {
+            // Data URI Format: data:<mediatype>;base64,<data>
+
+            // Find the comma
+            int i = 0;
+            while ((cgltfImage->uri[i] != ',') && (cgltfImage->uri[i] != 0)) i++;
+
+            if (cgltfImage->uri[i] == 0) TRACELOG(LOG_WARNING, "IMAGE: glTF data URI is not a valid image");
+            else
+            {
+                int base64Size = (int)strlen(cgltfImage->uri + i + 1);
+                while (cgltfImage->uri[i + base64Size] == '=') base64Size--;    // Ignore optional paddings
+                int numberOfEncodedBits = base64Size*6 - (base64Size*6) % 8 ;   // Encoded bits minus extra bits, so it becomes a multiple of 8 bits
+                int outSize = numberOfEncodedBits/8 ;                           // Actual encoded bytes
+                void *data = NULL;
+
+                cgltf_options options = { 0 };
+                options.file.read = LoadFileGLTFCallback;
+                options.file.release = ReleaseFileGLTFCallback;
+                cgltf_result result = cgltf_load_buffer_base64(&options, outSize, cgltfImage->uri + i + 1, &data);
+
+                if (result == cgltf_result_success)
+                {
+                    image = LoadImageFromMemory(".png", (unsigned char *)data, outSize);
+                    RL_FREE(data);
+                }
+            }
+        }
+        else     // Check if image is provided as image path
+        {
+            image = LoadImage(TextFormat("%s/%s", texPath, cgltfImage->uri));
+        }
+    }
+    else if ((cgltfImage->buffer_view != NULL) && (cgltfImage->buffer_view->buffer->data != NULL))    // Check if image is provided as data buffer
+    {
+        unsigned char *data = (unsigned char *)RL_MALLOC(cgltfImage->buffer_view->size);
+        int offset = (int)cgltfImage->buffer_view->offset;
+        int stride = (int)cgltfImage->buffer_view->stride? (int)cgltfImage->buffer_view->stride : 1;
+
+        // Copy buffer data to memory for loading
+        for (unsigned int i = 0; i < cgltfImage->buffer_view->size; i++)
+        {
+            data[i] = ((unsigned char *)cgltfImage->buffer_view->buffer->data)[offset];
+            offset += stride;
+        }
+
+        // Check mime_type for image: (cgltfImage->mime_type == "image/png")
+        // NOTE: Detected that some models define mime_type as "image\\/png"
+        if ((strcmp(cgltfImage->mime_type, "image\\/png") == 0) || (strcmp(cgltfImage->mime_type, "image/png") == 0))
+        {
+            image = LoadImageFromMemory(".png", data, (int)cgltfImage->buffer_view->size);
+        }
+        else if ((strcmp(cgltfImage->mime_type, "image\\/jpeg") == 0) || (strcmp(cgltfImage->mime_type, "image/jpeg") == 0))
+        {
+            image = LoadImageFromMemory(".jpg", data, (int)cgltfImage->buffer_view->size);
+        }
+        else TRACELOG(LOG_WARNING, "MODEL: glTF image data MIME type not recognized", TextFormat("%s/%s", texPath, cgltfImage->uri));
+
+        RL_FREE(data);
+    }
+
+    return image;
+}
+
+// Load bone info from GLTF skin data
+static BoneInfo *LoadBoneInfoGLTF(cgltf_skin skin, int *boneCount)
+{
+    *boneCount = (int)skin.joints_count;
+    BoneInfo *bones = (BoneInfo *)RL_CALLOC(skin.joints_count, sizeof(BoneInfo));
+
+    for (unsigned int i = 0; i < skin.joints_count; i++)
+    {
+        cgltf_node node = *skin.joints[i];
+        if (node.name != NULL) strncpy(bones[i].name, node.name, sizeof(bones[i].name) - 1);
+
+        // Find parent bone index
+        int parentIndex = -1;
+
+        for (unsigned int j = 0; j < skin.joints_count; j++)
+        {
+            if (skin.joints[j] == node.parent)
+            {
+                parentIndex = (int)j;
+                break;
+            }
+        }
+
+        bones[i].parent = parentIndex;
+    }
+
+    return bones;
+}
+
+// Macro to simplify attributes loading code
+#define LOAD_ATTRIBUTE(accesor, numComp, srcType, dstPtr) LOAD_ATTRIBUTE_CAST(accesor, numComp, srcType, dstPtr, srcType)
+
+#define LOAD_ATTRIBUTE_CAST(accesor, numComp, srcType, dstPtr, dstType) \
+{ \
+    int n = 0; \
+    srcType *buffer = (srcType *)accesor->buffer_view->buffer->data + accesor->buffer_view->offset/sizeof(srcType) + accesor->offset/sizeof(srcType); \
+    for (unsigned int k = 0; k < accesor->count; k++) \
+    {\
+        for (int l = 0; l < numComp; l++) \
+        {\
+            dstPtr[numComp*k + l] = (dstType)buffer[n + l];\
+        }\
+        n += (int)(accesor->stride/sizeof(srcType));\
+    }\
+}
+
+// Load glTF primitive into a raylib mesh (worker task)
+// NOTE: Attributes are converted and transformed by node world transform, tangents
+// are generated for normal mapped materials not providing them
+static void LoadPrimitiveGLTF(PrimitiveTaskGLTF *task)
+{
+    cgltf_primitive *primitive = task->primitive;
+    Mesh *mesh = task->mesh;
+    Matrix worldMatrix = task->worldMatrix;
+    Matrix worldMatrixNormals = task->worldMatrixNormals;
+    const char *fileName = task->fileName;
+
+    // NOTE: Attributes data could be provided in several data formats (8, 8u, 16u, 32...),
+    // Only some formats for each attribute type are supported, read info at the top of LoadGLTF()!
+
+    for (unsigned int j = 0; j < primitive->attributes_count; j++)
+    {
+        // Check the different attributes for every primitive
+        if (primitive->attributes[j].type == cgltf_attribute_type_position)      // POSITION, vec3, float
+        {
+            cgltf_accessor *attribute = primitive->attributes[j].data;
+
+            // WARNING: SPECS: POSITION accessor MUST have its min and max properties defined
+
+            if ((attribute->type == cgltf_type_vec3) && (attribute->component_type == cgltf_component_type_r_32f))
+            {
+                // Init raylib mesh vertices to copy glTF attribute data
+                mesh->vertexCount = (int)attribute->count;
+                mesh->vertices = (float *)RL_MALLOC(attribute->count*3*sizeof(float));
+
+                // Load 3 components of float data type into mesh.vertices
+                LOAD_ATTRIBUTE(attribute, 3, float, mesh->vertices)
+
+                // Transform the vertices
+                float *vertices = mesh->vertices;
+                for (unsigned int k = 0; k < attribute->count; k++)
+                {
+                    Vector3 vt = Vector3Transform((Vector3){ vertices[3*k], vertices[3*k+1], vertices[3*k+2] }, worldMatrix);
+                    vertices[3*k] = vt.x;
+                    vertices[3*k+1] = vt.y;
+                    vertices[3*k+2] = vt.z;
+                }
+            }
+            else TRACELOG(LOG_WARNING, "MODEL: [%s] Vertices attribute data format not supported, use vec3 float", fileName);
+        }
+        else if (primitive->attributes[j].type == cgltf_attribute_type_normal)   // NORMAL, vec3, float
+        {
+            cgltf_accessor *attribute = primitive->attributes[j].data;
+
+            if ((attribute->type == cgltf_type_vec3) && (attribute->component_type == cgltf_component_type_r_32f))
+            {
+                // Init raylib mesh normals to copy glTF attribute data
+                mesh->normals = (float *)RL_MALLOC(attribute->count*3*sizeof(float));
+
+                // Load 3 components of float data type into mesh.normals
+                LOAD_ATTRIBUTE(attribute, 3, float, mesh->normals)
+
+                // Transform the normals
+                float *normals = mesh->normals;
+                for (unsigned int k = 0; k < attribute->count; k++)
+                {
+                    Vector3 nt = Vector3Transform((Vector3){ normals[3*k], normals[3*k+1], normals[3*k+2] }, worldMatrixNormals);
+                    normals[3*k] = nt.x;
+                    normals[3*k+1] = nt.y;
+                    normals[3*k+2] = nt.z;
+                }
+            }
+            else TRACELOG(LOG_WARNING, "MODEL: [%s] Normal attribute data format not supported, use vec3 float", fileName);
+        }
+        else if (primitive->attributes[j].type == cgltf_attribute_type_tangent)   // TANGENT, vec3, float
+        {
+            cgltf_accessor *attribute = primitive->attributes[j].data;
+
+            if ((attribute->type == cgltf_type_vec4) && (attribute->component_type == cgltf_component_type_r_32f))
+            {
+                // Init raylib mesh tangent to copy glTF attribute data
+                mesh->tangents = (float *)RL_MALLOC(attribute->count*4*sizeof(float));
+
+                // Load 4 components of float data type into mesh.tangents
+                LOAD_ATTRIBUTE(attribute, 4, float, mesh->tangents)
+
+                // Transform the tangents
+                float *tangents = mesh->tangents;
+                for (unsigned int k = 0; k < attribute->count; k++)
+                {
+                    Vector3 tt = Vector3Transform((Vector3){ tangents[3*k], tangents[3*k+1], tangents[3*k+2] }, worldMatrix);
+                    tangents[3*k] = tt.x;
+                    tangents[3*k+1] = tt.y;
+                    tangents[3*k+2] = tt.z;
+                }
+            }
+            else TRACELOG(LOG_WARNING, "MODEL: [%s] Tangent attribute data format not supported, use vec4 float", fileName);
+        }
+        else if (primitive->attributes[j].type == cgltf_attribute_type_texcoord) // TEXCOORD_n, vec2, float/u8n/u16n
+        {
+            // Support up to 2 texture coordinates attributes
+            float *texcoordPtr = NULL;
+
+            cgltf_accessor *attribute = primitive->attributes[j].data;
+
+            if (attribute->type == cgltf_type_vec2)
+            {
+                if (attribute->component_type == cgltf_component_type_r_32f)  // vec2, float
+                {
+                    // Init raylib mesh texcoords to copy glTF attribute data
+                    texcoordPtr = (float *)RL_MALLOC(attribute->count*2*sizeof(float));
+
+                    // Load 3 components of float data type into mesh.texcoords
+                    LOAD_ATTRIBUTE(attribute, 2, float, texcoordPtr)
+                }
+                else if (attribute->component_type == cgltf_component_type_r_8u) // vec2, u8n
+                {
+                    // Init raylib mesh texcoords to copy glTF attribute data
+                    texcoordPtr = (float *)RL_MALLOC(attribute->count*2*sizeof(float));
+
+                    // Load data into a temp buffer to be converted to raylib data type
+                    unsigned char *temp = (unsigned char *)RL_MALLOC(attribute->count*2*sizeof(unsigned char));
+                    LOAD_ATTRIBUTE(attribute, 2, unsigned char, temp);
+
+                    // Convert data to raylib texcoord data type (float)
+                    for (unsigned int t = 0; t < attribute->count*2; t++) texcoordPtr[t] = (float)temp[t]/255.0f;
+
+                    RL_FREE(temp);
+                }
+                else if (attribute->component_type == cgltf_component_type_r_16u) // vec2, u16n
+                {
+                    // Init raylib mesh texcoords to copy glTF attribute data
+                    texcoordPtr = (float *)RL_MALLOC(attribute->count*2*sizeof(float));
+
+                    // Load data into a temp buffer to be converted to raylib data type
+                    unsigned short *temp = (unsigned short *)RL_MALLOC(attribute->count*2*sizeof(unsigned short));
+                    LOAD_ATTRIBUTE(attribute, 2, unsigned short, temp);
+
+                    // Convert data to raylib texcoord data type (float)
+                    for (unsigned int t = 0; t < attribute->count*2; t++) texcoordPtr[t] = (float)temp[t]/65535.0f;
+
+                    RL_FREE(temp);
+                }
+                else TRACELOG(LOG_WARNING, "MODEL: [%s] Texcoords attribute data format not supported", fileName);
+            }
+            else TRACELOG(LOG_WARNING, "MODEL: [%s] Texcoords attribute data format not supported, use vec2 float", fileName);
+
+            int index = primitive->attributes[j].index;
+            if (index == 0) mesh->texcoords = texcoordPtr;
+            else if (index == 1) mesh->texcoords2 = texcoordPtr;
+            else
+            {
+                TRACELOG(LOG_WARNING, "MODEL: [%s] No more than 2 texture coordinates attributes supported", fileName);
+                if (texcoordPtr != NULL) RL_FREE(texcoordPtr);
+            }
+        }
+        else if (primitive->attributes[j].type == cgltf_attribute_type_color)    // COLOR_n, vec3/vec4, float/u8n/u16n
+        {
+            cgltf_accessor *attribute = primitive->attributes[j].data;
+
+            // WARNING: SPECS: All components of each COLOR_n accessor element MUST be clamped to [0.0, 1.0] range
+
+            if (attribute->type == cgltf_type_vec3)  // RGB
+            {
+                if (attribute->component_type == cgltf_component_type_r_8u)
+                {
+                    // Init raylib mesh color to copy glTF attribute data
+                    mesh->colors = (unsigned char *)RL_MALLOC(attribute->count*4*sizeof(unsigned char));
+
+                    // Load data into a temp buffer to be converted to raylib data type
+                    unsigned char *temp = (unsigned char *)RL_MALLOC(attribute->count*3*sizeof(unsigned char));
+                    LOAD_ATTRIBUTE(attribute, 3, unsigned char, temp);
+
+                    // Convert data to raylib color data type (4 bytes)
+                    for (unsigned int c = 0, k = 0; c < (attribute->count*4 - 3); c += 4, k += 3)
+                    {
+                        mesh->colors[c] = temp[k];
+                        mesh->colors[c + 1] = temp[k + 1];
+                        mesh->colors[c + 2] = temp[k + 2];
+                        mesh->colors[c + 3] = 255;
+                    }
+
+                    RL_FREE(temp);
+                }
+                else if (attribute->component_type == cgltf_component_type_r_16u)
+                {
+                    // Init raylib mesh color to copy glTF attribute data
+                    mesh->colors = (unsigned char *)RL_MALLOC(attribute->count*4*sizeof(unsigned char));
+
+                    // Load data into a temp buffer to be converted to raylib data type
+                    unsigned short *temp = (unsigned short *)RL_MALLOC(attribute->count*3*sizeof(unsigned short));
+                    LOAD_ATTRIBUTE(attribute, 3, unsigned short, temp);
 
-                if (poses[i].mask & 0x80)
-                {
-                    animations[a].framePoses[frame][i].scale.x += framedata[dcounter]*poses[i].channelscale[7];
-                    dcounter++;
+                    // Convert data to raylib color data type (4 bytes)
+                    for (unsigned int c = 0, k = 0; c < (attribute->count*4 - 3); c += 4, k += 3)
+                    {
+                        mesh->colors[c] = (unsigned char)(((float)temp[k]/65535.0f)*255.0f);
+                        mesh->colors[c + 1] = (unsigned char)(((float)temp[k + 1]/65535.0f)*255.0f);
+                        mesh->colors[c + 2] = (unsigned char)(((float)temp[k + 2]/65535.0f)*255.0f);
+                        mesh->colors[c + 3] = 255;
+                    }
+
+                    RL_FREE(temp);
                 }
+                else if (attribute->component_type == cgltf_component_type_r_32f)
+                {
+                    // Init raylib mesh color to copy glTF attribute data
+                    mesh->colors = (unsigned char *)RL_MALLOC(attribute->count*4*sizeof(unsigned char));
 
-                animations[a].framePoses[frame][i].scale.y = poses[i].channeloffset[8];
+                    // Load data into a temp buffer to be converted to raylib data type
+                    float *temp = (float *)RL_MALLOC(attribute->count*3*sizeof(float));
+                    LOAD_ATTRIBUTE(attribute, 3, float, temp);
 
-                if (poses[i].mask & 0x100)
+                    // Convert data to raylib color data type (4 bytes)
+                    for (unsigned int c = 0, k = 0; c < (attribute->count*4 - 3); c += 4, k += 3)
+                    {
+                        mesh->colors[c] = (unsigned char)(temp[k]*255.0f);
+                        mesh->colors[c + 1] = (unsigned char)(temp[k + 1]*255.0f);
+                        mesh->colors[c + 2] = (unsigned char)(temp[k + 2]*255.0f);
+                        mesh->colors[c + 3] = 255;
+                    }
+
+                    RL_FREE(temp);
+                }
+                else TRACELOG(LOG_WARNING, "MODEL: [%s] Color attribute data format not supported", fileName);
+            }
+            else if (attribute->type == cgltf_type_vec4) // RGBA
+            {
+                if (attribute->component_type == cgltf_component_type_r_8u)
                 {
-                    animations[a].framePoses[frame][i].scale.y += framedata[dcounter]*poses[i].channelscale[8];
-                    dcounter++;
+                    // Init raylib mesh color to copy glTF attribute data
+                    mesh->colors = (unsigned char *)RL_MALLOC(attribute->count*4*sizeof(unsigned char));
+
+                    // Load 4 components of unsigned char data type into mesh.colors
+                    LOAD_ATTRIBUTE(attribute, 4, unsigned char, mesh->colors)
                 }
+                else if (attribute->component_type == cgltf_component_type_r_16u)
+                {
+                    // Init raylib mesh color to copy glTF attribute data
+                    mesh->colors = (unsigned char *)RL_MALLOC(attribute->count*4*sizeof(unsigned char));
 
-                animations[a].framePoses[frame][i].scale.z = poses[i].channeloffset[9];
+                    // Load data into a temp buffer to be converted to raylib data type
+                    unsigned short *temp = (unsigned short *)RL_MALLOC(attribute->count*4*sizeof(unsigned short));
+                    LOAD_ATTRIBUTE(attribute, 4, unsigned short, temp);
 
-                if (poses[i].mask & 0x200)
-                {
-                    animations[a].framePoses[frame][i].scale.z += framedata[dcounter]*poses[i].channelscale[9];
-                    dcounter++;
+                    // Convert data to raylib color data type (4 bytes)
+                    for (unsigned int c = 0; c < attribute->count*4; c++) mesh->colors[c] = (unsigned char)(((float)temp[c]/65535.0f)*255.0f);
+
+                    RL_FREE(temp);
                 }
+                else if (attribute->component_type == cgltf_component_type_r_32f)
+                {
+                    // Init raylib mesh color to copy glTF attribute data
+                    mesh->colors = (unsigned char *)RL_MALLOC(attribute->count*4*sizeof(unsigned char));
 
-                animations[a].framePoses[frame][i].rotation = QuaternionNormalize(animations[a].framePoses[frame][i].rotation);
-            }
-        }
+                    // Load data into a temp buffer to be converted to raylib data type
+                    float *temp = (float *)RL_MALLOC(attribute->count*4*sizeof(float));
+                    LOAD_ATTRIBUTE(attribute, 4, float, temp);
 
-        // Build frameposes
-        for (unsigned int frame = 0; frame < anim[a].num_frames; frame++)
-        {
-            for (int i = 0; i < animations[a].boneCount; i++)
-            {
-                if (animations[a].bones[i].parent >= 0)
-                {
-                    animations[a].framePoses[frame][i].rotation = QuaternionMultiply(animations[a].framePoses[frame][animations[a].bones[i].parent].rotation, animations[a].framePoses[frame][i].rotation);
-                    animations[a].framePoses[frame][i].translation = Vector3RotateByQuaternion(animations[a].framePoses[frame][i].translation, animations[a].framePoses[frame][animations[a].bones[i].parent].rotation);
-                    animations[a].framePoses[frame][i].translation = Vector3Add(animations[a].framePoses[frame][i].translation, animations[a].framePoses[frame][animations[a].bones[i].parent].translation);
-                    animations[a].framePoses[frame][i].scale = Vector3Multiply(animations[a].framePoses[frame][i].scale, animations[a].framePoses[frame][animations[a].bones[i].parent].scale);
+                    // Convert data to raylib color data type (4 bytes), we expect the color data normalized
+                    for (unsigned int c = 0; c < attribute->count*4; c++) mesh->colors[c] = (unsigned char)(temp[c]*255.0f);
+
+                    RL_FREE(temp);
                 }
+                else TRACELOG(LOG_WARNING, "MODEL: [%s] Color attribute data format not supported", fileName);
             }
+            else TRACELOG(LOG_WARNING, "MODEL: [%s] Color attribute data format not supported", fileName);
         }
-    }
 
-    UnloadFileData(fileData);
+        // NOTE: Attributes related to animations are processed separately
+    }
 
-    RL_FREE(joints);
-    RL_FREE(framedata);
-    RL_FREE(poses);
-    RL_FREE(anim);
+    // Load primitive indices data (if provided)
+    if ((primitive->indices != NULL) && (primitive->indices->buffer_view != NULL))
+    {
+        cgltf_accessor *attribute = primitive->indices;
 
-    return animations;
-}
+        mesh->triangleCount = (int)attribute->count/3;
 
-#endif
+        if (attribute->component_type == cgltf_component_type_r_16u)
+        {
+            // Init raylib mesh indices to copy glTF attribute data
+            mesh->indices = (unsigned short *)RL_MALLOC(attribute->count*sizeof(unsigned short));
 
-#if defined(SUPPORT_FILEFORMAT_GLTF)
-// Load file data callback for cgltf
-static cgltf_result LoadFileGLTFCallback(const struct cgltf_memory_options *memoryOptions, const struct cgltf_file_options *fileOptions, const char *path, cgltf_size *size, void **data)
-{
-    int filesize;
-    unsigned char *filedata = LoadFileData(path, &filesize);
+            // Load unsigned short data type into mesh.indices
+            LOAD_ATTRIBUTE(attribute, 1, unsigned short, mesh->indices)
+        }
+        else if (attribute->component_type == cgltf_component_type_r_8u)
+        {
+            // Init raylib mesh indices to copy glTF attribute data
+            mesh->indices = (unsigned short *)RL_MALLOC(attribute->count*sizeof(unsigned short));
+            LOAD_ATTRIBUTE_CAST(attribute, 1, unsigned char, mesh->indices, unsigned short)
 
-    if (filedata == NULL) return cgltf_result_io_error;
+        }
+        else if (attribute->component_type == cgltf_component_type_r_32u)
+        {
+            // Init raylib mesh indices to copy glTF attribute data
+            mesh->indices = (unsigned short *)RL_MALLOC(attribute->count*sizeof(unsigned short));
+            LOAD_ATTRIBUTE_CAST(attribute, 1, unsigned int, mesh->indices, unsigned short);
 
-    *size = filesize;
-    *data = filedata;
+            TRACELOG(LOG_WARNING, "MODEL: [%s] Indices data converted from u32 to u16, possible loss of data", fileName);
+        }
+        else
+        {
+            TRACELOG(LOG_WARNING, "MODEL: [%s] Indices data format not supported, use u16", fileName);
+        }
+    }
+    else mesh->triangleCount = mesh->vertexCount/3;    // Unindexed mesh
 
-    return cgltf_result_success;
+    if (task->generateTangents && (mesh->tangents == NULL) && (mesh->normals != NULL) && (mesh->texcoords != NULL)) GenMeshTangents(mesh);
 }
 
-// Release file data callback for cgltf
-static void ReleaseFileGLTFCallback(const struct cgltf_memory_options *memoryOptions, const struct cgltf_file_options *fileOptions, void *data)
+// Load glTF model data task (worker task), image decoding tasks first, then primitives
+static void LoadTaskGLTF(void *data, int taskIndex)
 {
-    UnloadFileData(data);
+    LoadBatchGLTF *batch = (LoadBatchGLTF *)data;
+
+    if (taskIndex < batch->decodeCount)
+    {
+        int index = batch->decodeIndices[taskIndex];
+        batch->images[index] = LoadImageFromCgltfImage(&batch->data->images[index], batch->texPath);
+    }
+    else LoadPrimitiveGLTF(&batch->primitives[taskIndex - batch->decodeCount]);
 }
 
-// Load image from different glTF provided methods (uri, path, buffer_view)
-static Image LoadImageFromCgltfImage(cgltf_image *cgltfImage, const char *texPath)
+// Get glTF texture image decoded for a material map
+// NOTE: Images shared by several material maps are copied, last use takes the decoded image
+static Image GetImageGLTF(LoadBatchGLTF *batch, cgltf_texture *texture)
 {
     Image image = { 0 };
 
-    if (cgltfImage == NULL) return image;
+    if ((texture == NULL) || (texture->image == NULL)) return image;
 
-    if (cgltfImage->uri != NULL)     // Check if image data is provided as an uri (base64 or path)
+    int index = (int)cgltf_image_index(batch->data, texture->image);
+
+    batch->imageUses[index]--;
+    if (batch->imageUses[index] > 0) image = ImageCopy(batch->images[index]);
+    else
     {
-        if ((strlen(cgltfImage->uri) > 5) &&
-            (cgltfImage->uri[0] == 'd') &&
-            (cgltfImage->uri[1] == 'a') &&
-            (cgltfImage->uri[2] == 't') &&
-            (cgltfImage->uri[3] == 'a') &&
-            (cgltfImage->uri[4] == ':'))     // Check if image is provided as base64 text data
-        {
-            // Data URI Format: data:<mediatype>;base64,<data>
+        image = batch->images[index];
+        batch->images[index] = (Image){ 0 };
+    }
 
-            // Find the comma
-            int i = 0;
-            while ((cgltfImage->uri[i] != ',') && (cgltfImage->uri[i] != 0)) i++;
+    return image;
+}
 
-            if (cgltfImage->uri[i] == 0) TRACELOG(LOG_WARNING, "IMAGE: glTF data URI is not a valid image");
-            else
-            {
-                int base64Size = (int)strlen(cgltfImage->uri + i + 1);
-                while (cgltfImage->uri[i + base64Size] == '=') base64Size--;    // Ignore optional paddings
-                int numberOfEncodedBits = base64Size*6 - (base64Size*6) % 8 ;   // Encoded bits minus extra bits, so it becomes a multiple of 8 bits
-                int outSize = numberOfEncodedBits/8 ;                           // Actual encoded bytes
-                void *data = NULL;
+#if defined(SUPPORT_MODEL_RESOURCE_CACHE)
+// Get glTF image encoded data hash, 0 if not available
+static unsigned long long GetImageHashGLTF(cgltf_image *cgltfImage, const char *texPath)
+{
+    unsigned long long hash = 0;
 
-                cgltf_options options = { 0 };
-                options.file.read = LoadFileGLTFCallback;
-                options.file.release = ReleaseFileGLTFCallback;
-                cgltf_result result = cgltf_load_buffer_base64(&options, outSize, cgltfImage->uri + i + 1, &data);
+    if (cgltfImage->uri != NULL)
+    {
+        if (strncmp(cgltfImage->uri, "data:", 5) == 0) hash = HashData(cgltfImage->uri, (int)strlen(cgltfImage->uri), 0);
+        else
+        {
+            // External image files are identified by path, size and modification time, not read,
+            // identical images on different files are still shared by pixel data once decoded
+            const char *filePath = TextFormat("%s/%s", texPath, cgltfImage->uri);
 
-                if (result == cgltf_result_success)
-                {
-                    image = LoadImageFromMemory(".png", (unsigned char *)data, outSize);
-                    RL_FREE(data);
-                }
+            if (FileExists(filePath))
+            {
+                long long stamp[2] = { GetFileLength(filePath), GetFileModTime(filePath) };
+                hash = HashData(filePath, (int)strlen(filePath), HashData(stamp, sizeof(stamp), 0));
             }
         }
-        else     // Check if image is provided as image path
-        {
-            image = LoadImage(TextFormat("%s/%s", texPath, cgltfImage->uri));
-        }
     }
-    else if ((cgltfImage->buffer_view != NULL) && (cgltfImage->buffer_view->buffer->data != NULL))    // Check if image is provided as data buffer
+    else if ((cgltfImage->buffer_view != NULL) && (cgltfImage->buffer_view->buffer->data != NULL) && (cgltfImage->buffer_view->stride <= 1))
     {
-        unsigned char *data = (unsigned char *)RL_MALLOC(cgltfImage->buffer_view->size);
-        int offset = (int)cgltfImage->buffer_view->offset;
-        int stride = (int)cgltfImage->buffer_view->stride? (int)cgltfImage->buffer_view->stride : 1;
+        hash = HashData((unsigned char *)cgltfImage->buffer_view->buffer->data + cgltfImage->buffer_view->offset, (int)cgltfImage->buffer_view->size, 0);
+    }
 
-        // Copy buffer data to memory for loading
-        for (unsigned int i = 0; i < cgltfImage->buffer_view->size; i++)
-        {
-            data[i] = ((unsigned char *)cgltfImage->buffer_view->buffer->data)[offset];
-            offset += stride;
-        }
+    return hash;
+}
+#endif
 
-        // Check mime_type for image: (cgltfImage->mime_type == "image/png")
-        // NOTE: Detected that some models define mime_type as "image\\/png"
-        if ((strcmp(cgltfImage->mime_type, "image\\/png") == 0) || (strcmp(cgltfImage->mime_type, "image/png") == 0))
-        {
-            image = LoadImageFromMemory(".png", data, (int)cgltfImage->buffer_view->size);
-        }
-        else if ((strcmp(cgltfImage->mime_type, "image\\/jpeg") == 0) || (strcmp(cgltfImage->mime_type, "image/jpeg") == 0))
-        {
-            image = LoadImageFromMemory(".jpg", data, (int)cgltfImage->buffer_view->size);
-        }
-        else TRACELOG(LOG_WARNING, "MODEL: glTF image data MIME type not recognized", TextFormat("%s/%s", texPath, cgltfImage->uri));
+// Get glTF material map texture source hash, 0 if not available
+// NOTE: Metallic/roughness maps are derived from the same image, map type is hashed too
+static unsigned long long GetSourceHashGLTF(LoadBatchGLTF *batch, cgltf_texture *texture, int mapType)
+{
+    if ((texture == NULL) || (texture->image == NULL)) return 0;
 
-        RL_FREE(data);
-    }
+    unsigned long long hash = batch->imageHashes[cgltf_image_index(batch->data, texture->image)];
 
-    return image;
+    if ((hash != 0) && ((mapType == MATERIAL_MAP_ROUGHNESS) || (mapType == MATERIAL_MAP_METALNESS))) hash = HashData(&mapType, sizeof(int), hash);
+
+    return hash;
 }
 
-// Load bone info from GLTF skin data
-static BoneInfo *LoadBoneInfoGLTF(cgltf_skin skin, int *boneCount)
+// Get glTF material maps textures already loaded from texture image, mapTypes terminated by -1
+// NOTE: Returns true only if all material maps textures are available, image is not decoded then
+static bool GetCachedTexturesGLTF(LoadBatchGLTF *batch, int materialIndex, cgltf_texture *texture, const int *mapTypes)
 {
-    *boneCount = (int)skin.joints_count;
-    BoneInfo *bones = (BoneInfo *)RL_CALLOC(skin.joints_count, sizeof(BoneInfo));
+    Texture2D *cached = &batch->cachedTextures[materialIndex*MAX_MATERIAL_MAPS];
 
-    for (unsigned int i = 0; i < skin.joints_count; i++)
+    for (int i = 0; (i < 2) && (mapTypes[i] >= 0); i++)
     {
-        cgltf_node node = *skin.joints[i];
-        if (node.name != NULL) strncpy(bones[i].name, node.name, sizeof(bones[i].name) - 1);
-
-        // Find parent bone index
-        int parentIndex = -1;
+        cached[mapTypes[i]] = GetCachedTexture(GetSourceHashGLTF(batch, texture, mapTypes[i]));
 
-        for (unsigned int j = 0; j < skin.joints_count; j++)
+        if (cached[mapTypes[i]].id == 0)
         {
-            if (skin.joints[j] == node.parent)
+            for (int k = 0; k < i; k++)
             {
-                parentIndex = (int)j;
-                break;
+                ReleaseTextureCached(cached[mapTypes[k]]);
+                cached[mapTypes[k]] = (Texture2D){ 0 };
             }
-        }
 
-        bones[i].parent = parentIndex;
+            return false;
+        }
     }
 
-    return bones;
+    return true;
+}
+
+// Load glTF material map texture, shared if already loaded from the same image data
+static void LoadMaterialMapGLTF(LoadBatchGLTF *batch, Material *material, int materialIndex, int mapType, cgltf_texture *texture)
+{
+    Texture2D cached = batch->cachedTextures[materialIndex*MAX_MATERIAL_MAPS + mapType];
+
+    if (cached.id > 0) material->maps[mapType].texture = cached;
+    else LoadMaterialMapTexture(material, mapType, GetImageGLTF(batch, texture), GetSourceHashGLTF(batch, texture, mapType));
 }
 
 // Load glTF file into model struct, .gltf and .glb supported
@@ -5276,6 +7335,11 @@ static Model LoadGLTF(const char *fileName)
             but the hierarchy is not kept (as it can't be represented)
           - Mesh instances in the glTF file (i.e. same mesh linked from multiple nodes)
             are turned into separate raylib Meshes
+          - Images decoding and primitives conversion (and tangents generation for
+            normal mapped materials) run as a batch of worker tasks, textures are
+            uploaded from calling thread once the batch is done
+          - File data is mapped into memory (LoadFileDataMapped()), buffers and images
+            are read in place, without an intermediate copy of the file
 
         RESTRICTIONS:
           - Only triangle meshes supported
@@ -5290,28 +7354,11 @@ static Model LoadGLTF(const char *fileName)
 
     ***********************************************************************************************/
 
-    // Macro to simplify attributes loading code
-    #define LOAD_ATTRIBUTE(accesor, numComp, srcType, dstPtr) LOAD_ATTRIBUTE_CAST(accesor, numComp, srcType, dstPtr, srcType)
-
-    #define LOAD_ATTRIBUTE_CAST(accesor, numComp, srcType, dstPtr, dstType) \
-    { \
-        int n = 0; \
-        srcType *buffer = (srcType *)accesor->buffer_view->buffer->data + accesor->buffer_view->offset/sizeof(srcType) + accesor->offset/sizeof(srcType); \
-        for (unsigned int k = 0; k < accesor->count; k++) \
-        {\
-            for (int l = 0; l < numComp; l++) \
-            {\
-                dstPtr[numComp*k + l] = (dstType)buffer[n + l];\
-            }\
-            n += (int)(accesor->stride/sizeof(srcType));\
-        }\
-    }
-
     Model model = { 0 };
 
     // glTF file loading
     int dataSize = 0;
-    unsigned char *fileData = LoadFileData(fileName, &dataSize);
+    unsigned char *fileData = LoadFileDataMapped(fileName, &dataSize);
 
     if (fileData == NULL) return model;
 
@@ -5328,160 +7375,92 @@ static Model LoadGLTF(const char *fileName)
         else if (data->file_type == cgltf_file_type_gltf) TRACELOG(LOG_INFO, "MODEL: [%s] Model basic data (glTF) loaded successfully", fileName);
         else TRACELOG(LOG_WARNING, "MODEL: [%s] Model format not recognized", fileName);
 
-        TRACELOG(LOG_INFO, "    > Meshes count: %i", data->meshes_count);
-        TRACELOG(LOG_INFO, "    > Materials count: %i (+1 default)", data->materials_count);
-        TRACELOG(LOG_DEBUG, "    > Buffers count: %i", data->buffers_count);
-        TRACELOG(LOG_DEBUG, "    > Images count: %i", data->images_count);
-        TRACELOG(LOG_DEBUG, "    > Textures count: %i", data->textures_count);
-
-        // Force reading data buffers (fills buffer_view->buffer->data)
-        // NOTE: If an uri is defined to base64 data or external path, it's automatically loaded
-        result = cgltf_load_buffers(&options, data, fileName);
-        if (result != cgltf_result_success) TRACELOG(LOG_INFO, "MODEL: [%s] Failed to load mesh/material buffers", fileName);
-
-        int primitivesCount = 0;
-
-        // NOTE: We will load every primitive in the glTF as a separate raylib Mesh.
-        // Determine total number of meshes needed from the node hierarchy.
-        for (unsigned int i = 0; i < data->nodes_count; i++)
-        {
-            cgltf_node *node = &(data->nodes[i]);
-            cgltf_mesh *mesh = node->mesh;
-            if (!mesh) continue;
-
-            for (unsigned int p = 0; p < mesh->primitives_count; p++)
-            {
-                if (mesh->primitives[p].type == cgltf_primitive_type_triangles) primitivesCount++;
-            }
-        }
-        TRACELOG(LOG_DEBUG, "    > Primitives (triangles only) count based on hierarchy : %i", primitivesCount);
-
-        // Load our model data: meshes and materials
-        model.meshCount = primitivesCount;
-        model.meshes = (Mesh *)RL_CALLOC(model.meshCount, sizeof(Mesh));
-
-        // NOTE: We keep an extra slot for default material, in case some mesh requires it
-        model.materialCount = (int)data->materials_count + 1;
-        model.materials = (Material *)RL_CALLOC(model.materialCount, sizeof(Material));
-        model.materials[0] = LoadMaterialDefault();     // Load default material (index: 0)
-
-        // Load mesh-material indices, by default all meshes are mapped to material index: 0
-        model.meshMaterial = (int *)RL_CALLOC(model.meshCount, sizeof(int));
-
-        // Load materials data
-        //----------------------------------------------------------------------------------------------------
-        for (unsigned int i = 0, j = 1; i < data->materials_count; i++, j++)
-        {
-            model.materials[j] = LoadMaterialDefault();
-            const char *texPath = GetDirectoryPath(fileName);
-
-            // Check glTF material flow: PBR metallic/roughness flow
-            // NOTE: Alternatively, materials can follow PBR specular/glossiness flow
-            if (data->materials[i].has_pbr_metallic_roughness)
-            {
-                // Load base color texture (albedo)
-                if (data->materials[i].pbr_metallic_roughness.base_color_texture.texture)
-                {
-                    Image imAlbedo = LoadImageFromCgltfImage(data->materials[i].pbr_metallic_roughness.base_color_texture.texture->image, texPath);
-                    if (imAlbedo.data != NULL)
-                    {
-                        model.materials[j].maps[MATERIAL_MAP_ALBEDO].texture = LoadTextureFromImage(imAlbedo);
-                        UnloadImage(imAlbedo);
-                    }
-                }
-                // Load base color factor (tint)
-                model.materials[j].maps[MATERIAL_MAP_ALBEDO].color.r = (unsigned char)(data->materials[i].pbr_metallic_roughness.base_color_factor[0]*255);
-                model.materials[j].maps[MATERIAL_MAP_ALBEDO].color.g = (unsigned char)(data->materials[i].pbr_metallic_roughness.base_color_factor[1]*255);
-                model.materials[j].maps[MATERIAL_MAP_ALBEDO].color.b = (unsigned char)(data->materials[i].pbr_metallic_roughness.base_color_factor[2]*255);
-                model.materials[j].maps[MATERIAL_MAP_ALBEDO].color.a = (unsigned char)(data->materials[i].pbr_metallic_roughness.base_color_factor[3]*255);
-
-                // Load metallic/roughness texture
-                if (data->materials[i].pbr_metallic_roughness.metallic_roughness_texture.texture)
-                {
-                    Image imMetallicRoughness = LoadImageFromCgltfImage(data->materials[i].pbr_metallic_roughness.metallic_roughness_texture.texture->image, texPath);
-                    if (imMetallicRoughness.data != NULL)
-                    {
-                        Image imMetallic = { 0 };
-                        Image imRoughness = { 0 };
-
-                        imMetallic.data = RL_MALLOC(imMetallicRoughness.width*imMetallicRoughness.height);
-                        imRoughness.data = RL_MALLOC(imMetallicRoughness.width*imMetallicRoughness.height);
-
-                        imMetallic.width = imRoughness.width = imMetallicRoughness.width;
-                        imMetallic.height = imRoughness.height = imMetallicRoughness.height;
+        TRACELOG(LOG_INFO, "    > Meshes count: %i", data->meshes_count);
+        TRACELOG(LOG_INFO, "    > Materials count: %i (+1 default)", data->materials_count);
+        TRACELOG(LOG_DEBUG, "    > Buffers count: %i", data->buffers_count);
+        TRACELOG(LOG_DEBUG, "    > Images count: %i", data->images_count);
+        TRACELOG(LOG_DEBUG, "    > Textures count: %i", data->textures_count);
 
-                        imMetallic.format = imRoughness.format = PIXELFORMAT_UNCOMPRESSED_GRAYSCALE;
-                        imMetallic.mipmaps = imRoughness.mipmaps = 1;
+        // Force reading data buffers (fills buffer_view->buffer->data)
+        // NOTE: If an uri is defined to base64 data or external path, it's automatically loaded
+        result = cgltf_load_buffers(&options, data, fileName);
+        if (result != cgltf_result_success) TRACELOG(LOG_INFO, "MODEL: [%s] Failed to load mesh/material buffers", fileName);
 
-                        for (int x = 0; x < imRoughness.width; x++)
-                        {
-                            for (int y = 0; y < imRoughness.height; y++)
-                            {
-                                Color color = GetImageColor(imMetallicRoughness, x, y);
+        int primitivesCount = 0;
 
-                                ((unsigned char *)imRoughness.data)[y*imRoughness.width + x] = color.g; // Roughness color channel
-                                ((unsigned char *)imMetallic.data)[y*imMetallic.width + x] = color.b; // Metallic color channel
-                            }
-                        }
+        // NOTE: We will load every primitive in the glTF as a separate raylib Mesh.
+        // Determine total number of meshes needed from the node hierarchy.
+        for (unsigned int i = 0; i < data->nodes_count; i++)
+        {
+            cgltf_node *node = &(data->nodes[i]);
+            cgltf_mesh *mesh = node->mesh;
+            if (!mesh) continue;
 
-                        model.materials[j].maps[MATERIAL_MAP_ROUGHNESS].texture = LoadTextureFromImage(imRoughness);
-                        model.materials[j].maps[MATERIAL_MAP_METALNESS].texture = LoadTextureFromImage(imMetallic);
+            for (unsigned int p = 0; p < mesh->primitives_count; p++)
+            {
+                if (mesh->primitives[p].type == cgltf_primitive_type_triangles) primitivesCount++;
+            }
+        }
+        TRACELOG(LOG_DEBUG, "    > Primitives (triangles only) count based on hierarchy : %i", primitivesCount);
 
-                        UnloadImage(imRoughness);
-                        UnloadImage(imMetallic);
-                        UnloadImage(imMetallicRoughness);
-                    }
+        // Load our model data: meshes and materials
+        model.meshCount = primitivesCount;
+        model.meshes = (Mesh *)RL_CALLOC(model.meshCount, sizeof(Mesh));
 
-                    // Load metallic/roughness material properties
-                    float roughness = data->materials[i].pbr_metallic_roughness.roughness_factor;
-                    model.materials[j].maps[MATERIAL_MAP_ROUGHNESS].value = roughness;
+        // NOTE: We keep an extra slot for default material, in case some mesh requires it
+        model.materialCount = (int)data->materials_count + 1;
+        model.materials = (Material *)RL_CALLOC(model.materialCount, sizeof(Material));
+        model.materials[0] = LoadMaterialDefault();     // Load default material (index: 0)
 
-                    float metallic = data->materials[i].pbr_metallic_roughness.metallic_factor;
-                    model.materials[j].maps[MATERIAL_MAP_METALNESS].value = metallic;
-                }
+        // Load mesh-material indices, by default all meshes are mapped to material index: 0
+        model.meshMaterial = (int *)RL_CALLOC(model.meshCount, sizeof(int));
 
-                // Load normal texture
-                if (data->materials[i].normal_texture.texture)
-                {
-                    Image imNormal = LoadImageFromCgltfImage(data->materials[i].normal_texture.texture->image, texPath);
-                    if (imNormal.data != NULL)
-                    {
-                        model.materials[j].maps[MATERIAL_MAP_NORMAL].texture = LoadTextureFromImage(imNormal);
-                        UnloadImage(imNormal);
-                    }
-                }
+        // Prepare loading batch: images used by materials (decoded once) and primitives
+        LoadBatchGLTF batch = { 0 };
+        batch.data = data;
+        batch.texPath = (char *)RL_CALLOC(strlen(GetDirectoryPath(fileName)) + 1, 1);    // Copied, path buffer is thread local
+        strcpy(batch.texPath, GetDirectoryPath(fileName));
+        batch.images = (Image *)RL_CALLOC(data->images_count + 1, sizeof(Image));
+        batch.imageUses = (int *)RL_CALLOC(data->images_count + 1, sizeof(int));
+        batch.imageHashes = (unsigned long long *)RL_CALLOC(data->images_count + 1, sizeof(unsigned long long));
+        batch.cachedTextures = (Texture2D *)RL_CALLOC((data->materials_count + 1)*MAX_MATERIAL_MAPS, sizeof(Texture2D));
+        batch.decodeIndices = (int *)RL_CALLOC(data->images_count + 1, sizeof(int));
+        batch.primitives = (PrimitiveTaskGLTF *)RL_CALLOC(primitivesCount + 1, sizeof(PrimitiveTaskGLTF));
+
+#if defined(SUPPORT_MODEL_RESOURCE_CACHE)
+        // Images encoded data is hashed, textures already loaded from the same data are shared (not decoded again)
+        for (unsigned int i = 0; i < data->images_count; i++) batch.imageHashes[i] = GetImageHashGLTF(&data->images[i], batch.texPath);
+#endif
 
-                // Load ambient occlusion texture
-                if (data->materials[i].occlusion_texture.texture)
-                {
-                    Image imOcclusion = LoadImageFromCgltfImage(data->materials[i].occlusion_texture.texture->image, texPath);
-                    if (imOcclusion.data != NULL)
-                    {
-                        model.materials[j].maps[MATERIAL_MAP_OCCLUSION].texture = LoadTextureFromImage(imOcclusion);
-                        UnloadImage(imOcclusion);
-                    }
-                }
+        // Material maps loaded from every texture, metallic/roughness texture is split in two maps
+        const int textureMaps[5][2] = {
+            { MATERIAL_MAP_ALBEDO, -1 },
+            { MATERIAL_MAP_ROUGHNESS, MATERIAL_MAP_METALNESS },
+            { MATERIAL_MAP_NORMAL, -1 },
+            { MATERIAL_MAP_OCCLUSION, -1 },
+            { MATERIAL_MAP_EMISSION, -1 }
+        };
 
-                // Load emissive texture
-                if (data->materials[i].emissive_texture.texture)
-                {
-                    Image imEmissive = LoadImageFromCgltfImage(data->materials[i].emissive_texture.texture->image, texPath);
-                    if (imEmissive.data != NULL)
-                    {
-                        model.materials[j].maps[MATERIAL_MAP_EMISSION].texture = LoadTextureFromImage(imEmissive);
-                        UnloadImage(imEmissive);
-                    }
+        for (unsigned int i = 0; i < data->materials_count; i++)
+        {
+            // NOTE: Only PBR metallic/roughness flow textures are loaded
+            if (!data->materials[i].has_pbr_metallic_roughness) continue;
+
+            cgltf_texture *textures[5] = {
+                data->materials[i].pbr_metallic_roughness.base_color_texture.texture,
+                data->materials[i].pbr_metallic_roughness.metallic_roughness_texture.texture,
+                data->materials[i].normal_texture.texture,
+                data->materials[i].occlusion_texture.texture,
+                data->materials[i].emissive_texture.texture
+            };
 
-                    // Load emissive color factor
-                    model.materials[j].maps[MATERIAL_MAP_EMISSION].color.r = (unsigned char)(data->materials[i].emissive_factor[0]*255);
-                    model.materials[j].maps[MATERIAL_MAP_EMISSION].color.g = (unsigned char)(data->materials[i].emissive_factor[1]*255);
-                    model.materials[j].maps[MATERIAL_MAP_EMISSION].color.b = (unsigned char)(data->materials[i].emissive_factor[2]*255);
-                    model.materials[j].maps[MATERIAL_MAP_EMISSION].color.a = 255;
-                }
-            }
+            for (int t = 0; t < 5; t++)
+            {
+                if ((textures[t] == NULL) || (textures[t]->image == NULL)) continue;
 
-            // Other possible materials not supported by raylib pipeline:
-            // has_clearcoat, has_transmission, has_volume, has_ior, has specular, has_sheen
+                // Image not decoded if all its material maps textures are already loaded
+                if (!GetCachedTexturesGLTF(&batch, i, textures[t], textureMaps[t])) batch.imageUses[cgltf_image_index(data, textures[t]->image)]++;
+            }
         }
 
         // Visit each node in the hierarchy and process any mesh linked from it.
@@ -5520,317 +7499,153 @@ static Model LoadGLTF(const char *fileName)
                 // Other alternatives: points, lines, line_strip, triangle_strip
                 if (mesh->primitives[p].type != cgltf_primitive_type_triangles) continue;
 
-                // NOTE: Attributes data could be provided in several data formats (8, 8u, 16u, 32...),
-                // Only some formats for each attribute type are supported, read info at the top of this function!
+                // Primitive attributes are converted on worker threads
+                PrimitiveTaskGLTF *task = &batch.primitives[meshIndex];
+                task->primitive = &mesh->primitives[p];
+                task->worldMatrix = worldMatrix;
+                task->worldMatrixNormals = worldMatrixNormals;
+                task->mesh = &model.meshes[meshIndex];
+                task->generateTangents = (mesh->primitives[p].material != NULL) && (mesh->primitives[p].material->normal_texture.texture != NULL);
+                task->fileName = fileName;
 
-                for (unsigned int j = 0; j < mesh->primitives[p].attributes_count; j++)
+                // Assign to the primitive mesh the corresponding material index
+                // NOTE: If no material defined, mesh uses the already assigned default material (index: 0)
+                for (unsigned int m = 0; m < data->materials_count; m++)
                 {
-                    // Check the different attributes for every primitive
-                    if (mesh->primitives[p].attributes[j].type == cgltf_attribute_type_position)      // POSITION, vec3, float
+                    // The primitive actually keeps the pointer to the corresponding material,
+                    // raylib instead assigns to the mesh the by its index, as loaded in model.materials array
+                    // To get the index, we check if material pointers match, and we assign the corresponding index,
+                    // skipping index 0, the default material
+                    if (&data->materials[m] == mesh->primitives[p].material)
                     {
-                        cgltf_accessor *attribute = mesh->primitives[p].attributes[j].data;
+                        model.meshMaterial[meshIndex] = m + 1;
+                        break;
+                    }
+                }
 
-                        // WARNING: SPECS: POSITION accessor MUST have its min and max properties defined
+                meshIndex++;       // Move to next mesh
+            }
+        }
 
-                        if ((attribute->type == cgltf_type_vec3) && (attribute->component_type == cgltf_component_type_r_32f))
-                        {
-                            // Init raylib mesh vertices to copy glTF attribute data
-                            model.meshes[meshIndex].vertexCount = (int)attribute->count;
-                            model.meshes[meshIndex].vertices = (float *)RL_MALLOC(attribute->count*3*sizeof(float));
+        // Decode material images and convert primitives on worker threads
+        // NOTE: Textures are uploaded once decoding is done, from calling thread
+        batch.decodeCount = 0;
+        for (unsigned int i = 0; i < data->images_count; i++) if (batch.imageUses[i] > 0) batch.decodeIndices[batch.decodeCount++] = (int)i;
 
-                            // Load 3 components of float data type into mesh.vertices
-                            LOAD_ATTRIBUTE(attribute, 3, float, model.meshes[meshIndex].vertices)
+        RunWorkerTasks(LoadTaskGLTF, &batch, batch.decodeCount + primitivesCount);
 
-                            // Transform the vertices
-                            float *vertices = model.meshes[meshIndex].vertices;
-                            for (unsigned int k = 0; k < attribute->count; k++)
-                            {
-                                Vector3 vt = Vector3Transform((Vector3){ vertices[3*k], vertices[3*k+1], vertices[3*k+2] }, worldMatrix);
-                                vertices[3*k] = vt.x;
-                                vertices[3*k+1] = vt.y;
-                                vertices[3*k+2] = vt.z;
-                            }
-                        }
-                        else TRACELOG(LOG_WARNING, "MODEL: [%s] Vertices attribute data format not supported, use vec3 float", fileName);
-                    }
-                    else if (mesh->primitives[p].attributes[j].type == cgltf_attribute_type_normal)   // NORMAL, vec3, float
-                    {
-                        cgltf_accessor *attribute = mesh->primitives[p].attributes[j].data;
+        // Load materials data, textures from images decoded
+        //----------------------------------------------------------------------------------------------------
+        for (unsigned int i = 0, j = 1; i < data->materials_count; i++, j++)
+        {
+            model.materials[j] = LoadMaterialDefault();
 
-                        if ((attribute->type == cgltf_type_vec3) && (attribute->component_type == cgltf_component_type_r_32f))
-                        {
-                            // Init raylib mesh normals to copy glTF attribute data
-                            model.meshes[meshIndex].normals = (float *)RL_MALLOC(attribute->count*3*sizeof(float));
+            // Check glTF material flow: PBR metallic/roughness flow
+            // NOTE: Alternatively, materials can follow PBR specular/glossiness flow
+            if (data->materials[i].has_pbr_metallic_roughness)
+            {
+                // Load base color texture (albedo)
+                if (data->materials[i].pbr_metallic_roughness.base_color_texture.texture)
+                {
+                    LoadMaterialMapGLTF(&batch, &model.materials[j], i, MATERIAL_MAP_ALBEDO, data->materials[i].pbr_metallic_roughness.base_color_texture.texture);
+                }
+                // Load base color factor (tint)
+                model.materials[j].maps[MATERIAL_MAP_ALBEDO].color.r = (unsigned char)(data->materials[i].pbr_metallic_roughness.base_color_factor[0]*255);
+                model.materials[j].maps[MATERIAL_MAP_ALBEDO].color.g = (unsigned char)(data->materials[i].pbr_metallic_roughness.base_color_factor[1]*255);
+                model.materials[j].maps[MATERIAL_MAP_ALBEDO].color.b = (unsigned char)(data->materials[i].pbr_metallic_roughness.base_color_factor[2]*255);
+                model.materials[j].maps[MATERIAL_MAP_ALBEDO].color.a = (unsigned char)(data->materials[i].pbr_metallic_roughness.base_color_factor[3]*255);
 
-                            // Load 3 components of float data type into mesh.normals
-                            LOAD_ATTRIBUTE(attribute, 3, float, model.meshes[meshIndex].normals)
+                // Load metallic/roughness texture
+                if (data->materials[i].pbr_metallic_roughness.metallic_roughness_texture.texture)
+                {
+                    cgltf_texture *texMetallicRoughness = data->materials[i].pbr_metallic_roughness.metallic_roughness_texture.texture;
+                    Texture2D *cached = &batch.cachedTextures[i*MAX_MATERIAL_MAPS];
+                    Image imMetallicRoughness = { 0 };
 
-                            // Transform the normals
-                            float *normals = model.meshes[meshIndex].normals;
-                            for (unsigned int k = 0; k < attribute->count; k++)
-                            {
-                                Vector3 nt = Vector3Transform((Vector3){ normals[3*k], normals[3*k+1], normals[3*k+2] }, worldMatrixNormals);
-                                normals[3*k] = nt.x;
-                                normals[3*k+1] = nt.y;
-                                normals[3*k+2] = nt.z;
-                            }
-                        }
-                        else TRACELOG(LOG_WARNING, "MODEL: [%s] Normal attribute data format not supported, use vec3 float", fileName);
-                    }
-                    else if (mesh->primitives[p].attributes[j].type == cgltf_attribute_type_tangent)   // TANGENT, vec3, float
+                    if (cached[MATERIAL_MAP_ROUGHNESS].id > 0)
                     {
-                        cgltf_accessor *attribute = mesh->primitives[p].attributes[j].data;
-
-                        if ((attribute->type == cgltf_type_vec4) && (attribute->component_type == cgltf_component_type_r_32f))
-                        {
-                            // Init raylib mesh tangent to copy glTF attribute data
-                            model.meshes[meshIndex].tangents = (float *)RL_MALLOC(attribute->count*4*sizeof(float));
-
-                            // Load 4 components of float data type into mesh.tangents
-                            LOAD_ATTRIBUTE(attribute, 4, float, model.meshes[meshIndex].tangents)
-
-                            // Transform the tangents
-                            float *tangents = model.meshes[meshIndex].tangents;
-                            for (unsigned int k = 0; k < attribute->count; k++)
-                            {
-                                Vector3 tt = Vector3Transform((Vector3){ tangents[3*k], tangents[3*k+1], tangents[3*k+2] }, worldMatrix);
-                                tangents[3*k] = tt.x;
-                                tangents[3*k+1] = tt.y;
-                                tangents[3*k+2] = tt.z;
-                            }
-                        }
-                        else TRACELOG(LOG_WARNING, "MODEL: [%s] Tangent attribute data format not supported, use vec4 float", fileName);
+                        model.materials[j].maps[MATERIAL_MAP_ROUGHNESS].texture = cached[MATERIAL_MAP_ROUGHNESS];
+                        model.materials[j].maps[MATERIAL_MAP_METALNESS].texture = cached[MATERIAL_MAP_METALNESS];
                     }
-                    else if (mesh->primitives[p].attributes[j].type == cgltf_attribute_type_texcoord) // TEXCOORD_n, vec2, float/u8n/u16n
-                    {
-                        // Support up to 2 texture coordinates attributes
-                        float *texcoordPtr = NULL;
-
-                        cgltf_accessor *attribute = mesh->primitives[p].attributes[j].data;
-
-                        if (attribute->type == cgltf_type_vec2)
-                        {
-                            if (attribute->component_type == cgltf_component_type_r_32f)  // vec2, float
-                            {
-                                // Init raylib mesh texcoords to copy glTF attribute data
-                                texcoordPtr = (float *)RL_MALLOC(attribute->count*2*sizeof(float));
-
-                                // Load 3 components of float data type into mesh.texcoords
-                                LOAD_ATTRIBUTE(attribute, 2, float, texcoordPtr)
-                            }
-                            else if (attribute->component_type == cgltf_component_type_r_8u) // vec2, u8n
-                            {
-                                // Init raylib mesh texcoords to copy glTF attribute data
-                                texcoordPtr = (float *)RL_MALLOC(attribute->count*2*sizeof(float));
-
-                                // Load data into a temp buffer to be converted to raylib data type
-                                unsigned char *temp = (unsigned char *)RL_MALLOC(attribute->count*2*sizeof(unsigned char));
-                                LOAD_ATTRIBUTE(attribute, 2, unsigned char, temp);
-
-                                // Convert data to raylib texcoord data type (float)
-                                for (unsigned int t = 0; t < attribute->count*2; t++) texcoordPtr[t] = (float)temp[t]/255.0f;
-
-                                RL_FREE(temp);
-                            }
-                            else if (attribute->component_type == cgltf_component_type_r_16u) // vec2, u16n
-                            {
-                                // Init raylib mesh texcoords to copy glTF attribute data
-                                texcoordPtr = (float *)RL_MALLOC(attribute->count*2*sizeof(float));
-
-                                // Load data into a temp buffer to be converted to raylib data type
-                                unsigned short *temp = (unsigned short *)RL_MALLOC(attribute->count*2*sizeof(unsigned short));
-                                LOAD_ATTRIBUTE(attribute, 2, unsigned short, temp);
+                    else imMetallicRoughness = GetImageGLTF(&batch, texMetallicRoughness);
 
-                                // Convert data to raylib texcoord data type (float)
-                                for (unsigned int t = 0; t < attribute->count*2; t++) texcoordPtr[t] = (float)temp[t]/65535.0f;
-
-                                RL_FREE(temp);
-                            }
-                            else TRACELOG(LOG_WARNING, "MODEL: [%s] Texcoords attribute data format not supported", fileName);
-                        }
-                        else TRACELOG(LOG_WARNING, "MODEL: [%s] Texcoords attribute data format not supported, use vec2 float", fileName);
-
-                        int index = mesh->primitives[p].attributes[j].index;
-                        if (index == 0) model.meshes[meshIndex].texcoords = texcoordPtr;
-                        else if (index == 1) model.meshes[meshIndex].texcoords2 = texcoordPtr;
-                        else
-                        {
-                            TRACELOG(LOG_WARNING, "MODEL: [%s] No more than 2 texture coordinates attributes supported", fileName);
-                            if (texcoordPtr != NULL) RL_FREE(texcoordPtr);
-                        }
-                    }
-                    else if (mesh->primitives[p].attributes[j].type == cgltf_attribute_type_color)    // COLOR_n, vec3/vec4, float/u8n/u16n
+                    if (imMetallicRoughness.data != NULL)
                     {
-                        cgltf_accessor *attribute = mesh->primitives[p].attributes[j].data;
-
-                        // WARNING: SPECS: All components of each COLOR_n accessor element MUST be clamped to [0.0, 1.0] range
-
-                        if (attribute->type == cgltf_type_vec3)  // RGB
-                        {
-                            if (attribute->component_type == cgltf_component_type_r_8u)
-                            {
-                                // Init raylib mesh color to copy glTF attribute data
-                                model.meshes[meshIndex].colors = (unsigned char *)RL_MALLOC(attribute->count*4*sizeof(unsigned char));
-
-                                // Load data into a temp buffer to be converted to raylib data type
-                                unsigned char *temp = (unsigned char *)RL_MALLOC(attribute->count*3*sizeof(unsigned char));
-                                LOAD_ATTRIBUTE(attribute, 3, unsigned char, temp);
-
-                                // Convert data to raylib color data type (4 bytes)
-                                for (unsigned int c = 0, k = 0; c < (attribute->count*4 - 3); c += 4, k += 3)
-                                {
-                                    model.meshes[meshIndex].colors[c] = temp[k];
-                                    model.meshes[meshIndex].colors[c + 1] = temp[k + 1];
-                                    model.meshes[meshIndex].colors[c + 2] = temp[k + 2];
-                                    model.meshes[meshIndex].colors[c + 3] = 255;
-                                }
-
-                                RL_FREE(temp);
-                            }
-                            else if (attribute->component_type == cgltf_component_type_r_16u)
-                            {
-                                // Init raylib mesh color to copy glTF attribute data
-                                model.meshes[meshIndex].colors = (unsigned char *)RL_MALLOC(attribute->count*4*sizeof(unsigned char));
-
-                                // Load data into a temp buffer to be converted to raylib data type
-                                unsigned short *temp = (unsigned short *)RL_MALLOC(attribute->count*3*sizeof(unsigned short));
-                                LOAD_ATTRIBUTE(attribute, 3, unsigned short, temp);
-
-                                // Convert data to raylib color data type (4 bytes)
-                                for (unsigned int c = 0, k = 0; c < (attribute->count*4 - 3); c += 4, k += 3)
-                                {
-                                    model.meshes[meshIndex].colors[c] = (unsigned char)(((float)temp[k]/65535.0f)*255.0f);
-                                    model.meshes[meshIndex].colors[c + 1] = (unsigned char)(((float)temp[k + 1]/65535.0f)*255.0f);
-                                    model.meshes[meshIndex].colors[c + 2] = (unsigned char)(((float)temp[k + 2]/65535.0f)*255.0f);
-                                    model.meshes[meshIndex].colors[c + 3] = 255;
-                                }
+                        Image imMetallic = { 0 };
+                        Image imRoughness = { 0 };
 
-                                RL_FREE(temp);
-                            }
-                            else if (attribute->component_type == cgltf_component_type_r_32f)
-                            {
-                                // Init raylib mesh color to copy glTF attribute data
-                                model.meshes[meshIndex].colors = (unsigned char *)RL_MALLOC(attribute->count*4*sizeof(unsigned char));
+                        imMetallic.data = RL_MALLOC(imMetallicRoughness.width*imMetallicRoughness.height);
+                        imRoughness.data = RL_MALLOC(imMetallicRoughness.width*imMetallicRoughness.height);
 
-                                // Load data into a temp buffer to be converted to raylib data type
-                                float *temp = (float *)RL_MALLOC(attribute->count*3*sizeof(float));
-                                LOAD_ATTRIBUTE(attribute, 3, float, temp);
+                        imMetallic.width = imRoughness.width = imMetallicRoughness.width;
+                        imMetallic.height = imRoughness.height = imMetallicRoughness.height;
 
-                                // Convert data to raylib color data type (4 bytes)
-                                for (unsigned int c = 0, k = 0; c < (attribute->count*4 - 3); c += 4, k += 3)
-                                {
-                                    model.meshes[meshIndex].colors[c] = (unsigned char)(temp[k]*255.0f);
-                                    model.meshes[meshIndex].colors[c + 1] = (unsigned char)(temp[k + 1]*255.0f);
-                                    model.meshes[meshIndex].colors[c + 2] = (unsigned char)(temp[k + 2]*255.0f);
-                                    model.meshes[meshIndex].colors[c + 3] = 255;
-                                }
+                        imMetallic.format = imRoughness.format = PIXELFORMAT_UNCOMPRESSED_GRAYSCALE;
+                        imMetallic.mipmaps = imRoughness.mipmaps = 1;
 
-                                RL_FREE(temp);
-                            }
-                            else TRACELOG(LOG_WARNING, "MODEL: [%s] Color attribute data format not supported", fileName);
-                        }
-                        else if (attribute->type == cgltf_type_vec4) // RGBA
+                        for (int x = 0; x < imRoughness.width; x++)
                         {
-                            if (attribute->component_type == cgltf_component_type_r_8u)
-                            {
-                                // Init raylib mesh color to copy glTF attribute data
-                                model.meshes[meshIndex].colors = (unsigned char *)RL_MALLOC(attribute->count*4*sizeof(unsigned char));
-
-                                // Load 4 components of unsigned char data type into mesh.colors
-                                LOAD_ATTRIBUTE(attribute, 4, unsigned char, model.meshes[meshIndex].colors)
-                            }
-                            else if (attribute->component_type == cgltf_component_type_r_16u)
-                            {
-                                // Init raylib mesh color to copy glTF attribute data
-                                model.meshes[meshIndex].colors = (unsigned char *)RL_MALLOC(attribute->count*4*sizeof(unsigned char));
-
-                                // Load data into a temp buffer to be converted to raylib data type
-                                unsigned short *temp = (unsigned short *)RL_MALLOC(attribute->count*4*sizeof(unsigned short));
-                                LOAD_ATTRIBUTE(attribute, 4, unsigned short, temp);
-
-                                // Convert data to raylib color data type (4 bytes)
-                                for (unsigned int c = 0; c < attribute->count*4; c++) model.meshes[meshIndex].colors[c] = (unsigned char)(((float)temp[c]/65535.0f)*255.0f);
-
-                                RL_FREE(temp);
-                            }
-                            else if (attribute->component_type == cgltf_component_type_r_32f)
+                            for (int y = 0; y < imRoughness.height; y++)
                             {
-                                // Init raylib mesh color to copy glTF attribute data
-                                model.meshes[meshIndex].colors = (unsigned char *)RL_MALLOC(attribute->count*4*sizeof(unsigned char));
-
-                                // Load data into a temp buffer to be converted to raylib data type
-                                float *temp = (float *)RL_MALLOC(attribute->count*4*sizeof(float));
-                                LOAD_ATTRIBUTE(attribute, 4, float, temp);
-
-                                // Convert data to raylib color data type (4 bytes), we expect the color data normalized
-                                for (unsigned int c = 0; c < attribute->count*4; c++) model.meshes[meshIndex].colors[c] = (unsigned char)(temp[c]*255.0f);
+                                Color color = GetImageColor(imMetallicRoughness, x, y);
 
-                                RL_FREE(temp);
+                                ((unsigned char *)imRoughness.data)[y*imRoughness.width + x] = color.g; // Roughness color channel
+                                ((unsigned char *)imMetallic.data)[y*imMetallic.width + x] = color.b; // Metallic color channel
                             }
-                            else TRACELOG(LOG_WARNING, "MODEL: [%s] Color attribute data format not supported", fileName);
                         }
-                        else TRACELOG(LOG_WARNING, "MODEL: [%s] Color attribute data format not supported", fileName);
-                    }
-
-                    // NOTE: Attributes related to animations are processed separately
-                }
 
-                // Load primitive indices data (if provided)
-                if ((mesh->primitives[p].indices != NULL) && (mesh->primitives[p].indices->buffer_view != NULL))
-                {
-                    cgltf_accessor *attribute = mesh->primitives[p].indices;
-
-                    model.meshes[meshIndex].triangleCount = (int)attribute->count/3;
-
-                    if (attribute->component_type == cgltf_component_type_r_16u)
-                    {
-                        // Init raylib mesh indices to copy glTF attribute data
-                        model.meshes[meshIndex].indices = (unsigned short *)RL_MALLOC(attribute->count*sizeof(unsigned short));
+                        LoadMaterialMapTexture(&model.materials[j], MATERIAL_MAP_ROUGHNESS, imRoughness, GetSourceHashGLTF(&batch, texMetallicRoughness, MATERIAL_MAP_ROUGHNESS));
+                        LoadMaterialMapTexture(&model.materials[j], MATERIAL_MAP_METALNESS, imMetallic, GetSourceHashGLTF(&batch, texMetallicRoughness, MATERIAL_MAP_METALNESS));
 
-                        // Load unsigned short data type into mesh.indices
-                        LOAD_ATTRIBUTE(attribute, 1, unsigned short, model.meshes[meshIndex].indices)
+                        UnloadImage(imMetallicRoughness);
                     }
-                    else if (attribute->component_type == cgltf_component_type_r_8u)
-                    {
-                        // Init raylib mesh indices to copy glTF attribute data
-                        model.meshes[meshIndex].indices = (unsigned short *)RL_MALLOC(attribute->count*sizeof(unsigned short));
-                        LOAD_ATTRIBUTE_CAST(attribute, 1, unsigned char, model.meshes[meshIndex].indices, unsigned short)
 
-                    }
-                    else if (attribute->component_type == cgltf_component_type_r_32u)
-                    {
-                        // Init raylib mesh indices to copy glTF attribute data
-                        model.meshes[meshIndex].indices = (unsigned short *)RL_MALLOC(attribute->count*sizeof(unsigned short));
-                        LOAD_ATTRIBUTE_CAST(attribute, 1, unsigned int, model.meshes[meshIndex].indices, unsigned short);
+                    // Load metallic/roughness material properties
+                    float roughness = data->materials[i].pbr_metallic_roughness.roughness_factor;
+                    model.materials[j].maps[MATERIAL_MAP_ROUGHNESS].value = roughness;
 
-                        TRACELOG(LOG_WARNING, "MODEL: [%s] Indices data converted from u32 to u16, possible loss of data", fileName);
-                    }
-                    else
-                    {
-                        TRACELOG(LOG_WARNING, "MODEL: [%s] Indices data format not supported, use u16", fileName);
-                    }
+                    float metallic = data->materials[i].pbr_metallic_roughness.metallic_factor;
+                    model.materials[j].maps[MATERIAL_MAP_METALNESS].value = metallic;
                 }
-                else model.meshes[meshIndex].triangleCount = model.meshes[meshIndex].vertexCount/3;    // Unindexed mesh
 
-                // Assign to the primitive mesh the corresponding material index
-                // NOTE: If no material defined, mesh uses the already assigned default material (index: 0)
-                for (unsigned int m = 0; m < data->materials_count; m++)
+                // Load normal texture
+                if (data->materials[i].normal_texture.texture)
                 {
-                    // The primitive actually keeps the pointer to the corresponding material,
-                    // raylib instead assigns to the mesh the by its index, as loaded in model.materials array
-                    // To get the index, we check if material pointers match, and we assign the corresponding index,
-                    // skipping index 0, the default material
-                    if (&data->materials[m] == mesh->primitives[p].material)
-                    {
-                        model.meshMaterial[meshIndex] = m + 1;
-                        break;
-                    }
+                    LoadMaterialMapGLTF(&batch, &model.materials[j], i, MATERIAL_MAP_NORMAL, data->materials[i].normal_texture.texture);
                 }
 
-                meshIndex++;       // Move to next mesh
+                // Load ambient occlusion texture
+                if (data->materials[i].occlusion_texture.texture)
+                {
+                    LoadMaterialMapGLTF(&batch, &model.materials[j], i, MATERIAL_MAP_OCCLUSION, data->materials[i].occlusion_texture.texture);
+                }
+
+                // Load emissive texture
+                if (data->materials[i].emissive_texture.texture)
+                {
+                    LoadMaterialMapGLTF(&batch, &model.materials[j], i, MATERIAL_MAP_EMISSION, data->materials[i].emissive_texture.texture);
+
+                    // Load emissive color factor
+                    model.materials[j].maps[MATERIAL_MAP_EMISSION].color.r = (unsigned char)(data->materials[i].emissive_factor[0]*255);
+                    model.materials[j].maps[MATERIAL_MAP_EMISSION].color.g = (unsigned char)(data->materials[i].emissive_factor[1]*255);
+                    model.materials[j].maps[MATERIAL_MAP_EMISSION].color.b = (unsigned char)(data->materials[i].emissive_factor[2]*255);
+                    model.materials[j].maps[MATERIAL_MAP_EMISSION].color.a = 255;
+                }
             }
+
+            // Other possible materials not supported by raylib pipeline:
+            // has_clearcoat, has_transmission, has_volume, has_ior, has specular, has_sheen
         }
 
+        for (unsigned int i = 0; i < data->images_count; i++) UnloadImage(batch.images[i]);
+        RL_FREE(batch.texPath);
+        RL_FREE(batch.images);
+        RL_FREE(batch.imageUses);
+        RL_FREE(batch.imageHashes);
+        RL_FREE(batch.cachedTextures);
+        RL_FREE(batch.decodeIndices);
+        RL_FREE(batch.primitives);
+
         // Load glTF meshes animation data
         // REF: https://www.khronos.org/registry/glTF/specs/2.0/glTF-2.0.html#skins
         // REF: https://www.khronos.org/registry/glTF/specs/2.0/glTF-2.0.html#skinned-mesh-attributes
@@ -6042,7 +7857,7 @@ static Model LoadGLTF(const char *fileName)
     else TRACELOG(LOG_WARNING, "MODEL: [%s] Failed to load glTF data", fileName);
 
     // WARNING: cgltf requires the file pointer available while reading data
-    UnloadFileData(fileData);
+    UnloadFileDataMapped(fileData);
 
     return model;
 }
@@ -6188,7 +8003,7 @@ static ModelAnimation *LoadModelAnimationsGLTF(const char *fileName, int *animCo
 {
     // glTF file loading
     int dataSize = 0;
-    unsigned char *fileData = LoadFileData(fileName, &dataSize);
+    unsigned char *fileData = LoadFileDataMapped(fileName, &dataSize);
 
     ModelAnimation *animations = NULL;
 
@@ -6350,7 +8165,7 @@ static ModelAnimation *LoadModelAnimationsGLTF(const char *fileName, int *animCo
 
         cgltf_free(data);
     }
-    UnloadFileData(fileData);
+    UnloadFileDataMapped(fileData);
     return animations;
 }
 #endif
@@ -6730,12 +8545,12 @@ static Model LoadM3D(const char *fileName)
 
                             switch (prop->type)
                             {
-                                case m3dp_map_Kd: model.materials[i + 1].maps[MATERIAL_MAP_DIFFUSE].texture = LoadTextureFromImage(image); break;
-                                case m3dp_map_Ks: model.materials[i + 1].maps[MATERIAL_MAP_SPECULAR].texture = LoadTextureFromImage(image); break;
-                                case m3dp_map_Ke: model.materials[i + 1].maps[MATERIAL_MAP_EMISSION].texture = LoadTextureFromImage(image); break;
-                                case m3dp_map_Km: model.materials[i + 1].maps[MATERIAL_MAP_NORMAL].texture = LoadTextureFromImage(image); break;
-                                case m3dp_map_Ka: model.materials[i + 1].maps[MATERIAL_MAP_OCCLUSION].texture = LoadTextureFromImage(image); break;
-                                case m3dp_map_Pm: model.materials[i + 1].maps[MATERIAL_MAP_ROUGHNESS].texture = LoadTextureFromImage(image); break;
+                                case m3dp_map_Kd: LoadMaterialMapTexture(&model.materials[i + 1], MATERIAL_MAP_DIFFUSE, ImageCopy(image), 0); break;
+                                case m3dp_map_Ks: LoadMaterialMapTexture(&model.materials[i + 1], MATERIAL_MAP_SPECULAR, ImageCopy(image), 0); break;
+                                case m3dp_map_Ke: LoadMaterialMapTexture(&model.materials[i + 1], MATERIAL_MAP_EMISSION, ImageCopy(image), 0); break;
+                                case m3dp_map_Km: LoadMaterialMapTexture(&model.materials[i + 1], MATERIAL_MAP_NORMAL, ImageCopy(image), 0); break;
+                                case m3dp_map_Ka: LoadMaterialMapTexture(&model.materials[i + 1], MATERIAL_MAP_OCCLUSION, ImageCopy(image), 0); break;
+                                case m3dp_map_Pm: LoadMaterialMapTexture(&model.materials[i + 1], MATERIAL_MAP_ROUGHNESS, ImageCopy(image), 0); break;
                                 default: break;
                             }
                         }
@@ -6927,4 +8742,550 @@ static ModelAnimation *LoadModelAnimationsM3D(const char *fileName, int *animCou
 }
 #endif
 
+#if defined(SUPPORT_FILEFORMAT_RMDL)
+// Get interleaved vertex size for provided optional attributes
+static int GetVertexStrideRMDL(unsigned int attributes)
+{
+    int stride = (3 + 2)*sizeof(float);         // Position and texcoord always available
+
+    if (attributes & RMDL_ATTRIB_NORMAL) stride += 3*sizeof(float);
+    if (attributes & RMDL_ATTRIB_COLOR) stride += 4*sizeof(unsigned char);
+    if (attributes & RMDL_ATTRIB_TANGENT) stride += 4*sizeof(float);
+    if (attributes & RMDL_ATTRIB_TEXCOORD2) stride += 2*sizeof(float);
+
+    return stride;
+}
+
+// Get texture pixel data size including all mipmap levels (0 if mipmap levels not valid for size)
+static size_t GetPixelDataSizeRMDL(int width, int height, int format, int mipmaps)
+{
+    size_t dataSize = 0;
+
+    for (int i = 0; i < mipmaps; i++)
+    {
+        // Mipmap levels end at 1x1
+        if ((i > 0) && (width == 1) && (height == 1)) return 0;
+
+        dataSize += GetPixelDataSize(width, height, format);
+
+        if (width > 1) width /= 2;
+        if (height > 1) height /= 2;
+    }
+
+    return dataSize;
+}
+
+// Load RMDL model cache data
+// NOTE: File is loaded with a single read, vertex and index data is uploaded to GPU as stored,
+// no CPU copy of vertex data is kept (mesh bounds are available through GetMeshBoundingBox())
+static Model LoadRMDL(const char *fileName)
+{
+    Model model = { 0 };
+
+    int dataSize = 0;
+    unsigned char *fileData = LoadFileDataMapped(fileName, &dataSize);
+
+    if (fileData == NULL) return model;
+
+    RMDLHeader *header = (RMDLHeader *)fileData;
+    RMDLMesh *meshes = (RMDLMesh *)(fileData + sizeof(RMDLHeader));
+    RMDLMaterial *materials = NULL;
+
+    // Validate header and tables
+    bool valid = ((unsigned int)dataSize >= sizeof(RMDLHeader)) && (memcmp(header->id, "rMDL", 4) == 0) &&
+                 (header->version == RMDL_FILE_VERSION) && (header->fileSize == (unsigned int)dataSize) &&
+                 (header->meshCount > 0) && (header->materialCount >= 0) &&
+                 (sizeof(RMDLHeader) + (size_t)header->meshCount*sizeof(RMDLMesh) + (size_t)header->materialCount*sizeof(RMDLMaterial) <= (size_t)dataSize);
+
+    if (valid)
+    {
+        materials = (RMDLMaterial *)(fileData + sizeof(RMDLHeader) + header->meshCount*sizeof(RMDLMesh));
+
+        for (int i = 0; valid && (i < header->meshCount); i++)
+        {
+            RMDLMesh *info = &meshes[i];
+
+            valid = (info->vertexCount > 0) && (info->vertexCount <= 65536) && (info->indexCount > 0) && (info->indexCount%3 == 0) &&
+                    (info->vertexStride == GetVertexStrideRMDL(info->attributes)) &&
+                    (info->materialIndex >= 0) && ((info->materialIndex < header->materialCount) || (header->materialCount == 0)) &&
+                    ((size_t)info->vertexOffset + (size_t)info->vertexCount*info->vertexStride <= (size_t)dataSize) &&
+                    ((size_t)info->indexOffset + (size_t)info->indexCount*sizeof(unsigned short) <= (size_t)dataSize) &&
+                    (info->vertexOffset%RMDL_DATA_ALIGNMENT == 0) && (info->indexOffset%RMDL_DATA_ALIGNMENT == 0);
+
+            // Every index must reference a stored vertex
+            const unsigned short *indices = (const unsigned short *)(fileData + info->indexOffset);
+            for (int k = 0; valid && (k < info->indexCount); k++) valid = (indices[k] < info->vertexCount);
+        }
+
+        for (int i = 0; valid && (i < header->materialCount); i++)
+        {
+            for (int j = 0; valid && (j < RMDL_MATERIAL_MAPS); j++)
+            {
+                RMDLMaterialMap *map = &materials[i].maps[j];
+                valid = (map->dataSize == 0) || ((map->width > 0) && (map->height > 0) && (map->mipmaps > 0) &&
+                        (map->format >= PIXELFORMAT_UNCOMPRESSED_GRAYSCALE) && (map->format <= PIXELFORMAT_COMPRESSED_ASTC_8x8_RGBA) &&
+                        (map->dataSize == GetPixelDataSizeRMDL(map->width, map->height, map->format, map->mipmaps)) &&
+                        ((size_t)map->dataOffset + map->dataSize <= (size_t)dataSize));
+            }
+        }
+    }
+
+    if (!valid)
+    {
+        TRACELOG(LOG_WARNING, "MODEL: [%s] Model cache file not valid (expected version: %i)", fileName, RMDL_FILE_VERSION);
+        UnloadFileDataMapped(fileData);
+        return model;
+    }
+
+    model.meshCount = header->meshCount;
+    model.meshes = (Mesh *)RL_CALLOC(model.meshCount, sizeof(Mesh));
+    model.meshMaterial = (int *)RL_CALLOC(model.meshCount, sizeof(int));
+
+    for (int i = 0; i < model.meshCount; i++)
+    {
+        RMDLMesh *info = &meshes[i];
+        Mesh *mesh = &model.meshes[i];
+        const unsigned char *vertices = fileData + info->vertexOffset;
+        const unsigned short *indices = (const unsigned short *)(fileData + info->indexOffset);
+
+        mesh->vertexCount = info->vertexCount;
+        mesh->triangleCount = info->indexCount/3;
+        model.meshMaterial[i] = info->materialIndex;
+
+        // NOTE: On model data loading (no GPU access) vertex data is kept in RAM, uploaded by UploadModel()
+        if (!modelUploadDeferred) mesh->vaoId = rlLoadVertexArray();
+
+        if (mesh->vaoId > 0)
+        {
+            // Single interleaved vertex buffer, every attribute is sourced from it (stride and offset)
+            // NOTE: Other vboId slots remain 0, so the buffer is only unloaded once by UnloadMesh()
+            mesh->vboId = (unsigned int *)RL_CALLOC(MAX_MESH_VERTEX_BUFFERS, sizeof(unsigned int));
+
+            rlEnableVertexArray(mesh->vaoId);
+
+            int stride = info->vertexStride;
+            int offset = 0;
+
+            mesh->vboId[RL_DEFAULT_SHADER_ATTRIB_LOCATION_POSITION] = rlLoadVertexBuffer(vertices, info->vertexCount*stride, false);
+            rlSetVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_POSITION, 3, RL_FLOAT, 0, stride, offset);
+            rlEnableVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_POSITION);
+            offset += 3*sizeof(float);
+
+            rlSetVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD, 2, RL_FLOAT, 0, stride, offset);
+            rlEnableVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD);
+            offset += 2*sizeof(float);
+
+            if (info->attributes & RMDL_ATTRIB_NORMAL)
+            {
+                rlSetVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_NORMAL, 3, RL_FLOAT, 0, stride, offset);
+                rlEnableVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_NORMAL);
+                offset += 3*sizeof(float);
+            }
+            else
+            {
+                float value[3] = { 0.0f, 0.0f, 1.0f };
+                rlSetVertexAttributeDefault(RL_DEFAULT_SHADER_ATTRIB_LOCATION_NORMAL, value, SHADER_ATTRIB_VEC3, 3);
+                rlDisableVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_NORMAL);
+            }
+
+            if (info->attributes & RMDL_ATTRIB_COLOR)
+            {
+                rlSetVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_COLOR, 4, RL_UNSIGNED_BYTE, 1, stride, offset);
+                rlEnableVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_COLOR);
+                offset += 4*sizeof(unsigned char);
+            }
+            else
+            {
+                float value[4] = { 1.0f, 1.0f, 1.0f, 1.0f };    // WHITE
+                rlSetVertexAttributeDefault(RL_DEFAULT_SHADER_ATTRIB_LOCATION_COLOR, value, SHADER_ATTRIB_VEC4, 4);
+                rlDisableVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_COLOR);
+            }
+
+            if (info->attributes & RMDL_ATTRIB_TANGENT)
+            {
+                rlSetVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TANGENT, 4, RL_FLOAT, 0, stride, offset);
+                rlEnableVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TANGENT);
+                offset += 4*sizeof(float);
+            }
+            else
+            {
+                float value[4] = { 1.0f, 0.0f, 0.0f, 1.0f };
+                rlSetVertexAttributeDefault(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TANGENT, value, SHADER_ATTRIB_VEC4, 4);
+                rlDisableVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TANGENT);
+            }
+
+            if (info->attributes & RMDL_ATTRIB_TEXCOORD2)
+            {
+                rlSetVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD2, 2, RL_FLOAT, 0, stride, offset);
+                rlEnableVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD2);
+            }
+            else
+            {
+                float value[2] = { 0.0f, 0.0f };
+                rlSetVertexAttributeDefault(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD2, value, SHADER_ATTRIB_VEC2, 2);
+                rlDisableVertexAttribute(RL_DEFAULT_SHADER_ATTRIB_LOCATION_TEXCOORD2);
+            }
+
+            mesh->vboId[RL_DEFAULT_SHADER_ATTRIB_LOCATION_INDICES] = rlLoadVertexBufferElement(indices, info->indexCount*sizeof(unsigned short), false);
+
+            rlDisableVertexArray();
+
+            // Keep mesh precomputed bounds, indexed by VAO id
+            if (mesh->vaoId >= (unsigned int)meshBoundsCount)
+            {
+                int count = mesh->vaoId + 64;
+                meshBounds = (MeshBounds *)RL_REALLOC(meshBounds, count*sizeof(MeshBounds));
+                memset(meshBounds + meshBoundsCount, 0, (count - meshBoundsCount)*sizeof(MeshBounds));
+                meshBoundsCount = count;
+            }
+
+            meshBounds[mesh->vaoId].vaoId = mesh->vaoId;
+            meshBounds[mesh->vaoId].bounds = info->bounds;
+            meshBoundsLoaded++;
+
+            TRACELOG(LOG_INFO, "VAO: [ID %i] Mesh uploaded successfully to VRAM (GPU) from model cache", mesh->vaoId);
+        }
+        else
+        {
+            // No VAO support or deferred upload: de-interleave vertex data into mesh arrays, uploaded by UploadModel()
+            unsigned int attributes = info->attributes;
+
+            mesh->vertices = (float *)RL_MALLOC(mesh->vertexCount*3*sizeof(float));
+            mesh->texcoords = (float *)RL_MALLOC(mesh->vertexCount*2*sizeof(float));
+            if (attributes & RMDL_ATTRIB_NORMAL) mesh->normals = (float *)RL_MALLOC(mesh->vertexCount*3*sizeof(float));
+            if (attributes & RMDL_ATTRIB_COLOR) mesh->colors = (unsigned char *)RL_MALLOC(mesh->vertexCount*4*sizeof(unsigned char));
+            if (attributes & RMDL_ATTRIB_TANGENT) mesh->tangents = (float *)RL_MALLOC(mesh->vertexCount*4*sizeof(float));
+            if (attributes & RMDL_ATTRIB_TEXCOORD2) mesh->texcoords2 = (float *)RL_MALLOC(mesh->vertexCount*2*sizeof(float));
+            mesh->indices = (unsigned short *)RL_MALLOC(info->indexCount*sizeof(unsigned short));
+
+            for (int v = 0; v < mesh->vertexCount; v++)
+            {
+                const unsigned char *vertex = vertices + v*info->vertexStride;
+
+                memcpy(mesh->vertices + v*3, vertex, 3*sizeof(float)); vertex += 3*sizeof(float);
+                memcpy(mesh->texcoords + v*2, vertex, 2*sizeof(float)); vertex += 2*sizeof(float);
+                if (mesh->normals != NULL) { memcpy(mesh->normals + v*3, vertex, 3*sizeof(float)); vertex += 3*sizeof(float); }
+                if (mesh->colors != NULL) { memcpy(mesh->colors + v*4, vertex, 4*sizeof(unsigned char)); vertex += 4*sizeof(unsigned char); }
+                if (mesh->tangents != NULL) { memcpy(mesh->tangents + v*4, vertex, 4*sizeof(float)); vertex += 4*sizeof(float); }
+                if (mesh->texcoords2 != NULL) memcpy(mesh->texcoords2 + v*2, vertex, 2*sizeof(float));
+            }
+
+            memcpy(mesh->indices, indices, info->indexCount*sizeof(unsigned short));
+        }
+    }
+
+    // Load materials, textures pixel data is uploaded as stored
+    // NOTE: If no material is stored, LoadModel() assigns the default material
+    if (header->materialCount > 0)
+    {
+        model.materialCount = header->materialCount;
+        model.materials = (Material *)RL_CALLOC(model.materialCount, sizeof(Material));
+
+        for (int i = 0; i < model.materialCount; i++)
+        {
+            model.materials[i] = LoadMaterialDefault();
+
+            for (int j = 0; (j < RMDL_MATERIAL_MAPS) && (j < MAX_MATERIAL_MAPS); j++)
+            {
+                RMDLMaterialMap *map = &materials[i].maps[j];
+
+                model.materials[i].maps[j].color = (Color){ map->color[0], map->color[1], map->color[2], map->color[3] };
+                model.materials[i].maps[j].value = map->value;
+
+                if (map->dataSize == 0) continue;
+
+                Image image = { 0 };
+                image.data = fileData + map->dataOffset;
+                image.width = map->width;
+                image.height = map->height;
+                image.mipmaps = map->mipmaps;
+                image.format = map->format;
+
+                unsigned long long sourceHash = 0;
+#if defined(SUPPORT_MODEL_RESOURCE_CACHE)
+                // Texture already loaded from identical pixel data is shared, no copy or upload required
+                sourceHash = HashData(image.data, map->dataSize, 0);
+#endif
+                Texture2D texture = GetCachedTexture(sourceHash);
+
+                if (texture.id > 0) model.materials[i].maps[j].texture = texture;
+                else if (modelUploadDeferred)
+                {
+                    // Pixel data is copied, file data is unloaded before upload
+                    image.data = RL_MALLOC(map->dataSize);
+                    memcpy(image.data, fileData + map->dataOffset, map->dataSize);
+
+                    LoadMaterialMapTexture(&model.materials[i], j, image, sourceHash);
+                }
+                else
+                {
+                    texture = LoadTextureCached(image, sourceHash);
+
+                    if (texture.id > 0) model.materials[i].maps[j].texture = texture;
+                }
+            }
+
+            for (int p = 0; p < 4; p++) model.materials[i].params[p] = materials[i].params[p];
+        }
+    }
+
+    UnloadFileDataMapped(fileData);
+
+    TRACELOG(LOG_INFO, "MODEL: [%s] Model cache loaded successfully (%i meshes, %i materials)", fileName, model.meshCount, model.materialCount);
+
+    return model;
+}
+
+// Export RMDL model cache data
+// NOTE: Mesh vertex data is interleaved and welded (duplicate vertices removed), vertices
+// are stored in first use order to improve vertex fetch locality, textures are read back from GPU
+static bool ExportRMDL(Model model, const char *fileName)
+{
+    if ((model.meshCount <= 0) || (model.meshes == NULL))
+    {
+        TRACELOG(LOG_WARNING, "MODEL: [%s] Model cache requires model meshes", fileName);
+        return false;
+    }
+
+    if (model.boneCount > 0)
+    {
+        TRACELOG(LOG_WARNING, "MODEL: [%s] Model cache does not support skinned models", fileName);
+        return false;
+    }
+
+    int materialCount = (model.materials != NULL)? model.materialCount : 0;
+
+    RMDLMesh *meshes = (RMDLMesh *)RL_CALLOC(model.meshCount, sizeof(RMDLMesh));
+    RMDLMaterial *materials = (RMDLMaterial *)RL_CALLOC((materialCount > 0)? materialCount : 1, sizeof(RMDLMaterial));
+    unsigned char **vertexData = (unsigned char **)RL_CALLOC(model.meshCount, sizeof(unsigned char *));
+    unsigned short **indexData = (unsigned short **)RL_CALLOC(model.meshCount, sizeof(unsigned short *));
+    Image *images = (Image *)RL_CALLOC(((materialCount > 0)? materialCount : 1)*RMDL_MATERIAL_MAPS, sizeof(Image));
+    bool success = true;
+
+    BoundingBox modelBounds = { 0 };
+
+    for (int m = 0; success && (m < model.meshCount); m++)
+    {
+        Mesh mesh = model.meshes[m];
+        RMDLMesh *info = &meshes[m];
+
+        if ((mesh.vertices == NULL) || (mesh.vertexCount <= 0))
+        {
+            TRACELOG(LOG_WARNING, "MODEL: [%s] Mesh %i has no CPU vertex data available", fileName, m);
+            success = false;
+            break;
+        }
+
+        info->attributes = 0;
+        if (mesh.normals != NULL) info->attributes |= RMDL_ATTRIB_NORMAL;
+        if (mesh.colors != NULL) info->attributes |= RMDL_ATTRIB_COLOR;
+        if (mesh.tangents != NULL) info->attributes |= RMDL_ATTRIB_TANGENT;
+        if (mesh.texcoords2 != NULL) info->attributes |= RMDL_ATTRIB_TEXCOORD2;
+        info->vertexStride = GetVertexStrideRMDL(info->attributes);
+        info->materialIndex = ((model.meshMaterial != NULL) && (model.meshMaterial[m] < materialCount))? model.meshMaterial[m] : 0;
+
+        int stride = info->vertexStride;
+        int indexCount = (mesh.indices != NULL)? mesh.triangleCount*3 : mesh.vertexCount - mesh.vertexCount%3;
+
+        // Interleave source vertices
+        unsigned char *source = (unsigned char *)RL_CALLOC(mesh.vertexCount, stride);
+
+        for (int v = 0; v < mesh.vertexCount; v++)
+        {
+            unsigned char *vertex = source + v*stride;
+
+            memcpy(vertex, mesh.vertices + v*3, 3*sizeof(float)); vertex += 3*sizeof(float);
+            if (mesh.texcoords != NULL) memcpy(vertex, mesh.texcoords + v*2, 2*sizeof(float));
+            vertex += 2*sizeof(float);
+            if (mesh.normals != NULL) { memcpy(vertex, mesh.normals + v*3, 3*sizeof(float)); vertex += 3*sizeof(float); }
+            if (mesh.colors != NULL) { memcpy(vertex, mesh.colors + v*4, 4*sizeof(unsigned char)); vertex += 4*sizeof(unsigned char); }
+            if (mesh.tangents != NULL) { memcpy(vertex, mesh.tangents + v*4, 4*sizeof(float)); vertex += 4*sizeof(float); }
+            if (mesh.texcoords2 != NULL) memcpy(vertex, mesh.texcoords2 + v*2, 2*sizeof(float));
+        }
+
+        // Weld identical vertices, output vertices in first use order
+        // NOTE: Open addressing hash table, stores output vertex index + 1 (0: empty slot)
+        int tableSize = 1;
+        while (tableSize < 2*indexCount) tableSize <<= 1;
+
+        int *table = (int *)RL_CALLOC(tableSize, sizeof(int));
+        unsigned char *output = (unsigned char *)RL_MALLOC((size_t)((indexCount > 0)? indexCount : 1)*stride);
+        unsigned short *indices = (unsigned short *)RL_MALLOC(((indexCount > 0)? indexCount : 1)*sizeof(unsigned short));
+        int outputCount = 0;
+
+        for (int i = 0; i < indexCount; i++)
+        {
+            int index = (mesh.indices != NULL)? mesh.indices[i] : i;
+            const unsigned char *vertex = source + index*stride;
+
+            unsigned int hash = 2166136261u;        // FNV-1a
+            for (int b = 0; b < stride; b++) hash = (hash ^ vertex[b])*16777619u;
+
+            int slot = (int)(hash & (unsigned int)(tableSize - 1));
+            while ((table[slot] != 0) && (memcmp(output + (table[slot] - 1)*stride, vertex, stride) != 0)) slot = (slot + 1) & (tableSize - 1);
+
+            if (table[slot] == 0)
+            {
+                if (outputCount >= 65536) { success = false; break; }
+
+                memcpy(output + outputCount*stride, vertex, stride);
+                table[slot] = ++outputCount;
+            }
+
+            indices[i] = (unsigned short)(table[slot] - 1);
+        }
+
+        RL_FREE(table);
+        RL_FREE(source);
+
+        if (!success || (indexCount == 0))
+        {
+            TRACELOG(LOG_WARNING, "MODEL: [%s] Mesh %i can not be indexed with 16bit indices", fileName, m);
+            RL_FREE(output);
+            RL_FREE(indices);
+            success = false;
+            break;
+        }
+
+        // Compute mesh bounds
+        Vector3 position = { 0 };
+        memcpy(&position, output, sizeof(Vector3));
+        info->bounds.min = position;
+        info->bounds.max = position;
+
+        for (int v = 1; v < outputCount; v++)
+        {
+            memcpy(&position, output + v*stride, sizeof(Vector3));
+            info->bounds.min = Vector3Min(info->bounds.min, position);
+            info->bounds.max = Vector3Max(info->bounds.max, position);
+        }
+
+        if (m == 0) modelBounds = info->bounds;
+        else
+        {
+            modelBounds.min = Vector3Min(modelBounds.min, info->bounds.min);
+            modelBounds.max = Vector3Max(modelBounds.max, info->bounds.max);
+        }
+
+        info->vertexCount = outputCount;
+        info->indexCount = indexCount;
+        vertexData[m] = output;
+        indexData[m] = indices;
+
+        TRACELOG(LOG_INFO, "MODEL: [%s] Mesh %i: %i vertices welded into %i (%i bytes/vertex)", fileName, m, mesh.vertexCount, outputCount, stride);
+    }
+
+    // Read back material textures pixel data
+    for (int i = 0; success && (i < materialCount); i++)
+    {
+        for (int j = 0; (j < RMDL_MATERIAL_MAPS) && (j < MAX_MATERIAL_MAPS); j++)
+        {
+            MaterialMap map = model.materials[i].maps[j];
+            RMDLMaterialMap *info = &materials[i].maps[j];
+
+            info->color[0] = map.color.r;
+            info->color[1] = map.color.g;
+            info->color[2] = map.color.b;
+            info->color[3] = map.color.a;
+            info->value = map.value;
+
+            // NOTE: Default texture is not stored, it is assigned on loading
+            if ((map.texture.id > 0) && (map.texture.id != rlGetTextureIdDefault()))
+            {
+                Image image = LoadImageFromTexture(map.texture);
+
+                if (image.data != NULL)
+                {
+                    images[i*RMDL_MATERIAL_MAPS + j] = image;
+                    info->width = image.width;
+                    info->height = image.height;
+                    info->mipmaps = image.mipmaps;
+                    info->format = image.format;
+                    info->dataSize = GetPixelDataSize(image.width, image.height, image.format);
+                }
+            }
+        }
+
+        for (int p = 0; p < 4; p++) materials[i].params[p] = model.materials[i].params[p];
+    }
+
+    if (success)
+    {
+        // Compute data offsets, every data block is aligned
+        #define RMDL_ALIGN(offset) (((offset) + RMDL_DATA_ALIGNMENT - 1)/RMDL_DATA_ALIGNMENT*RMDL_DATA_ALIGNMENT)
+
+        size_t fileSize = RMDL_ALIGN(sizeof(RMDLHeader) + model.meshCount*sizeof(RMDLMesh) + materialCount*sizeof(RMDLMaterial));
+
+        for (int m = 0; m < model.meshCount; m++)
+        {
+            meshes[m].vertexOffset = (unsigned int)fileSize;
+            fileSize = RMDL_ALIGN(fileSize + (size_t)meshes[m].vertexCount*meshes[m].vertexStride);
+            meshes[m].indexOffset = (unsigned int)fileSize;
+            fileSize = RMDL_ALIGN(fileSize + (size_t)meshes[m].indexCount*sizeof(unsigned short));
+        }
+
+        for (int i = 0; i < materialCount*RMDL_MATERIAL_MAPS; i++)
+        {
+            RMDLMaterialMap *info = &materials[i/RMDL_MATERIAL_MAPS].maps[i%RMDL_MATERIAL_MAPS];
+
+            if (info->dataSize > 0)
+            {
+                info->dataOffset = (unsigned int)fileSize;
+                fileSize = RMDL_ALIGN(fileSize + info->dataSize);
+            }
+        }
+
+        // Write file data
+        unsigned char *fileData = (unsigned char *)RL_CALLOC(fileSize, 1);
+        RMDLHeader header = { 0 };
+
+        memcpy(header.id, "rMDL", 4);
+        header.version = RMDL_FILE_VERSION;
+        header.meshCount = model.meshCount;
+        header.materialCount = materialCount;
+        header.bounds = modelBounds;
+        header.fileSize = (unsigned int)fileSize;
+
+        memcpy(fileData, &header, sizeof(RMDLHeader));
+        memcpy(fileData + sizeof(RMDLHeader), meshes, model.meshCount*sizeof(RMDLMesh));
+        if (materialCount > 0) memcpy(fileData + sizeof(RMDLHeader) + model.meshCount*sizeof(RMDLMesh), materials, materialCount*sizeof(RMDLMaterial));
+
+        for (int m = 0; m < model.meshCount; m++)
+        {
+            memcpy(fileData + meshes[m].vertexOffset, vertexData[m], (size_t)meshes[m].vertexCount*meshes[m].vertexStride);
+            memcpy(fileData + meshes[m].indexOffset, indexData[m], (size_t)meshes[m].indexCount*sizeof(unsigned short));
+        }
+
+        for (int i = 0; i < materialCount*RMDL_MATERIAL_MAPS; i++)
+        {
+            RMDLMaterialMap *info = &materials[i/RMDL_MATERIAL_MAPS].maps[i%RMDL_MATERIAL_MAPS];
+            if (info->dataSize > 0) memcpy(fileData + info->dataOffset, images[i].data, info->dataSize);
+        }
+
+        success = SaveFileData(fileName, fileData, (int)fileSize);
+        RL_FREE(fileData);
+
+        #undef RMDL_ALIGN
+
+        if (success) TRACELOG(LOG_INFO, "MODEL: [%s] Model cache exported successfully (%i bytes)", fileName, (int)fileSize);
+    }
+
+    for (int m = 0; m < model.meshCount; m++)
+    {
+        RL_FREE(vertexData[m]);
+        RL_FREE(indexData[m]);
+    }
+
+    for (int i = 0; i < materialCount*RMDL_MATERIAL_MAPS; i++) UnloadImage(images[i]);
+
+    RL_FREE(vertexData);
+    RL_FREE(indexData);
+    RL_FREE(images);
+    RL_FREE(meshes);
+    RL_FREE(materials);
+
+    return success;
+}
+#endif
+
 #endif      // SUPPORT_MODULE_RMODELS
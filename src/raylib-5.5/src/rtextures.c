@@ -283,16 +283,16 @@ Image LoadImage(const char *fileName)
     #define STBI_REQUIRED
 #endif
 
-    // Loading file to memory
+    // Loading file to memory (mapped, decoded in place)
     int dataSize = 0;
-    unsigned char *fileData = LoadFileData(fileName, &dataSize);
+    unsigned char *fileData = LoadFileDataMapped(fileName, &dataSize);
 
     // Loading image from memory data
     if (fileData != NULL)
     {
         image = LoadImageFromMemory(GetFileExtension(fileName), fileData, dataSize);
 
-        UnloadFileData(fileData);
+        UnloadFileDataMapped(fileData);
     }
 
     return image;
@@ -7,6 +7,10 @@
 *           Show TraceLog() output messages
 *           NOTE: By default LOG_DEBUG traces not shown
 *
+*       #define SUPPORT_WORKER_THREADS
+*           Run batches of tasks (RunWorkerTasks()) on a pool of worker threads, requires pthreads
+*           NOTE: Without it (or without pthreads available) tasks run on calling thread
+*
 *
 *   LICENSE: zlib/libpng
 *
@@ -49,12 +53,68 @@
 #include <stdarg.h>                     // Required for: va_list, va_start(), va_end()
 #include <string.h>                     // Required for: strcpy(), strcat()
 
+// Worker threads require pthreads (web builds only when compiled with -pthread)
+#if defined(SUPPORT_WORKER_THREADS) && (!defined(_WIN32) || defined(__MINGW32__)) && \
+    (!defined(__EMSCRIPTEN__) || defined(__EMSCRIPTEN_PTHREADS__))
+    #define WORKER_THREADS_ENABLED
+    #include <pthread.h>                // Required for: pthread_create(), pthread_mutex_lock(), pthread_cond_wait()...
+    #if !defined(_WIN32)
+        #include <unistd.h>             // Required for: sysconf()
+    #endif
+#endif
+
+#if defined(FILE_MAPPING_ENABLED)
+    #include <pthread.h>                // Required for: pthread_mutex_lock(), pthread_mutex_unlock()
+    #include <sys/mman.h>               // Required for: mmap(), munmap(), posix_madvise()
+    #include <sys/stat.h>               // Required for: fstat()
+    #include <fcntl.h>                  // Required for: open()
+    #include <unistd.h>                 // Required for: close()
+#endif
+
 //----------------------------------------------------------------------------------
 // Defines and Macros
 //----------------------------------------------------------------------------------
 #ifndef MAX_TRACELOG_MSG_LENGTH
     #define MAX_TRACELOG_MSG_LENGTH     256         // Max length of one trace-log message
 #endif
+#ifndef MAX_WORKER_THREADS
+    #define MAX_WORKER_THREADS            8         // Maximum number of worker threads (calling thread not included)
+#endif
+#ifndef MIN_FILE_MAPPING_SIZE
+    #define MIN_FILE_MAPPING_SIZE     65536         // Minimum file size to be mapped, smaller files are read
+#endif
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+#if defined(WORKER_THREADS_ENABLED)
+// Worker threads pool, processing one batch of tasks at a time
+typedef struct WorkerPool {
+    pthread_t threads[MAX_WORKER_THREADS];  // Worker threads
+    int threadCount;                        // Number of worker threads started
+    bool closing;                           // Worker threads requested to exit
+
+    pthread_mutex_t batchLock;              // Held by the thread running a batch
+    pthread_mutex_t lock;                   // Protects batch state
+    pthread_cond_t wakeCond;                // Signaled when a new batch starts (or on closing)
+    pthread_cond_t doneCond;                // Signaled when last task of batch is done
+
+    unsigned int batchId;                   // Current batch id, increased for every batch
+    WorkerTaskCallback callback;            // Current batch task callback
+    void *data;                             // Current batch data
+    int taskCount;                          // Current batch number of tasks
+    int nextTask;                           // Next task index to be processed
+    int doneCount;                          // Number of tasks done
+} WorkerPool;
+#endif
+
+#if defined(FILE_MAPPING_ENABLED)
+// File data mapped into memory by LoadFileDataMapped()
+typedef struct FileMapping {
+    unsigned char *data;                    // Mapped file data
+    size_t size;                            // Mapped file size in bytes
+} FileMapping;
+#endif
 
 //----------------------------------------------------------------------------------
 // Global Variables Definition
@@ -63,15 +123,32 @@ static int logTypeLevel = LOG_INFO;                 // Minimum log type level
 
 static TraceLogCallback traceLog = NULL;            // TraceLog callback function pointer
 static LoadFileDataCallback loadFileData = NULL;    // LoadFileData callback function pointer
+static UnloadFileDataCallback unloadFileData = NULL; // UnloadFileData callback function pointer
 static SaveFileDataCallback saveFileData = NULL;    // SaveFileText callback function pointer
 static LoadFileTextCallback loadFileText = NULL;    // LoadFileText callback function pointer
 static SaveFileTextCallback saveFileText = NULL;    // SaveFileText callback function pointer
 
+#if defined(FILE_MAPPING_ENABLED)
+static FileMapping *fileMappings = NULL;            // File data mapped, unmapped by UnloadFileDataMapped()
+static int fileMappingCount = 0;                    // Number of files mapped
+static pthread_mutex_t fileMappingsLock = PTHREAD_MUTEX_INITIALIZER;    // Protects fileMappings (loading threads)
+#endif
+
+#if defined(WORKER_THREADS_ENABLED)
+static WorkerPool workers = {
+    .batchLock = PTHREAD_MUTEX_INITIALIZER,
+    .lock = PTHREAD_MUTEX_INITIALIZER,
+    .wakeCond = PTHREAD_COND_INITIALIZER,
+    .doneCond = PTHREAD_COND_INITIALIZER
+};
+#endif
+
 //----------------------------------------------------------------------------------
 // Functions to set internal callbacks
 //----------------------------------------------------------------------------------
 void SetTraceLogCallback(TraceLogCallback callback) { traceLog = callback; }              // Set custom trace log
 void SetLoadFileDataCallback(LoadFileDataCallback callback) { loadFileData = callback; }  // Set custom file data loader
+void SetUnloadFileDataCallback(UnloadFileDataCallback callback) { unloadFileData = callback; }  // Set custom file data unloader
 void SetSaveFileDataCallback(SaveFileDataCallback callback) { saveFileData = callback; }  // Set custom file data saver
 void SetLoadFileTextCallback(LoadFileTextCallback callback) { loadFileText = callback; }  // Set custom file text loader
 void SetSaveFileTextCallback(SaveFileTextCallback callback) { saveFileText = callback; }  // Set custom file text saver
@@ -94,6 +171,12 @@ static fpos_t android_seek(void *cookie, fpos_t offset, int whence);
 static int android_close(void *cookie);
 #endif
 
+#if defined(WORKER_THREADS_ENABLED)
+static void *WorkerThread(void *arg);               // Worker thread main loop
+static void ProcessWorkerTasks(void);               // Process tasks of current batch until none left (lock held)
+static bool IsWorkerThread(void);                   // Check if calling thread is a worker thread
+#endif
+
 //----------------------------------------------------------------------------------
 // Module Functions Definition - Utilities
 //----------------------------------------------------------------------------------
@@ -245,11 +328,120 @@ unsigned char *LoadFileData(const char *fileName, int *dataSize)
 }
 
 // Unload file data allocated by LoadFileData()
+// NOTE: Data loaded by a custom LoadFileData callback could be owned by it (i.e. zero-copy archive entries),
+// a matching UnloadFileData callback should be set in that case
 void UnloadFileData(unsigned char *data)
 {
+    if (unloadFileData)
+    {
+        unloadFileData(data);
+        return;
+    }
+
     RL_FREE(data);
 }
 
+// Load file data mapped into memory
+// NOTE: Mapping is private (copy-on-write), data can be modified as data loaded by LoadFileData(),
+// pages are read on first access and shared with the file cache, without an intermediate copy
+// WARNING: File must not be truncated while mapped, reading beyond its new size raises SIGBUS
+unsigned char *LoadFileDataMapped(const char *fileName, int *dataSize)
+{
+#if defined(FILE_MAPPING_ENABLED)
+    // NOTE: Custom LoadFileData callback takes precedence, data is unloaded through UnloadFileData()
+    if ((fileName != NULL) && (loadFileData == NULL))
+    {
+        unsigned char *data = NULL;
+        size_t size = 0;
+        int fd = open(fileName, O_RDONLY);
+
+        if (fd != -1)
+        {
+            struct stat info = { 0 };
+
+            if ((fstat(fd, &info) == 0) && (info.st_size >= MIN_FILE_MAPPING_SIZE) && (info.st_size <= 2147483647))
+            {
+                size = (size_t)info.st_size;
+                void *mapping = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+
+                if (mapping != MAP_FAILED)
+                {
+                    data = (unsigned char *)mapping;
+                    posix_madvise(mapping, size, POSIX_MADV_WILLNEED);  // Start reading pages ahead of loader access
+                }
+            }
+
+            close(fd);      // NOTE: Mapping keeps a reference to the file
+        }
+
+        if (data != NULL)
+        {
+            pthread_mutex_lock(&fileMappingsLock);
+            FileMapping *mappings = (FileMapping *)RL_REALLOC(fileMappings, (fileMappingCount + 1)*sizeof(FileMapping));
+
+            if (mappings != NULL)
+            {
+                fileMappings = mappings;
+                fileMappings[fileMappingCount].data = data;
+                fileMappings[fileMappingCount].size = size;
+                fileMappingCount++;
+            }
+            pthread_mutex_unlock(&fileMappingsLock);
+
+            if (mappings != NULL)
+            {
+                *dataSize = (int)size;
+                TRACELOG(LOG_INFO, "FILEIO: [%s] File mapped successfully", fileName);
+
+                return data;
+            }
+
+            munmap(data, size);
+        }
+    }
+#endif
+
+    return LoadFileData(fileName, dataSize);
+}
+
+// Unload file data loaded by LoadFileDataMapped()
+void UnloadFileDataMapped(unsigned char *data)
+{
+#if defined(FILE_MAPPING_ENABLED)
+    if (data == NULL) return;
+
+    size_t size = 0;
+
+    pthread_mutex_lock(&fileMappingsLock);
+    for (int i = 0; i < fileMappingCount; i++)
+    {
+        if (fileMappings[i].data == data)
+        {
+            size = fileMappings[i].size;
+            fileMappings[i] = fileMappings[fileMappingCount - 1];
+            fileMappingCount--;
+            break;
+        }
+    }
+
+    if (fileMappingCount == 0)
+    {
+        RL_FREE(fileMappings);
+        fileMappings = NULL;
+    }
+    pthread_mutex_unlock(&fileMappingsLock);
+
+    // File data not mapped was loaded by LoadFileData()
+    if (size > 0)
+    {
+        munmap(data, size);
+        return;
+    }
+#endif
+
+    UnloadFileData(data);
+}
+
 // Save data to file from buffer
 bool SaveFileData(const char *fileName, void *data, int dataSize)
 {
@@ -438,6 +630,102 @@ bool SaveFileText(const char *fileName, const char *text)
     return success;
 }
 
+// Run a batch of tasks on worker threads and calling thread, returns when all are done
+// NOTE: Tasks run on calling thread if pool is not available, already busy with another batch
+// or if called from a worker task (nested batch)
+void RunWorkerTasks(WorkerTaskCallback callback, void *data, int taskCount)
+{
+    if ((callback == NULL) || (taskCount <= 0)) return;
+
+#if defined(WORKER_THREADS_ENABLED)
+    if ((taskCount > 1) && !IsWorkerThread() && (pthread_mutex_trylock(&workers.batchLock) == 0))
+    {
+        // Start worker threads on first batch
+        if (workers.threadCount == 0)
+        {
+    #if defined(_WIN32)
+            int cpuCount = pthread_num_processors_np();
+    #else
+            int cpuCount = (int)sysconf(_SC_NPROCESSORS_ONLN);
+    #endif
+            int count = (cpuCount > MAX_WORKER_THREADS)? MAX_WORKER_THREADS : cpuCount - 1;
+
+            workers.closing = false;
+            for (int i = 0; i < count; i++)
+            {
+                if (pthread_create(&workers.threads[workers.threadCount], NULL, WorkerThread, NULL) == 0) workers.threadCount++;
+            }
+
+            if (workers.threadCount > 0) TRACELOG(LOG_INFO, "THREADS: Worker threads started successfully (%i)", workers.threadCount);
+        }
+
+        if (workers.threadCount > 0)
+        {
+            pthread_mutex_lock(&workers.lock);
+
+            workers.callback = callback;
+            workers.data = data;
+            workers.taskCount = taskCount;
+            workers.nextTask = 0;
+            workers.doneCount = 0;
+            workers.batchId++;
+            pthread_cond_broadcast(&workers.wakeCond);
+
+            // Calling thread also processes tasks, then waits for the ones still running
+            ProcessWorkerTasks();
+            while (workers.doneCount < workers.taskCount) pthread_cond_wait(&workers.doneCond, &workers.lock);
+
+            workers.callback = NULL;
+            workers.data = NULL;
+
+            pthread_mutex_unlock(&workers.lock);
+            pthread_mutex_unlock(&workers.batchLock);
+            return;
+        }
+
+        pthread_mutex_unlock(&workers.batchLock);
+    }
+#endif
+
+    for (int i = 0; i < taskCount; i++) callback(data, i);
+}
+
+// Get number of threads processing a batch (calling thread included)
+// NOTE: Worker threads are started on first batch, before that only calling thread is counted
+int GetWorkerThreadCount(void)
+{
+#if defined(WORKER_THREADS_ENABLED)
+    return workers.threadCount + 1;
+#else
+    return 1;
+#endif
+}
+
+// Stop worker threads (started again on next batch)
+void CloseWorkerThreads(void)
+{
+#if defined(WORKER_THREADS_ENABLED)
+    pthread_mutex_lock(&workers.batchLock);
+
+    if (workers.threadCount > 0)
+    {
+        pthread_mutex_lock(&workers.lock);
+        workers.closing = true;
+        pthread_cond_broadcast(&workers.wakeCond);
+        pthread_mutex_unlock(&workers.lock);
+
+        for (int i = 0; i < workers.threadCount; i++) pthread_join(workers.threads[i], NULL);
+
+        workers.threadCount = 0;
+        workers.closing = false;
+
+        TRACELOG(LOG_INFO, "THREADS: Worker threads stopped successfully");
+    }
+
+    pthread_mutex_unlock(&workers.batchLock);
+#endif
+}
+
 #if defined(PLATFORM_ANDROID)
 // Initialize asset manager from android app
 void InitAssetManager(AAssetManager *manager, const char *dataPath)
@@ -484,6 +772,62 @@ FILE *android_fopen(const char *fileName, const char *mode)
 //----------------------------------------------------------------------------------
 // Module specific Functions Definition
 //----------------------------------------------------------------------------------
+#if defined(WORKER_THREADS_ENABLED)
+// Worker thread main loop
+static void *WorkerThread(void *arg)
+{
+    (void)arg;
+    unsigned int lastBatchId = 0;
+
+    pthread_mutex_lock(&workers.lock);
+    lastBatchId = workers.batchId;
+
+    while (!workers.closing)
+    {
+        while ((workers.batchId == lastBatchId) && !workers.closing) pthread_cond_wait(&workers.wakeCond, &workers.lock);
+        if (workers.closing) break;
+
+        lastBatchId = workers.batchId;
+        ProcessWorkerTasks();
+    }
+
+    pthread_mutex_unlock(&workers.lock);
+
+    return NULL;
+}
+
+// Process tasks of current batch until none left (lock held)
+static void ProcessWorkerTasks(void)
+{
+    while ((workers.callback != NULL) && (workers.nextTask < workers.taskCount))
+    {
+        int taskIndex = workers.nextTask++;
+        WorkerTaskCallback callback = workers.callback;
+        void *data = workers.data;
+
+        pthread_mutex_unlock(&workers.lock);
+        callback(data, taskIndex);
+        pthread_mutex_lock(&workers.lock);
+
+        workers.doneCount++;
+        if (workers.doneCount == workers.taskCount) pthread_cond_broadcast(&workers.doneCond);
+    }
+}
+
+// Check if calling thread is a worker thread
+static bool IsWorkerThread(void)
+{
+    pthread_t self = pthread_self();
+
+    for (int i = 0; i < workers.threadCount; i++)
+    {
+        if (pthread_equal(self, workers.threads[i])) return true;
+    }
+
+    return false;
+}
+#endif  // WORKER_THREADS_ENABLED
+
 #if defined(PLATFORM_ANDROID)
 static int android_read(void *cookie, char *data, int dataSize)
 {
@@ -52,10 +52,26 @@
     #define fopen(name, mode) android_fopen(name, mode)
 #endif
 
+// File data mapping requires mmap(), Android assets are read through AAssetManager
+#if defined(SUPPORT_FILE_MAPPING) && !defined(_WIN32) && !defined(__EMSCRIPTEN__) && !defined(PLATFORM_ANDROID)
+    #define FILE_MAPPING_ENABLED
+#endif
+
+// Thread local storage, used by static buffers of functions callable from loading threads
+// NOTE: Compilers without support keep a single buffer shared by all threads
+#if defined(_MSC_VER)
+    #define RL_THREAD_LOCAL __declspec(thread)
+#elif defined(__GNUC__) || defined(__clang__)
+    #define RL_THREAD_LOCAL __thread
+#else
+    #define RL_THREAD_LOCAL
+#endif
+
 //----------------------------------------------------------------------------------
 // Types and Structures Definition
 //----------------------------------------------------------------------------------
-//...
+// Worker task callback, processes task taskIndex of a batch
+typedef void (*WorkerTaskCallback)(void *data, int taskIndex);
 
 //----------------------------------------------------------------------------------
 // Global Variables Definition
@@ -74,6 +90,11 @@ void InitAssetManager(AAssetManager *manager, const char *dataPath);   // Initia
 FILE *android_fopen(const char *fileName, const char *mode);           // Replacement for fopen() -> Read-only!
 #endif
 
+// Worker threads pool
+void RunWorkerTasks(WorkerTaskCallback callback, void *data, int taskCount);  // Run a batch of tasks on worker threads and calling thread, returns when all are done
+int GetWorkerThreadCount(void);                                        // Get number of threads processing a batch (calling thread included)
+void CloseWorkerThreads(void);                                         // Stop worker threads (started again on next batch)
+
 #if defined(__cplusplus)
 }
 #endif
@@ -51,17 +51,16 @@ int main(void)
 
     InitAudioDevice();
 
-    currentScreen = TITLE;
-    kingModel = LoadModel("resources/models/king.glb");
-    pieceModels[PIECE_PAWN] = LoadModel("resources/models/pawn.glb");
-    pieceModels[PIECE_KNIGHT] = LoadModel("resources/models/knight.glb");
-    pieceModels[PIECE_BISHOP] = LoadModel("resources/models/bishop.glb");
-    pieceModels[PIECE_ROOK] = LoadModel("resources/models/rook.glb");
-    pieceModels[PIECE_QUEEN] = LoadModel("resources/models/queen.glb");
+    // Resources packed archive preferred if available, generated with: make pack
+    OpenResourceArchive("resources.pak");
+
+    // Models, music and font are loaded in the background, title screen shows loading progress
+    StartLoadingAssets();
     // woodTexture = LoadTexture("resources/images/wood.png");
     // pieceTexture = LoadTexture("resources/images/piece.png");
-    backgroundMusic = LoadMusicStream("resources/audio/background.ogg");
-    font = LoadFont("resources/images/mecha.png");
+
+    currentScreen = TITLE;
+    InitTitleScreen();
 
     DisableCursor(); // Limit cursor to relative movement inside the window
 
@@ -80,15 +79,15 @@ int main(void)
 
     // De-Initialization
     //--------------------------------------------------------------------------------------
-    UnloadFont(font);
-    UnloadMusicStream(backgroundMusic);
+    if (currentScreen == GAMEPLAY)
+        UnloadGameplayScreen(); // Stop game update thread before music and audio device are unloaded
+
+    UnloadAssets();
     // UnloadTexture(pieceTexture);
     // UnloadTexture(woodTexture);
-    for (int i = 0; i < 5; i++)
-        UnloadModel(pieceModels[i]);
-    UnloadModel(kingModel);
 
     CloseAudioDevice();
+    CloseResourceArchive();
     CloseWindow();
     //--------------------------------------------------------------------------------------
 
@@ -2,6 +2,59 @@
 #include "raymath.h"
 #include "screens.h"
 
+#include "rlgl.h" // Required for: rlViewport()
+
+#if defined(PLATFORM_WEB)
+#define GLSL_VERSION 100
+#else
+#define GLSL_VERSION 330
+#endif
+
+// Game update runs on a worker thread pipelined with drawing, except on web builds without pthreads
+#if !defined(PLATFORM_WEB) || defined(__EMSCRIPTEN_PTHREADS__)
+#define GAMEPLAY_THREADS_ENABLED
+#include <pthread.h>
+#endif
+
+//----------------------------------------------------------------------------------
+// Defines and Macros
+//----------------------------------------------------------------------------------
+// Dynamic resolution scaling of the 3D pass
+#define RENDER_SCALE_MIN 0.5f // Lowest allowed 3D render scale
+#define RENDER_SCALE_MAX 1.0f // Highest allowed 3D render scale (native)
+#define RENDER_SCALE_STEP 0.05f // Scale change applied per adjustment
+#define RENDER_TARGET_FRAME_TIME (1.0f / 60.0f) // Frame budget in seconds
+#define RENDER_SCALE_COOLDOWN 0.5f // Seconds to wait after a scale change before raising it again
+#define RENDER_SCALE_HOLD 4.0f // Seconds a scale that missed the frame budget is not raised to again
+#define RENDER_SCALE_HOLD_MAX 60.0f // Longest hold, doubled on every miss at the same scale
+#define RENDER_SHARPEN_STRENGTH 0.6f // Sharpening applied at RENDER_SCALE_MIN
+
+// Positional audio, emitters attenuated by distance to the camera
+#define AUDIO_REF_DISTANCE 30.0f // Distance heard at full volume (camera to board center)
+#define AUDIO_MAX_DISTANCE 90.0f // Distance attenuation stops at (volume clamped)
+
+//----------------------------------------------------------------------------------
+// Types and Structures Definition
+//----------------------------------------------------------------------------------
+// Input sampled on main thread for one game update, raylib input state is
+// polled by main thread while the update runs
+typedef struct GameplayInput {
+    float frameTime;
+    Vector3 movement; // Camera movement keys: forward-backward, right-left, up-down (-1..1)
+    Vector2 mouseDelta;
+    int lane; // Lane key pressed (1..3), 0 if none
+    bool spawn[5]; // Spawn key pressed, by PieceType
+} GameplayInput;
+
+// Game state required to draw a frame, published by every game update
+typedef struct GameplaySnapshot {
+    Camera camera;
+    Player player;
+    Player computer;
+    int selectedLane;
+    int finishScreen;
+} GameplaySnapshot;
+
 //----------------------------------------------------------------------------------
 // Module Variables Definition (local)
 //----------------------------------------------------------------------------------
@@ -13,31 +66,106 @@ static const int PIECE_STATS[5][3] = {
     { 500, 350, 40 } // QUEEN
 };
 
-// Game entities
+// Game entities (update thread)
 static Camera camera = { 0 };
 static Player player = { 0 };
 static Player computer = { 0 };
 
-// Required variables to manage game logic
-static bool showHelp = false;
-static bool showHitboxes = false;
+// Required variables to manage game logic (update thread)
 static int selectedLane = 0;
 static float aiSpawnTimer = 0.0f;
+static GameplayInput input = { 0 };
+
+// Manage game over (update thread)
+static int finishScreen = 0;
+
+// View settings (main thread)
+static bool showHelp = false;
+static bool showHitboxes = false;
+static bool showDebugInfo = false;
+static bool lowLatencyInput = false;
 static float kingScale = 0.0f;
 static float pieceScales[5] = { 0 };
 
-// Manage game over
-static int finishScreen = 0;
+// Double-buffered render state: frame N is drawn from the front snapshot while
+// update N+1 writes the back one, they are swapped once the update is done
+static GameplaySnapshot snapshots[2] = { 0 };
+static int frontSnapshot = 0;
+
+#if defined(GAMEPLAY_THREADS_ENABLED)
+static pthread_t updateThread;
+static bool updateThreadRunning = false;
+static bool updatePending = false; // Update requested and not finished yet
+static bool updateQuit = false;
+static pthread_mutex_t updateLock = PTHREAD_MUTEX_INITIALIZER; // Protects updatePending and updateQuit
+static pthread_cond_t updateRequested = PTHREAD_COND_INITIALIZER;
+static pthread_cond_t updateDone = PTHREAD_COND_INITIALIZER;
+#endif
+
+// Dynamic resolution: the 3D pass is rendered into a sub-rectangle of a native
+// sized render target and upscaled with a sharpening filter, the HUD is drawn on top
+static RenderTexture2D sceneTarget = { 0 };
+static Shader sharpenShader = { 0 };
+static int sharpenTexelSizeLoc = -1;
+static int sharpenStrengthLoc = -1;
+static float renderScale = RENDER_SCALE_MAX;
+static float smoothFrameTime = RENDER_TARGET_FRAME_TIME; // Smoothed total frame time
+static float smoothDrawTime = 0.0f; // Smoothed CPU time spent submitting the 3D pass
+static float scaleCooldown = 0.0f;
+static float missedScale = RENDER_SCALE_MAX; // Scale the frame budget was last missed at
+static float missedHold = 0.0f; // Seconds the missed scale is held off
+static float missedTimer = 0.0f; // Seconds left until the missed scale can be raised to again
+
+static const char* sharpenShaderCode =
+#if GLSL_VERSION == 330
+    "#version 330\n"
+    "in vec2 fragTexCoord;\n"
+    "in vec4 fragColor;\n"
+    "out vec4 finalColor;\n"
+    "#define texture2D texture\n"
+#else
+    "#version 100\n"
+    "precision mediump float;\n"
+    "varying vec2 fragTexCoord;\n"
+    "varying vec4 fragColor;\n"
+    "#define finalColor gl_FragColor\n"
+#endif
+    "uniform sampler2D texture0;\n"
+    "uniform vec4 colDiffuse;\n"
+    "uniform vec2 texelSize;\n"
+    "uniform float strength;\n"
+    "void main()\n"
+    "{\n"
+    "    vec3 c = texture2D(texture0, fragTexCoord).rgb;\n"
+    "    vec3 n = texture2D(texture0, fragTexCoord + vec2(0.0, texelSize.y)).rgb;\n"
+    "    vec3 s = texture2D(texture0, fragTexCoord - vec2(0.0, texelSize.y)).rgb;\n"
+    "    vec3 e = texture2D(texture0, fragTexCoord + vec2(texelSize.x, 0.0)).rgb;\n"
+    "    vec3 w = texture2D(texture0, fragTexCoord - vec2(texelSize.x, 0.0)).rgb;\n"
+    "    vec3 sharp = c + strength*(4.0*c - n - s - e - w);\n"
+    "    vec3 lo = min(c, min(min(n, s), min(e, w)));\n"
+    "    vec3 hi = max(c, max(max(n, s), max(e, w)));\n"
+    "    finalColor = vec4(clamp(sharp, lo, hi), 1.0)*colDiffuse*fragColor;\n"
+    "}\n";
 
 //----------------------------------------------------------------------------------
 // Local Functions Declaration
 //----------------------------------------------------------------------------------
 static void TrySpawnPiece(Player* p, PieceType type, int lane);
-static void HandleInput(void);
+static void SampleInput(GameplayInput* sample); // Read input for next update, handle view settings (main thread)
+static void HandleInput(void); // Apply sampled input to game state (update thread)
 static void UpdateAI(void);
-static void DrawHealthBar3D(Vector3 position, float modelHeight, int currentHealth, int maxHealth);
+static void UpdateGame(void); // Game update, publishes back snapshot (update thread)
+static void PublishSnapshot(GameplaySnapshot* snapshot);
+#if defined(GAMEPLAY_THREADS_ENABLED)
+static void* UpdateThread(void* arg); // Update thread, runs requested game updates until quit
+static void WaitUpdateDone(void); // Wait for requested game update to finish (main thread)
+#endif
+static void DrawHealthBar3D(Camera view, Vector3 position, float modelHeight, int currentHealth, int maxHealth);
 static void DrawHelpWindow(void);
-static void DrawPieceSelectionUI(void);
+static void DrawDebugInfo(void);
+static void DrawPieceSelectionUI(float points);
+static void LoadSceneTarget(void);
+static void UpdateRenderScale(float drawTime);
 
 //----------------------------------------------------------------------------------
 // Gameplay Screen Functions Definition
@@ -56,6 +184,7 @@ void InitGameplayScreen(void)
     camera.up = (Vector3) { 0.0f, 1.0f, 0.0f };
     camera.fovy = 45.0f;
     camera.projection = CAMERA_PERSPECTIVE;
+    SetAudioSpatialDistance(AUDIO_REF_DISTANCE, AUDIO_MAX_DISTANCE, 1.0f);
 
     // Player initialization
     player.points = 500.0f;
@@ -87,6 +216,7 @@ void InitGameplayScreen(void)
     // Game logic initialization
     showHelp = true;
     showHitboxes = false;
+    showDebugInfo = false;
     selectedLane = 0;
     aiSpawnTimer = 0.0;
     if (IsModelValid(kingModel)) {
@@ -104,20 +234,226 @@ void InitGameplayScreen(void)
         }
     }
 
+    // Dynamic resolution initialization
+    sharpenShader = LoadShaderFromMemory(0, sharpenShaderCode);
+    sharpenTexelSizeLoc = GetShaderLocation(sharpenShader, "texelSize");
+    sharpenStrengthLoc = GetShaderLocation(sharpenShader, "strength");
+    LoadSceneTarget();
+    renderScale = RENDER_SCALE_MAX;
+    smoothFrameTime = RENDER_TARGET_FRAME_TIME;
+    smoothDrawTime = 0.0f;
+    scaleCooldown = 0.0f;
+    missedScale = RENDER_SCALE_MAX;
+    missedHold = 0.0f;
+    missedTimer = 0.0f;
+
     // Game over initialization
     finishScreen = 0;
+
+    // Update pipeline initialization, first frame drawn from initial state
+    PublishSnapshot(&snapshots[0]);
+    PublishSnapshot(&snapshots[1]);
+    frontSnapshot = 0;
+    input = (GameplayInput) { 0 };
+
+#if defined(GAMEPLAY_THREADS_ENABLED)
+    updatePending = false;
+    updateQuit = false;
+    updateThreadRunning = (pthread_create(&updateThread, NULL, UpdateThread, NULL) == 0);
+    if (!updateThreadRunning)
+        TraceLog(LOG_WARNING, "GAMEPLAY: Failed to create update thread, updating on main thread");
+#endif
 }
 
 // Gameplay Screen Update logic
+// NOTE: Game update for frame N+1 runs on the update thread while main thread draws frame N,
+// frame time is the longest of update and draw instead of their sum (one frame of latency added)
 void UpdateGameplayScreen(void)
 {
+    GameplayInput sample = { 0 };
+    SampleInput(&sample);
+
+#if defined(GAMEPLAY_THREADS_ENABLED)
+    if (updateThreadRunning) {
+        WaitUpdateDone();
+        frontSnapshot = 1 - frontSnapshot;
+
+        pthread_mutex_lock(&updateLock);
+        input = sample;
+        updatePending = true;
+        pthread_cond_signal(&updateRequested);
+        pthread_mutex_unlock(&updateLock);
+        return;
+    }
+#endif
+
+    input = sample;
+    UpdateGame();
+    frontSnapshot = 1 - frontSnapshot;
+}
+
+// Gameplay Screen Draw logic
+// NOTE: Only the front snapshot and view settings are read, game state is owned by update thread
+void DrawGameplayScreen(void)
+{
+    const GameplaySnapshot* frame = &snapshots[frontSnapshot];
+
+    if ((sceneTarget.texture.width != GetRenderWidth()) || (sceneTarget.texture.height != GetRenderHeight()))
+        LoadSceneTarget();
+
+    int sceneWidth = (int)(sceneTarget.texture.width * renderScale);
+    int sceneHeight = (int)(sceneTarget.texture.height * renderScale);
+    double drawStart = GetTime();
+
+    // The whole target is cleared but only the scaled viewport is rasterized,
+    // keeping the aspect ratio (and projection) of the native resolution
+    BeginTextureMode(sceneTarget);
+    ClearBackground(SKYBLUE);
+    rlViewport(0, 0, sceneWidth, sceneHeight);
+    BeginMode3D(frame->camera);
+    DrawPlane((Vector3) { 0.0f, 0.0f, 0.0f }, (Vector2) { 50.0f, 50.0f }, DARKBROWN);
+
+    // Draw Lanes
+    for (int i = 1; i <= LANE_COUNT; i++) {
+        float laneX = (i - 2) * LANE_SPACING;
+        Color laneColor = (frame->selectedLane == i) ? Fade(GOLD, 0.5f) : Fade(DARKGRAY, 0.5f);
+        DrawCube((Vector3) { laneX, 0.1f, 0.0f }, LANE_WIDTH, 0.05f, 40.0f, laneColor);
+    }
+
+    // Draw Models
+    Vector3 kingScaleVec = { 2 * kingScale, 2 * kingScale, 2 * kingScale };
+    DrawModelEx(kingModel, frame->player.king.position, (Vector3) { 0, 1, 0 }, 0.0f, kingScaleVec, WHITE);
+    DrawModelEx(kingModel, frame->computer.king.position, (Vector3) { 0, 1, 0 }, 180.0f, kingScaleVec, BLACK);
+
+    // Pieces are drawn grouped by side and type, so consecutive draws share
+    // model buffers, textures and tint (fewer GL state changes)
+    for (int t = 0; t < 5; t++) {
+        Vector3 pScale = { pieceScales[t], pieceScales[t], pieceScales[t] };
+        for (int i = 0; i < MAX_PIECES; i++) {
+            const Piece* p = &frame->player.pieces[i];
+            if (p->active && (int)p->type == t) {
+                DrawModelEx(pieceModels[t], p->position, (Vector3) { 0, 1, 0 }, 0.0f, pScale, WHITE);
+            }
+        }
+    }
+    for (int t = 0; t < 5; t++) {
+        Vector3 pScale = { pieceScales[t], pieceScales[t], pieceScales[t] };
+        for (int i = 0; i < MAX_PIECES; i++) {
+            const Piece* p = &frame->computer.pieces[i];
+            if (p->active && (int)p->type == t) {
+                DrawModelEx(pieceModels[t], p->position, (Vector3) { 0, 1, 0 }, 180.0f, pScale, BLACK);
+            }
+        }
+    }
+
+    // Draw Debug Hitboxes (Toggle with 'B')
+    if (showHitboxes) {
+        DrawBoundingBox(frame->player.king.collisionBox, LIME);
+        DrawBoundingBox(frame->computer.king.collisionBox, LIME);
+
+        for (int i = 0; i < MAX_PIECES; i++) {
+            if (frame->player.pieces[i].active) {
+                const Piece* p = &frame->player.pieces[i];
+                BoundingBox hitbox = { { p->position.x - p->size.x / 2, p->position.y, p->position.z - p->size.z / 2 },
+                    { p->position.x + p->size.x / 2, p->position.y + p->size.y, p->position.z + p->size.z / 2 } };
+                DrawBoundingBox(hitbox, Fade(GREEN, 0.5f));
+            }
+            if (frame->computer.pieces[i].active) {
+                const Piece* p = &frame->computer.pieces[i];
+                BoundingBox hitbox = { { p->position.x - p->size.x / 2, p->position.y, p->position.z - p->size.z / 2 },
+                    { p->position.x + p->size.x / 2, p->position.y + p->size.y, p->position.z + p->size.z / 2 } };
+                DrawBoundingBox(hitbox, Fade(ORANGE, 0.5f));
+            }
+        }
+    }
+    EndMode3D();
+    EndTextureMode();
+
+    UpdateRenderScale((float)(GetTime() - drawStart));
+
+    // Upscale the 3D pass to native resolution (render texture is y-flipped)
+    Vector2 texelSize = { 1.0f / sceneTarget.texture.width, 1.0f / sceneTarget.texture.height };
+    float strength = RENDER_SHARPEN_STRENGTH * (RENDER_SCALE_MAX - renderScale) / (RENDER_SCALE_MAX - RENDER_SCALE_MIN);
+    SetShaderValue(sharpenShader, sharpenTexelSizeLoc, &texelSize, SHADER_UNIFORM_VEC2);
+    SetShaderValue(sharpenShader, sharpenStrengthLoc, &strength, SHADER_UNIFORM_FLOAT);
+    BeginShaderMode(sharpenShader);
+    DrawTexturePro(sceneTarget.texture, (Rectangle) { 0, 0, (float)sceneWidth, -(float)sceneHeight },
+        (Rectangle) { 0, 0, (float)GetScreenWidth(), (float)GetScreenHeight() }, (Vector2) { 0, 0 }, 0.0f, WHITE);
+    EndShaderMode();
+
+    // Draw UI
+    DrawHealthBar3D(frame->camera, frame->player.king.position, 2 * TARGET_KING_HEIGHT, frame->player.king.health, frame->player.king.maxHealth);
+    DrawHealthBar3D(frame->camera, frame->computer.king.position, 2 * TARGET_KING_HEIGHT, frame->computer.king.health, frame->computer.king.maxHealth);
+
+    for (int i = 0; i < MAX_PIECES; i++) {
+        const Piece* p = &frame->player.pieces[i];
+        const Piece* c = &frame->computer.pieces[i];
+        if (p->active)
+            DrawHealthBar3D(frame->camera, p->position, p->size.y, p->health, p->maxHealth);
+        if (c->active)
+            DrawHealthBar3D(frame->camera, c->position, c->size.y, c->health, c->maxHealth);
+    }
+
+    DrawRectangle(5, 5, 250, 105, Fade(SKYBLUE, 0.7f));
+    DrawRectangleLines(5, 5, 250, 105, BLUE);
+    DrawText(TextFormat("Points: %d", (int)frame->player.points), 15, 15, 20, GOLD);
+    DrawText(TextFormat("Population: %d/%d", frame->player.population, MAX_PIECES), 15, 40, 20, BLACK);
+    DrawText(TextFormat("Selected Lane: %d", frame->selectedLane), 15, 65, 20, (frame->selectedLane > 0) ? LIME : GRAY);
+    DrawText("Toggle Hitboxes: [B]", 15, 90, 15, DARKGRAY);
+    DrawFPS(GetScreenWidth() - 100, 10);
+
+    if (showDebugInfo)
+        DrawDebugInfo();
+
+    DrawPieceSelectionUI(frame->player.points);
+
+    if (showHelp)
+        DrawHelpWindow();
+}
+
+// Gameplay Screen Unload logic
+void UnloadGameplayScreen(void)
+{
+#if defined(GAMEPLAY_THREADS_ENABLED)
+    if (updateThreadRunning) {
+        pthread_mutex_lock(&updateLock);
+        updateQuit = true;
+        pthread_cond_signal(&updateRequested);
+        pthread_mutex_unlock(&updateLock);
+        pthread_join(updateThread, NULL);
+        updateThreadRunning = false;
+    }
+#endif
+
+    UnloadRenderTexture(sceneTarget);
+    UnloadShader(sharpenShader);
+    sceneTarget = (RenderTexture2D) { 0 };
+    sharpenShader = (Shader) { 0 };
+}
+
+// Gameplay Screen should finish?
+int FinishGameplayScreen(void)
+{
+    return snapshots[frontSnapshot].finishScreen;
+}
+
+//----------------------------------------------------------------------------------
+// Module specific Functions Definition
+//----------------------------------------------------------------------------------
+// Game update logic, only sampled input is read from raylib
+// NOTE: Audio functions are thread-safe, music stream and listener are updated from here
+static void UpdateGame(void)
+{
+    float frameTime = input.frameTime;
+
     UpdateMusicStream(backgroundMusic);
     HandleInput();
+    SetAudioListener(camera); // Positional audio follows the camera
     UpdateAI();
 
     // Passive points earn for player and computer
-    player.points += 2.0f * GetFrameTime();
-    computer.points += 4.0f * GetFrameTime();
+    player.points += 2.0f * frameTime;
+    computer.points += 4.0f * frameTime;
 
     // Iterate over both players (player and computer)
     Player* players[2] = { &player, &computer };
@@ -147,7 +483,7 @@ void UpdateGameplayScreen(void)
             if (CheckCollisionBoxes(pieceHitbox, opponentP->king.collisionBox)) {
                 // King attack logic
                 isBlocked = true;
-                pPiece->attackTimer += GetFrameTime();
+                pPiece->attackTimer += frameTime;
                 if (pPiece->attackTimer >= 1.0f) {
                     pPiece->attackTimer = 0.0f;
                     opponentP->king.health -= pPiece->damage;
@@ -168,7 +504,7 @@ void UpdateGameplayScreen(void)
                         if (CheckCollisionBoxes(pieceHitbox, opponentHitbox)) {
                             // Opponent piece attack logic
                             isBlocked = true;
-                            pPiece->attackTimer += GetFrameTime();
+                            pPiece->attackTimer += frameTime;
                             if (pPiece->attackTimer >= 1.0f) {
                                 pPiece->attackTimer = 0.0f;
                                 oPiece->health -= pPiece->damage;
@@ -194,7 +530,7 @@ void UpdateGameplayScreen(void)
 
             // Piece movement
             if (!isBlocked)
-                pPiece->position.z += moveDirection * pPiece->speed * GetFrameTime();
+                pPiece->position.z += moveDirection * pPiece->speed * frameTime;
 
             // Piece death
             if (pPiece->health <= 0) {
@@ -215,101 +551,54 @@ void UpdateGameplayScreen(void)
         finishScreen = 1;
         winner = HUMAN;
     }
+
+    PublishSnapshot(&snapshots[1 - frontSnapshot]);
 }
 
-// Gameplay Screen Draw logic
-void DrawGameplayScreen(void)
+// Copy game state required to draw into snapshot
+static void PublishSnapshot(GameplaySnapshot* snapshot)
 {
-    ClearBackground(SKYBLUE);
-    BeginMode3D(camera);
-    DrawPlane((Vector3) { 0.0f, 0.0f, 0.0f }, (Vector2) { 50.0f, 50.0f }, DARKBROWN);
-
-    // Draw Lanes
-    for (int i = 1; i <= LANE_COUNT; i++) {
-        float laneX = (i - 2) * LANE_SPACING;
-        Color laneColor = (selectedLane == i) ? Fade(GOLD, 0.5f) : Fade(DARKGRAY, 0.5f);
-        DrawCube((Vector3) { laneX, 0.1f, 0.0f }, LANE_WIDTH, 0.05f, 40.0f, laneColor);
-    }
-
-    // Draw Models
-    Vector3 kingScaleVec = { 2 * kingScale, 2 * kingScale, 2 * kingScale };
-    DrawModelEx(kingModel, player.king.position, (Vector3) { 0, 1, 0 }, 0.0f, kingScaleVec, WHITE);
-    DrawModelEx(kingModel, computer.king.position, (Vector3) { 0, 1, 0 }, 180.0f, kingScaleVec, BLACK);
-
-    for (int i = 0; i < MAX_PIECES; i++) {
-        if (player.pieces[i].active) {
-            Piece* p = &player.pieces[i];
-            Vector3 pScale = { pieceScales[p->type], pieceScales[p->type], pieceScales[p->type] };
-            DrawModelEx(pieceModels[p->type], p->position, (Vector3) { 0, 1, 0 }, 0.0f, pScale, WHITE);
-        }
-        if (computer.pieces[i].active) {
-            Piece* p = &computer.pieces[i];
-            Vector3 pScale = { pieceScales[p->type], pieceScales[p->type], pieceScales[p->type] };
-            DrawModelEx(pieceModels[p->type], p->position, (Vector3) { 0, 1, 0 }, 180.0f, pScale, BLACK);
-        }
-    }
-
-    // Draw Debug Hitboxes (Toggle with 'B')
-    if (showHitboxes) {
-        DrawBoundingBox(player.king.collisionBox, LIME);
-        DrawBoundingBox(computer.king.collisionBox, LIME);
-
-        for (int i = 0; i < MAX_PIECES; i++) {
-            if (player.pieces[i].active) {
-                Piece* p = &player.pieces[i];
-                BoundingBox hitbox = { { p->position.x - p->size.x / 2, p->position.y, p->position.z - p->size.z / 2 },
-                    { p->position.x + p->size.x / 2, p->position.y + p->size.y, p->position.z + p->size.z / 2 } };
-                DrawBoundingBox(hitbox, Fade(GREEN, 0.5f));
-            }
-            if (computer.pieces[i].active) {
-                Piece* p = &computer.pieces[i];
-                BoundingBox hitbox = { { p->position.x - p->size.x / 2, p->position.y, p->position.z - p->size.z / 2 },
-                    { p->position.x + p->size.x / 2, p->position.y + p->size.y, p->position.z + p->size.z / 2 } };
-                DrawBoundingBox(hitbox, Fade(ORANGE, 0.5f));
-            }
-        }
-    }
-    EndMode3D();
-
-    // Draw UI
-    DrawHealthBar3D(player.king.position, 2 * TARGET_KING_HEIGHT, player.king.health, player.king.maxHealth);
-    DrawHealthBar3D(computer.king.position, 2 * TARGET_KING_HEIGHT, computer.king.health, computer.king.maxHealth);
-
-    for (int i = 0; i < MAX_PIECES; i++) {
-        if (player.pieces[i].active)
-            DrawHealthBar3D(player.pieces[i].position, player.pieces[i].size.y, player.pieces[i].health, player.pieces[i].maxHealth);
-        if (computer.pieces[i].active)
-            DrawHealthBar3D(computer.pieces[i].position, computer.pieces[i].size.y, computer.pieces[i].health, computer.pieces[i].maxHealth);
-    }
-
-    DrawRectangle(5, 5, 250, 105, Fade(SKYBLUE, 0.7f));
-    DrawRectangleLines(5, 5, 250, 105, BLUE);
-    DrawText(TextFormat("Points: %d", (int)player.points), 15, 15, 20, GOLD);
-    DrawText(TextFormat("Population: %d/%d", player.population, MAX_PIECES), 15, 40, 20, BLACK);
-    DrawText(TextFormat("Selected Lane: %d", selectedLane), 15, 65, 20, (selectedLane > 0) ? LIME : GRAY);
-    DrawText("Toggle Hitboxes: [B]", 15, 90, 15, DARKGRAY);
-    DrawFPS(GetScreenWidth() - 100, 10);
-
-    DrawPieceSelectionUI();
-
-    if (showHelp)
-        DrawHelpWindow();
+    snapshot->camera = camera;
+    snapshot->player = player;
+    snapshot->computer = computer;
+    snapshot->selectedLane = selectedLane;
+    snapshot->finishScreen = finishScreen;
 }
 
-// Gameplay Screen Unload logic
-void UnloadGameplayScreen(void)
+#if defined(GAMEPLAY_THREADS_ENABLED)
+static void* UpdateThread(void* arg)
 {
+    (void)arg;
+
+    pthread_mutex_lock(&updateLock);
+    while (true) {
+        while (!updatePending && !updateQuit)
+            pthread_cond_wait(&updateRequested, &updateLock);
+        if (updateQuit)
+            break;
+
+        // Main thread only writes input and swaps snapshots while no update is pending
+        pthread_mutex_unlock(&updateLock);
+        UpdateGame();
+        pthread_mutex_lock(&updateLock);
+
+        updatePending = false;
+        pthread_cond_signal(&updateDone);
+    }
+    pthread_mutex_unlock(&updateLock);
+
+    return NULL;
 }
 
-// Gameplay Screen should finish?
-int FinishGameplayScreen(void)
+static void WaitUpdateDone(void)
 {
-    return finishScreen;
+    pthread_mutex_lock(&updateLock);
+    while (updatePending)
+        pthread_cond_wait(&updateDone, &updateLock);
+    pthread_mutex_unlock(&updateLock);
 }
+#endif
 
-//----------------------------------------------------------------------------------
-// Module specific Functions Definition
-//----------------------------------------------------------------------------------
 // Spawns a piece of the given type and in the given lane for the player 'p'
 // only if the player have enough points
 static void TrySpawnPiece(Player* p, PieceType type, int lane)
@@ -345,53 +634,70 @@ static void TrySpawnPiece(Player* p, PieceType type, int lane)
     }
 }
 
+// Sample user input for next game update
+// NOTE: View settings only affect drawing and raylib state, they are applied right away
+static void SampleInput(GameplayInput* sample)
+{
+    sample->frameTime = GetFrameTime();
+    sample->movement = (Vector3) {
+        (IsKeyDown(KEY_W) || IsKeyDown(KEY_UP)) - (IsKeyDown(KEY_S) || IsKeyDown(KEY_DOWN)), // Move forward-backward
+        (IsKeyDown(KEY_D) || IsKeyDown(KEY_RIGHT)) - (IsKeyDown(KEY_A) || IsKeyDown(KEY_LEFT)), // Move right-left
+        IsKeyDown(KEY_SPACE) - IsKeyDown(KEY_LEFT_SHIFT) // Move up-down
+    };
+    sample->mouseDelta = GetMouseDelta();
+
+    if (IsKeyPressed(KEY_ONE))
+        sample->lane = 1;
+    if (IsKeyPressed(KEY_TWO))
+        sample->lane = 2;
+    if (IsKeyPressed(KEY_THREE))
+        sample->lane = 3;
+    for (int i = 0; i < 5; i++)
+        sample->spawn[i] = IsKeyPressed(KEY_FOUR + i);
+
+    if (IsKeyPressed(KEY_B))
+        showHitboxes = !showHitboxes;
+    if (IsKeyPressed(KEY_H))
+        showHelp = !showHelp;
+    if (IsKeyPressed(KEY_F3))
+        showDebugInfo = !showDebugInfo;
+    if (IsKeyPressed(KEY_L)) {
+        // Input polled just before update and frames not queued, latency stats restarted to compare modes
+        lowLatencyInput = !lowLatencyInput;
+        if (lowLatencyInput)
+            EnableLowLatencyInput();
+        else
+            DisableLowLatencyInput();
+        ResetFramePacingStats();
+    }
+}
+
 // Handle user input
 static void HandleInput(void)
 {
-    float speed = 12.0f * GetFrameTime();
+    float speed = 12.0f * input.frameTime;
     float mouseSensibility = 0.1f;
     UpdateCameraPro(&camera,
+        Vector3Scale(input.movement, speed),
         (Vector3) {
-            (IsKeyDown(KEY_W) || IsKeyDown(KEY_UP)) * speed - // Move forward-backward
-                (IsKeyDown(KEY_S) || IsKeyDown(KEY_DOWN)) * speed,
-            (IsKeyDown(KEY_D) || IsKeyDown(KEY_RIGHT)) * speed - // Move right-left
-                (IsKeyDown(KEY_A) || IsKeyDown(KEY_LEFT)) * speed,
-            (IsKeyDown(KEY_SPACE)) * speed - // Move up-down
-                (IsKeyDown(KEY_LEFT_SHIFT)) * speed },
-        (Vector3) {
-            GetMouseDelta().x * mouseSensibility, // Rotation: yaw
-            GetMouseDelta().y * mouseSensibility, // Rotation: pitch
+            input.mouseDelta.x * mouseSensibility, // Rotation: yaw
+            input.mouseDelta.y * mouseSensibility, // Rotation: pitch
             0.0f // Rotation: roll
         },
         0.0f); // Move to target (zoom)
-    if (IsKeyPressed(KEY_B))
-        showHitboxes = !showHitboxes;
-    if (IsKeyPressed(KEY_H))
-        showHelp = !showHelp;
-    if (IsKeyPressed(KEY_ONE))
-        selectedLane = 1;
-    if (IsKeyPressed(KEY_TWO))
-        selectedLane = 2;
-    if (IsKeyPressed(KEY_THREE))
-        selectedLane = 3;
+    if (input.lane != 0)
+        selectedLane = input.lane;
     if (selectedLane != 0) {
-        if (IsKeyPressed(KEY_FOUR))
-            TrySpawnPiece(&player, PIECE_PAWN, selectedLane);
-        if (IsKeyPressed(KEY_FIVE))
-            TrySpawnPiece(&player, PIECE_KNIGHT, selectedLane);
-        if (IsKeyPressed(KEY_SIX))
-            TrySpawnPiece(&player, PIECE_BISHOP, selectedLane);
-        if (IsKeyPressed(KEY_SEVEN))
-            TrySpawnPiece(&player, PIECE_ROOK, selectedLane);
-        if (IsKeyPressed(KEY_EIGHT))
-            TrySpawnPiece(&player, PIECE_QUEEN, selectedLane);
+        for (int i = 0; i < 5; i++)
+            if (input.spawn[i])
+                TrySpawnPiece(&player, (PieceType)i, selectedLane);
     }
 }
 
 // Computer actions
 static void UpdateAI(void)
 {
-    aiSpawnTimer += GetFrameTime();
+    aiSpawnTimer += input.frameTime;
     if (aiSpawnTimer > 2.5f) {
         aiSpawnTimer = (float)GetRandomValue(0, 150) / 100.0f;
         PieceType affordablePieces[5];
@@ -407,7 +713,7 @@ static void UpdateAI(void)
     }
 }
 
-static void DrawHealthBar3D(Vector3 position, float modelHeight, int currentHealth, int maxHealth)
+static void DrawHealthBar3D(Camera view, Vector3 position, float modelHeight, int currentHealth, int maxHealth)
 {
     if (currentHealth <= 0)
         return;
@@ -416,10 +722,10 @@ static void DrawHealthBar3D(Vector3 position, float modelHeight, int currentHeal
     Vector3 barPosition = Vector3Add(position, (Vector3) { 0, modelHeight + 0.4f, 0 });
 
     // Get the vector from the camera to the health bar
-    Vector3 toBar = Vector3Subtract(barPosition, camera.position);
+    Vector3 toBar = Vector3Subtract(barPosition, view.position);
 
     // Get the camera's forward-facing vector
-    Vector3 cameraForward = Vector3Normalize(Vector3Subtract(camera.target, camera.position));
+    Vector3 cameraForward = Vector3Normalize(Vector3Subtract(view.target, view.position));
 
     // Check if the health bar is in front of the camera
     float dotProduct = Vector3DotProduct(toBar, cameraForward);
@@ -427,7 +733,7 @@ static void DrawHealthBar3D(Vector3 position, float modelHeight, int currentHeal
     if (dotProduct > 0) // Only draw if the bar is in front
     {
         // Project the 3D position to 2D screen space
-        Vector2 screenPos = GetWorldToScreen(barPosition, camera);
+        Vector2 screenPos = GetWorldToScreen(barPosition, view);
 
         // Define bar dimensions and calculate health percentage
         float barWidth = 60;
@@ -443,7 +749,7 @@ static void DrawHealthBar3D(Vector3 position, float modelHeight, int currentHeal
 
 static void DrawHelpWindow(void)
 {
-    int width = 500, height = 250, posX = GetScreenWidth() / 2 - width / 2, posY = GetScreenHeight() / 2 - height / 2;
+    int width = 500, height = 280, posX = GetScreenWidth() / 2 - width / 2, posY = GetScreenHeight() / 2 - height / 2;
     DrawRectangle(posX, posY, width, height, Fade(RAYWHITE, 0.9f));
     DrawRectangleLines(posX, posY, width, height, DARKGRAY);
     DrawText("GAME CONTROLS (Press H to hide)", posX + 10, posY + 10, 20, BLACK);
@@ -455,10 +761,28 @@ static void DrawHelpWindow(void)
     DrawText("6 - Bishop (250)", posX + 40, posY + 180, 20, DARKGRAY);
     DrawText("7 - Rook (300)", posX + 250, posY + 130, 20, DARKGRAY);
     DrawText("8 - Queen (500)", posX + 250, posY + 155, 20, DARKGRAY);
-    DrawText("Objective: Destroy the enemy King!", posX + 20, posY + 215, 20, BLACK);
+    DrawText("Hitboxes: B, Low Latency: L, Debug: F3", posX + 20, posY + 215, 20, DARKGRAY);
+    DrawText("Objective: Destroy the enemy King!", posX + 20, posY + 245, 20, BLACK);
+}
+
+// Draw render scale, audio, frame pacing stats and input mode (Toggle with 'F3')
+static void DrawDebugInfo(void)
+{
+    int posX = GetScreenWidth() - 100;
+    DrawText(TextFormat("3D scale: %d%%", (int)(renderScale * 100.0f + 0.5f)), posX, 35, 10, DARKGRAY);
+
+    AudioStats audioStats = GetAudioStats();
+    unsigned int audioGlitches = audioStats.overruns + audioStats.lateCallbacks + audioStats.streamUnderruns;
+    DrawText(TextFormat("Audio: %.2f/%.1f ms", audioStats.callbackTimeAvg, audioStats.periodTime), posX, 50, 10, DARKGRAY);
+    DrawText(TextFormat("Audio glitches: %u", audioGlitches), posX, 65, 10, (audioGlitches > 0) ? RED : DARKGRAY);
+
+    FramePacingStats pacing = GetFramePacingStats();
+    DrawText(TextFormat("Jitter: %.2f/%.2f ms", pacing.jitterAvg, pacing.jitterMax), posX, 80, 10, DARKGRAY);
+    DrawText(TextFormat("Input: %.1f/%.1f ms", pacing.inputLatencyAvg, pacing.inputLatencyMax), posX, 95, 10, DARKGRAY);
+    DrawText(TextFormat("Low latency: %s", lowLatencyInput ? "ON" : "OFF"), posX, 110, 10, lowLatencyInput ? LIME : DARKGRAY);
 }
 
-static void DrawPieceSelectionUI(void)
+static void DrawPieceSelectionUI(float points)
 {
     const int panelX = 15;
     const int panelY = 120;
@@ -484,10 +808,10 @@ static void DrawPieceSelectionUI(void)
         int barHeight = 15;
 
         // Calculate progress and clamp it between 0 and 1
-        float progress = player.points / PIECE_STATS[i][0];
+        float progress = points / PIECE_STATS[i][0];
         progress = Clamp(progress, 0.0f, 1.0f);
 
-        bool affordable = (player.points >= PIECE_STATS[i][0]);
+        bool affordable = (points >= PIECE_STATS[i][0]);
 
         // Draw bar background
         DrawRectangle(barX, barY, barWidth, barHeight, Fade(DARKGRAY, 0.5f));
@@ -500,3 +824,46 @@ static void DrawPieceSelectionUI(void)
         DrawRectangleLines(barX, barY, barWidth, barHeight, GRAY);
     }
 }
+
+// (Re)create the 3D pass render target at native framebuffer resolution
+static void LoadSceneTarget(void)
+{
+    if (IsRenderTextureValid(sceneTarget))
+        UnloadRenderTexture(sceneTarget);
+
+    sceneTarget = LoadRenderTexture(GetRenderWidth(), GetRenderHeight());
+    SetTextureFilter(sceneTarget.texture, TEXTURE_FILTER_BILINEAR);
+}
+
+// Adapt the 3D render scale toward the target frame budget
+// NOTE: GPU timer queries are not available on every target (WebGL 1.0), the previous
+// frame time catches missed frames (GPU or CPU bound) while the submission time of the
+// 3D pass measures the headroom left when frame time is clamped by vsync/frame limiter
+// NOTE: Submission time does not depend on resolution, GPU bound frames look within budget
+// right after a drop, the scale that missed the budget is held off (longer on every miss there)
+static void UpdateRenderScale(float drawTime)
+{
+    smoothFrameTime += (GetFrameTime() - smoothFrameTime) * 0.1f;
+    smoothDrawTime += (drawTime - smoothDrawTime) * 0.1f;
+    if (missedTimer > 0.0f)
+        missedTimer -= GetFrameTime();
+    if (scaleCooldown > 0.0f) {
+        scaleCooldown -= GetFrameTime();
+        return;
+    }
+
+    if ((smoothFrameTime > RENDER_TARGET_FRAME_TIME * 1.1f) && (renderScale > RENDER_SCALE_MIN)) {
+        // Over budget: drop resolution quickly
+        bool missedAgain = fabsf(renderScale - missedScale) < RENDER_SCALE_STEP * 0.5f;
+        missedHold = missedAgain ? fminf(fmaxf(missedHold * 2.0f, RENDER_SCALE_HOLD), RENDER_SCALE_HOLD_MAX) : RENDER_SCALE_HOLD;
+        missedTimer = missedHold;
+        missedScale = renderScale;
+        renderScale = fmaxf(renderScale - RENDER_SCALE_STEP, RENDER_SCALE_MIN);
+        scaleCooldown = RENDER_SCALE_COOLDOWN * 0.25f;
+    } else if ((smoothFrameTime < RENDER_TARGET_FRAME_TIME * 1.05f) && (smoothDrawTime < RENDER_TARGET_FRAME_TIME * 0.5f) && (renderScale < RENDER_SCALE_MAX)
+        && ((missedTimer <= 0.0f) || (renderScale + RENDER_SCALE_STEP < missedScale - RENDER_SCALE_STEP * 0.5f))) {
+        // Within budget with headroom: recover resolution slowly
+        renderScale = fminf(renderScale + RENDER_SCALE_STEP, RENDER_SCALE_MAX);
+        scaleCooldown = RENDER_SCALE_COOLDOWN;
+    }
+}
@@ -9,6 +9,11 @@ static Camera3D camera = { 0 };
 static float rotationY = 0.0f; // Rotation angle for the models
 static int framesCounter = 0; // Used for blinking text animation
 
+//----------------------------------------------------------------------------------
+// Module Functions Declaration (local)
+//----------------------------------------------------------------------------------
+static void DrawLoadingBar(void); // Draw assets loading progress, one bar segment per asset
+
 //----------------------------------------------------------------------------------
 // Title Screen Functions Definition
 //----------------------------------------------------------------------------------
@@ -35,6 +40,12 @@ void UpdateTitleScreen(void)
     framesCounter++;
     rotationY += 0.2f; // Slower rotation speed
 
+    // Upload assets decoded in the background, game can start once all are loaded
+    if (!IsAssetsLoaded()) {
+        UpdateLoadingAssets();
+        return;
+    }
+
     // Continue playing background music
     UpdateMusicStream(backgroundMusic);
 
@@ -48,6 +59,11 @@ void DrawTitleScreen(void)
 {
     ClearBackground(BLACK); // A dark background makes the 3D scene pop
 
+    if (!IsAssetsLoaded()) {
+        DrawLoadingBar();
+        return;
+    }
+
     //-- Draw the 3D Scene --//
     BeginMode3D(camera);
 
@@ -100,3 +116,31 @@ int FinishTitleScreen(void)
 {
     return finishScreen;
 }
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition (local)
+//----------------------------------------------------------------------------------
+
+// Draw assets loading progress, one bar segment per asset
+// NOTE: Game font is one of the assets loaded, default font is used
+static void DrawLoadingBar(void)
+{
+    const int barWidth = 480;
+    const int barHeight = 24;
+    const int segmentSpacing = 4;
+    int assetCount = GetAssetCount();
+    int segmentWidth = (barWidth - (assetCount - 1) * segmentSpacing) / assetCount;
+    int barX = (GetScreenWidth() - barWidth) / 2;
+    int barY = GetScreenHeight() / 2;
+
+    const char* loadingText = TextFormat("LOADING... %i%%", (int)(GetAssetsProgress() * 100.0f));
+    DrawText(loadingText, (GetScreenWidth() - MeasureText(loadingText, 20)) / 2, barY - 40, 20, RAYWHITE);
+
+    for (int i = 0; i < assetCount; i++) {
+        int segmentX = barX + i * (segmentWidth + segmentSpacing);
+        float progress = GetAssetProgress(i);
+
+        DrawRectangle(segmentX, barY, segmentWidth, barHeight, DARKGRAY);
+        DrawRectangle(segmentX, barY, (int)(segmentWidth * progress), barHeight, (progress >= 1.0f) ? GOLD : ORANGE);
+    }
+}
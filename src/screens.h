@@ -84,6 +84,25 @@ extern Font font;
 // Game logic
 extern Winner winner;
 
+//----------------------------------------------------------------------------------
+// Resource Archive Functions Declaration
+//----------------------------------------------------------------------------------
+bool OpenResourceArchive(const char* fileName);
+void CloseResourceArchive(void);
+bool ResourceExists(const char* fileName);
+bool ExportResourceArchive(const char* fileName, const char** files, int fileCount);
+
+//----------------------------------------------------------------------------------
+// Assets Loader Functions Declaration
+//----------------------------------------------------------------------------------
+void StartLoadingAssets(void);
+void UpdateLoadingAssets(void);
+bool IsAssetsLoaded(void);
+int GetAssetCount(void);
+float GetAssetProgress(int index);
+float GetAssetsProgress(void);
+void UnloadAssets(void);
+
 //----------------------------------------------------------------------------------
 // Title Screen Functions Declaration
 //----------------------------------------------------------------------------------
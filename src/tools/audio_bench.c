@@ -0,0 +1,111 @@
+/*******************************************************************************************
+ *
+ *   audio_bench - Audio mixer throughput benchmark
+ *
+ *   Mixes <voices> sounds playing at once, each one with <processors> audio processors
+ *   attached, on an offline audio device (no sound hardware required) and reports the
+ *   mixing cost per frame and voice, mixed output is written to <output> if provided
+ *
+ *   Usage: audio_bench [voices] [processors] [seconds] [pitch] [output.wav]
+ *
+ ********************************************************************************************/
+
+#include "raylib.h"
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#define BENCH_SAMPLE_RATE 48000
+#define BENCH_MAX_VOICES 256
+
+//----------------------------------------------------------------------------------
+// Module Functions Definition
+//----------------------------------------------------------------------------------
+// Audio processor, attenuates the voice samples (stereo)
+static void ProcessVoice(void* buffer, unsigned int frames)
+{
+    float* samples = (float*)buffer;
+
+    for (unsigned int i = 0; i < frames * 2; i++) samples[i] *= 0.99f;
+}
+
+// Generate a sine tone wave (16 bit, mono)
+static Wave GenWaveTone(float frequency, float seconds)
+{
+    Wave wave = { 0 };
+    wave.frameCount = (unsigned int)(seconds * BENCH_SAMPLE_RATE);
+    wave.sampleRate = BENCH_SAMPLE_RATE;
+    wave.sampleSize = 16;
+    wave.channels = 1;
+
+    short* samples = (short*)malloc(wave.frameCount * sizeof(short));
+
+    for (unsigned int i = 0; i < wave.frameCount; i++) {
+        samples[i] = (short)(8000.0f * sinf(2.0f * PI * frequency * (float)i / BENCH_SAMPLE_RATE));
+    }
+
+    wave.data = samples;
+
+    return wave;
+}
+
+//----------------------------------------------------------------------------------
+// Main entry point
+//----------------------------------------------------------------------------------
+int main(int argc, char* argv[])
+{
+    int voiceCount = (argc > 1) ? atoi(argv[1]) : 64;
+    int processorCount = (argc > 2) ? atoi(argv[2]) : 1;
+    float seconds = (argc > 3) ? (float)atof(argv[3]) : 10.0f;
+    float pitch = (argc > 4) ? (float)atof(argv[4]) : 1.0f;
+    const char* outputFile = (argc > 5) ? argv[5] : NULL;
+
+    if ((voiceCount < 1) || (voiceCount > BENCH_MAX_VOICES) || (processorCount < 0) || (seconds <= 0.0f) || (pitch <= 0.0f)) {
+        printf("Usage: %s [voices (1..%i)] [processors] [seconds] [pitch] [output.wav]\n", argv[0], BENCH_MAX_VOICES);
+        return 1;
+    }
+
+    SetTraceLogLevel(LOG_WARNING);
+    InitAudioDeviceOffline(BENCH_SAMPLE_RATE, outputFile);
+
+    // Voices share the sample data, sound lasts longer than the benchmark (even pitched up)
+    Wave wave = GenWaveTone(440.0f, seconds * pitch + 1.0f);
+    Sound sound = LoadSoundFromWave(wave);
+    UnloadWave(wave);
+
+    Sound voices[BENCH_MAX_VOICES] = { 0 };
+
+    for (int i = 0; i < voiceCount; i++) {
+        voices[i] = LoadSoundAlias(sound);
+        SetSoundVolume(voices[i], 1.0f / voiceCount);
+        SetSoundPitch(voices[i], pitch);
+        SetSoundPan(voices[i], (float)i / voiceCount);
+        for (int p = 0; p < processorCount; p++) AttachAudioStreamProcessor(voices[i].stream, ProcessVoice);
+        PlaySound(voices[i]);
+    }
+
+    // Commands queued are applied on first period, not measured
+    UpdateAudioDeviceOffline(1);
+
+    int frameCount = (int)(seconds * BENCH_SAMPLE_RATE);
+
+    clock_t start = clock();
+    UpdateAudioDeviceOffline(frameCount);
+    double elapsed = (double)(clock() - start) / CLOCKS_PER_SEC;
+
+    int playing = 0;
+    for (int i = 0; i < voiceCount; i++) if (IsSoundPlaying(voices[i])) playing++;
+
+    printf("AUDIO_BENCH: voices: %i (%i playing at end), processors: %i, pitch: %.2f, frames: %i\n", voiceCount, playing, processorCount, pitch, frameCount);
+    printf("AUDIO_BENCH: mixed in %.3f ms, %.2f ns/frame, %.2f ns/frame/voice, %.1fx realtime\n",
+        elapsed * 1000.0, elapsed * 1e9 / frameCount, elapsed * 1e9 / ((double)frameCount * voiceCount), seconds / elapsed);
+
+    for (int i = 0; i < voiceCount; i++) UnloadSoundAlias(voices[i]);
+    UnloadSound(sound);
+
+    CloseAudioDevice();
+
+    return 0;
+}
@@ -0,0 +1,47 @@
+/*******************************************************************************************
+ *
+ *   model_cache - Offline model cache (.rmdl) generator
+ *
+ *   Converts every model provided (.glb, .gltf, .obj...) into a GPU-ready model cache
+ *   file (.rmdl) next to it, loaded by the game instead of the source model if available
+ *
+ *   Usage: model_cache <model> [<model> ...]
+ *
+ ********************************************************************************************/
+
+#include "raylib.h"
+
+#include <stdio.h>
+
+//----------------------------------------------------------------------------------
+// Main entry point
+//----------------------------------------------------------------------------------
+int main(int argc, char* argv[])
+{
+    if (argc < 2) {
+        printf("Usage: %s <model> [<model> ...]\n", argv[0]);
+        return 1;
+    }
+
+    // NOTE: A graphics context is required to load models and read back their textures
+    SetConfigFlags(FLAG_WINDOW_HIDDEN);
+    InitWindow(64, 64, "model_cache");
+
+    int failed = 0;
+
+    for (int i = 1; i < argc; i++) {
+        const char* cachePath = TextFormat("%s/%s.rmdl", GetDirectoryPath(argv[i]), GetFileNameWithoutExt(argv[i]));
+        Model model = LoadModel(argv[i]);
+
+        if ((model.meshCount == 0) || !ExportModel(model, cachePath)) {
+            TraceLog(LOG_ERROR, "MODEL_CACHE: [%s] Model cache could not be generated", argv[i]);
+            failed++;
+        }
+
+        UnloadModel(model);
+    }
+
+    CloseWindow();
+
+    return (failed > 0) ? 1 : 0;
+}
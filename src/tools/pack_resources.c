@@ -0,0 +1,34 @@
+/*******************************************************************************************
+ *
+ *   pack_resources - Resource archive (.pak) generator
+ *
+ *   Packs every file provided into a single resource archive, entries are named as the
+ *   file paths provided and compressed (DEFLATE) if worth it, the game loads files packed
+ *   from the archive instead of disk if available
+ *
+ *   Usage: pack_resources <archive> <file> [<file> ...]
+ *
+ ********************************************************************************************/
+
+#include "raylib.h"
+#include "screens.h"
+
+#include <stdio.h>
+
+//----------------------------------------------------------------------------------
+// Main entry point
+//----------------------------------------------------------------------------------
+int main(int argc, char* argv[])
+{
+    if (argc < 3) {
+        printf("Usage: %s <archive> <file> [<file> ...]\n", argv[0]);
+        return 1;
+    }
+
+    if (!ExportResourceArchive(argv[1], (const char**)&argv[2], argc - 2)) {
+        TraceLog(LOG_ERROR, "PACK_RESOURCES: [%s] Resource archive could not be generated", argv[1]);
+        return 1;
+    }
+
+    return 0;
+}